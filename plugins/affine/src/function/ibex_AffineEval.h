@@ -49,57 +49,57 @@ public:
 	 */
 	TemplateDomain<AffineMain<T> >& eval(const AffineMainVector<T>& af);
 
-	void idx_cp_fwd (int x, int y);
-	void idx_fwd (int  x, int y);
-	void vector_fwd(int* x, int y);
-	void cst_fwd   (int y);
-	void symbol_fwd(int y);
-	void apply_fwd (int* x, int y);
-	void chi_fwd   (int x1, int x2, int x3, int y);
-	void gen2_fwd  (int x1, int x2, int y);
-	void add_fwd   (int x1, int x2, int y);
-	void mul_fwd   (int x1, int x2, int y);
-	void sub_fwd   (int x1, int x2, int y);
-	void div_fwd   (int x1, int x2, int y);
-	void max_fwd   (int x1, int x2, int y);
-	void min_fwd   (int x1, int x2, int y);
-	void atan2_fwd (int x1, int x2, int y);
-	void gen1_fwd  (int x, int y);
-	void minus_fwd (int x, int y);
-	void minus_V_fwd(int x, int y);
-	void minus_M_fwd(int x, int y);
-	void trans_V_fwd(int x, int y);
-	void trans_M_fwd(int x, int y);
-	void sign_fwd   (int x, int y);
-	void abs_fwd    (int x, int y);
-	void power_fwd  (int x, int y, int p);
-	void sqr_fwd    (int x, int y);
-	void sqrt_fwd   (int x, int y);
-	void exp_fwd    (int x, int y);
-	void log_fwd    (int x, int y);
-	void cos_fwd    (int x, int y);
-	void sin_fwd    (int x, int y);
-	void tan_fwd    (int x, int y);
-	void cosh_fwd   (int x, int y);
-	void sinh_fwd   (int x, int y);
-	void tanh_fwd   (int x, int y);
-	void acos_fwd   (int x, int y);
-	void asin_fwd   (int x, int y);
-	void atan_fwd   (int x, int y);
-	void acosh_fwd  (int x, int y);
-	void asinh_fwd  (int x, int y);
-	void atanh_fwd  (int x, int y);
-
-	void add_V_fwd  (int x1, int x2, int y);
-	void add_M_fwd  (int x1, int x2, int y);
-	void mul_SV_fwd (int x1, int x2, int y);
-	void mul_SM_fwd (int x1, int x2, int y);
-	void mul_VV_fwd (int x1, int x2, int y);
-	void mul_MV_fwd (int x1, int x2, int y);
-	void mul_VM_fwd (int x1, int x2, int y);
-	void mul_MM_fwd (int x1, int x2, int y);
-	void sub_V_fwd  (int x1, int x2, int y);
-	void sub_M_fwd  (int x1, int x2, int y);
+	bool idx_cp_fwd (int x, int y);
+	bool idx_fwd (int  x, int y);
+	bool vector_fwd(int* x, int y);
+	bool cst_fwd   (int y);
+	bool symbol_fwd(int y);
+	bool apply_fwd (int* x, int y);
+	bool chi_fwd   (int x1, int x2, int x3, int y);
+	bool gen2_fwd  (int x1, int x2, int y);
+	bool add_fwd   (int x1, int x2, int y);
+	bool mul_fwd   (int x1, int x2, int y);
+	bool sub_fwd   (int x1, int x2, int y);
+	bool div_fwd   (int x1, int x2, int y);
+	bool max_fwd   (int x1, int x2, int y);
+	bool min_fwd   (int x1, int x2, int y);
+	bool atan2_fwd (int x1, int x2, int y);
+	bool gen1_fwd  (int x, int y);
+	bool minus_fwd (int x, int y);
+	bool minus_V_fwd(int x, int y);
+	bool minus_M_fwd(int x, int y);
+	bool trans_V_fwd(int x, int y);
+	bool trans_M_fwd(int x, int y);
+	bool sign_fwd   (int x, int y);
+	bool abs_fwd    (int x, int y);
+	bool power_fwd  (int x, int y, int p);
+	bool sqr_fwd    (int x, int y);
+	bool sqrt_fwd   (int x, int y);
+	bool exp_fwd    (int x, int y);
+	bool log_fwd    (int x, int y);
+	bool cos_fwd    (int x, int y);
+	bool sin_fwd    (int x, int y);
+	bool tan_fwd    (int x, int y);
+	bool cosh_fwd   (int x, int y);
+	bool sinh_fwd   (int x, int y);
+	bool tanh_fwd   (int x, int y);
+	bool acos_fwd   (int x, int y);
+	bool asin_fwd   (int x, int y);
+	bool atan_fwd   (int x, int y);
+	bool acosh_fwd  (int x, int y);
+	bool asinh_fwd  (int x, int y);
+	bool atanh_fwd  (int x, int y);
+
+	bool add_V_fwd  (int x1, int x2, int y);
+	bool add_M_fwd  (int x1, int x2, int y);
+	bool mul_SV_fwd (int x1, int x2, int y);
+	bool mul_SM_fwd (int x1, int x2, int y);
+	bool mul_VV_fwd (int x1, int x2, int y);
+	bool mul_MV_fwd (int x1, int x2, int y);
+	bool mul_VM_fwd (int x1, int x2, int y);
+	bool mul_MM_fwd (int x1, int x2, int y);
+	bool sub_V_fwd  (int x1, int x2, int y);
+	bool sub_M_fwd  (int x1, int x2, int y);
 
 	const Function& f;
 	ExprDomain d;
@@ -196,24 +196,25 @@ inline void AffineEval<T>::forward(const AffineMainVector<T>& box) {
 }
 
 template<class T>
-inline void AffineEval<T>::idx_fwd(int, int ) { /* nothing to do */ }
+inline bool AffineEval<T>::idx_fwd(int, int ) { /* nothing to do */ return true; }
 
 
 template<class T>
-void AffineEval<T>::idx_cp_fwd(int x, int y) {
+bool AffineEval<T>::idx_cp_fwd(int x, int y) {
 	assert(dynamic_cast<const ExprIndex*> (&f.node(y)));
 
 	const ExprIndex& e = (const ExprIndex&) f.node(y);
 
 	d[y] = d[x][e.index];
 	af2[y] = af2[x][e.index];
+	return true;
 }
 
 template<class T>
-inline void AffineEval<T>::symbol_fwd(int) { /* nothing to do */ }
+inline bool AffineEval<T>::symbol_fwd(int) { /* nothing to do */ return true; }
 
 template<class T>
-inline void AffineEval<T>::cst_fwd(int y) {
+inline bool AffineEval<T>::cst_fwd(int y) {
 	const ExprConstant& c = (const ExprConstant&) f.node(y);
 	switch (c.type()) {
 	case Dim::SCALAR:      {
@@ -233,9 +234,10 @@ inline void AffineEval<T>::cst_fwd(int y) {
 		break;
 	}
 	}
+	return true;
 }
 template<class T>
-inline void AffineEval<T>::gen2_fwd(int x1, int x2, int y) {
+inline bool AffineEval<T>::gen2_fwd(int x1, int x2, int y) {
 	const ExprGenericBinaryOp& e = (const ExprGenericBinaryOp&) f.node(y);
 	d[y]=e.eval(d[x1],d[x2]);
 	switch(e.dim.type()) {
@@ -244,60 +246,69 @@ inline void AffineEval<T>::gen2_fwd(int x1, int x2, int y) {
 	case Dim::COL_VECTOR : af2[y].v()=AffineMainVector<T>(d[y].v()); break;
 	case Dim::MATRIX :     af2[y].m()=AffineMainMatrix<T>(d[y].m()); break;
 	}
+	return true;
 }
 
 template<class T>
-inline void AffineEval<T>::chi_fwd(int x1, int x2, int x3, int y) {
+inline bool AffineEval<T>::chi_fwd(int x1, int x2, int x3, int y) {
 	af2[y].i()=chi(d[x1].i(),af2[x2].i(),af2[x3].i());
 	d[y].i()  =chi(d[x1].i(),d[x2].i(),d[x3].i());
+	return true;
 }
 
 template<class T>
-inline void AffineEval<T>::add_fwd(int x1, int x2, int y) {
+inline bool AffineEval<T>::add_fwd(int x1, int x2, int y) {
 	af2[y].i()=af2[x1].i()+af2[x2].i();
 	d[y].i()=(af2[y].i().itv() & (d[x1].i()+d[x2].i()));
+	return true;
 }
 
 template<class T>
-inline void AffineEval<T>::mul_fwd(int x1, int x2, int y) {
+inline bool AffineEval<T>::mul_fwd(int x1, int x2, int y) {
 	af2[y].i()=af2[x1].i()*af2[x2].i();
 	d[y].i()=(af2[y].i().itv() & (d[x1].i()*d[x2].i()));
+	return true;
 }
 
 template<class T>
-inline void AffineEval<T>::sub_fwd(int x1, int x2, int y) {
+inline bool AffineEval<T>::sub_fwd(int x1, int x2, int y) {
 	af2[y].i()=af2[x1].i()-af2[x2].i();
 	d[y].i()=(af2[y].i().itv() & (d[x1].i()-d[x2].i()));
+	return true;
 }
 
 template<class T>
-inline void AffineEval<T>::div_fwd(int x1, int x2, int y) {
+inline bool AffineEval<T>::div_fwd(int x1, int x2, int y) {
 	af2[y].i()=af2[x2].i();
 	af2[y].i().Ainv(d[x2].i());
 	af2[y].i() *= af2[x1].i();
 	d[y].i()=(af2[y].i().itv() & (d[x1].i()/d[x2].i()));
+	return true;
 }
 
 template<class T>
-inline void AffineEval<T>::max_fwd(int x1, int x2, int y) {
+inline bool AffineEval<T>::max_fwd(int x1, int x2, int y) {
 	d[y].i()= max(d[x1].i(),d[x2].i());
 	af2[y].i() = AffineMain<T>(d[y].i());
+	return true;
 }
 
 template<class T>
-inline void AffineEval<T>::min_fwd(int x1, int x2, int y) {
+inline bool AffineEval<T>::min_fwd(int x1, int x2, int y) {
 	d[y].i() = min(d[x1].i(),d[x2].i());
 	af2[y].i()= AffineMain<T>( d[y].i());
+	return true;
 }
 
 template<class T>
-inline void AffineEval<T>::atan2_fwd(int x1, int x2, int y) {
+inline bool AffineEval<T>::atan2_fwd(int x1, int x2, int y) {
 	d[y].i() = atan2(d[x1].i(),d[x2].i());
 	af2[y].i()= AffineMain<T>(d[y].i());
+	return true;
 }
 
 template<class T>
-inline void AffineEval<T>::gen1_fwd(int x, int y) {
+inline bool AffineEval<T>::gen1_fwd(int x, int y) {
 	const ExprGenericUnaryOp& e = (const ExprGenericUnaryOp&) f.node(y);
 	d[y]=e.eval(d[x]);
 	switch(e.dim.type()) {
@@ -306,219 +317,254 @@ inline void AffineEval<T>::gen1_fwd(int x, int y) {
 	case Dim::COL_VECTOR : af2[y].v()=AffineMainVector<T>(d[y].v()); break;
 	case Dim::MATRIX :     af2[y].m()=AffineMainMatrix<T>(d[y].m()); break;
 	}
+	return true;
 }
 
 template<class T>
-inline void AffineEval<T>::minus_fwd(int x, int y) {
+inline bool AffineEval<T>::minus_fwd(int x, int y) {
 	af2[y].i()=-af2[x].i();
 	d[y].i()=(af2[y].i().itv() & (-d[x].i()));
+	return true;
 }
 
 template<class T>
-inline void AffineEval<T>::minus_V_fwd(int x, int y) {
+inline bool AffineEval<T>::minus_V_fwd(int x, int y) {
 	af2[y].v()=-af2[x].v();
 	d[y].v()=(af2[y].v().itv() & (-d[x].v()));
+	return true;
 }
 
 template<class T>
-inline void AffineEval<T>::minus_M_fwd(int x, int y) {
+inline bool AffineEval<T>::minus_M_fwd(int x, int y) {
 	af2[y].m()=-af2[x].m();
 	d[y].m() = af2[y].m().itv();
 	d[y].m()&= (-d[x].m());
+	return true;
 }
 
 template<class T>
-inline void AffineEval<T>::sign_fwd(int x, int y) {
+inline bool AffineEval<T>::sign_fwd(int x, int y) {
 	d[y].i()=sign(d[x].i());
 	af2[y].i()=d[y].i();
+	return true;
 }
 
 template<class T>
-inline void AffineEval<T>::abs_fwd(int x, int y) {
+inline bool AffineEval<T>::abs_fwd(int x, int y) {
 	af2[y].i()=AffineMain<T>(af2[x].i()).Aabs(d[x].i());
 	d[y].i()=(af2[y].i().itv() & abs(d[x].i()));
+	return true;
 }
 
 template<class T>
-inline void AffineEval<T>::power_fwd(int x, int y, int p) {
+inline bool AffineEval<T>::power_fwd(int x, int y, int p) {
 	af2[y].i()=AffineMain<T>(af2[x].i()).Apow(p,d[x].i());
 	d[y].i()=(af2[y].i().itv() & pow(d[x].i(),p));
+	return true;
 }
 
 template<class T>
-inline void AffineEval<T>::sqr_fwd(int x, int y) {
+inline bool AffineEval<T>::sqr_fwd(int x, int y) {
 	af2[y].i()=AffineMain<T>(af2[x].i()).Asqr(d[x].i());
 	d[y].i()=(af2[y].i().itv() & sqr(d[x].i()));
+	return true;
 }
 
 template<class T>
-inline void AffineEval<T>::sqrt_fwd(int x, int y) {
+inline bool AffineEval<T>::sqrt_fwd(int x, int y) {
 	af2[y].i()=AffineMain<T>(af2[x].i()).Asqrt(d[x].i());
 	d[y].i()=(af2[y].i().itv() & sqrt(d[x].i()));
+	return true;
 }
 
 template<class T>
-inline void AffineEval<T>::exp_fwd(int x, int y) {
+inline bool AffineEval<T>::exp_fwd(int x, int y) {
 	af2[y].i()=AffineMain<T>(af2[x].i()).Aexp(d[x].i());
 	d[y].i()=(af2[y].i().itv() & exp(d[x].i()));
+	return true;
 }
 
 template<class T>
-inline void AffineEval<T>::log_fwd(int x, int y) {
+inline bool AffineEval<T>::log_fwd(int x, int y) {
 	af2[y].i()=AffineMain<T>(af2[x].i()).Alog(d[x].i());
 	d[y].i()=(af2[y].i().itv() & log(d[x].i()));
+	return true;
 }
 
 template<class T>
-inline void AffineEval<T>::cos_fwd(int x, int y) {
+inline bool AffineEval<T>::cos_fwd(int x, int y) {
 	af2[y].i()=AffineMain<T>(af2[x].i()).Acos(d[x].i());
 	d[y].i()=(af2[y].i().itv() & cos(d[x].i()));
+	return true;
 }
 
 template<class T>
-inline void AffineEval<T>::sin_fwd(int x, int y) {
+inline bool AffineEval<T>::sin_fwd(int x, int y) {
 	af2[y].i()=AffineMain<T>(af2[x].i()).Asin(d[x].i());
 	d[y].i()=(af2[y].i().itv() & sin(d[x].i()));
+	return true;
 }
 
 template<class T>
-inline void AffineEval<T>::tan_fwd(int x, int y) {
+inline bool AffineEval<T>::tan_fwd(int x, int y) {
 	af2[y].i()=AffineMain<T>(af2[x].i()).Atan(d[x].i());
 	d[y].i()=(af2[y].i().itv() & tan(d[x].i()));
+	return true;
 }
 
 template<class T>
-inline void AffineEval<T>::cosh_fwd(int x, int y) {
+inline bool AffineEval<T>::cosh_fwd(int x, int y) {
 	af2[y].i()=AffineMain<T>(af2[x].i()).Acosh(d[x].i());
 	d[y].i()=(af2[y].i().itv() & cosh(d[x].i()));
+	return true;
 }
 
 template<class T>
-inline void AffineEval<T>::sinh_fwd(int x, int y) {
+inline bool AffineEval<T>::sinh_fwd(int x, int y) {
 	af2[y].i()=AffineMain<T>(af2[x].i()).Asinh(d[x].i());
 	d[y].i()=(af2[y].i().itv() & sinh(d[x].i()));
+	return true;
 }
 
 template<class T>
-inline void AffineEval<T>::tanh_fwd(int x, int y) {
+inline bool AffineEval<T>::tanh_fwd(int x, int y) {
 	af2[y].i()=AffineMain<T>(af2[x].i()).Atanh(d[x].i());
 	d[y].i()=(af2[y].i().itv() & tanh(d[x].i()));
+	return true;
 }
 
 template<class T>
-inline void AffineEval<T>::acos_fwd(int x, int y) {
+inline bool AffineEval<T>::acos_fwd(int x, int y) {
 	af2[y].i()=AffineMain<T>(af2[x].i()).Aacos(d[x].i());
 	d[y].i()=(af2[y].i().itv() & acos(d[x].i()));
+	return true;
 }
 
 template<class T>
-inline void AffineEval<T>::asin_fwd(int x, int y) {
+inline bool AffineEval<T>::asin_fwd(int x, int y) {
 	af2[y].i()=AffineMain<T>(af2[x].i()).Aasin(d[x].i());
 	d[y].i()=(af2[y].i().itv() & asin(d[x].i()));
+	return true;
 }
 
 template<class T>
-inline void AffineEval<T>::atan_fwd(int x, int y) {
+inline bool AffineEval<T>::atan_fwd(int x, int y) {
 	af2[y].i()=AffineMain<T>(af2[x].i()).Aatan(d[x].i());
 	d[y].i()=(af2[y].i().itv() & atan(d[x].i()));
+	return true;
 }
 
 template<class T>
-inline void AffineEval<T>::acosh_fwd(int x, int y) {
+inline bool AffineEval<T>::acosh_fwd(int x, int y) {
 	d[y].i()=acosh(d[x].i());
 	af2[y].i()= AffineMain<T>(d[y].i());
+	return true;
 }
 
 template<class T>
-inline void AffineEval<T>::asinh_fwd(int x, int y) {
+inline bool AffineEval<T>::asinh_fwd(int x, int y) {
 	d[y].i()=asinh(d[x].i());
 	af2[y].i()= AffineMain<T>(d[y].i());
+	return true;
 }
 
 template<class T>
-inline void AffineEval<T>::atanh_fwd(int x, int y) {
+inline bool AffineEval<T>::atanh_fwd(int x, int y) {
 	d[y].i()=atanh(d[x].i());
 	af2[y].i()= AffineMain<T>(d[y].i());
+	return true;
 }
 
 template<class T>
-inline void AffineEval<T>::trans_V_fwd(int x, int y) {
+inline bool AffineEval<T>::trans_V_fwd(int x, int y) {
 	af2[y].v()=af2[x].v();
 	d[y].v()=d[x].v();
+	return true;
 }
 
 template<class T>
-inline void AffineEval<T>::trans_M_fwd(int x, int y) {
+inline bool AffineEval<T>::trans_M_fwd(int x, int y) {
 	af2[y].m()=af2[x].m().transpose();
 	d[y].m()=d[x].m().transpose();
+	return true;
 }
 
 template<class T>
-inline void AffineEval<T>::add_V_fwd(int x1, int x2, int y) {
+inline bool AffineEval<T>::add_V_fwd(int x1, int x2, int y) {
 	af2[y].v()=af2[x1].v()+af2[x2].v();
 	d[y].v()=(af2[y].v().itv() & (d[x1].v()+d[x2].v()));
+	return true;
 }
 
 template<class T>
-inline void AffineEval<T>::add_M_fwd(int x1, int x2, int y) {
+inline bool AffineEval<T>::add_M_fwd(int x1, int x2, int y) {
 	af2[y].m()=af2[x1].m()+af2[x2].m();
 	d[y].m()=(af2[y].m().itv());
 	d[y].m() &= (d[x1].m()+d[x2].m());
+	return true;
 }
 
 template<class T>
-inline void AffineEval<T>::mul_SV_fwd(int x1, int x2, int y) {
+inline bool AffineEval<T>::mul_SV_fwd(int x1, int x2, int y) {
 	af2[y].v()=af2[x1].i()*af2[x2].v();
 	d[y].v()=(af2[y].v().itv() & (d[x1].i()*d[x2].v()));
+	return true;
 }
 
 template<class T>
-inline void AffineEval<T>::mul_SM_fwd(int x1, int x2, int y) {
+inline bool AffineEval<T>::mul_SM_fwd(int x1, int x2, int y) {
 	af2[y].m()=af2[x1].i()*af2[x2].m();
 	d[y].m()=(af2[y].m().itv());
 	d[y].m() &= (d[x1].i()*d[x2].m());
+	return true;
 }
 
 template<class T>
-inline void AffineEval<T>::mul_VV_fwd(int x1, int x2, int y) {
+inline bool AffineEval<T>::mul_VV_fwd(int x1, int x2, int y) {
 	af2[y].i()=af2[x1].v()*af2[x2].v();
 	d[y].i()=(af2[y].i().itv() & (d[x1].v()*d[x2].v()));
+	return true;
 }
 
 template<class T>
-inline void AffineEval<T>::mul_MV_fwd(int x1, int x2, int y) {
+inline bool AffineEval<T>::mul_MV_fwd(int x1, int x2, int y) {
 	af2[y].v()=af2[x1].m()*af2[x2].v();
 	d[y].v()=(af2[y].v().itv() & (d[x1].m()*d[x2].v()));
+	return true;
 }
 
 template<class T>
-inline void AffineEval<T>::mul_VM_fwd(int x1, int x2, int y) {
+inline bool AffineEval<T>::mul_VM_fwd(int x1, int x2, int y) {
 	af2[y].v()=af2[x1].v()*af2[x2].m();
 	d[y].v()=(af2[y].v().itv() & (d[x1].v()*d[x2].m()));
+	return true;
 }
 
 template<class T>
-inline void AffineEval<T>::mul_MM_fwd(int x1, int x2, int y) {
+inline bool AffineEval<T>::mul_MM_fwd(int x1, int x2, int y) {
 	af2[y].m()=af2[x1].m()*af2[x2].m();
 	d[y].m()=(af2[y].m().itv()) ;
 	d[y].m() &=  (d[x1].m()*d[x2].m());
+	return true;
 }
 
 template<class T>
-inline void AffineEval<T>::sub_V_fwd(int x1, int x2, int y) {
+inline bool AffineEval<T>::sub_V_fwd(int x1, int x2, int y) {
 	af2[y].v()=af2[x1].v()-af2[x2].v();
 	d[y].v()=(af2[y].v().itv() & (d[x1].v()-d[x2].v()));
+	return true;
 }
 
 template<class T>
-inline void AffineEval<T>::sub_M_fwd(int x1, int x2, int y) {
+inline bool AffineEval<T>::sub_M_fwd(int x1, int x2, int y) {
 	af2[y].m()=af2[x1].m()-af2[x2].m();
 	d[y].m() = af2[y].m().itv();
 	d[y].m() &= (d[x1].m()-d[x2].m());
+	return true;
 }
 
 template<class T>
-inline void AffineEval<T>::apply_fwd(int* x, int y) {
+inline bool AffineEval<T>::apply_fwd(int* x, int y) {
 	assert(dynamic_cast<const ExprApply*> (&f.node(y)));
 
 	const ExprApply& a = (const ExprApply&) f.node(y);
@@ -545,10 +591,11 @@ inline void AffineEval<T>::apply_fwd(int* x, int y) {
 
 	d[y] = *func_eval->d.top;
 	af2[y] = *func_eval->af2.top;
+	return true;
 }
 
 template<class T>
-inline void AffineEval<T>::vector_fwd(int *x, int y) {
+inline bool AffineEval<T>::vector_fwd(int *x, int y) {
 	assert(dynamic_cast<const ExprVector*>(&(f.node(y))));
 
 	const ExprVector& v = (const ExprVector&) f.node(y);
@@ -573,6 +620,7 @@ inline void AffineEval<T>::vector_fwd(int *x, int y) {
 				d[y].m().set_row(i,d[x[i]].v());
 			}
 	}
+	return true;
 }
 } // namespace ibex
 
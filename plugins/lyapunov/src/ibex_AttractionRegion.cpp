@@ -52,7 +52,7 @@ AttractionRegion::AttractionRegion(Function& f, Function& v, Function& vminor,
 		const Vector& xhat, const IntervalVector& theta, const Array<NumConstraint>& theta_ctr) :
 		timeout(DEFAULT_TIMEOUT),
 		n(f.args()[0].dim.vec_size()), p(f.args().size()>1? f.args()[1].dim.vec_size() : 0), f(f),
-		v(v), dv(v,Function::DIFF), vdot_xstar(), vdot_xhat(), vddot(),
+		v(v), dv(v,Function::DIFF), vdot_xstar(), vdot_xhat(),
 		vmin(&v==&vminor? dv : Function(vminor,Function::DIFF) /* only differential vminor if different from v */),
 		xstar(n), xhat(xhat),
 		is_quadratic(false), theta(theta), varset(f,f.args()[0]),
@@ -106,24 +106,6 @@ void AttractionRegion::init_vdot(Function& vdot, const IntervalVector& center) {
 	 vdot.init(args,(dv(x-center)*f((const Array<const ExprNode>&) args)).simplify(),"vdot");
 }
 
-void AttractionRegion::init_vddot() {
-	// we differentiate with respect to x and theta:
-	Function dvdot_xtheta(vdot_xstar,Function::DIFF);
-
-	Array<const ExprSymbol> args(f.args().size());
-	varcopy(f.args(), args);
-
-	// we retrieve all the derivatives w.r.t to x
-	const ExprNode& e=dvdot_xtheta((Array<const ExprNode>&) args);
-	Array<const ExprNode> a(n);
-	for (int i=0; i<n; i++) {
-		a.set_ref(i,e[varset.var(i)]);
-	}
-	const ExprVector& v=ExprVector::new_col(a);
-
-	vddot.init(args,v.simplify());
-}
-
 bool AttractionRegion::is_pos_def(const IntervalMatrix& Q) {
 	// try fast PD test: diagonal dominancy.
 	if (is_diagonal_dominant(Q)) {
@@ -180,18 +162,20 @@ bool AttractionRegion::is_lyapunov_hessian(const IntervalVector& u) {
 	IntervalMatrix J(n,n);
 	IntervalVector x=xstar+u;
 
-	if (vddot.name==NULL) {
+	if (vdot_xstar.name==NULL) {
 		init_vdot(vdot_xstar, xstar);
-		init_vddot();
 	//	cout << vdot_xstar << endl;
-	//	cout << *vddot << endl;
 	}
 
 	if (p>0) {
-		IntervalMatrix Jtheta(n,p);
-		vddot.jacobian(cart_prod(x,theta),J,Jtheta,varset);
+		// the Hessian includes also theta
+		IntervalMatrix H(n+p,n+p);
+		vdot_xstar.hessian(cart_prod(x,theta),H);
+		for (int i=0; i<n; i++)
+			for (int j=0; j<n; j++)
+				J[i][j]=H[varset.var(i)][varset.var(j)];
 	} else {
-		vddot.jacobian(x,J);
+		vdot_xstar.hessian(x,J);
 	}
 	return is_pos_def(-J);
 
@@ -193,9 +193,9 @@ protected:
 	Function& f;            // EDO
 	Function& v;            // Lyapunov function
 	Function dv;            // gradient of v (used in vdot)
-	Function vdot_xstar;    // Lie derivative (centered on xstar)
+	Function vdot_xstar;    // Lie derivative (centered on xstar). Its Hessian (w.r.t. x and theta)
+	                        // is used in Delanoue's test.
 	Function vdot_xhat;     // Lie derivative (centered on xhat)
-	Function vddot;         // Lie second derivative (for Delanoue's test only) (includes also w.r.t. theta)
 	QuadraticFunction vmin; // Quadratic minorant of v
 	IntervalVector xstar;   // Enclosure of x*
 	Vector xhat;            // Approximation of the fixpoint
@@ -222,11 +222,6 @@ private:
 	 */
 	void init_vdot(Function& vdot, const IntervalVector& center);
 
-	/**
-	 * Create vddot by formally derivating vdot w.r.t. x
-	 */
-	void init_vddot();
-
 	/**
 	 * Positive definiteness test used in the algorithms.
 	 */
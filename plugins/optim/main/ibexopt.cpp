@@ -41,6 +41,14 @@ int main(int argc, char** argv) {
 	args::ValueFlag<double> timeout(parser, "float", "Timeout (time in seconds). Default value is +oo.", {'t', "timeout"});
 	args::ValueFlag<double> random_seed(parser, "float", _random_seed.str(), {"random-seed"});
 	args::ValueFlag<double> eps_x(parser, "float", _eps_x.str(), {"eps-x"});
+	args::ValueFlag<int> threads(parser, "int", "Number of threads (0 means the number of hardware threads). Default value is 1.", {"threads"});
+	args::ValueFlag<string> coordinate(parser, "address", "Distribute the search to worker processes (see --workers) that connect "
+			"to this address, either \"unix:<path>\" (Unix-domain socket) or \"<host>:<port>\" (TCP socket).", {"coordinate"});
+	args::ValueFlag<int> workers(parser, "int", "Number of worker processes (with --coordinate). Default value is 1.", {"workers"});
+	args::ValueFlag<string> worker(parser, "address", "Run as a worker process of the coordinator at this address (see --coordinate). "
+			"The MINIBEX file and the options must be the same as the coordinator's.", {"worker"});
+	args::ValueFlag<double> slice(parser, "float", "Time (in seconds) spent by a worker process on a subproblem before returning "
+			"the remaining boxes to the coordinator. Default value is 1.", {"slice"});
 	args::ValueFlag<double> initial_loup(parser, "float", "Intial \"loup\" (a priori known upper bound).", {"initial-loup"});
 	args::ValueFlag<string> input_file(parser, "filename", "COV input file. The file contains "
 			"optimization data in the COV (binary) format.", {'i',"input"});
@@ -49,6 +57,7 @@ int main(int argc, char** argv) {
 	args::Flag rigor(parser, "rigor", "Activate rigor mode (certify feasibility of equalities).", {"rigor"});
 	args::Flag output_no_obj(parser, "output-no-obj", "Generate a COV with domains of variables only (not objective values).", {"output-no-obj"});
 	args::Flag trace(parser, "trace", "Activate trace. Updates of loup/uplo are printed while minimizing.", {"trace"});
+	args::Flag profile(parser, "profile", "Profile the contractors (number of calls, time, etc.). The profile is displayed with the report.", {"profile"});
 	args::Flag format(parser, "format", "Give a description of the COV format used by IbexOpt", {"format"});
 	args::Flag quiet(parser, "quiet", "Print no report on the standard output.",{'q',"quiet"});
 
@@ -162,7 +171,7 @@ int main(int argc, char** argv) {
 
 		if (output_file) {
 			output_cov_file = output_file.Get();
-		} else {
+		} else if (!worker) {
 			// got from stackoverflow.com:
 			string::size_type const p(filename.Get().find_last_of('.'));
 			// filename without extension
@@ -224,6 +233,41 @@ int main(int argc, char** argv) {
 			o.trace=trace.Get();
 		}
 
+		// This option explores the search tree with several threads
+		if (threads) {
+			o.set_nb_threads(threads.Get());
+			if (!quiet)
+				cout << "  threads:\t\t" << (threads.Get()>0? threads.Get() : ThreadPool::hardware_threads()) << endl;
+		}
+
+		if (coordinate && input_file) {
+			ibex_error("--coordinate and --input are not compatible");
+		}
+
+		// This option runs this process as a worker of a coordinator
+		if (worker) {
+			Channel channel(worker.Get());
+			o.work(channel, slice? slice.Get() : Optimizer::default_slice);
+			delete sys;
+			return 0;
+		}
+
+		// This option distributes the search to worker processes
+		if (coordinate) {
+			if (!quiet) {
+				cout << "  coordinator:\t\t" << coordinate.Get() << endl;
+				cout << "  workers:\t\t" << (workers? workers.Get() : 1) << endl;
+			}
+		}
+
+		// This option records statistics on each contractor
+		CtcProfiler profiler;
+		if (profile) {
+			if (!quiet)
+				cout << "  profile:\t\tON" << endl;
+			o.profiler=&profiler;
+		}
+
 		if (!inHC4) {
 			cerr << "\n  \033[33mwarning: inHC4 disabled\033[0m (does not support vector/matrix operations)" << endl;
 		}
@@ -245,7 +289,11 @@ int main(int argc, char** argv) {
 
 		// Search for the optimum
 		// Get the solutions
-		if (input_file)
+		if (coordinate) {
+			ChannelServer server(coordinate.Get());
+			o.coordinate(server, workers? workers.Get() : 1, sys->box, initial_loup? initial_loup.Get() : POS_INFINITY);
+		}
+		else if (input_file)
 			if (initial_loup)
 				o.optimize(input_file.Get().c_str(), initial_loup.Get());
 			else
@@ -262,6 +310,8 @@ int main(int argc, char** argv) {
 
 		if (!quiet)
 			o.report();
+		else if (profile)
+			profiler.report();
 
 		o.get_data().save(output_cov_file.c_str());
 
@@ -279,6 +329,9 @@ int main(int argc, char** argv) {
 	catch(ibex::UnknownFileException& e) {
 		cerr << "Error: cannot read file '" << filename.Get() << "'" << endl;
 	}
+	catch(ibex::Channel::Closed& e) {
+		cerr << "Error: all the workers have disconnected" << endl;
+	}
 	catch(ibex::SyntaxError& e) {
 		cout << e << endl;
 	}
@@ -153,5 +153,10 @@ int LSmear::var_to_bisect(IntervalMatrix& J, const IntervalVector& box) const {
 	return lvar;
 }
 
+int LSmear::var_to_bisect(const IntervalSparseMatrix& J, const IntervalVector& box) const {
+	// the linear program is dense anyway
+	return SmearFunction::var_to_bisect(J, box);
+}
+
 
 } /* namespace ibex */
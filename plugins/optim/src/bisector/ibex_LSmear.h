@@ -58,6 +58,11 @@ public :
 	 */
 	virtual int var_to_bisect(IntervalMatrix& J,const IntervalVector& box) const;
 
+	/**
+	 * \brief Sparse variant (the matrix is converted to a dense one).
+	 */
+	virtual int var_to_bisect(const IntervalSparseMatrix& J, const IntervalVector& box) const;
+
 	/**
 	 * \brief Computes the dual solution of the linear program mid(J).x<=0
 	 *
@@ -33,7 +33,7 @@ long BxpOptimData::get_id(const ExtendedSystem& sys) {
 	try {
 		return ids()[sys.id];
 	} catch(Map<long,false>::NotFound&) {
-		long new_id=next_id();
+		long new_id=next_bxp_id();
 		ids().insert_new(sys.id, new_id);
 		return new_id;
 	}
@@ -46,6 +46,12 @@ public:
 	 */
 	void update(const BoxEvent& event, const BoxProperties& prop);
 
+	/**
+	 * \brief Always true (the data is shared by the sub-boxes
+	 * until they are initialized).
+	 */
+	virtual bool unchanged(const BoxEvent& event, const BoxProperties& prop) const;
+
 	/**
 	 * \brief Initialize the value of "pf"
 	 *
@@ -62,6 +68,9 @@ public:
 
 	/**
 	 * \brief Get the OptimData id of a system.
+	 *
+	 * Not thread-safe when the id of the system is created
+	 * (first call): see #CellCostFunc::optim_data_id.
 	 */
 	static long get_id(const ExtendedSystem& sys);
 
@@ -100,6 +109,10 @@ inline Bxp* BxpOptimData::copy(const IntervalVector& box, const BoxProperties& p
 	return new BxpOptimData(*this);
 }
 
+inline bool BxpOptimData::unchanged(const BoxEvent& event, const BoxProperties& prop) const {
+	return true;
+}
+
 inline void BxpOptimData::update(const BoxEvent& event, const BoxProperties& prop) {
 	// TODO: we should call compute_pf and compute_pu here or create some
 	// "is_up_to_date" flag.
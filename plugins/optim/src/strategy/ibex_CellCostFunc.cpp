@@ -14,7 +14,7 @@ using namespace std;
 
 namespace ibex {
 
-CellCostFunc::CellCostFunc(const ExtendedSystem& sys, bool depends_on_loup) : sys(sys), depends_on_loup(depends_on_loup) {
+CellCostFunc::CellCostFunc(const ExtendedSystem& sys, bool depends_on_loup) : sys(sys), optim_data_id(BxpOptimData::get_id(sys)), depends_on_loup(depends_on_loup) {
 
 }
 
@@ -72,7 +72,7 @@ CellCostC3::CellCostC3(const ExtendedSystem& sys, double lb) : CellCostFunc(sys,
 }
 
 double CellCostC3::cost(const Cell& c) const {
-	const BxpOptimData *data = (BxpOptimData*) c.prop[BxpOptimData::get_id(sys)];
+	const BxpOptimData *data = (BxpOptimData*) c.prop[optim_data_id];
 	if (data) {
 		return -((loup - data->pf.lb()) / data->pf.diam() );
 	} else {
@@ -82,12 +82,12 @@ double CellCostC3::cost(const Cell& c) const {
 }
 
 void CellCostC3::add_property(BoxProperties& map) {
-	if (!map[BxpOptimData::get_id(sys)])
+	if (!((const BoxProperties&) map)[optim_data_id])
 		map.add(new BxpOptimData(sys));
 }
 
 void CellCostC3::set_optim_data(Cell& c) {
-	((BxpOptimData*) c.prop[BxpOptimData::get_id(sys)])->compute_pf(*sys.goal,c.box);
+	((BxpOptimData*) c.prop[optim_data_id])->compute_pf(*sys.goal,c.box);
 }
 
 // -----------------------------------------------------------------------------------------------------------------------------------
@@ -97,7 +97,7 @@ CellCostC5::CellCostC5(const ExtendedSystem& sys, double lb) : CellCostFunc(sys,
 }
 
 double CellCostC5::cost(const Cell& c) const {
-	const BxpOptimData *data = (BxpOptimData*) c.prop[BxpOptimData::get_id(sys)];
+	const BxpOptimData *data = (BxpOptimData*) c.prop[optim_data_id];
 	if (data) {
 		return (-(data->pu * (loup - data->pf.lb()) / data->pf.diam()));
 	} else {
@@ -106,12 +106,12 @@ double CellCostC5::cost(const Cell& c) const {
 }
 
 void CellCostC5::add_property(BoxProperties& map) {
-	if (!map[BxpOptimData::get_id(sys)])
+	if (!((const BoxProperties&) map)[optim_data_id])
 		map.add(new BxpOptimData(sys));
 }
 
 void CellCostC5::set_optim_data(Cell& c) {
-	BxpOptimData *data = (BxpOptimData*) c.prop[BxpOptimData::get_id(sys)];
+	BxpOptimData *data = (BxpOptimData*) c.prop[optim_data_id];
 	data->compute_pu(sys,c.box);
 	data->compute_pf(*sys.goal,c.box);
 }
@@ -123,7 +123,7 @@ CellCostC7::CellCostC7(const ExtendedSystem& sys, int ind_var, double lb) : Cell
 }
 
 double CellCostC7::cost(const Cell& c) const {
-	const BxpOptimData *data = (BxpOptimData*) c.prop[BxpOptimData::get_id(sys)];
+	const BxpOptimData *data = (BxpOptimData*) c.prop[optim_data_id];
 	if (data) {
 		return c.box[goal_var].lb()/(data->pu*(loup-data->pf.lb())/data->pf.diam());
 	} else {
@@ -132,12 +132,12 @@ double CellCostC7::cost(const Cell& c) const {
 }
 
 void CellCostC7::add_property(BoxProperties& map) {
-	if (!map[BxpOptimData::get_id(sys)])
+	if (!((const BoxProperties&) map)[optim_data_id])
 		map.add(new BxpOptimData(sys));
 }
 
 void CellCostC7::set_optim_data(Cell& c) {
-	BxpOptimData *data = (BxpOptimData*) c.prop[BxpOptimData::get_id(sys)];
+	BxpOptimData *data = (BxpOptimData*) c.prop[optim_data_id];
 	data->compute_pu(sys,c.box);
 	data->compute_pf(*sys.goal,c.box);
 }
@@ -149,7 +149,7 @@ CellCostPU::CellCostPU(const ExtendedSystem& sys) :  CellCostFunc(sys ,false) {
 }
 
 double CellCostPU::cost(const Cell& c) const {
-	const BxpOptimData *data = (BxpOptimData*) c.prop[BxpOptimData::get_id(sys)];
+	const BxpOptimData *data = (BxpOptimData*) c.prop[optim_data_id];
 	if (data) {
 		return  -data->pu;
 	} else {
@@ -158,13 +158,13 @@ double CellCostPU::cost(const Cell& c) const {
 }
 
 void CellCostPU::add_property(BoxProperties& map) {
-	if (!map[BxpOptimData::get_id(sys)])
+	if (!((const BoxProperties&) map)[optim_data_id])
 		map.add(new BxpOptimData(sys));
 }
 
 void CellCostPU::set_optim_data(Cell& c) {
 
-	((BxpOptimData*) c.prop[BxpOptimData::get_id(sys)])->compute_pu(sys,c.box);
+	((BxpOptimData*) c.prop[optim_data_id])->compute_pu(sys,c.box);
 }
 
 // -----------------------------------------------------------------------------------------------------------------------------------
@@ -174,16 +174,16 @@ CellCostPFlb::CellCostPFlb(const ExtendedSystem& sys) :  CellCostFunc(sys, false
 }
 
 void CellCostPFlb::add_property(BoxProperties& map) {
-	if (!map[BxpOptimData::get_id(sys)])
+	if (!((const BoxProperties&) map)[optim_data_id])
 		map.add(new BxpOptimData(sys));
 }
 
 void CellCostPFlb::set_optim_data(Cell& c) {
-	((BxpOptimData*) c.prop[BxpOptimData::get_id(sys)])->compute_pf(*sys.goal,c.box);
+	((BxpOptimData*) c.prop[optim_data_id])->compute_pf(*sys.goal,c.box);
 }
 
 double CellCostPFlb::cost(const Cell& c) const {
-	const BxpOptimData *data = (BxpOptimData*) c.prop[BxpOptimData::get_id(sys)];
+	const BxpOptimData *data = (BxpOptimData*) c.prop[optim_data_id];
 	if (data) {
 		return  data->pf.lb();
 	} else {
@@ -198,16 +198,16 @@ CellCostPFub::CellCostPFub(const ExtendedSystem& sys) :  CellCostFunc(sys, false
 }
 
 void CellCostPFub::add_property(BoxProperties& map) {
-	if (!map[BxpOptimData::get_id(sys)])
+	if (!((const BoxProperties&) map)[optim_data_id])
 		map.add(new BxpOptimData(sys));
 }
 
 void CellCostPFub::set_optim_data(Cell& c) {
-	((BxpOptimData*) c.prop[BxpOptimData::get_id(sys)])->compute_pf(*sys.goal,c.box);
+	((BxpOptimData*) c.prop[optim_data_id])->compute_pf(*sys.goal,c.box);
 }
 
 double CellCostPFub::cost(const Cell& c) const {
-	const BxpOptimData *data = (BxpOptimData*) c.prop[BxpOptimData::get_id(sys)];
+	const BxpOptimData *data = (BxpOptimData*) c.prop[optim_data_id];
 	if (data) {
 		return data->pf.ub();
 	} else {
@@ -222,16 +222,16 @@ CellCostMaxPFub::CellCostMaxPFub(const ExtendedSystem& sys) :  CellCostFunc(sys,
 }
 
 void CellCostMaxPFub::add_property(BoxProperties& map) {
-	if (!map[BxpOptimData::get_id(sys)])
+	if (!((const BoxProperties&) map)[optim_data_id])
 		map.add(new BxpOptimData(sys));
 }
 
 void CellCostMaxPFub::set_optim_data(Cell& c) {
-	((BxpOptimData*) c.prop[BxpOptimData::get_id(sys)])->compute_pf(*sys.goal,c.box);
+	((BxpOptimData*) c.prop[optim_data_id])->compute_pf(*sys.goal,c.box);
 }
 
 double CellCostMaxPFub::cost(const Cell& c) const {
-	const BxpOptimData *data = (BxpOptimData*) c.prop[BxpOptimData::get_id(sys)];
+	const BxpOptimData *data = (BxpOptimData*) c.prop[optim_data_id];
 	if (data) {
 		return -data->pf.ub();
 	} else {
@@ -75,6 +75,15 @@ public:
 	 */
 	const ExtendedSystem& sys;
 
+	/**
+	 * Identifier of the BxpOptimData property of the system.
+	 *
+	 * Obtained once in the constructor: the identifiers map of
+	 * BxpOptimData must not be filled concurrently with the
+	 * lookups made by the threads of a parallel optimization.
+	 */
+	const long optim_data_id;
+
 	/**
 	 * If the cost depends on the loup.
 	 */
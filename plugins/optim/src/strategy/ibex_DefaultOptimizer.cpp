@@ -71,10 +71,11 @@ DefaultOptimizer::DefaultOptimizer(const System& sys, double rel_eps_f, double a
 			  get_ext_sys(sys,eps_h).goal_var(),
 			  eps_x,
 			  rel_eps_f,
-			  abs_eps_f) {
-  
+			  abs_eps_f),
+		sys(sys), eps_h(eps_h), rigor(rigor), inHC4(inHC4), random_seed(random_seed) {
 
 	RNG::srand(random_seed);
+	parallel_seed=random_seed;
 
 }
 
@@ -99,4 +100,53 @@ Ctc&  DefaultOptimizer::ctc(const ExtendedSystem& ext_sys) {
 	return rec(new CtcCompo(ctc_list));
 }
 
+DefaultOptimizer::~DefaultOptimizer() {
+	clear_threads();
+}
+
+void DefaultOptimizer::set_adaptive(bool adaptive) {
+	((CtcCompo&) Optimizer::ctc).adaptive = adaptive;
+
+	for (vector<DefaultOptimizer*>::iterator it=workers.begin(); it!=workers.end(); ++it)
+		(*it)->set_adaptive(adaptive);
+}
+
+void DefaultOptimizer::clear_threads() {
+	set_thread_optimizers(Array<Optimizer>());
+
+	for (vector<DefaultOptimizer*>::iterator it=workers.begin(); it!=workers.end(); ++it)
+		delete *it;
+	workers.clear();
+
+	for (vector<System*>::iterator it=worker_systems.begin(); it!=worker_systems.end(); ++it)
+		delete *it;
+	worker_systems.clear();
+}
+
+void DefaultOptimizer::set_nb_threads(int n) {
+	clear_threads();
+
+	if (n<=0) n=ThreadPool::hardware_threads();
+
+	if (n==1) return;
+
+	Array<Optimizer> optimizers(n-1);
+
+	for (int i=0; i<n-1; i++) {
+		// evaluating a function is not thread-safe: each
+		// thread has its own copy of the system
+		System* sys_copy=new System(sys, System::COPY);
+		worker_systems.push_back(sys_copy);
+
+		DefaultOptimizer* o=new DefaultOptimizer(*sys_copy, rel_eps_f, abs_eps_f, eps_h,
+				rigor, inHC4, random_seed, eps_x);
+		o->set_adaptive(((CtcCompo&) Optimizer::ctc).adaptive);
+		workers.push_back(o);
+
+		optimizers.set_ref(i, *o);
+	}
+
+	set_thread_optimizers(optimizers);
+}
+
 } // end namespace ibex
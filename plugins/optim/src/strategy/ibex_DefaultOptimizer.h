@@ -17,6 +17,8 @@
 #include "ibex_NormalizedSystem.h"
 #include "ibex_ExtendedSystem.h"
 
+#include <vector>
+
 namespace ibex {
 
 /**
@@ -50,11 +52,55 @@ public:
 			double random_seed=default_random_seed,
     		double eps_x=Optimizer::default_eps_x);
 
+	/**
+	 * \brief Set the adaptive mode of the contractor.
+	 *
+	 * In adaptive mode, the sub-contractors of the main composition
+	 * that are not efficient enough are skipped (see #CtcCompo::adaptive).
+	 * Disabled by default.
+	 */
+	void set_adaptive(bool adaptive);
+
+	/**
+	 * \brief Optimize with n threads.
+	 *
+	 * Build n-1 other default optimizers on copies of the system
+	 * (see #Optimizer::set_thread_optimizers(const Array<Optimizer>&)).
+	 * If n<=0, the number of hardware threads is taken.
+	 * n=1 makes the optimizer sequential again.
+	 */
+	void set_nb_threads(int n);
+
+	/**
+	 * \brief Delete this.
+	 */
+	~DefaultOptimizer();
+
 	/** Default random seed: 1.0. */
 	static constexpr double default_random_seed = 1.0;
 
 private:
 
+	/**
+	 * Delete the optimizers of the other threads.
+	 */
+	void clear_threads();
+
+	/**
+	 * The system and the parameters (given to the optimizers of the other threads).
+	 */
+	const System& sys;
+	const double eps_h;
+	const bool rigor;
+	const bool inHC4;
+	const double random_seed;
+
+	/**
+	 * The optimizers of the other threads and their systems.
+	 */
+	std::vector<DefaultOptimizer*> workers;
+	std::vector<System*> worker_systems;
+
     /**
      * The contractor: HC4 + acid(HC4) + X-Newton
      */
@@ -13,10 +13,16 @@
 #include "ibex_NoBisectableVariableException.h"
 #include "ibex_BxpOptimData.h"
 #include "ibex_CovOptimData.h"
+#include "ibex_Dispatcher.h"
+#include "ibex_Random.h"
 
 #include <float.h>
 #include <stdlib.h>
 #include <iomanip>
+#include <deque>
+#include <atomic>
+#include <chrono>
+#include <condition_variable>
 
 using namespace std;
 
@@ -47,23 +53,45 @@ Optimizer::Optimizer(int n, Ctc& ctc, Bsc& bsc, LoupFinder& finder,
                 						n(n), goal_var(goal_var),
 										ctc(ctc), bsc(bsc), loup_finder(finder), buffer(buffer),
 										eps_x(eps_x), rel_eps_f(rel_eps_f), abs_eps_f(abs_eps_f),
-										trace(0), timeout(-1), extended_COV(true),
+										trace(0), timeout(-1), parallel_seed(-1), extended_COV(true), profiler(NULL),
 										status(SUCCESS),
 										//kkt(normalized_user_sys),
 										uplo(NEG_INFINITY), uplo_of_epsboxes(POS_INFINITY), loup(POS_INFINITY),
 										loup_point(IntervalVector::empty(n)), initial_loup(POS_INFINITY), loup_changed(false),
-										time(0), nb_cells(0), cov(NULL) {
+										time(0), nb_cells(0), cov(NULL), pool(NULL) {
 
 	if (trace) cout.precision(12);
 }
 
 Optimizer::~Optimizer() {
 	if (cov) delete cov;
+	if (pool) delete pool;
+}
+
+void Optimizer::set_thread_optimizers(const Array<Optimizer>& optimizers) {
+	if (pool) {
+		delete pool;
+		pool=NULL;
+	}
+
+	thread_optimizers.clear();
+
+	for (int i=0; i<optimizers.size(); i++) {
+		assert(optimizers[i].n==n && optimizers[i].goal_var==goal_var);
+		thread_optimizers.push_back(&optimizers[i]);
+	}
+
+	if (optimizers.size()>0)
+		pool=new ThreadPool(1+optimizers.size());
 }
 
 // compute the value ymax (decreasing the loup with the precision)
 // the heap and the current box are contracted with y <= ymax
 double Optimizer::compute_ymax() {
+	return compute_ymax(loup);
+}
+
+double Optimizer::compute_ymax(double loup) const {
 	double ymax = loup - rel_eps_f*fabs(loup);
 	if (loup - abs_eps_f < ymax)
 		ymax = loup - abs_eps_f;
@@ -198,13 +226,14 @@ void Optimizer::contract_and_bound(Cell& c) {
 	//cout << " [contract]  y before=" << y << endl;
 
 	ContractContext context(c.prop);
+	context.profiler = profiler;
 	if (c.bisected_var!=-1) {
 		context.impact.clear();
 		context.impact.add(c.bisected_var);
 		context.impact.add(goal_var);
 	}
 
-	ctc.contract(c.box, context);
+	CtcProfiler::contract(ctc, c.box, context);
 	//cout << c.prop << endl;
 	if (c.box.is_empty()) return;
 
@@ -389,7 +418,8 @@ Optimizer::Status Optimizer::optimize() {
 	update_uplo();
 
 	try {
-	     while (!buffer.empty()) {
+		if (pool) parallel_optimize(timer);
+		else while (!buffer.empty()) {
 		  
 			loup_changed=false;
 			// for double heap , choose randomly the buffer : top  has to be called before pop
@@ -446,23 +476,34 @@ Optimizer::Status Optimizer::optimize() {
 	 	timer.stop();
 	 	time = timer.get_time();
 
-		// No solution found and optimization stopped with empty buffer
-		// before the required precision is reached => means infeasible problem
-	 	if (uplo_of_epsboxes == NEG_INFINITY)
-	 		status = UNBOUNDED_OBJ;
-	 	else if (uplo_of_epsboxes == POS_INFINITY && (loup==POS_INFINITY || (loup==initial_loup && abs_eps_f==0 && rel_eps_f==0)))
-	 		status = INFEASIBLE;
-	 	else if (loup==initial_loup)
-	 		status = NO_FEASIBLE_FOUND;
-	 	else if (get_obj_rel_prec()>rel_eps_f && get_obj_abs_prec()>abs_eps_f)
-	 		status = UNREACHED_PREC;
-	 	else
-	 		status = SUCCESS;
+	 	status = end_status();
 	}
 	catch (TimeOutException& ) {
 		status = TIME_OUT;
 	}
 
+	update_data();
+
+	return status;
+}
+
+Optimizer::Status Optimizer::end_status() const {
+	// No solution found and optimization stopped with empty buffer
+	// before the required precision is reached => means infeasible problem
+	if (uplo_of_epsboxes == NEG_INFINITY)
+		return UNBOUNDED_OBJ;
+	else if (uplo_of_epsboxes == POS_INFINITY && (loup==POS_INFINITY || (loup==initial_loup && abs_eps_f==0 && rel_eps_f==0)))
+		return INFEASIBLE;
+	else if (loup==initial_loup)
+		return NO_FEASIBLE_FOUND;
+	else if (get_obj_rel_prec()>rel_eps_f && get_obj_abs_prec()>abs_eps_f)
+		return UNREACHED_PREC;
+	else
+		return SUCCESS;
+}
+
+void Optimizer::update_data() {
+
 	/* TODO: cannot retrieve variable names here. */
 	for (int i=0; i<(extended_COV ? n+1 : n); i++)
 		cov->data->_optim_var_names.push_back(string(""));
@@ -499,10 +540,487 @@ Optimizer::Status Optimizer::optimize() {
 		}
 		delete buffer.pop();
 	}
+}
+
+struct Optimizer::ParallelSearch {
+
+	/* Bounds published by a task. */
+	struct Task {
+		std::atomic<double> lb;                // lower bound of the cells held by the task
+		std::atomic<double> uplo_of_epsboxes;
+	};
+
+	ParallelSearch(Optimizer& master, Timer& timer, int nb_tasks) : master(master), tasks(nb_tasks),
+			loup(master.loup), loup_point(master.loup_point), nb_busy(0), nb_hungry(0), stop(false), time_out(false),
+			uplo(master.uplo) {
+		for (int i=0; i<nb_tasks; i++) {
+			tasks[i].lb=POS_INFINITY;
+			tasks[i].uplo_of_epsboxes=POS_INFINITY;
+		}
+
+		// the timeout is measured from the start of optimize()
+		if (master.timeout>0)
+			deadline=chrono::steady_clock::now()+
+				chrono::duration_cast<chrono::steady_clock::duration>(
+						chrono::duration<double>(master.timeout-timer.get_time()));
+	}
+
+	/* Whether the timeout is reached. */
+	bool timed_out() const {
+		return master.timeout>0 && chrono::steady_clock::now()>=deadline;
+	}
+
+	/* Take a cell given by another task. Wait until a cell is given
+	 * or the search is over (return NULL in this case).
+	 * The cell is accounted to the task before leaving the queue. */
+	Cell* take(int task) {
+		unique_lock<std::mutex> lock(queue_mutex);
+		if (queue.empty()) {
+			nb_hungry++;
+			while (queue.empty() && nb_busy>0 && !stop)
+				ready.wait(lock);
+			nb_hungry--;
+		}
+		if (queue.empty() || stop) return NULL;
+		Cell* c=queue.front();
+		queue.pop_front();
+		tasks[task].lb=c->box[master.goal_var].lb();
+		nb_busy++;
+		return c;
+	}
+
+	/* Give a cell to the other tasks. */
+	void give(Cell* c) {
+		lock_guard<std::mutex> lock(queue_mutex);
+		queue.push_back(c);
+		ready.notify_one();
+	}
+
+	/* A task holds no cell anymore. */
+	void release() {
+		lock_guard<std::mutex> lock(queue_mutex);
+		if (--nb_busy==0) ready.notify_all(); // the search is over
+	}
+
+	/* Stop the search. */
+	void abort() {
+		stop=true;
+		lock_guard<std::mutex> lock(queue_mutex);
+		ready.notify_all();
+	}
+
+	Optimizer& master;
+	std::vector<Task> tasks;
+	std::mutex loup_mutex;          // protects loup_point
+	std::atomic<double> loup;
+	IntervalVector loup_point;
+	std::mutex queue_mutex;
+	std::deque<Cell*> queue;        // cells given to the hungry tasks
+	std::condition_variable ready;  // notified when a cell is given or the search is over
+	std::atomic<int> nb_busy;       // number of tasks holding cells
+	std::atomic<int> nb_hungry;     // number of tasks waiting for a cell
+	std::atomic<bool> stop;
+	std::atomic<bool> time_out;
+	chrono::steady_clock::time_point deadline; // wall-clock timeout
+	double uplo;                    // only updated by task 0
+};
+
+void Optimizer::parallel_update_uplo(ParallelSearch& search) {
+	double lb=POS_INFINITY;
+	double eps=POS_INFINITY;
+
+	{
+		// no cell can be exchanged meanwhile. The lower bounds are read
+		// before the epsilon-boxes because a task publishes its
+		// epsilon-boxes before its lower bound.
+		lock_guard<std::mutex> lock(search.queue_mutex);
+
+		for (vector<ParallelSearch::Task>::iterator it=search.tasks.begin(); it!=search.tasks.end(); ++it)
+			lb=std::min(lb, it->lb.load());
+
+		for (vector<ParallelSearch::Task>::iterator it=search.tasks.begin(); it!=search.tasks.end(); ++it)
+			eps=std::min(eps, it->uplo_of_epsboxes.load());
+
+		for (deque<Cell*>::iterator it=search.queue.begin(); it!=search.queue.end(); ++it)
+			lb=std::min(lb, (*it)->box[goal_var].lb());
+	}
+
+	double new_uplo=distributed_uplo(lb, search.loup, eps);
+
+	if (new_uplo>search.uplo) {
+		search.uplo=new_uplo;
+		if (trace)
+			cout << "\033[33m uplo= " << new_uplo << "\033[0m" << endl;
+	}
+}
+
+double Optimizer::distributed_uplo(double lb, double loup, double eps) const {
+	double new_uplo;
+
+	// same as update_uplo(): the cells with a lower bound
+	// greater than ymax are (or will be) removed.
+	if (lb<POS_INFINITY)
+		new_uplo=loup<POS_INFINITY ? std::min(lb, compute_ymax(loup)) : lb;
+	else if (loup<POS_INFINITY)
+		new_uplo=compute_ymax(loup);
+	else
+		return NEG_INFINITY;
+
+	return std::min(new_uplo, eps);
+}
+
+void Optimizer::add_property(Cell& c) {
+	bsc.add_property(c.box, c.prop);
+	ctc.add_property(c.box, c.prop);
+	buffer.add_property(c.box, c.prop);
+	loup_finder.add_property(c.box, c.prop);
+}
+
+void Optimizer::parallel_explore(ParallelSearch& search, int task) {
+	ParallelSearch::Task& me=search.tasks[task];
+	bool busy=false;   // whether this task holds cells
+
+	// the generator of this thread (see parallel_seed)
+	if (search.master.parallel_seed>=0)
+		RNG::srand((int) search.master.parallel_seed+task);
+
+	try {
+		while (!search.stop) {
+
+			if (search.timed_out()) {
+				search.time_out=true;
+				search.abort();
+				break;
+			}
+
+			// only one thread calculates the uplo
+			if (task==0)
+				parallel_update_uplo(search);
+
+			// a better loup has been found by another thread
+			if (search.loup<loup) {
+				lock_guard<std::mutex> lock(search.loup_mutex);
+				loup=search.loup;
+				loup_point=search.loup_point;
+				buffer.contract(compute_ymax());
+			}
+
+			if (buffer.empty()) {
+				if (busy) {
+					me.lb=POS_INFINITY;
+					busy=false;
+					search.release();
+				}
+
+				Cell* c=search.take(task);
+
+				if (!c) break; // search is over
+
+				// the cell may have been created by another optimizer
+				add_property(*c);
+
+				busy=true;
+				buffer.push(c);
+			}
+
+			loup_changed=false;
+			// for double heap , choose randomly the buffer : top  has to be called before pop
+			Cell *c = buffer.top();
+			if (trace >= 2) cout << " current box " << c->box << endl;
+
+			try {
+
+				pair<Cell*,Cell*> new_cells=bsc.bisect(*c);
+				buffer.pop();
+				delete c; // deletes the cell.
+
+				nb_cells+=2;
+
+				handle_cell(*new_cells.first);
+				handle_cell(*new_cells.second);
+
+				if (uplo_of_epsboxes == NEG_INFINITY) {
+					me.uplo_of_epsboxes=NEG_INFINITY;
+					search.abort();
+					break;
+				}
+				if (loup_changed) {
+					{
+						lock_guard<std::mutex> lock(search.loup_mutex);
+						if (loup<search.loup) {
+							search.loup_point=loup_point;
+							search.loup=loup;
+						} else { // another thread has found better meanwhile
+							loup=search.loup;
+							loup_point=search.loup_point;
+						}
+					}
+
+					double ymax=compute_ymax();
+
+					buffer.contract(ymax);
+
+					if (ymax <= NEG_INFINITY) {
+						if (trace) cout << " infinite value for the minimum " << endl;
+						search.abort();
+						break;
+					}
+				}
+			}
+			catch (NoBisectableVariableException& ) {
+				update_uplo_of_epsboxes((c->box)[goal_var].lb());
+				buffer.pop();
+				delete c; // deletes the cell.
+			}
+
+			// publish the bounds (epsilon-boxes first: see parallel_update_uplo)
+			me.uplo_of_epsboxes=uplo_of_epsboxes;
+			me.lb=buffer.empty()? POS_INFINITY : buffer.minimum();
+
+			// load balancing
+			if (search.nb_hungry>0 && buffer.size()>1) {
+				Cell* c=buffer.top();
+				buffer.pop();
+				search.give(c);
+			}
+		}
+	} catch(...) {
+		search.abort();
+		throw;
+	}
+}
+
+void Optimizer::parallel_optimize(Timer& timer) {
+	int nb_tasks=pool->size();
+
+	ParallelSearch search(*this, timer, nb_tasks);
+
+	// The properties required by the optimizer of another
+	// thread are added when it takes a cell (see parallel_explore).
+	while (!buffer.empty()) {
+		Cell* c=buffer.top();
+		buffer.pop();
+		search.queue.push_back(c);
+	}
+
+	for (vector<Optimizer*>::iterator it=thread_optimizers.begin(); it!=thread_optimizers.end(); ++it) {
+		Optimizer& o=**it;
+		o.buffer.flush();
+		o.loup=loup;
+		o.loup_point=loup_point;
+		o.initial_loup=initial_loup;
+		o.buffer.contract(loup);
+		o.uplo=uplo;
+		o.uplo_of_epsboxes=POS_INFINITY;
+		o.nb_cells=0;
+		o.trace=trace;
+		o.profiler=profiler;
+	}
+
+	exception_ptr error;
+
+	try {
+		pool->run(nb_tasks, [this,&search](int task, int thread) {
+			(thread==0 ? *this : *thread_optimizers[thread-1]).parallel_explore(search, task);
+		});
+	} catch(...) {
+		error=current_exception();
+	}
+
+	// gather the results
+	loup=search.loup;
+	loup_point=search.loup_point;
+	uplo=search.uplo;
+
+	for (vector<Optimizer*>::iterator it=thread_optimizers.begin(); it!=thread_optimizers.end(); ++it) {
+		Optimizer& o=**it;
+		nb_cells+=o.nb_cells;
+		if (o.uplo_of_epsboxes<uplo_of_epsboxes)
+			uplo_of_epsboxes=o.uplo_of_epsboxes;
+		while (!o.buffer.empty()) {
+			Cell* c=o.buffer.top();
+			o.buffer.pop();
+			add_property(*c);
+			buffer.push(c);
+		}
+	}
+
+	for (deque<Cell*>::iterator it=search.queue.begin(); it!=search.queue.end(); ++it) {
+		add_property(**it);
+		buffer.push(*it);
+	}
+
+	if (loup<POS_INFINITY)
+		buffer.contract(compute_ymax());
+
+	if (error) rethrow_exception(error);
+
+	update_uplo();
+
+	time=timer.get_time();
+
+	if (search.time_out) throw TimeOutException();
+}
+
+Optimizer::Status Optimizer::coordinate(ChannelServer& server, int nb_workers, const IntervalVector& init_box, double obj_init_bound) {
+
+	chrono::steady_clock::time_point start_time=chrono::steady_clock::now();
+
+	loup=obj_init_bound;
+	buffer.contract(loup);
+	buffer.flush();
+
+	uplo=NEG_INFINITY;
+	uplo_of_epsboxes=POS_INFINITY;
+	nb_cells=0;
+	loup_changed=false;
+	initial_loup=obj_init_bound;
+	loup_point=init_box;
+	time=0;
+
+	if (cov) delete cov;
+	cov = new CovOptimData(extended_COV? n+1 : n, extended_COV);
+	cov->data->_optim_time = 0;
+	cov->data->_optim_nb_cells = 0;
+
+	// split the initial (extended) box
+	deque<IntervalVector> boxes;
+	boxes.push_back(IntervalVector(n+1));
+	write_ext_box(init_box, boxes.back());
+
+	while ((int) boxes.size() < Dispatcher::NB_SUBPROBLEMS*nb_workers) {
+		IntervalVector& box=boxes.front();
+		int var=-1; // largest original variable
+		for (int i=0; i<n+1; i++)
+			if (i!=goal_var && box[i].is_bisectable() && (var==-1 || box[i].diam()>box[var].diam()))
+				var=i;
+		if (var==-1) break;
+		pair<IntervalVector,IntervalVector> p=box.bisect(var);
+		boxes.pop_front();
+		boxes.push_back(p.first);
+		boxes.push_back(p.second);
+	}
+
+	vector<double> sent_lb(nb_workers, POS_INFINITY); // lower bound of the boxes sent to each worker
+	bool time_out=false;
+
+	Dispatcher::run<CovOptimData>(server, nb_workers, boxes,
+
+		[&](int w, const vector<IntervalVector>& batch) {
+			CovOptimData* task=new CovOptimData(n+1, true);
+
+			task->data->_optim_var_names.assign(n+1, "");
+			task->data->_optim_uplo = uplo;
+			task->data->_optim_loup = loup;
+			task->data->_optim_loup_point = loup_point;
+			task->data->_optim_time = 0;
+
+			// by convention, the first box has to be the loup-point.
+			IntervalVector tmp(n+1);
+			write_ext_box(loup_point, tmp);
+			tmp[goal_var] = Interval(uplo,loup);
+			task->add(tmp);
+
+			for (vector<IntervalVector>::const_iterator it=batch.begin(); it!=batch.end(); ++it) {
+				task->add(*it);
+				sent_lb[w]=std::min(sent_lb[w], (*it)[goal_var].lb());
+			}
+			return task;
+		},
+
+		[&](int w, const CovOptimData& result) {
+			time += result.time();
+			nb_cells += result.nb_cells();
+
+			if (result.uplo_of_epsboxes() < uplo_of_epsboxes)
+				uplo_of_epsboxes = result.uplo_of_epsboxes();
+
+			if (result.loup() < loup) {
+				loup = result.loup();
+				loup_point = result.loup_point();
+				if (trace)
+					cout << "                    \033[32m loup= " << loup << "\033[0m" << endl;
+			}
+
+			// the boxes with a lower bound greater than ymax are removed
+			double ymax = loup<POS_INFINITY ? compute_ymax() : POS_INFINITY;
+
+			for (size_t i=result.loup_point().is_empty()? 0 : 1; i<result.size(); i++)
+				boxes.push_back(result[i]);
+
+			for (deque<IntervalVector>::iterator it=boxes.begin(); it!=boxes.end(); ) {
+				(*it)[goal_var] &= Interval(NEG_INFINITY,ymax);
+				if ((*it)[goal_var].is_empty()) it=boxes.erase(it);
+				else ++it;
+			}
+
+			sent_lb[w]=POS_INFINITY;
+
+			// uplo
+			double lb=POS_INFINITY;
+			for (deque<IntervalVector>::iterator it=boxes.begin(); it!=boxes.end(); ++it)
+				lb=std::min(lb, (*it)[goal_var].lb());
+			for (vector<double>::iterator it=sent_lb.begin(); it!=sent_lb.end(); ++it)
+				lb=std::min(lb, *it);
+
+			double new_uplo=distributed_uplo(lb, loup, uplo_of_epsboxes);
+			if (new_uplo>uplo) {
+				uplo=new_uplo;
+				if (trace)
+					cout << "\033[33m uplo= " << uplo << "\033[0m" << endl;
+			}
+
+			if (uplo_of_epsboxes == NEG_INFINITY)
+				return true;
+			else if (timeout>0 && chrono::duration<double>(chrono::steady_clock::now()-start_time).count()>=timeout) {
+				time_out=true;
+				return true;
+			} else
+				return false;
+		},
+
+		[&](int w) {
+			sent_lb[w]=POS_INFINITY;
+		});
+
+	if (time_out)
+		status = TIME_OUT;
+	else
+		status = end_status();
+
+	// the remaining boxes (time out)
+	for (deque<IntervalVector>::iterator it=boxes.begin(); it!=boxes.end(); ++it) {
+		Cell* cell=new Cell(*it);
+		buffer.add_property(*it, cell->prop);
+		buffer.push(cell);
+	}
+
+	update_data();
 
 	return status;
 }
 
+void Optimizer::work(Channel& channel, double slice) {
+	double _timeout=timeout;
+	bool _extended_COV=extended_COV;
+
+	timeout=slice;
+	extended_COV=true; // the coordinator works in the extended space
+
+	try {
+		CovOptimData* data;
+
+		while ((data=channel.receive_cov<CovOptimData>())!=NULL) {
+			optimize(*data, data->loup());
+			delete data;
+			channel.send_cov(get_data());
+		}
+	} catch(Channel::Closed&) { }
+
+	timeout=_timeout;
+	extended_COV=_extended_COV;
+}
+
 namespace {
 const char* green() {
 #ifndef _WIN32
@@ -599,6 +1117,8 @@ void Optimizer::report() {
 	if (cov->nb_cells()!=nb_cells)
 		cout << " [total=" << cov->nb_cells() << "]";
 	cout << endl << endl;
+
+	if (profiler) profiler->report();
 }
 
 
@@ -12,12 +12,18 @@
 #define __IBEX_OPTIMIZER_H__
 
 #include "ibex_Ctc.h"
+#include "ibex_CtcProfiler.h"
 #include "ibex_Bsc.h"
 #include "ibex_LoupFinder.h"
 #include "ibex_CellBufferOptim.h"
 //#include "ibex_EntailedCtr.h"
 #include "ibex_CtcKhunTucker.h"
 #include "ibex_CovOptimData.h"
+#include "ibex_ThreadPool.h"
+#include "ibex_Timer.h"
+#include "ibex_Channel.h"
+
+#include <vector>
 
 namespace ibex {
 
@@ -88,6 +94,33 @@ public:
 	 */
 	virtual ~Optimizer();
 
+	/**
+	 * \brief Optimize with several threads.
+	 *
+	 * The branch and bound of optimize(...) is run on a pool of
+	 * 1+optimizers.size() threads. The calling thread uses this
+	 * optimizer and the ith other thread uses optimizers[i] (its
+	 * contractor, bisector, loup finder and cell buffer). Each
+	 * optimizers[i] must solve the same problem as this optimizer
+	 * but must not share any function with it, since evaluating a
+	 * function is not thread-safe (build it on a copy of the system,
+	 * for instance).
+	 *
+	 * Each thread explores the cells of its own buffer. The loup
+	 * (and the loup point) is shared: a thread that finds a better
+	 * loup publishes it and the other threads contract their buffer
+	 * with it as soon as they see it. A thread with an empty buffer
+	 * receives the next cell of a thread that has several ones.
+	 * The uplo is the minimum of the lower bounds of all the cells
+	 * (including those being processed or exchanged) and of the
+	 * epsilon-boxes. The timeout is checked against the wall-clock
+	 * time, but the reported time is the CPU time of the whole
+	 * process (including all the threads).
+	 *
+	 * An empty array makes the optimizer sequential again.
+	 */
+	void set_thread_optimizers(const Array<Optimizer>& optimizers);
+
 	/**
 	 * \brief Run the optimization.
 	 *
@@ -141,6 +174,37 @@ public:
 	 */
 	Status optimize(const char* cov_file, double obj_init_bound=POS_INFINITY);
 
+	/**
+	 * \brief Run the optimization with worker processes.
+	 *
+	 * The initial box is split into subproblems that are sent, with
+	 * the current loup and loup point, to nb_workers processes connected
+	 * to the server (see #work(Channel&, double)). A worker optimizes
+	 * its subproblem during a time slice and returns its loup and the
+	 * remaining boxes. These boxes are distributed again to the idle
+	 * workers (load balancing), until no box remains.
+	 *
+	 * The result is available as with optimize(...) (see #report(),
+	 * #get_data(), etc.). The timeout is the elapsed (real) time of this
+	 * process and the time is the total CPU time of the workers.
+	 *
+	 * See optimize(const IntervalVector&, double) for the return values.
+	 *
+	 * \throw Channel::Closed - if all the workers have disconnected before the end.
+	 */
+	Status coordinate(ChannelServer& server, int nb_workers, const IntervalVector& init_box, double obj_init_bound=POS_INFINITY);
+
+	/**
+	 * \brief Run as a worker process (see #coordinate(...)).
+	 *
+	 * This optimizer must be built on the same problem as the one of
+	 * the coordinator. Return when the coordinator closes the connection.
+	 *
+	 * \param slice - Time (in seconds) spent on a subproblem before
+	 *                returning the remaining boxes to the coordinator.
+	 */
+	void work(Channel& channel, double slice=default_slice);
+
 	/* =========================== Output ============================= */
 
 	/**
@@ -278,6 +342,9 @@ public:
 	/** Default goal absolute precision: 1e-7. */
 	static constexpr double default_abs_eps_f = 1e-07;;
 
+	/** Default time slice of a worker process (see #work(Channel&, double)): 1s. */
+	static constexpr double default_slice = 1.0;
+
 	/**
 	 * \brief Trace activation flag.
 	 *
@@ -298,6 +365,16 @@ public:
 	 */
 	double timeout;
 
+	/**
+	 * \brief Random seed of the threads in a parallel optimization.
+	 *
+	 * The state of the random number generator (see #ibex::RNG) is local
+	 * to each thread. If this value is not negative, the generator of
+	 * task n°i of a parallel optimization is seeded with this value + i when
+	 * the task starts. By default, it is -1 (the generators are not seeded).
+	 */
+	double parallel_seed;
+
 	/**
 	 * \brief Whether the output has to be in the extended space.
 	 *
@@ -308,6 +385,15 @@ public:
 	 */
 	bool extended_COV;
 
+	/**
+	 * \brief Contractor profiler.
+	 *
+	 * If not NULL, statistics on the contractors are recorded
+	 * (see #ibex::CtcProfiler) and displayed by report().
+	 * NULL by default. The profiler is not owned by the optimizer.
+	 */
+	CtcProfiler* profiler;
+
 protected:
 	/*
 	 * \brief Initialize the optimizer from a single box.
@@ -324,6 +410,57 @@ protected:
 	 */
 	Status optimize();
 
+	/**
+	 * \brief State shared by the threads of parallel_optimize(...).
+	 */
+	struct ParallelSearch;
+
+	/**
+	 * \brief Multi-threaded variant of the loop of optimize() (see #set_thread_optimizers).
+	 *
+	 * \throw TimeOutException
+	 */
+	void parallel_optimize(Timer& timer);
+
+	/**
+	 * \brief Add the properties required by this optimizer to a cell.
+	 */
+	void add_property(Cell& c);
+
+	/**
+	 * \brief Explore the cells of the search (task n°task, run
+	 * by this optimizer in a thread of the pool).
+	 */
+	void parallel_explore(ParallelSearch& search, int task);
+
+	/**
+	 * \brief Lower bound of the cells of all the threads.
+	 */
+	void parallel_update_uplo(ParallelSearch& search);
+
+	/**
+	 * \brief Uplo of a search distributed on several threads or processes.
+	 *
+	 * \param lb   - lower bound of the remaining cells (+oo if none)
+	 * \param loup - the shared loup
+	 * \param eps  - the minimum of the uplo_of_epsboxes
+	 *
+	 * Return -oo if the uplo is unknown (no remaining cell and no loup).
+	 */
+	double distributed_uplo(double lb, double loup, double eps) const;
+
+	/**
+	 * \brief Status at the end of the search (the time limit being not reached).
+	 */
+	Status end_status() const;
+
+	/**
+	 * \brief Store the results of the search in the COV data (see #get_data()).
+	 *
+	 * The remaining cells are moved from the buffer to the data.
+	 */
+	void update_data();
+
 	/**
 	 * \brief Main procedure for processing a box.
 	 *
@@ -377,6 +514,11 @@ protected:
 	 */
 	double compute_ymax ();
 
+	/**
+	 * \brief Computes the value ymax for a given loup.
+	 */
+	double compute_ymax (double loup) const;
+
 	/**
 	 * \brief Check time is not out.
 	 */
@@ -445,6 +587,10 @@ private:
 
 	/** Result. */
 	CovOptimData* cov;
+
+	/** Threads (NULL if sequential) and their optimizers. */
+	ThreadPool* pool;
+	std::vector<Optimizer*> thread_optimizers;
 };
 
 inline Optimizer::Status Optimizer::get_status() const { return status; }
@@ -67,4 +67,38 @@ void TestCtcPolytopeHull::fixbug01() {
 }
 
 
+void TestCtcPolytopeHull::threads01() {
+	int n=20;
+	int m=100;
+
+	Matrix A(m,n);
+	Vector b(m);
+	for (int i=0; i<m; i++) {
+		b[i]=1+::cos(1.0*i);
+		if (i<2*n) {
+			// bounded polytope: -0.5*x_(j+1)-b <= x_j <= b-0.5*x_(j+1)
+			A[i]=Vector::zeros(n);
+			A[i][i/2]=i%2==0? 1 : -1;
+			A[i][(i/2+1)%n]=0.5;
+		} else
+			for (int j=0; j<n; j++)
+				A[i][j]=::sin(1.0+i*n+j);
+	}
+
+	IntervalVector box(n,Interval(-10,10));
+
+	CtcPolytopeHull seq(A,b);
+	IntervalVector box1(box);
+	seq.contract(box1);
+	CPPUNIT_ASSERT(box1.is_strict_subset(box));
+
+	CtcPolytopeHull par(A,b);
+	par.set_nb_threads(4);
+	for (int k=0; k<2; k++) { // twice to check the reuse of the threads
+		IntervalVector box2(box);
+		par.contract(box2);
+		CPPUNIT_ASSERT(almost_eq(box2,box1,1e-7));
+	}
+}
+
 } // end namespace ibex
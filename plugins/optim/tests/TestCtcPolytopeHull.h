@@ -26,6 +26,7 @@ public:
 
 		CPPUNIT_TEST(lp01);
 		CPPUNIT_TEST(fixbug01);
+		CPPUNIT_TEST(threads01);
 
 #endif //_IBEX_WITH_NOLP_
 
@@ -34,6 +35,8 @@ public:
 	void lp01();
 
 	void fixbug01();
+
+	void threads01();
 };
 
 CPPUNIT_TEST_SUITE_REGISTRATION(TestCtcPolytopeHull);
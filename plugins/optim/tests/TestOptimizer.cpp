@@ -15,6 +15,14 @@
 #include "ibex_DefaultOptimizer.h"
 #include "ibex_SystemFactory.h"
 
+#include <sstream>
+#include <chrono>
+
+#ifndef _WIN32
+#include <unistd.h>
+#include <sys/wait.h>
+#endif
+
 using namespace std;
 
 namespace ibex {
@@ -75,7 +83,7 @@ void TestOptimizer::vec_problem02() {
 }
 
 // true minimum is 0.
-Optimizer::Status issue50(double init_loup, double prec) {
+Optimizer::Status issue50(double init_loup, double prec, int nb_threads=1) {
 	SystemFactory f;
 	const ExprSymbol& x=ExprSymbol::new_();
 	f.add_var(x);
@@ -84,6 +92,7 @@ Optimizer::Status issue50(double init_loup, double prec) {
 
 	System sys(f);
 	DefaultOptimizer o(sys,prec,prec,prec);
+	o.set_nb_threads(nb_threads);
 
 	IntervalVector init_box(1,Interval::ALL_REALS);
 	Optimizer::Status st=o.optimize(init_box,init_loup);
@@ -118,4 +127,106 @@ void TestOptimizer::unconstrained() {
 	CPPUNIT_ASSERT(o.get_loup()>=0 && o.get_uplo()<=0);
 }
 
+void TestOptimizer::threads01() {
+
+	const ExprSymbol& x=ExprSymbol::new_(Dim::col_vec(3));
+
+	SystemFactory f;
+	f.add_var(x);
+	f.add_ctr(x[0]*x[1]*x[2]>=1);
+	f.add_goal(x*x);
+	System sys(f);
+
+	DefaultOptimizer o(sys,
+			Optimizer::default_rel_eps_f,
+			Optimizer::default_abs_eps_f,
+			NormalizedSystem::default_eps_h, false, false); // no INHC4
+	o.set_nb_threads(3);
+	Optimizer::Status status=o.optimize(IntervalVector(3,Interval(0,10)));
+
+	CPPUNIT_ASSERT(status==Optimizer::SUCCESS);
+	CPPUNIT_ASSERT(o.get_loup()>=3 && o.get_uplo()<=3);
+	CPPUNIT_ASSERT(o.get_obj_rel_prec()<=Optimizer::default_rel_eps_f || o.get_obj_abs_prec()<=Optimizer::default_abs_eps_f);
+	CPPUNIT_ASSERT(almost_eq(o.get_loup_point(),Vector::ones(3),0.1));
+}
+
+void TestOptimizer::threads02() {
+	CPPUNIT_ASSERT(issue50(1e-10, 0, 3)==Optimizer::SUCCESS);
+	CPPUNIT_ASSERT(issue50(-1e-10, 0, 3)==Optimizer::INFEASIBLE);
+}
+
+void TestOptimizer::threads03() {
+
+	const ExprSymbol& x=ExprSymbol::new_(Dim::col_vec(3));
+
+	SystemFactory f;
+	f.add_var(x);
+	f.add_ctr(x[0]*x[1]*x[2]>=1);
+	f.add_goal(x*x);
+	System sys(f);
+
+	// no precision on the objective: the search does not end
+	DefaultOptimizer o(sys, 0, 0,
+			NormalizedSystem::default_eps_h, false, false); // no INHC4
+	o.set_nb_threads(4);
+	o.timeout=0.5;
+
+	chrono::steady_clock::time_point start=chrono::steady_clock::now();
+	Optimizer::Status status=o.optimize(IntervalVector(3,Interval(0,10)));
+	double elapsed=chrono::duration<double>(chrono::steady_clock::now()-start).count();
+
+	CPPUNIT_ASSERT(status==Optimizer::TIME_OUT);
+	CPPUNIT_ASSERT(o.get_loup()>=3 && o.get_uplo()<=3);
+	// the timeout is a wall-clock time (not the CPU time of all the threads)
+	CPPUNIT_ASSERT(elapsed>=0.45);
+	CPPUNIT_ASSERT(elapsed<10);
+}
+
+#ifndef _WIN32
+void TestOptimizer::distributed01() {
+
+	const ExprSymbol& x=ExprSymbol::new_(Dim::col_vec(3));
+
+	SystemFactory f;
+	f.add_var(x);
+	f.add_ctr(x[0]*x[1]*x[2]>=1);
+	f.add_goal(x*x);
+	System sys(f);
+
+	stringstream address;
+	address << "unix:/tmp/ibex-test-optim-" << getpid() << ".sock";
+	ChannelServer server(address.str());
+
+	vector<pid_t> workers;
+	for (int i=0; i<2; i++) {
+		pid_t pid=fork();
+		if (pid==0) {
+			DefaultOptimizer o(sys,
+					Optimizer::default_rel_eps_f,
+					Optimizer::default_abs_eps_f,
+					NormalizedSystem::default_eps_h, false, false); // no INHC4
+			Channel channel(address.str());
+			o.work(channel, 0.01);
+			_exit(0);
+		}
+		workers.push_back(pid);
+	}
+
+	DefaultOptimizer o(sys,
+			Optimizer::default_rel_eps_f,
+			Optimizer::default_abs_eps_f,
+			NormalizedSystem::default_eps_h, false, false); // no INHC4
+	Optimizer::Status status=o.coordinate(server, 2, IntervalVector(3,Interval(0,10)));
+
+	for (vector<pid_t>::iterator it=workers.begin(); it!=workers.end(); ++it)
+		waitpid(*it, NULL, 0);
+
+	CPPUNIT_ASSERT(status==Optimizer::SUCCESS);
+	CPPUNIT_ASSERT(o.get_loup()>=3 && o.get_uplo()<=3);
+	CPPUNIT_ASSERT(o.get_obj_rel_prec()<=Optimizer::default_rel_eps_f || o.get_obj_abs_prec()<=Optimizer::default_abs_eps_f);
+	CPPUNIT_ASSERT(almost_eq(o.get_loup_point(),Vector::ones(3),0.1));
+	CPPUNIT_ASSERT(o.get_data().size()==1); // only the loup point
+}
+#endif
+
 } // end namespace
@@ -31,6 +31,12 @@ public:
 	CPPUNIT_TEST(issue50_3);
 	CPPUNIT_TEST(issue50_4);
 	CPPUNIT_TEST(unconstrained);
+	CPPUNIT_TEST(threads01);
+	CPPUNIT_TEST(threads02);
+	CPPUNIT_TEST(threads03);
+#ifndef _WIN32
+	CPPUNIT_TEST(distributed01);
+#endif
 #endif
 	CPPUNIT_TEST_SUITE_END();
 
@@ -49,6 +55,15 @@ public:
 	void issue50_4();
 
 	void unconstrained(); // issue 333 and 335
+
+	// vec_problem01 with 3 threads
+	void threads01();
+	// issue50_2 and issue50_4 with 3 threads
+	void threads02();
+	// timeout with 4 threads
+	void threads03();
+	// vec_problem01 with two worker processes
+	void distributed01();
 };
 
 CPPUNIT_TEST_SUITE_REGISTRATION(TestOptimizer);
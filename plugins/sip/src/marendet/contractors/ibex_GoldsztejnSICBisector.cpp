@@ -44,7 +44,7 @@ ParameterEvaluationsCache _createNewCache(const SIConstraint& constraint, const
 }
 
 void GoldsztejnSICBisector::add_property(const IntervalVector& init_box, BoxProperties& map) {
-    if(map[BxpNodeData::id] == nullptr) {
+    if(((const BoxProperties&) map)[BxpNodeData::id] == nullptr) {
         map.add(new BxpNodeData(system_.getInitialNodeCaches()));
         ((BxpNodeData*)map[BxpNodeData::id])->init_box = init_box;
     }
@@ -24,7 +24,7 @@ namespace ibex {
 
 //SIPSystem* BxpNodeData::sip_system = nullptr;
 
-long BxpNodeData::id = next_id();
+long BxpNodeData::id = next_bxp_id();
 
 /*BxpNodeData::BxpNodeData() :
 		BxpNodeData(BxpNodeData::sip_system->getInitialNodeCaches()) {
@@ -46,6 +46,7 @@ int main(int argc, char** argv) {
 	args::Flag format(parser, "format", "Give a description of the COV format used by IbexSolve", {"format"});
 	args::Flag bfs(parser, "bfs", "Perform breadth-first search (instead of depth-first search, by default)", {"bfs"});
 	args::Flag trace(parser, "trace", "Activate trace. \"Solutions\" (output boxes) are displayed as and when they are found.", {"trace"});
+	args::Flag profile(parser, "profile", "Profile the contractors (number of calls, time, etc.). The profile is displayed with the report.", {"profile"});
 	args::ValueFlag<string> boundary_test_arg(parser, "true|full-rank|half-ball|false", "Boundary test strength. Possible values are:\n"
 			"\t\t* true:\talways satisfied. Set by default for under constrained problems (0<m<n).\n"
 			"\t\t* full-rank:\tthe gradients of all constraints (equalities and potentially activated inequalities) must be linearly independent.\n"
@@ -54,6 +55,14 @@ int main(int argc, char** argv) {
 			{"boundary"});
 	args::Flag sols(parser, "sols", "Display the \"solutions\" (output boxes) on the standard output.", {'s',"sols"});
 	args::ValueFlag<double> random_seed(parser, "float", _random_seed.str(), {"random-seed"});
+	args::ValueFlag<int> threads(parser, "int", "Number of threads (0 means the number of hardware threads). Default value is 1.", {"threads"});
+	args::ValueFlag<string> coordinate(parser, "address", "Distribute the search to worker processes (see --workers) that connect "
+			"to this address, either \"unix:<path>\" (Unix-domain socket) or \"<host>:<port>\" (TCP socket).", {"coordinate"});
+	args::ValueFlag<int> workers(parser, "int", "Number of worker processes (with --coordinate). Default value is 1.", {"workers"});
+	args::ValueFlag<string> worker(parser, "address", "Run as a worker process of the coordinator at this address (see --coordinate). "
+			"The MINIBEX file and the options must be the same as the coordinator's.", {"worker"});
+	args::ValueFlag<double> slice(parser, "float", "Time (in seconds) spent by a worker process on a subproblem before returning "
+			"the remaining boxes to the coordinator. Default value is 1.", {"slice"});
 	args::Flag quiet(parser, "quiet", "Print no report on the standard output.",{'q',"quiet"});
 	args::ValueFlag<string> forced_params(parser, "vars","Force some variables to be parameters in the parametric proofs, separated by '+'. Example: --forced-params=x+y",{"forced-params"});
 	args::Positional<std::string> filename(parser, "filename", "The name of the MINIBEX file.");
@@ -121,7 +130,7 @@ int main(int argc, char** argv) {
 
 		if (output_file) {
 			output_manifold_file = output_file.Get();
-		} else {
+		} else if (!worker) {
 			// got from stackoverflow.com:
 			string::size_type const p(filename.Get().find_last_of('.'));
 			// filename without extension
@@ -220,6 +229,40 @@ int main(int argc, char** argv) {
 			s.trace=trace.Get();
 		}
 
+		// This option explores the search tree with several threads
+		if (threads) {
+			s.set_nb_threads(threads.Get());
+			if (!quiet)
+				cout << "  threads:\t\t" << (threads.Get()>0? threads.Get() : ThreadPool::hardware_threads()) << endl;
+		}
+
+		if (coordinate && input_file) {
+			ibex_error("--coordinate and --input are not compatible");
+		}
+
+		// This option runs this process as a worker of a coordinator
+		if (worker) {
+			Channel channel(worker.Get());
+			s.work(channel, slice? slice.Get() : Solver::default_slice);
+			return 0;
+		}
+
+		// This option distributes the search to worker processes
+		if (coordinate) {
+			if (!quiet) {
+				cout << "  coordinator:\t\t" << coordinate.Get() << endl;
+				cout << "  workers:\t\t" << (workers? workers.Get() : 1) << endl;
+			}
+		}
+
+		// This option records statistics on each contractor
+		CtcProfiler profiler;
+		if (profile) {
+			if (!quiet)
+				cout << "  profile:\t\tON" << endl;
+			s.profiler=&profiler;
+		}
+
 		if (!quiet) {
 			cout << "*****************************************************************" << endl << endl;
 		}
@@ -228,7 +271,11 @@ int main(int argc, char** argv) {
 			cout << "running............" << endl << endl;
 
 		// Get the solutions
-		if (input_file)
+		if (coordinate) {
+			ChannelServer server(coordinate.Get());
+			s.coordinate(server, workers? workers.Get() : 1, sys.box);
+		}
+		else if (input_file)
 			s.solve(input_file.Get().c_str());
 		else
 			s.solve(sys.box);
@@ -236,6 +283,7 @@ int main(int argc, char** argv) {
 		if (trace) cout << endl;
 
 		if (!quiet) s.report();
+		else if (profile) profiler.report();
 
 		if (sols) cout << s.get_data() << endl;
 
@@ -254,6 +302,9 @@ int main(int argc, char** argv) {
 	catch(ibex::UnknownFileException& e) {
 		cerr << "Error: cannot read file '" << filename.Get() << "'" << endl;
 	}
+	catch(ibex::Channel::Closed& e) {
+		cerr << "Error: all the workers have disconnected" << endl;
+	}
 	catch(ibex::SyntaxError& e) {
 		cout << e << endl;
 	}
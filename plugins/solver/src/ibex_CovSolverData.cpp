@@ -24,7 +24,7 @@ const unsigned int CovSolverData::subformat_level = 5;
 const unsigned int CovSolverData::subformat_number = 0;
 
 CovSolverData::CovSolverData(size_t n, size_t m, size_t nb_ineq, BoundaryType boundary_type, const vector<string>& var_names) :
-		CovManifold(n, m, nb_ineq, boundary_type), data(new Data()), own_data(true) {
+		CovManifold(n, m, nb_ineq, boundary_type), data(new Data()), own_data(true), mutex(NULL) {
 
 	data->_solver_var_names = var_names;
 	data->_solver_solver_status = Solver::SUCCESS; /* ? */
@@ -40,7 +40,7 @@ CovSolverData::CovSolverData(const char* filename) : CovSolverData(0, 0, 0 /* tm
 	delete f;
 }
 
-CovSolverData::CovSolverData(const Cov& cov, bool copy) : CovManifold(cov, copy) {
+CovSolverData::CovSolverData(const Cov& cov, bool copy) : CovManifold(cov, copy), mutex(NULL) {
 	const CovSolverData* covSolverData = dynamic_cast<const CovSolverData*>(&cov);
 
 	if (covSolverData) {
@@ -79,6 +79,20 @@ CovSolverData::~CovSolverData() {
 	if (own_data) {
 		delete data;
 	}
+	if (mutex) delete mutex;
+}
+
+void CovSolverData::set_concurrent(bool concurrent) {
+	if (concurrent && !mutex)
+		mutex=new recursive_mutex();
+	else if (!concurrent && mutex) {
+		delete mutex;
+		mutex=NULL;
+	}
+}
+
+unique_lock<recursive_mutex> CovSolverData::lock() {
+	return mutex? unique_lock<recursive_mutex>(*mutex) : unique_lock<recursive_mutex>();
 }
 
 void CovSolverData::save(const char* filename) const {
@@ -94,27 +108,32 @@ void CovSolverData::add(const IntervalVector& x) {
 }
 
 void CovSolverData::add_inner(const IntervalVector& x) {
+	unique_lock<recursive_mutex> l=lock();
 	CovManifold::add_inner(x);
 	data->_solver_status.push_back(SOLUTION);
 }
 
 void CovSolverData::add_boundary(const IntervalVector& x, const VarSet& varset) {
+	unique_lock<recursive_mutex> l=lock();
 	CovManifold::add_boundary(x,varset);
 	data->_solver_status.push_back(BOUNDARY);
 }
 
 void CovSolverData::add_unknown(const IntervalVector& x) {
+	unique_lock<recursive_mutex> l=lock();
 	CovManifold::add_unknown(x);
 	data->_solver_status.push_back(UNKNOWN);
 	data->_solver_unknown.push_back(size()-1);
 }
 
 void CovSolverData::add_solution(const IntervalVector& existence, const IntervalVector& unicity, const VarSet& varset) {
+	unique_lock<recursive_mutex> l=lock();
 	CovManifold::add_solution(existence, unicity, varset);
 	data->_solver_status.push_back(SOLUTION);
 }
 
 void CovSolverData::add_pending(const IntervalVector& x) {
+	unique_lock<recursive_mutex> l=lock();
 	CovManifold::add_unknown(x);
 	data->_solver_status.push_back(PENDING);
 	data->_solver_pending.push_back(size()-1);
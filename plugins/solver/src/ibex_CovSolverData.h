@@ -13,6 +13,8 @@
 
 #include "ibex_CovManifold.h"
 
+#include <mutex>
+
 namespace ibex {
 /**
  * \ingroup data
@@ -126,6 +128,15 @@ public:
 	 */
 	virtual void add_pending(const IntervalVector& x);
 
+	/**
+	 * \brief Allow concurrent calls to the add_xxx functions.
+	 *
+	 * If set to true, boxes can be added by several threads at the
+	 * same time (see the parallel mode of #ibex::Solver). The boxes
+	 * must not be read while they are added. Disabled by default.
+	 */
+	void set_concurrent(bool concurrent);
+
 	/**
 	 * \brief Status of the ith box.
 	 */
@@ -248,6 +259,12 @@ protected:
 	} *data;
 
 	bool own_data;
+
+	/* Lock of the add_xxx functions (NULL if not concurrent). */
+	std::recursive_mutex* mutex;
+
+	/* Lock the add_xxx functions (if concurrent). */
+	std::unique_lock<std::recursive_mutex> lock();
 };
 
 /**
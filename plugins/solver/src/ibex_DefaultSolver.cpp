@@ -99,9 +99,10 @@ DefaultSolver::DefaultSolver(System& sys, double eps_x_min, double eps_x_max,
 				(Bsc&) rec(new RoundRobin(eps_x_min)),
 				rec(dfs? (CellBuffer*) new CellStack() : (CellBuffer*) new CellList()),
 				Vector(sys.nb_var,eps_x_min), Vector(sys.nb_var,eps_x_max)),
-		sys(sys) {
+		sys(sys), random_seed(random_seed) {
 
 	RNG::srand(random_seed);
+	parallel_seed=random_seed;
 
 }
 
@@ -113,10 +114,60 @@ DefaultSolver::DefaultSolver(System& sys, const Vector& eps_x_min, double eps_x_
 				(Bsc&) rec(new RoundRobin(eps_x_min)),
 		rec(dfs? (CellBuffer*) new CellStack() : (CellBuffer*) new CellList()),
 		eps_x_min, Vector(sys.nb_var,eps_x_max)),
-		sys(sys) {
+		sys(sys), random_seed(random_seed) {
 
 	RNG::srand(random_seed);
+	parallel_seed=random_seed;
 
 }
 
+DefaultSolver::~DefaultSolver() {
+	clear_threads();
+}
+
+void DefaultSolver::set_adaptive(bool adaptive) {
+	((CtcCompo&) Solver::ctc).adaptive = adaptive;
+
+	for (vector<DefaultSolver*>::iterator it=workers.begin(); it!=workers.end(); ++it)
+		(*it)->set_adaptive(adaptive);
+}
+
+void DefaultSolver::clear_threads() {
+	set_thread_solvers(Array<Solver>());
+
+	for (vector<DefaultSolver*>::iterator it=workers.begin(); it!=workers.end(); ++it)
+		delete *it;
+	workers.clear();
+
+	for (vector<System*>::iterator it=worker_systems.begin(); it!=worker_systems.end(); ++it)
+		delete *it;
+	worker_systems.clear();
+}
+
+void DefaultSolver::set_nb_threads(int n) {
+	clear_threads();
+
+	if (n<=0) n=ThreadPool::hardware_threads();
+
+	if (n==1) return;
+
+	Array<Solver> solvers(n-1);
+
+	for (int i=0; i<n-1; i++) {
+		// evaluating a function is not thread-safe: each
+		// thread has its own copy of the system
+		System* sys_copy=new System(sys, System::COPY);
+		worker_systems.push_back(sys_copy);
+
+		DefaultSolver* s=new DefaultSolver(*sys_copy, eps_x_min, eps_x_max[0],
+				dynamic_cast<CellStack*>(&buffer)!=NULL, random_seed);
+		s->set_adaptive(((CtcCompo&) Solver::ctc).adaptive);
+		workers.push_back(s);
+
+		solvers.set_ref(i, *s);
+	}
+
+	set_thread_solvers(solvers);
+}
+
 } // end namespace ibex
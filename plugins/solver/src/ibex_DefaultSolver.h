@@ -66,10 +66,50 @@ public:
 	 */
 	static constexpr double default_random_seed = 1.0;
 
+	/**
+	 * \brief Set the adaptive mode of the contractor.
+	 *
+	 * In adaptive mode, the sub-contractors of the main composition
+	 * that are not efficient enough are skipped (see #CtcCompo::adaptive).
+	 * Disabled by default.
+	 */
+	void set_adaptive(bool adaptive);
+
+	/**
+	 * \brief Solve with n threads.
+	 *
+	 * Build n-1 other default solvers on copies of the system
+	 * (see #Solver::set_thread_solvers(const Array<Solver>&)).
+	 * If n<=0, the number of hardware threads is taken.
+	 * n=1 makes the solver sequential again.
+	 */
+	void set_nb_threads(int n);
+
+	/**
+	 * \brief Delete this.
+	 */
+	~DefaultSolver();
+
 	System& sys;
 
 private:
 
+	/**
+	 * Delete the solvers of the other threads.
+	 */
+	void clear_threads();
+
+	/**
+	 * The solvers of the other threads and their systems.
+	 */
+	std::vector<DefaultSolver*> workers;
+	std::vector<System*> worker_systems;
+
+	/**
+	 * Random seed (given to the solvers of the other threads).
+	 */
+	double random_seed;
+
 	/**
 	 * The contractor: hc4 + acid(hc4) + newton (if the system is square) + xnewton
 	 */
@@ -13,8 +13,14 @@
 #include "ibex_NoBisectableVariableException.h"
 #include "ibex_LinearException.h"
 #include "ibex_CovSolverData.h"
+#include "ibex_Dispatcher.h"
+#include "ibex_Random.h"
 
 #include <cassert>
+#include <deque>
+#include <atomic>
+#include <chrono>
+#include <condition_variable>
 
 using namespace std;
 
@@ -27,10 +33,10 @@ namespace {
 Solver::Solver(const System& sys, Ctc& ctc, Bsc& bsc, CellBuffer& buffer,
 		const Vector& eps_x_min, const Vector& eps_x_max) :
 		  ctc(ctc), bsc(bsc), buffer(buffer), eps_x_min(eps_x_min), eps_x_max(eps_x_max),
-		  boundary_test(ALL_TRUE), time_limit(-1), cell_limit(-1), trace(0),
+		  boundary_test(ALL_TRUE), time_limit(-1), cell_limit(-1), parallel_seed(-1), trace(0), profiler(NULL),
 		  solve_init_box(sys.box), eqs(NULL), ineqs(NULL),
 		  params(sys.nb_var,BitSet::empty(sys.nb_var),false) /* no forced parameter by default */,
-		  manif(NULL), time(0), nb_cells(0) {
+		  manif(NULL), time(0), nb_cells(0), pool(NULL) {
 
 	assert(sys.box.size()==ctc.nb_var);
 
@@ -76,6 +82,31 @@ Solver::~Solver() {
 	}
 
 	if (manif) delete manif;
+
+	if (pool) delete pool;
+}
+
+void Solver::set_thread_solvers(const Array<Solver>& solvers) {
+	if (pool) {
+		delete pool;
+		pool=NULL;
+	}
+
+	thread_solvers.clear();
+
+	for (int i=0; i<solvers.size(); i++) {
+		assert(solvers[i].n==n);
+		thread_solvers.push_back(&solvers[i]);
+	}
+
+	if (solvers.size()>0)
+		pool=new ThreadPool(1+solvers.size());
+}
+
+void Solver::add_property(Cell& c) {
+	bsc.add_property(c.box, c.prop);
+	ctc.add_property(c.box, c.prop);
+	buffer.add_property(c.box, c.prop);
 }
 
 void Solver::start(const IntervalVector& init_box) {
@@ -184,6 +215,7 @@ bool Solver::next(CovSolverData::BoxStatus& status, const IntervalVector** sol)
 		Cell* c=buffer.top();
 
 		ContractContext context(c->prop);
+		context.profiler = profiler;
 
 		int v=c->bisected_var; // last bisected var.
 
@@ -192,7 +224,7 @@ bool Solver::next(CovSolverData::BoxStatus& status, const IntervalVector** sol)
 		}
 
 		try {
-			ctc.contract(c->box,context);
+			CtcProfiler::contract(ctc, c->box, context);
 
 			if (c->box.is_empty()) throw EmptyBoxException();
 
@@ -278,7 +310,9 @@ Solver::Status Solver::solve() {
 
 	CovSolverData::BoxStatus status;
 
-	try {
+	if (pool)
+		final_status=parallel_solve();
+	else try {
 		while (next(status)) {
 			if (final_status==INFEASIBLE) // first solution found
 				final_status=SUCCESS; // by default... may be changed right after
@@ -304,6 +338,378 @@ Solver::Status Solver::solve() {
 	return final_status;
 }
 
+struct Solver::ParallelSearch {
+
+	/* Deque of cells of a task. */
+	struct Queue {
+		std::mutex mutex;
+		std::deque<Cell*> cells;
+	};
+
+	ParallelSearch(Solver& master, int nb_tasks) : master(master), queues(nb_tasks),
+			nb_pending(0), nb_cells(0), stop(false), stop_status(SUCCESS), nb_idle(0) {
+
+		// the time limit is measured from the start of the search (see start(...))
+		if (master.time_limit>0)
+			deadline=chrono::steady_clock::now()+
+				chrono::duration_cast<chrono::steady_clock::duration>(
+						chrono::duration<double>(master.time_limit-master.timer.get_time()));
+	}
+
+	/* Whether the time limit is reached. */
+	bool time_out() const {
+		return master.time_limit>0 && chrono::steady_clock::now()>=deadline;
+	}
+
+	/* Push a cell on the deque of a task. */
+	void push(int task, Cell* c) {
+		{
+			lock_guard<std::mutex> lock(queues[task].mutex);
+			queues[task].cells.push_back(c);
+		}
+		wake_up(false);
+	}
+
+	/* Pop the last cell of a task or, if its deque is empty,
+	 * steal the first cell of another one (stolen is then set). */
+	Cell* pop(int task, bool& stolen) {
+		int nb_tasks=(int) queues.size();
+
+		for (int i=0; i<nb_tasks; i++) {
+			Queue& q=queues[(task+i)%nb_tasks];
+			lock_guard<std::mutex> lock(q.mutex);
+			if (!q.cells.empty()) {
+				Cell* c;
+				if (i==0) {
+					c=q.cells.back();
+					q.cells.pop_back();
+				} else {
+					c=q.cells.front();
+					q.cells.pop_front();
+				}
+				stolen = i>0;
+				return c;
+			}
+		}
+		return NULL;
+	}
+
+	/* Wait until a cell can be popped (NULL if the search is over). */
+	Cell* wait(int task, bool& stolen) {
+		unique_lock<std::mutex> lock(idle_mutex);
+		nb_idle++;
+		Cell* c;
+		while (!(c=pop(task,stolen)) && !stop && nb_pending>0)
+			ready.wait(lock);
+		nb_idle--;
+		return c;
+	}
+
+	/* A cell has been processed. */
+	void done() {
+		if (--nb_pending==0) wake_up(true);
+	}
+
+	/* Stop the search. */
+	void abort(Status status) {
+		stop_status=status;
+		stop=true;
+		wake_up(true);
+	}
+
+	/* Wake up one (or all) idle thread(s). */
+	void wake_up(bool all) {
+		if (nb_idle>0) {
+			lock_guard<std::mutex> lock(idle_mutex);
+			if (all) ready.notify_all();
+			else ready.notify_one();
+		}
+	}
+
+	Solver& master;
+	std::vector<Queue> queues;
+	std::atomic<long> nb_pending;          // number of cells in the deques or being processed
+	std::atomic<unsigned long> nb_cells;   // number of cells created
+	std::atomic<bool> stop;
+	std::atomic<int> stop_status;          // TIME_OUT or CELL_OVERFLOW
+	chrono::steady_clock::time_point deadline; // wall-clock time limit
+	std::mutex idle_mutex;
+	std::condition_variable ready;         // notified when cells are pushed or the search is over
+	std::atomic<int> nb_idle;              // number of threads waiting for cells
+};
+
+void Solver::parallel_explore(ParallelSearch& search, int task, int thread) {
+	Solver& master=search.master;
+
+	// the generator of this thread (see parallel_seed)
+	if (master.parallel_seed>=0)
+		RNG::srand((int) master.parallel_seed+task);
+
+	// the initial cells of the task only have the properties of the master solver
+	if (this!=&master) {
+		lock_guard<std::mutex> lock(search.queues[task].mutex);
+		for (deque<Cell*>::iterator it=search.queues[task].cells.begin(); it!=search.queues[task].cells.end(); ++it)
+			add_property(**it);
+	}
+
+	while (!search.stop) {
+
+		if (search.time_out()) {
+			search.abort(TIME_OUT);
+			break;
+		}
+
+		bool stolen;
+		Cell* c=search.pop(task,stolen);
+
+		if (!c) {
+			c=search.wait(task,stolen);
+			if (!c) break; // search is over
+		}
+
+		// a cell created by another solver gets the properties of this one
+		if (stolen) add_property(*c);
+
+		ContractContext context(c->prop);
+		context.profiler = profiler;
+
+		int v=c->bisected_var; // last bisected var.
+
+		if (v!=-1) { // not the root node :  impact set to the last bisected variable only
+			context.impact = BitSet::singleton(n,v);
+		}
+
+		try {
+			CtcProfiler::contract(ctc, c->box, context);
+
+			if (c->box.is_empty()) throw EmptyBoxException();
+
+			// same strategy as next(...): certification at each intermediate step
+			// only if the system is under constrained
+			if (!(m==0 || (m<n && !is_too_large(c->box))) || check_sol(c->box)==CovSolverData::UNKNOWN) {
+				try {
+					if (is_too_small(c->box))
+						throw NoBisectableVariableException();
+
+					// next line may also throw NoBisectableVariableException
+					pair<Cell*,Cell*> new_cells=bsc.bisect(*c);
+
+					search.nb_pending+=2;
+					search.push(task, new_cells.first);
+					search.push(task, new_cells.second);
+
+					unsigned long nb=(search.nb_cells+=2);
+					if (master.cell_limit>=0 && master.nb_cells+nb>=(unsigned long) master.cell_limit)
+						search.abort(CELL_OVERFLOW);
+				}
+				catch (NoBisectableVariableException&) {
+					if (check_sol(c->box)==CovSolverData::UNKNOWN) {
+						if (trace >=1) cout << " [unknown] " << c->box << endl;
+						manif->add_unknown(c->box);
+					}
+				}
+			}
+		}
+		catch (EmptyBoxException&) {
+		}
+		catch (...) {
+			// the other threads must not wait for this cell
+			search.abort(SUCCESS);
+			delete c;
+			throw;
+		}
+
+		delete c;
+		search.done();
+	}
+}
+
+Solver::Status Solver::parallel_solve() {
+
+	int nb_tasks=pool->size();
+
+	ParallelSearch search(*this, nb_tasks);
+
+	// the solvers of the other threads output
+	// their boxes directly in the data of this one
+	vector<CovSolverData*> thread_manifs;
+
+	for (vector<Solver*>::iterator it=thread_solvers.begin(); it!=thread_solvers.end(); ++it) {
+		Solver& s=**it;
+		thread_manifs.push_back(s.manif);
+		s.manif=manif;
+		s.solve_init_box=solve_init_box;
+		s.boundary_test=boundary_test;
+		s.params=params;
+		s.trace=trace;
+		s.profiler=profiler;
+	}
+
+	// distribute the initial cells. The properties required by
+	// the solver of another thread are added when a cell migrates
+	// (see parallel_explore).
+	int i=0;
+	while (!buffer.empty()) {
+		Cell* c=buffer.pop();
+		search.queues[i++ % nb_tasks].cells.push_back(c);
+		search.nb_pending++;
+	}
+
+	manif->set_concurrent(true);
+
+	exception_ptr error;
+
+	try {
+		pool->run(nb_tasks, [this,&search](int task, int thread) {
+			(thread==0 ? *this : *thread_solvers[thread-1]).parallel_explore(search, task, thread);
+		});
+	} catch(...) {
+		error=current_exception();
+	}
+
+	manif->set_concurrent(false);
+
+	for (size_t j=0; j<thread_solvers.size(); j++)
+		thread_solvers[j]->manif=thread_manifs[j];
+
+	nb_cells+=search.nb_cells;
+
+	// remaining cells (time out or cell overflow)
+	for (vector<ParallelSearch::Queue>::iterator it=search.queues.begin(); it!=search.queues.end(); ++it) {
+		for (deque<Cell*>::iterator it2=it->cells.begin(); it2!=it->cells.end(); ++it2) {
+			if (!error) {
+				if (trace >=1) cout << " [pending] " << (*it2)->box << endl;
+				manif->add_pending((*it2)->box);
+			}
+			delete *it2;
+		}
+	}
+
+	if (error) rethrow_exception(error);
+
+	if (search.stop)
+		return (Status) (int) search.stop_status;
+	else
+		return end_status();
+}
+
+Solver::Status Solver::end_status() const {
+	if (manif->nb_inner()==0 && manif->nb_solution()==0 && manif->nb_boundary()==0)
+		return INFEASIBLE;
+	else if (manif->nb_unknown()>0)
+		return NOT_ALL_VALIDATED;
+	else
+		return SUCCESS;
+}
+
+Solver::Status Solver::coordinate(ChannelServer& server, int nb_workers, const IntervalVector& init_box) {
+
+	chrono::steady_clock::time_point start_time=chrono::steady_clock::now();
+
+	start(init_box);
+	buffer.flush(); // the cells are processed by the workers
+
+	time=0;
+	nb_cells=0;
+
+	// split the initial box
+	deque<IntervalVector> boxes;
+	boxes.push_back(init_box);
+
+	while ((int) boxes.size() < Dispatcher::NB_SUBPROBLEMS*nb_workers) {
+		const IntervalVector& box=boxes.front();
+		if (!box.is_bisectable()) break;
+		pair<IntervalVector,IntervalVector> p=box.bisect(box.extr_diam_index(false));
+		boxes.pop_front();
+		boxes.push_back(p.first);
+		boxes.push_back(p.second);
+	}
+
+	bool stop=false;
+	Status stop_status=SUCCESS;    // TIME_OUT or CELL_OVERFLOW
+
+	Dispatcher::run<CovSolverData>(server, nb_workers, boxes,
+
+		[&](int w, const vector<IntervalVector>& batch) {
+			CovSolverData* task=new CovSolverData(n, m, nb_ineq, CovManifold::EQU_ONLY, manif->var_names());
+			task->set_time(0);
+			for (vector<IntervalVector>::const_iterator it=batch.begin(); it!=batch.end(); ++it)
+				task->add_pending(*it);
+			return task;
+		},
+
+		[&](int w, const CovSolverData& result) {
+			time += result.time();
+			nb_cells += result.nb_cells();
+
+			for (size_t i=0; i<result.nb_inner(); i++)
+				manif->add_inner(result.inner(i));
+
+			for (size_t i=0; i<result.nb_solution(); i++) {
+				if (trace >=1) cout << " [solution] " << result.solution(i) << endl;
+				if (m==n)
+					manif->add_solution(result.solution(i), result.unicity(i));
+				else
+					manif->add_solution(result.solution(i), result.unicity(i), result.solution_varset(i));
+			}
+
+			for (size_t i=0; i<result.nb_boundary(); i++)
+				manif->add_boundary(result.boundary(i), result.boundary_varset(i));
+
+			for (size_t i=0; i<result.nb_unknown(); i++)
+				manif->add_unknown(result.unknown(i));
+
+			for (size_t i=0; i<result.nb_pending(); i++)
+				boxes.push_back(result.pending(i));
+
+			if (time_limit>0 && chrono::duration<double>(chrono::steady_clock::now()-start_time).count()>=time_limit) {
+				stop=true;
+				stop_status=TIME_OUT;
+			} else if (cell_limit>=0 && nb_cells>=(unsigned long) cell_limit) {
+				stop=true;
+				stop_status=CELL_OVERFLOW;
+			}
+			return stop;
+		});
+
+	// remaining boxes (time out or cell overflow)
+	for (deque<IntervalVector>::iterator it=boxes.begin(); it!=boxes.end(); ++it) {
+		if (trace >=1) cout << " [pending] " << *it << endl;
+		manif->add_pending(*it);
+	}
+
+	Status final_status = stop ? stop_status : end_status();
+
+	timer.stop();
+
+	manif->set_solver_status(final_status);
+	manif->set_time(time);
+	manif->set_nb_cells(nb_cells);
+
+	return final_status;
+}
+
+void Solver::work(Channel& channel, double slice) {
+	double _time_limit=time_limit;
+	long _cell_limit=cell_limit;
+
+	time_limit=slice;
+	cell_limit=-1; // the limit is checked by the coordinator
+
+	try {
+		CovSolverData* data;
+
+		while ((data=channel.receive_cov<CovSolverData>())!=NULL) {
+			solve(*data);
+			delete data;
+			channel.send_cov(get_data());
+		}
+	} catch(Channel::Closed&) { }
+
+	time_limit=_time_limit;
+	cell_limit=_cell_limit;
+}
+
 bool Solver::check_ineq(const IntervalVector& box) {
 	if (!ineqs)
 		return true;
@@ -547,6 +953,8 @@ void Solver::report() {
 	if (manif->nb_cells()!=nb_cells)
 		cout << " [total=" << manif->nb_cells() << "]";
 	cout << endl << endl;
+
+	if (profiler) profiler->report();
 }
 
 } // end namespace ibex
@@ -17,9 +17,12 @@
 #include "ibex_CellBuffer.h"
 #include "ibex_SubPaving.h"
 #include "ibex_Timer.h"
+#include "ibex_CtcProfiler.h"
 #include "ibex_Exception.h"
 #include "ibex_Linear.h"
 #include "ibex_CovSolverData.h"
+#include "ibex_ThreadPool.h"
+#include "ibex_Channel.h"
 
 #include <vector>
 
@@ -86,6 +89,32 @@ public:
 	 */
 	~Solver();
 
+	/**
+	 * \brief Solve with several threads.
+	 *
+	 * The search of #solve(const IntervalVector&) is run on a pool of
+	 * 1+solvers.size() threads. The calling thread uses this solver and
+	 * the ith other thread uses solvers[i] (its contractor, bisector
+	 * and certification functions). Each solvers[i] must solve the same
+	 * system as this solver but must not share any function with it,
+	 * since evaluating a function is not thread-safe (build it on a copy
+	 * of the system, for instance).
+	 *
+	 * Each thread explores its own deque of cells in depth-first order
+	 * and, when the deque is empty, steals the oldest cell (i.e., the
+	 * largest one) of another thread. The output boxes are directly
+	 * added to the data of this solver (see #get_data()), in an order
+	 * that depends on the run. The time limit is checked against the
+	 * wall-clock time, but the reported time is the CPU time of the
+	 * whole process (including all the threads).
+	 *
+	 * The interactive mode (see #next(CovSolverData::BoxStatus&, const IntervalVector**))
+	 * remains sequential.
+	 *
+	 * An empty array makes the solver sequential again.
+	 */
+	void set_thread_solvers(const Array<Solver>& solvers);
+
 	/**
 	 * \brief Solve the system (non-interactive mode).
 	 *
@@ -133,6 +162,39 @@ public:
 	 */
 	//Status solve(const char* init_paving);
 
+	/**
+	 * \brief Solve the system with worker processes.
+	 *
+	 * The initial box is split into subproblems that are sent to
+	 * nb_workers processes connected to the server (see #work(Channel&, double)).
+	 * A worker solves its subproblem during a time slice and returns
+	 * its paving. The inner, solution, boundary and unknown boxes are
+	 * added to the data of this solver and the pending boxes are
+	 * distributed again to the idle workers (load balancing), until no
+	 * box remains.
+	 *
+	 * The result is available as with solve(...) (see #report(),
+	 * #get_data(), etc.). The time limit is the elapsed (real) time of
+	 * this process and the time is the total CPU time of the workers.
+	 *
+	 * \throw Channel::Closed - if all the workers have disconnected before the end.
+	 */
+	Status coordinate(ChannelServer& server, int nb_workers, const IntervalVector& init_box);
+
+	/**
+	 * \brief Run as a worker process (see #coordinate(...)).
+	 *
+	 * This solver must be built on the same system as the one of
+	 * the coordinator. Return when the coordinator closes the connection.
+	 *
+	 * \param slice - Time (in seconds) spent on a subproblem before
+	 *                returning the paving to the coordinator.
+	 */
+	void work(Channel& channel, double slice=default_slice);
+
+	/** Default time slice of a worker process (see #work(Channel&, double)): 1s. */
+	static constexpr double default_slice = 1.0;
+
 	/**
 	 * \brief Start solving (interactive mode).
 	 *
@@ -251,6 +313,16 @@ public:
 	 */
 	long cell_limit;
 
+	/**
+	 * \brief Random seed of the threads in a parallel search.
+	 *
+	 * The state of the random number generator (see #ibex::RNG) is local
+	 * to each thread. If this value is not negative, the generator of
+	 * task n°i of a parallel search is seeded with this value + i when
+	 * the task starts. By default, it is -1 (the generators are not seeded).
+	 */
+	double parallel_seed;
+
 	/**
 	 * \brief Trace level
 	 *
@@ -262,6 +334,15 @@ public:
 	 */
 	int trace;
 
+	/**
+	 * \brief Contractor profiler.
+	 *
+	 * If not NULL, statistics on the contractors are recorded
+	 * (see #ibex::CtcProfiler) and displayed by report().
+	 * NULL by default. The profiler is not owned by the solver.
+	 */
+	CtcProfiler* profiler;
+
 
 protected:
 	/**
@@ -269,6 +350,32 @@ protected:
 	 */
 	Status solve();
 
+	/**
+	 * \brief Multi-threaded variant of solve() (see #set_thread_solvers).
+	 */
+	Status parallel_solve();
+
+	/**
+	 * \brief State shared by the threads of parallel_solve().
+	 */
+	struct ParallelSearch;
+
+	/**
+	 * \brief Add the properties required by this solver to a cell.
+	 */
+	void add_property(Cell& c);
+
+	/**
+	 * \brief Explore the cells of the search (task n°task, run by
+	 * this solver in thread n°thread of the pool).
+	 */
+	void parallel_explore(ParallelSearch& search, int task, int thread);
+
+	/**
+	 * \brief Status at the end of the search (no limit being reached).
+	 */
+	Status end_status() const;
+
 	/*
 	 * \brief Return a new "output box" that potentially contains solutions.
 	 * \throw An exception otherwise (no solution inside).
@@ -371,6 +478,12 @@ protected:
 	 * \brief Number of cells of the previous call.
 	 */
 	unsigned int old_nb_cells;
+
+	/**
+	 * Threads (NULL if sequential) and their solvers.
+	 */
+	ThreadPool* pool;
+	std::vector<Solver*> thread_solvers;
 };
 
 /*============================================ inline implementation ============================================ */
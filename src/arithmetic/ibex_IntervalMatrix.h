@@ -19,6 +19,8 @@
 
 namespace ibex {
 
+template<class D> class ExprDomainArena; // declared only for friendship
+
 /**
  * \ingroup arithmetic
  *
@@ -469,6 +471,7 @@ public:
     operator const ExprConstant&() const;
 
 private:
+	template<class D> friend class ExprDomainArena;
 
 	IntervalMatrix();
 
@@ -0,0 +1,139 @@
+/* ============================================================================
+ * I B E X - Sparse matrix of intervals
+ * ============================================================================
+ * Copyright   : IMT Atlantique (FRANCE)
+ * License     : This program can be distributed under the terms of the GNU LGPL.
+ *               See the file COPYING.LESSER.
+ *
+ * Author(s)   : Gilles Chabert
+ * Created     : Oct 17, 2026
+ * ---------------------------------------------------------------------------- */
+
+#include "ibex_IntervalSparseMatrix.h"
+
+#include <algorithm>
+
+using namespace std;
+
+namespace ibex {
+
+IntervalSparseMatrix::IntervalSparseMatrix() : _nb_rows(0), _nb_cols(0), _row_ptr(1,0), _empty(false) {
+
+}
+
+IntervalSparseMatrix::IntervalSparseMatrix(int nb_rows, int nb_cols, const vector<int>& row_ptr, const vector<int>& col_ind) :
+		_nb_rows(nb_rows), _nb_cols(nb_cols), _row_ptr(row_ptr), _col_ind(col_ind),
+		_val(col_ind.size(), Interval::ZERO), _empty(false) {
+
+	assert(nb_rows>=0 && nb_cols>=0);
+	assert((int) row_ptr.size()==nb_rows+1);
+	assert(row_ptr[0]==0 && row_ptr[nb_rows]==(int) col_ind.size());
+}
+
+IntervalSparseMatrix::IntervalSparseMatrix(const IntervalMatrix& m) :
+		_nb_rows(m.nb_rows()), _nb_cols(m.nb_cols()), _row_ptr(m.nb_rows()+1), _empty(m.is_empty()) {
+
+	_row_ptr[0]=0;
+	for (int i=0; i<_nb_rows; i++) {
+		for (int j=0; j<_nb_cols; j++) {
+			if (_empty || m[i][j]!=Interval::ZERO) {
+				_col_ind.push_back(j);
+				_val.push_back(m[i][j]);
+			}
+		}
+		_row_ptr[i+1]=(int) _col_ind.size();
+	}
+}
+
+int IntervalSparseMatrix::find(int i, int j) const {
+	assert(i>=0 && i<_nb_rows);
+	assert(j>=0 && j<_nb_cols);
+
+	vector<int>::const_iterator first=_col_ind.begin()+_row_ptr[i];
+	vector<int>::const_iterator last=_col_ind.begin()+_row_ptr[i+1];
+	vector<int>::const_iterator it=lower_bound(first, last, j);
+
+	return (it!=last && *it==j) ? (int) (it-_col_ind.begin()) : -1;
+}
+
+bool IntervalSparseMatrix::same_structure(const IntervalSparseMatrix& m) const {
+	return _nb_rows==m._nb_rows && _nb_cols==m._nb_cols &&
+			_row_ptr==m._row_ptr && _col_ind==m._col_ind;
+}
+
+void IntervalSparseMatrix::clear() {
+	for (vector<Interval>::iterator it=_val.begin(); it!=_val.end(); ++it)
+		*it=Interval::ZERO;
+	_empty=false;
+}
+
+void IntervalSparseMatrix::set_empty() {
+	for (vector<Interval>::iterator it=_val.begin(); it!=_val.end(); ++it)
+		it->set_empty();
+	_empty=true;
+}
+
+IntervalVector IntervalSparseMatrix::row(int i) const {
+	IntervalVector r(_nb_cols, Interval::ZERO);
+	if (_empty) r.set_empty();
+	else
+		for (int k=_row_ptr[i]; k<_row_ptr[i+1]; k++)
+			r[_col_ind[k]]=_val[k];
+	return r;
+}
+
+IntervalMatrix IntervalSparseMatrix::dense() const {
+	IntervalMatrix m(_nb_rows, _nb_cols, Interval::ZERO);
+	if (_empty) m.set_empty();
+	else
+		for (int i=0; i<_nb_rows; i++)
+			for (int k=_row_ptr[i]; k<_row_ptr[i+1]; k++)
+				m[i][_col_ind[k]]=_val[k];
+	return m;
+}
+
+bool IntervalSparseMatrix::operator==(const IntervalSparseMatrix& m) const {
+	if (!same_structure(m)) return false;
+	if (_empty || m._empty) return _empty && m._empty;
+	for (int k=0; k<nnz(); k++)
+		if (_val[k]!=m._val[k]) return false;
+	return true;
+}
+
+namespace {
+
+template<class V>
+IntervalVector _mulSV(const IntervalSparseMatrix& m, const V& x) {
+	assert(m.nb_cols()==x.size());
+
+	IntervalVector y(m.nb_rows());
+
+	if (m.is_empty()) {
+		y.set_empty();
+		return y;
+	}
+
+	for (int i=0; i<m.nb_rows(); i++) {
+		y[i]=Interval::ZERO;
+		for (int k=m.row_begin(i); k<m.row_end(i); k++)
+			y[i]+=m[k]*x[m.col(k)];
+	}
+	return y;
+}
+
+}
+
+IntervalVector operator*(const IntervalSparseMatrix& m, const IntervalVector& x) {
+	if (x.is_empty()) return IntervalVector::empty(m.nb_rows());
+	return _mulSV(m,x);
+}
+
+IntervalVector operator*(const IntervalSparseMatrix& m, const Vector& x) {
+	return _mulSV(m,x);
+}
+
+ostream& operator<<(ostream& os, const IntervalSparseMatrix& m) {
+	return os << m.dense();
+}
+
+} // namespace ibex
@@ -0,0 +1,234 @@
+/* ============================================================================
+ * I B E X - Sparse matrix of intervals
+ * ============================================================================
+ * Copyright   : IMT Atlantique (FRANCE)
+ * License     : This program can be distributed under the terms of the GNU LGPL.
+ *               See the file COPYING.LESSER.
+ *
+ * Author(s)   : Gilles Chabert
+ * Created     : Oct 17, 2026
+ * ---------------------------------------------------------------------------- */
+
+#ifndef __IBEX_INTERVAL_SPARSE_MATRIX_H__
+#define __IBEX_INTERVAL_SPARSE_MATRIX_H__
+
+#include "ibex_IntervalMatrix.h"
+
+#include <vector>
+#include <iostream>
+
+namespace ibex {
+
+/**
+ * \ingroup arithmetic
+ *
+ * \brief Sparse interval matrix (CSR layout).
+ *
+ * The structure of the matrix (the positions of the nonzero
+ * entries) is fixed at construction. The nonzero entries of
+ * the ith row are stored contiguously, in increasing order of
+ * columns, at positions row_begin(i)...row_end(i)-1.
+ * Entries outside of the structure are zero.
+ *
+ * Typical loop over the nonzero entries:
+ * <pre>
+ *   for (int i=0; i<J.nb_rows(); i++)
+ *      for (int k=J.row_begin(i); k<J.row_end(i); k++)
+ *         ... J.col(k) ... J[k] ...
+ * </pre>
+ */
+class IntervalSparseMatrix {
+
+public:
+	/**
+	 * \brief Create a 0x0 matrix.
+	 */
+	IntervalSparseMatrix();
+
+	/**
+	 * \brief Create a (nb_rows x nb_cols) matrix with a given structure.
+	 *
+	 * \param row_ptr - array of size nb_rows+1. The nonzero entries of
+	 *                  the ith row are at positions row_ptr[i]...row_ptr[i+1]-1.
+	 * \param col_ind - the column of each nonzero entry (increasing in each row).
+	 *
+	 * All the entries are initialized to 0.
+	 */
+	IntervalSparseMatrix(int nb_rows, int nb_cols, const std::vector<int>& row_ptr, const std::vector<int>& col_ind);
+
+	/**
+	 * \brief Create a sparse matrix from a dense one.
+	 *
+	 * The structure is made of the entries that are not
+	 * equal to zero.
+	 */
+	explicit IntervalSparseMatrix(const IntervalMatrix& m);
+
+	/**
+	 * \brief Return the number of rows.
+	 */
+	int nb_rows() const;
+
+	/**
+	 * \brief Return the number of columns.
+	 */
+	int nb_cols() const;
+
+	/**
+	 * \brief Return the number of nonzero entries.
+	 */
+	int nnz() const;
+
+	/**
+	 * \brief Position of the first nonzero entry of the ith row.
+	 */
+	int row_begin(int i) const;
+
+	/**
+	 * \brief Position following the last nonzero entry of the ith row.
+	 */
+	int row_end(int i) const;
+
+	/**
+	 * \brief Column of the kth nonzero entry.
+	 */
+	int col(int k) const;
+
+	/**
+	 * \brief Value of the kth nonzero entry.
+	 */
+	Interval& operator[](int k);
+
+	/**
+	 * \brief Value of the kth nonzero entry (const version).
+	 */
+	const Interval& operator[](int k) const;
+
+	/**
+	 * \brief Return the entry M(i,j) (0 if outside the structure).
+	 */
+	Interval get(int i, int j) const;
+
+	/**
+	 * \brief Position of M(i,j) in the nonzero entries (-1 if outside the structure).
+	 */
+	int find(int i, int j) const;
+
+	/**
+	 * \brief True if both matrices have the same structure.
+	 */
+	bool same_structure(const IntervalSparseMatrix& m) const;
+
+	/**
+	 * \brief Set all the nonzero entries to 0 (even if empty).
+	 */
+	void clear();
+
+	/**
+	 * \brief Set this matrix to the empty matrix.
+	 *
+	 * The structure remains the same.
+	 */
+	void set_empty();
+
+	/**
+	 * \brief Return true iff this matrix is empty.
+	 */
+	bool is_empty() const;
+
+	/**
+	 * \brief Return the ith row as a dense vector.
+	 */
+	IntervalVector row(int i) const;
+
+	/**
+	 * \brief Return the dense matrix.
+	 */
+	IntervalMatrix dense() const;
+
+	/**
+	 * \brief True if the structures and the entries coincide.
+	 */
+	bool operator==(const IntervalSparseMatrix& m) const;
+
+	/**
+	 * \brief True if the structures or one entry differ.
+	 */
+	bool operator!=(const IntervalSparseMatrix& m) const;
+
+protected:
+	int _nb_rows;
+	int _nb_cols;
+	std::vector<int> _row_ptr;
+	std::vector<int> _col_ind;
+	std::vector<Interval> _val;
+	bool _empty;
+};
+
+/**
+ * \brief Return m*x.
+ */
+IntervalVector operator*(const IntervalSparseMatrix& m, const IntervalVector& x);
+
+/**
+ * \brief Return m*x.
+ */
+IntervalVector operator*(const IntervalSparseMatrix& m, const Vector& x);
+
+/**
+ * \brief Display the (dense) matrix m.
+ */
+std::ostream& operator<<(std::ostream& os, const IntervalSparseMatrix& m);
+
+/*================================== inline implementations ========================================*/
+
+inline int IntervalSparseMatrix::nb_rows() const {
+	return _nb_rows;
+}
+
+inline int IntervalSparseMatrix::nb_cols() const {
+	return _nb_cols;
+}
+
+inline int IntervalSparseMatrix::nnz() const {
+	return (int) _val.size();
+}
+
+inline int IntervalSparseMatrix::row_begin(int i) const {
+	assert(i>=0 && i<_nb_rows);
+	return _row_ptr[i];
+}
+
+inline int IntervalSparseMatrix::row_end(int i) const {
+	assert(i>=0 && i<_nb_rows);
+	return _row_ptr[i+1];
+}
+
+inline int IntervalSparseMatrix::col(int k) const {
+	return _col_ind[k];
+}
+
+inline Interval& IntervalSparseMatrix::operator[](int k) {
+	return _val[k];
+}
+
+inline const Interval& IntervalSparseMatrix::operator[](int k) const {
+	return _val[k];
+}
+
+inline Interval IntervalSparseMatrix::get(int i, int j) const {
+	int k=find(i,j);
+	return k==-1 ? Interval::ZERO : _val[k];
+}
+
+inline bool IntervalSparseMatrix::is_empty() const {
+	return _empty;
+}
+
+inline bool IntervalSparseMatrix::operator!=(const IntervalSparseMatrix& m) const {
+	return !(*this==m);
+}
+
+} // namespace ibex
+
+#endif // __IBEX_INTERVAL_SPARSE_MATRIX_H__
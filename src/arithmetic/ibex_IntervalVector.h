@@ -24,6 +24,8 @@
 namespace ibex {
 
 class IntervalMatrix; // declared only for friendship
+template<class D> class ExprDomainArena; // declared only for friendship
+class Cell; // declared only for friendship
 
 /**
  * \ingroup arithmetic
@@ -609,6 +611,8 @@ public:
 
 private:
 	friend class IntervalMatrix;
+	template<class D> friend class ExprDomainArena;
+	friend class Cell;
 
 	int n;             // dimension (size of vec)
 	Interval *vec;	   // vector of elements
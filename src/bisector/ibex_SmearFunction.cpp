@@ -18,20 +18,70 @@ void SmearFunction::add_property(const IntervalVector& init_box, BoxProperties&
 	rr.add_property(init_box, map);
 }
 
+bool SmearFunction::check(const IntervalMatrix& J, const IntervalVector& box) const {
+	for (int i=0; i<J.nb_rows(); i++)
+		for (int j=0; j<J.nb_cols(); j++)
+			if (J[i][j].mag() == POS_INFINITY ||((J[i][j].mag() ==0) && box[j].diam()== POS_INFINITY ))
+				return false;
+	return true;
+}
+
+bool SmearFunction::check(const IntervalSparseMatrix& J, const IntervalVector& box) const {
+	if (J.is_empty()) return false;
+
+	// number of nonzero entries per column
+	int* count = new int[J.nb_cols()];
+	for (int j=0; j<J.nb_cols(); j++) count[j]=0;
+
+	bool ok=true;
+	for (int k=0; ok && k<J.nnz(); k++) {
+		int j=J.col(k);
+		count[j]++;
+		if (J[k].mag() == POS_INFINITY ||((J[k].mag() ==0) && box[j].diam()== POS_INFINITY ))
+			ok=false;
+	}
+
+	// structural zeros
+	for (int j=0; ok && j<J.nb_cols(); j++)
+		if (count[j]<J.nb_rows() && box[j].diam()== POS_INFINITY)
+			ok=false;
+
+	delete[] count;
+	return ok;
+}
+
+int SmearFunction::var_to_bisect(const IntervalSparseMatrix& J, const IntervalVector& box) const {
+	IntervalMatrix D=J.dense();
+	return var_to_bisect(D,box);
+}
+
 BisectionPoint SmearFunction::choose_var(const Cell& cell) {
 
 	const IntervalVector& box=cell.box;
 
-	IntervalMatrix J(sys.f_ctrs.image_dim(), sys.nb_var);
+	int var;
 
-	sys.f_ctrs.jacobian(box,J);
-	// in case of infinite derivatives  changing to round-robin bisection
-	for (int i=0; i<sys.f_ctrs.image_dim(); i++)
-		for (int j=0; j<sys.nb_var; j++)
-			if (J[i][j].mag() == POS_INFINITY ||((J[i][j].mag() ==0) && box[j].diam()== POS_INFINITY ))
-				return rr.choose_var(cell);
+	const IntervalSparseMatrix& S=sys.f_ctrs.jacobian_structure();
+
+	if (S.nnz() < sparse_density * ((double) S.nb_rows()) * S.nb_cols()) {
+		// only the nonzero entries are calculated
+		sys.f_ctrs.jacobian(box,sparse_J);
+		// in case of infinite derivatives  changing to round-robin bisection
+		if (!check(sparse_J,box))
+			return rr.choose_var(cell);
+
+		var = var_to_bisect(sparse_J,box);
+	} else {
+		IntervalMatrix J(sys.f_ctrs.image_dim(), sys.nb_var);
+
+		sys.f_ctrs.jacobian(box,J);
+		// in case of infinite derivatives  changing to round-robin bisection
+		if (!check(J,box))
+			return rr.choose_var(cell);
+
+		var = var_to_bisect (J,box);
+	}
 
-	int var = var_to_bisect (J,box);
 	// in case of selected var with infinite domain, change to round-robin bisection
 	if (var == -1 || !(box[var].is_bisectable()))
 		return rr.choose_var(cell);
@@ -138,4 +188,129 @@ int SmearMaxRelative::var_to_bisect(IntervalMatrix& J, const IntervalVector& box
 	return var;
 }
 
+namespace {
+
+// normalizing factor of each constraint (sum of the impacts)
+double* ctr_sums(const IntervalSparseMatrix& J, const IntervalVector& box) {
+	double* ctrjsum = new double[J.nb_rows()];
+	for (int i=0; i<J.nb_rows(); i++) {
+		ctrjsum[i]=0;
+		for (int k=J.row_begin(i); k<J.row_end(i); k++)
+			ctrjsum[i]+= J[k].mag() * box[J.col(k)].diam();
+	}
+	return ctrjsum;
+}
+
+}
+
+int SmearMax::var_to_bisect(const IntervalSparseMatrix& J, const IntervalVector& box) const {
+	if (J.nb_rows()==0) return -1;
+
+	// the maximal magnitude of the derivatives w.r.t. each variable
+	// (structural zeros count as 0)
+	double* colmax = new double[nbvars];
+	for (int j=0; j<nbvars; j++) colmax[j]=0;
+
+	for (int k=0; k<J.nnz(); k++)
+		if (J[k].mag() > colmax[J.col(k)])
+			colmax[J.col(k)] = J[k].mag();
+
+	double max_magn = NEG_INFINITY;
+	int var=-1;
+	for (int j=0; j<nbvars; j++) {
+		if ((!too_small(box,j)) && (box[j].mag() <1 ||  box[j].diam()/ box[j].mag() >= prec(j))) {
+			if (colmax[j] * box[j].diam() > max_magn) {
+				max_magn = colmax[j] * box[j].diam();
+				var = j;
+			}
+		}
+	}
+	delete[] colmax;
+	return var;
+}
+
+int SmearSum::var_to_bisect(const IntervalSparseMatrix& J, const IntervalVector& box) const {
+	if (J.nb_rows()==0) return -1;
+
+	double* sum_smear = new double[nbvars];
+	for (int j=0; j<nbvars; j++) sum_smear[j]=0;
+
+	for (int k=0; k<J.nnz(); k++)
+		sum_smear[J.col(k)]+= J[k].mag() * box[J.col(k)].diam();
+
+	double max_magn = NEG_INFINITY;
+	int var = -1;
+	for (int j=0; j<nbvars; j++) {
+		if ((!too_small(box,j)) && (box[j].mag() <1 ||  box[j].diam()/ box[j].mag() >= prec(j))) {
+			if (sum_smear[j] > max_magn) {
+				max_magn = sum_smear[j];
+				var = j;
+			}
+		}
+	}
+	delete[] sum_smear;
+	return var;
+}
+
+int SmearSumRelative::var_to_bisect(const IntervalSparseMatrix& J, const IntervalVector& box) const {
+	if (J.nb_rows()==0) return -1;
+
+	double* ctrjsum = ctr_sums(J,box);
+
+	double* sum_smear = new double[nbvars];
+	for (int j=0; j<nbvars; j++) sum_smear[j]=0;
+
+	for (int i=0; i<J.nb_rows(); i++) {
+		if (ctrjsum[i]!=0)
+			for (int k=J.row_begin(i); k<J.row_end(i); k++)
+				sum_smear[J.col(k)]+= J[k].mag() * box[J.col(k)].diam() / ctrjsum[i];
+	}
+
+	double max_magn = NEG_INFINITY;
+	int var = -1;
+	for (int j=0; j<nbvars; j++) {
+		if ((!too_small(box,j)) && (box[j].mag() <1 ||  box[j].diam()/ box[j].mag() >= prec(j))) {
+			if (sum_smear[j] > max_magn) {
+				max_magn = sum_smear[j];
+				var = j;
+			}
+		}
+	}
+	delete[] sum_smear;
+	delete[] ctrjsum;
+	return var;
+}
+
+int SmearMaxRelative::var_to_bisect(const IntervalSparseMatrix& J, const IntervalVector& box) const {
+	if (J.nb_rows()==0) return -1;
+
+	double* ctrjsum = ctr_sums(J,box);
+
+	double* maxsmear = new double[nbvars];
+	for (int j=0; j<nbvars; j++) maxsmear[j]=0;
+
+	for (int i=0; i<J.nb_rows(); i++) {
+		if (ctrjsum[i]!=0)
+			for (int k=J.row_begin(i); k<J.row_end(i); k++) {
+				int j=J.col(k);
+				double smear = J[k].mag() * box[j].diam() / ctrjsum[i];
+				if (smear > maxsmear[j]) maxsmear[j]=smear;
+			}
+	}
+
+	double max_magn = NEG_INFINITY;
+	int var = -1;
+	for (int j=0; j<nbvars; j++) {
+		if ((!too_small(box,j)) && (box[j].mag() <1 ||  box[j].diam()/ box[j].mag() >= prec(j))) {
+			if (maxsmear[j] > max_magn) {
+				max_magn = maxsmear[j];
+				var = j;
+			}
+		}
+	}
+	delete[] maxsmear;
+	delete[] ctrjsum;
+	return var;
+}
+
 } // end namespace ibex
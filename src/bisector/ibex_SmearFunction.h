@@ -14,6 +14,7 @@
 #include "ibex_Bsc.h"
 #include "ibex_RoundRobin.h"
 #include "ibex_System.h"
+#include "ibex_IntervalSparseMatrix.h"
 
 namespace ibex {
 
@@ -68,15 +69,46 @@ public:
 	 */
 	virtual int var_to_bisect(IntervalMatrix& J, const IntervalVector& box) const=0;
 
+	/**
+	 * \brief Returns the variable to bisect (sparse Jacobian).
+	 *
+	 * Same as var_to_bisect(IntervalMatrix&, const IntervalVector&) but only the
+	 * nonzero entries of the Jacobian matrix are considered. By default,
+	 * the matrix is converted to a dense one.
+	 */
+	virtual int var_to_bisect(const IntervalSparseMatrix& J, const IntervalVector& box) const;
+
+	/**
+	 * \brief Density threshold for the sparse Jacobian.
+	 *
+	 * The Jacobian matrix is calculated in a sparse matrix if the
+	 * ratio of structurally nonzero entries is less than this value.
+	 *
+	 * Set to 0.1.
+	 */
+	static constexpr double sparse_density = 0.1;
+
 	/**
 	 * \brief Add backtrackable data required by round robin.
 	 */
 	virtual void add_property(const IntervalVector& init_box, BoxProperties& map);
 
 protected :
+	/*
+	 * Return false if the Jacobian matrix could not be computed
+	 * correctly (infinite derivatives).
+	 */
+	bool check(const IntervalMatrix& J, const IntervalVector& box) const;
+
+	/*
+	 * Sparse variant.
+	 */
+	bool check(const IntervalSparseMatrix& J, const IntervalVector& box) const;
+
 	RoundRobin rr; // by default when smear function strategy does not apply.
 	int nbvars;
 	System& sys;
+	IntervalSparseMatrix sparse_J; // the sparse Jacobian (if used)
 };
 
 /**
@@ -118,6 +150,11 @@ public :
 	 * \param J the jacobian matrix J
 	 */
 	int var_to_bisect(IntervalMatrix& J, const IntervalVector& box) const;
+
+	/**
+	 * \brief Sparse variant.
+	 */
+	int var_to_bisect(const IntervalSparseMatrix& J, const IntervalVector& box) const;
 };
 
 /**
@@ -158,6 +195,11 @@ public :
 	 * \param J the jacobian matrix J
 	 */
 	int var_to_bisect(IntervalMatrix& J, const IntervalVector& box ) const;
+
+	/**
+	 * \brief Sparse variant.
+	 */
+	int var_to_bisect(const IntervalSparseMatrix& J, const IntervalVector& box) const;
 };
 
 
@@ -197,6 +239,11 @@ public :
 	 * \param J the jacobian matrix J
 	 */
 	virtual int var_to_bisect(IntervalMatrix & J, const IntervalVector& box ) const;
+
+	/**
+	 * \brief Sparse variant.
+	 */
+	virtual int var_to_bisect(const IntervalSparseMatrix& J, const IntervalVector& box) const;
 };
 
 
@@ -227,6 +274,11 @@ public :
 	 * \param J the jacobian matrix J
 	 */
 	int var_to_bisect(IntervalMatrix & J, const IntervalVector& box ) const;
+
+	/**
+	 * \brief Sparse variant.
+	 */
+	int var_to_bisect(const IntervalSparseMatrix& J, const IntervalVector& box) const;
 };
 
 
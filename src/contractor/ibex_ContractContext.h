@@ -15,6 +15,8 @@
 
 namespace ibex {
 
+class CtcProfiler;
+
 /**
  * \ingroup ctc
  *
@@ -76,6 +78,14 @@ public:
 	 */
 	BoxProperties& prop;
 
+	/**
+	 * \brief Profiler (NULL if profiling is disabled)
+	 *
+	 * Inherited by the copies of this context.
+	 * See #ibex::CtcProfiler.
+	 */
+	CtcProfiler* profiler;
+
 protected:
 	const bool own_prop; // for cleanup
 };
@@ -84,11 +94,11 @@ protected:
  	 	 	 	 	 	 	 inline implementation
  ============================================================================*/
 
-inline ContractContext::ContractContext(BoxProperties& prop) : impact(BitSet::all(prop.box.size())), output_flags(prop.box.size()), prop(prop), own_prop(false) {
+inline ContractContext::ContractContext(BoxProperties& prop) : impact(BitSet::all(prop.box.size())), output_flags(prop.box.size()), prop(prop), profiler(NULL), own_prop(false) {
 
 }
 
-inline ContractContext::ContractContext(const IntervalVector& box) : impact(BitSet::all(box.size())), output_flags(box.size()), prop(*new BoxProperties(box)), own_prop(true) {
+inline ContractContext::ContractContext(const IntervalVector& box) : impact(BitSet::all(box.size())), output_flags(box.size()), prop(*new BoxProperties(box)), profiler(NULL), own_prop(true) {
 
 }
 
@@ -96,7 +106,7 @@ inline ContractContext::ContractContext(const ContractContext& c) : ContractCont
 
 }
 
-inline ContractContext::ContractContext(const IntervalVector& box, const ContractContext& c) : impact(c.impact), output_flags(c.output_flags), prop(*new BoxProperties(box, c.prop)), own_prop(true) {
+inline ContractContext::ContractContext(const IntervalVector& box, const ContractContext& c) : impact(c.impact), output_flags(c.output_flags), prop(*new BoxProperties(box, c.prop)), profiler(c.profiler), own_prop(true) {
 
 }
 
@@ -17,7 +17,7 @@ namespace ibex {
 Ctc3BCid::Ctc3BCid(const BitSet& cid_vars, Ctc& ctc, int s3b, int scid, int vhandled, double var_min_width) :
 									Ctc(ctc.nb_var), cid_vars(cid_vars), ctc(ctc), s3b(s3b), scid(scid),
 									vhandled(vhandled<=0? cid_vars.size():vhandled),
-									var_min_width(var_min_width), start_var(0) {
+									var_min_width(var_min_width), start_var(0), context(NULL), pool(NULL) {
 	assert(ctc.nb_var>0);
 	//	if (ctc.nb_var<=0)
 	//		ibex_error("Ctc3BCID : the contractor is non-dimensional, Please specify the dimension with: \n Ctc3BCid(int nb_var, const BoolMask& cid_vars, Ctc& ctc, int s3b, int scid, int vhandled, double var_min_width);");
@@ -27,7 +27,7 @@ Ctc3BCid::Ctc3BCid(const BitSet& cid_vars, Ctc& ctc, int s3b, int scid, int vhan
 Ctc3BCid::Ctc3BCid(Ctc& ctc, int s3b, int scid, int vhandled, double var_min_width) :
                     				Ctc(ctc.nb_var), cid_vars(BitSet::all(nb_var)), ctc(ctc), s3b(s3b), scid(scid),
 									vhandled(vhandled<=0? nb_var : vhandled),
-									var_min_width(var_min_width), start_var(0), context(NULL) {
+									var_min_width(var_min_width), start_var(0), context(NULL), pool(NULL) {
 
 	assert(ctc.nb_var>0);
 	//	if (ctc.nb_var<=0)
@@ -35,7 +35,24 @@ Ctc3BCid::Ctc3BCid(Ctc& ctc, int s3b, int scid, int vhandled, double var_min_wid
 }
 
 Ctc3BCid::~Ctc3BCid() {
+	if (pool) delete pool;
+}
+
+void Ctc3BCid::set_thread_ctcs(const Array<Ctc>& ctcs) {
+	if (pool) {
+		delete pool;
+		pool=NULL;
+	}
+
+	thread_ctcs.clear();
 
+	for (int i=0; i<ctcs.size(); i++) {
+		assert(ctcs[i].nb_var==nb_var);
+		thread_ctcs.push_back(&ctcs[i]);
+	}
+
+	if (ctcs.size()>0)
+		pool=new ThreadPool(1+ctcs.size());
 }
 
 void Ctc3BCid::add_property(const IntervalVector& init_box, BoxProperties& map) {
@@ -177,6 +194,21 @@ void Ctc3BCid::update_and_contract(IntervalVector& box, int var) {
 	ctc.contract(box,sub_context);
 }
 
+void Ctc3BCid::update_and_contract(IntervalVector& box, int var, Ctc& c) {
+
+	ContractContext sub_context(box, *context);
+
+	sub_context.impact.clear();
+
+	sub_context.impact.add(var);
+
+	BoxEvent event(box, BoxEvent::CONTRACT, BitSet::singleton(nb_var,var));
+
+	sub_context.prop.update(event);
+
+	c.contract(box,sub_context);
+}
+
 bool Ctc3BCid::shave_bound_dicho(IntervalVector& box, int var, double wv, bool left) {
 
 	IntervalVector initbox = box;
@@ -270,6 +302,8 @@ bool Ctc3BCid::shave_bound_dicho(IntervalVector& box, int var, double wv, bool l
 
 bool Ctc3BCid::var3BCID_slices(IntervalVector& box, int var, int locs3b, double w_DC, Interval& dom) {
 
+	if (pool) return var3BCID_slices_parallel(box, var, locs3b, w_DC, dom);
+
 	IntervalVector savebox(box);
 
 	// Reduce left bound by shaving:
@@ -382,6 +416,87 @@ bool Ctc3BCid::var3BCID_slices(IntervalVector& box, int var, int locs3b, double
 }
 
 
+bool Ctc3BCid::var3BCID_slices_parallel(IntervalVector& box, int var, int locs3b, double w_DC, Interval& dom) {
+
+	const IntervalVector savebox(box);
+	const Interval initdom(dom);
+
+	// bounds of the kth slice (as in var3BCID_slices)
+	vector<Interval> slice(locs3b);
+	for (int k=0; k<locs3b; k++) {
+		double inf_k = initdom.lb()+k*w_DC;
+		double sup_k = initdom.lb()+(k+1)*w_DC;
+		if (sup_k > initdom.ub() || (k == locs3b - 1 && sup_k<initdom.ub())) sup_k = initdom.ub();
+		slice[k] = Interval(inf_k, sup_k);
+	}
+
+	enum { UNKNOWN, EMPTY, NOT_EMPTY };
+	vector<int> state(locs3b, UNKNOWN);
+	vector<IntervalVector> result(locs3b, savebox); // the contracted slices
+	vector<int> tasks;
+
+	int kLeft, kRight;                                 // the first and last non-empty slices
+
+	while (true) {
+		kLeft=0;
+		while (kLeft<locs3b && state[kLeft]==EMPTY) kLeft++;
+
+		if (kLeft==locs3b) {                           // all slices give an empty box
+			box.set_empty();
+			return true;
+		}
+
+		kRight=locs3b-1;
+		while (state[kRight]==EMPTY) kRight--;
+
+		if (state[kLeft]==NOT_EMPTY && state[kRight]==NOT_EMPTY) break;
+
+		// next round: the unknown slices closest to the bounds,
+		// taken alternately on the left and on the right
+		tasks.clear();
+		int l=kLeft;
+		int r=kRight;
+		while ((int) tasks.size()<pool->size() && l<=r) {
+			if (state[l]==UNKNOWN) tasks.push_back(l);
+			if ((int) tasks.size()<pool->size() && r>l && state[r]==UNKNOWN) tasks.push_back(r);
+			l++;
+			r--;
+		}
+
+		pool->run(tasks.size(), [&](int i, int t) {
+			int k=tasks[i];
+			result[k][var]=slice[k];
+			update_and_contract(result[k], var, t==0? ctc : *thread_ctcs[t-1]);
+		});
+
+		for (vector<int>::iterator it=tasks.begin(); it!=tasks.end(); ++it)
+			state[*it] = result[*it].is_empty()? EMPTY : NOT_EMPTY;
+	}
+
+	// merge the results as var3BCID_slices does
+	if (kLeft==kRight) {
+		box = result[kLeft];
+		return true;
+	}
+
+	IntervalVector newbox = result[kLeft] | result[kRight];
+
+	if (kLeft+1==kRight) {                             // No slice between the left and right slices
+		box = newbox;
+		return true;
+	}
+
+	box = savebox;
+	box[var] = Interval(slice[kLeft].ub(), slice[kRight].lb());
+
+	if (varCID(var,box,newbox))                        // Call to the central CID contraction
+		box = newbox;
+	else                                               // VarCID was useless : one returns the result of only 3B
+		box[var] = Interval(result[kLeft][var].lb(), result[kRight][var].ub());
+
+	return true;
+}
+
 bool Ctc3BCid::varCID(int var, IntervalVector &varcid_box, IntervalVector &var3Bcid_box) {
 
 	if(scid==0 || equalBoxes (var, varcid_box, var3Bcid_box)) return false;
@@ -390,6 +505,26 @@ bool Ctc3BCid::varCID(int var, IntervalVector &varcid_box, IntervalVector &var3B
 	Interval& dom(box[var]);
 
 	double w_DC = dom.diam() / scid;
+
+	if (pool && scid>1) {
+		// contract all the slices, then build the hull in the same order
+		vector<IntervalVector> result(scid, varcid_box);
+		pool->run(scid, [&](int k, int t) {
+			double inf_k = dom.lb() + k * w_DC;
+			double sup_k = dom.lb() + (k+1) * w_DC;
+			if (sup_k > dom.ub() || (k == scid-1 && sup_k < dom.ub())) sup_k = dom.ub();
+			result[k][var] = Interval(inf_k, sup_k);
+			update_and_contract(result[k], var, t==0? ctc : *thread_ctcs[t-1]);
+		});
+
+		for (int k = 0 ; k < scid ; k++) {
+			if (result[k].is_empty()) continue;
+			var3Bcid_box |= result[k];
+			if(equalBoxes (var, varcid_box, var3Bcid_box))
+				return false;
+		}
+		return true;
+	}
 	for (int k = 0 ; k < scid ; k++) {
 		if(k>0) box=varcid_box;
 		// compute slice:
@@ -14,6 +14,10 @@
 
 #include "ibex_Ctc.h"
 #include "ibex_BitSet.h"
+#include "ibex_Array.h"
+#include "ibex_ThreadPool.h"
+
+#include <vector>
 
 namespace ibex {
 
@@ -128,6 +132,25 @@ public:
 	 */
 	virtual void contract(IntervalVector& box, ContractContext& context);
 
+	/**
+	 * \brief Contract the slices of a variable with several threads.
+	 *
+	 * The slices of the linear shaving (see #var3BCID_slices) and of the
+	 * CID are contracted on a pool of 1+ctcs.size() threads. The calling
+	 * thread uses #ctc and the ith other thread uses ctcs[i]. Each ctcs[i]
+	 * must be equivalent to #ctc but must not share any function with it,
+	 * since evaluating a function is not thread-safe (build it on a copy of
+	 * the system, for instance).
+	 *
+	 * Slices are contracted by rounds (one slice per thread) from both
+	 * bounds of the domain, and the results are merged in the same order
+	 * as the sequential algorithm: the contracted box does not depend
+	 * on the number of threads.
+	 *
+	 * An empty array makes the contractor sequential again.
+	 */
+	void set_thread_ctcs(const Array<Ctc>& ctcs);
+
 	/** The variables to which var3BCID is applied **/
 	BitSet cid_vars;
 
@@ -219,8 +242,18 @@ protected:
 	 */
 	bool varCID(int var, IntervalVector& box, IntervalVector& newbox);
 
+	/**
+	 * Multi-threaded variant of var3BCID_slices (see #set_thread_ctcs).
+	 */
+	bool var3BCID_slices_parallel(IntervalVector& box, int var, int locs3b, double w_DC, Interval& dom);
+
 	void update_and_contract(IntervalVector& box, int var);
 
+	/**
+	 * Same as update_and_contract(box,var) with another sub-contractor.
+	 */
+	void update_and_contract(IntervalVector& box, int var, Ctc& c);
+
 	/**
 	 * Returns true iff \a box1 and \a box2 are equal, excepting the current interval (\a var )
 	 */
@@ -250,6 +283,12 @@ protected:
 	ContractContext* context;
 
 	virtual int limitCIDDichotomy();
+
+	/**
+	 * Threads (NULL if sequential) and their sub-contractors.
+	 */
+	ThreadPool* pool;
+	std::vector<Ctc*> thread_ctcs;
 };
 
 } // end namespace ibex
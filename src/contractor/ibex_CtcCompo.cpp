@@ -9,6 +9,12 @@
 //============================================================================
 
 #include "ibex_CtcCompo.h"
+#include "ibex_CtcProfiler.h"
+
+#include <chrono>
+#include <cmath>
+
+using namespace std;
 
 namespace ibex {
 
@@ -24,21 +30,27 @@ void CtcCompo::init_impacts() {
 }
 
 CtcCompo::CtcCompo(const Array<Ctc>& list, bool incremental, double ratio) :
-		Ctc(list), list(list), incremental(incremental), ratio(ratio) {
+		Ctc(list), list(list), incremental(incremental), ratio(ratio),
+		adaptive(false), adaptive_ratio(default_adaptive_ratio), adaptive_window(default_adaptive_window),
+		probe_period(default_probe_period), root_width(-1), before(nb_var) {
 	assert(check_nb_var_ctc_list(list));
 
 	init_impacts();
 }
 
 CtcCompo::CtcCompo(Ctc& c1, Ctc& c2, bool incremental, double ratio) :
-		Ctc(c1.nb_var),list(Array<Ctc>(c1,c2)), incremental(incremental), ratio(ratio) {
+		Ctc(c1.nb_var),list(Array<Ctc>(c1,c2)), incremental(incremental), ratio(ratio),
+		adaptive(false), adaptive_ratio(default_adaptive_ratio), adaptive_window(default_adaptive_window),
+		probe_period(default_probe_period), root_width(-1), before(nb_var) {
 	assert(check_nb_var_ctc_list(list));
 
 	init_impacts();
 }
 
 CtcCompo::CtcCompo(Ctc& c1, Ctc& c2, Ctc& c3, bool incremental, double ratio) :
-		Ctc(c1.nb_var),list(Array<Ctc>(c1,c2,c3)), incremental(incremental), ratio(ratio) {
+		Ctc(c1.nb_var),list(Array<Ctc>(c1,c2,c3)), incremental(incremental), ratio(ratio),
+		adaptive(false), adaptive_ratio(default_adaptive_ratio), adaptive_window(default_adaptive_window),
+		probe_period(default_probe_period), root_width(-1), before(nb_var) {
 	assert(check_nb_var_ctc_list(list));
 
 	init_impacts();
@@ -46,119 +58,153 @@ CtcCompo::CtcCompo(Ctc& c1, Ctc& c2, Ctc& c3, bool incremental, double ratio) :
 
 
 CtcCompo::CtcCompo(Ctc& c1, Ctc& c2, Ctc& c3, Ctc& c4, bool incremental, double ratio) :
-		Ctc(c1.nb_var),	list(Array<Ctc>(c1,c2,c3,c4)), incremental(incremental), ratio(ratio) {
+		Ctc(c1.nb_var),	list(Array<Ctc>(c1,c2,c3,c4)), incremental(incremental), ratio(ratio),
+		adaptive(false), adaptive_ratio(default_adaptive_ratio), adaptive_window(default_adaptive_window),
+		probe_period(default_probe_period), root_width(-1), before(nb_var) {
 	assert(check_nb_var_ctc_list(list));
 
 	init_impacts();
 }
 
 CtcCompo::CtcCompo(Ctc& c1, Ctc& c2, Ctc& c3, Ctc& c4, Ctc& c5, bool incremental, double ratio) :
-		Ctc(c1.nb_var),	list(Array<Ctc>(c1,c2,c3,c4,c5)), incremental(incremental), ratio(ratio) {
+		Ctc(c1.nb_var),	list(Array<Ctc>(c1,c2,c3,c4,c5)), incremental(incremental), ratio(ratio),
+		adaptive(false), adaptive_ratio(default_adaptive_ratio), adaptive_window(default_adaptive_window),
+		probe_period(default_probe_period), root_width(-1), before(nb_var) {
 	assert(check_nb_var_ctc_list(list));
 
 	init_impacts();
 }
 
 CtcCompo::CtcCompo(Ctc& c1, Ctc& c2, Ctc& c3, Ctc& c4, Ctc& c5, Ctc& c6, bool incremental, double ratio) :
-		Ctc(c1.nb_var),	list(Array<Ctc>(c1,c2,c3,c4,c5,c6)), incremental(incremental), ratio(ratio) {
+		Ctc(c1.nb_var),	list(Array<Ctc>(c1,c2,c3,c4,c5,c6)), incremental(incremental), ratio(ratio),
+		adaptive(false), adaptive_ratio(default_adaptive_ratio), adaptive_window(default_adaptive_window),
+		probe_period(default_probe_period), root_width(-1), before(nb_var) {
 	assert(check_nb_var_ctc_list(list));
 
 	init_impacts();
 }
 
 CtcCompo::CtcCompo(Ctc& c1, Ctc& c2, Ctc& c3, Ctc& c4, Ctc& c5, Ctc& c6, Ctc& c7, bool incremental, double ratio) :
-		Ctc(c1.nb_var),	list(Array<Ctc>(c1,c2,c3,c4,c5,c6,c7)), incremental(incremental), ratio(ratio) {
+		Ctc(c1.nb_var),	list(Array<Ctc>(c1,c2,c3,c4,c5,c6,c7)), incremental(incremental), ratio(ratio),
+		adaptive(false), adaptive_ratio(default_adaptive_ratio), adaptive_window(default_adaptive_window),
+		probe_period(default_probe_period), root_width(-1), before(nb_var) {
 	assert(check_nb_var_ctc_list(list));
 
 	init_impacts();
 }
 
 CtcCompo::CtcCompo(Ctc& c1, Ctc& c2, Ctc& c3, Ctc& c4, Ctc& c5, Ctc& c6, Ctc& c7, Ctc& c8, bool incremental, double ratio) :
-		Ctc(c1.nb_var),	list(Array<Ctc>(c1,c2,c3,c4,c5,c6,c7,c8)), incremental(incremental), ratio(ratio) {
+		Ctc(c1.nb_var),	list(Array<Ctc>(c1,c2,c3,c4,c5,c6,c7,c8)), incremental(incremental), ratio(ratio),
+		adaptive(false), adaptive_ratio(default_adaptive_ratio), adaptive_window(default_adaptive_window),
+		probe_period(default_probe_period), root_width(-1), before(nb_var) {
 	assert(check_nb_var_ctc_list(list));
 
 	init_impacts();
 }
 
 CtcCompo::CtcCompo(Ctc& c1, Ctc& c2, Ctc& c3, Ctc& c4, Ctc& c5, Ctc& c6, Ctc& c7, Ctc& c8, Ctc& c9, bool incremental, double ratio) :
-		Ctc(c1.nb_var),	list(Array<Ctc>(c1,c2,c3,c4,c5,c6,c7,c8,c9)), incremental(incremental), ratio(ratio) {
+		Ctc(c1.nb_var),	list(Array<Ctc>(c1,c2,c3,c4,c5,c6,c7,c8,c9)), incremental(incremental), ratio(ratio),
+		adaptive(false), adaptive_ratio(default_adaptive_ratio), adaptive_window(default_adaptive_window),
+		probe_period(default_probe_period), root_width(-1), before(nb_var) {
 	assert(check_nb_var_ctc_list(list));
 
 	init_impacts();
 }
 
 CtcCompo::CtcCompo(Ctc& c1, Ctc& c2, Ctc& c3, Ctc& c4, Ctc& c5, Ctc& c6, Ctc& c7, Ctc& c8, Ctc& c9, Ctc& c10, bool incremental, double ratio) :
-		Ctc(c1.nb_var),	list(Array<Ctc>(c1,c2,c3,c4,c5,c6,c7,c8,c9,c10)), incremental(incremental), ratio(ratio) {
+		Ctc(c1.nb_var),	list(Array<Ctc>(c1,c2,c3,c4,c5,c6,c7,c8,c9,c10)), incremental(incremental), ratio(ratio),
+		adaptive(false), adaptive_ratio(default_adaptive_ratio), adaptive_window(default_adaptive_window),
+		probe_period(default_probe_period), root_width(-1), before(nb_var) {
 	assert(check_nb_var_ctc_list(list));
 
 	init_impacts();
 }
 
 CtcCompo::CtcCompo(Ctc& c1, Ctc& c2, Ctc& c3, Ctc& c4, Ctc& c5, Ctc& c6, Ctc& c7, Ctc& c8, Ctc& c9, Ctc& c10, Ctc& c11, bool incremental, double ratio) :
-		Ctc(c1.nb_var),	list(Array<Ctc>(c1,c2,c3,c4,c5,c6,c7,c8,c9,c10,c11)), incremental(incremental), ratio(ratio) {
+		Ctc(c1.nb_var),	list(Array<Ctc>(c1,c2,c3,c4,c5,c6,c7,c8,c9,c10,c11)), incremental(incremental), ratio(ratio),
+		adaptive(false), adaptive_ratio(default_adaptive_ratio), adaptive_window(default_adaptive_window),
+		probe_period(default_probe_period), root_width(-1), before(nb_var) {
 	assert(check_nb_var_ctc_list(list));
 
 	init_impacts();
 }
 
 CtcCompo::CtcCompo(Ctc& c1, Ctc& c2, Ctc& c3, Ctc& c4, Ctc& c5, Ctc& c6, Ctc& c7, Ctc& c8, Ctc& c9, Ctc& c10, Ctc& c11, Ctc& c12, bool incremental, double ratio) :
-		Ctc(c1.nb_var),	list(Array<Ctc>(c1,c2,c3,c4,c5,c6,c7,c8,c9,c10,c11,c12)), incremental(incremental), ratio(ratio) {
+		Ctc(c1.nb_var),	list(Array<Ctc>(c1,c2,c3,c4,c5,c6,c7,c8,c9,c10,c11,c12)), incremental(incremental), ratio(ratio),
+		adaptive(false), adaptive_ratio(default_adaptive_ratio), adaptive_window(default_adaptive_window),
+		probe_period(default_probe_period), root_width(-1), before(nb_var) {
 	assert(check_nb_var_ctc_list(list));
 
 	init_impacts();
 }
 
 CtcCompo::CtcCompo(Ctc& c1, Ctc& c2, Ctc& c3, Ctc& c4, Ctc& c5, Ctc& c6, Ctc& c7, Ctc& c8, Ctc& c9, Ctc& c10, Ctc& c11, Ctc& c12, Ctc& c13, bool incremental, double ratio) :
-		Ctc(c1.nb_var),	list(Array<Ctc>(c1,c2,c3,c4,c5,c6,c7,c8,c9,c10,c11,c12,c13)), incremental(incremental), ratio(ratio) {
+		Ctc(c1.nb_var),	list(Array<Ctc>(c1,c2,c3,c4,c5,c6,c7,c8,c9,c10,c11,c12,c13)), incremental(incremental), ratio(ratio),
+		adaptive(false), adaptive_ratio(default_adaptive_ratio), adaptive_window(default_adaptive_window),
+		probe_period(default_probe_period), root_width(-1), before(nb_var) {
 	assert(check_nb_var_ctc_list(list));
 
 	init_impacts();
 }
 
 CtcCompo::CtcCompo(Ctc& c1, Ctc& c2, Ctc& c3, Ctc& c4, Ctc& c5, Ctc& c6, Ctc& c7, Ctc& c8, Ctc& c9, Ctc& c10, Ctc& c11, Ctc& c12, Ctc& c13, Ctc& c14, bool incremental, double ratio) :
-		Ctc(c1.nb_var),	list(Array<Ctc>(c1,c2,c3,c4,c5,c6,c7,c8,c9,c10,c11,c12,c13,c14)), incremental(incremental), ratio(ratio) {
+		Ctc(c1.nb_var),	list(Array<Ctc>(c1,c2,c3,c4,c5,c6,c7,c8,c9,c10,c11,c12,c13,c14)), incremental(incremental), ratio(ratio),
+		adaptive(false), adaptive_ratio(default_adaptive_ratio), adaptive_window(default_adaptive_window),
+		probe_period(default_probe_period), root_width(-1), before(nb_var) {
 	assert(check_nb_var_ctc_list(list));
 
 	init_impacts();
 }
 
 CtcCompo::CtcCompo(Ctc& c1, Ctc& c2, Ctc& c3, Ctc& c4, Ctc& c5, Ctc& c6, Ctc& c7, Ctc& c8, Ctc& c9, Ctc& c10, Ctc& c11, Ctc& c12, Ctc& c13, Ctc& c14, Ctc& c15, bool incremental, double ratio) :
-		Ctc(c1.nb_var),	list(Array<Ctc>(c1,c2,c3,c4,c5,c6,c7,c8,c9,c10,c11,c12,c13,c14,c15)), incremental(incremental), ratio(ratio) {
+		Ctc(c1.nb_var),	list(Array<Ctc>(c1,c2,c3,c4,c5,c6,c7,c8,c9,c10,c11,c12,c13,c14,c15)), incremental(incremental), ratio(ratio),
+		adaptive(false), adaptive_ratio(default_adaptive_ratio), adaptive_window(default_adaptive_window),
+		probe_period(default_probe_period), root_width(-1), before(nb_var) {
 	assert(check_nb_var_ctc_list(list));
 
 	init_impacts();
 }
 
 CtcCompo::CtcCompo(Ctc& c1, Ctc& c2, Ctc& c3, Ctc& c4, Ctc& c5, Ctc& c6, Ctc& c7, Ctc& c8, Ctc& c9, Ctc& c10, Ctc& c11, Ctc& c12, Ctc& c13, Ctc& c14, Ctc& c15, Ctc& c16, bool incremental, double ratio) :
-		Ctc(c1.nb_var),	list(Array<Ctc>(c1,c2,c3,c4,c5,c6,c7,c8,c9,c10,c11,c12,c13,c14,c15,c16)), incremental(incremental), ratio(ratio) {
+		Ctc(c1.nb_var),	list(Array<Ctc>(c1,c2,c3,c4,c5,c6,c7,c8,c9,c10,c11,c12,c13,c14,c15,c16)), incremental(incremental), ratio(ratio),
+		adaptive(false), adaptive_ratio(default_adaptive_ratio), adaptive_window(default_adaptive_window),
+		probe_period(default_probe_period), root_width(-1), before(nb_var) {
 	assert(check_nb_var_ctc_list(list));
 
 	init_impacts();
 }
 
 CtcCompo::CtcCompo(Ctc& c1, Ctc& c2, Ctc& c3, Ctc& c4, Ctc& c5, Ctc& c6, Ctc& c7, Ctc& c8, Ctc& c9, Ctc& c10, Ctc& c11, Ctc& c12, Ctc& c13, Ctc& c14, Ctc& c15, Ctc& c16, Ctc& c17, bool incremental, double ratio) :
-		Ctc(c1.nb_var),	list(Array<Ctc>(c1,c2,c3,c4,c5,c6,c7,c8,c9,c10,c11,c12,c13,c14,c15,c16,c17)), incremental(incremental), ratio(ratio) {
+		Ctc(c1.nb_var),	list(Array<Ctc>(c1,c2,c3,c4,c5,c6,c7,c8,c9,c10,c11,c12,c13,c14,c15,c16,c17)), incremental(incremental), ratio(ratio),
+		adaptive(false), adaptive_ratio(default_adaptive_ratio), adaptive_window(default_adaptive_window),
+		probe_period(default_probe_period), root_width(-1), before(nb_var) {
 	assert(check_nb_var_ctc_list(list));
 
 	init_impacts();
 }
 
 CtcCompo::CtcCompo(Ctc& c1, Ctc& c2, Ctc& c3, Ctc& c4, Ctc& c5, Ctc& c6, Ctc& c7, Ctc& c8, Ctc& c9, Ctc& c10, Ctc& c11, Ctc& c12, Ctc& c13, Ctc& c14, Ctc& c15, Ctc& c16, Ctc& c17, Ctc& c18, bool incremental, double ratio) :
-		Ctc(c1.nb_var),	list(Array<Ctc>(c1,c2,c3,c4,c5,c6,c7,c8,c9,c10,c11,c12,c13,c14,c15,c16,c17,c18)), incremental(incremental), ratio(ratio) {
+		Ctc(c1.nb_var),	list(Array<Ctc>(c1,c2,c3,c4,c5,c6,c7,c8,c9,c10,c11,c12,c13,c14,c15,c16,c17,c18)), incremental(incremental), ratio(ratio),
+		adaptive(false), adaptive_ratio(default_adaptive_ratio), adaptive_window(default_adaptive_window),
+		probe_period(default_probe_period), root_width(-1), before(nb_var) {
 	assert(check_nb_var_ctc_list(list));
 
 	init_impacts();
 }
 
 CtcCompo::CtcCompo(Ctc& c1, Ctc& c2, Ctc& c3, Ctc& c4, Ctc& c5, Ctc& c6, Ctc& c7, Ctc& c8, Ctc& c9, Ctc& c10, Ctc& c11, Ctc& c12, Ctc& c13, Ctc& c14, Ctc& c15, Ctc& c16, Ctc& c17, Ctc& c18, Ctc& c19, bool incremental, double ratio) :
-		Ctc(c1.nb_var),	list(Array<Ctc>(c1,c2,c3,c4,c5,c6,c7,c8,c9,c10,c11,c12,c13,c14,c15,c16,c17,c18,c19)), incremental(incremental), ratio(ratio) {
+		Ctc(c1.nb_var),	list(Array<Ctc>(c1,c2,c3,c4,c5,c6,c7,c8,c9,c10,c11,c12,c13,c14,c15,c16,c17,c18,c19)), incremental(incremental), ratio(ratio),
+		adaptive(false), adaptive_ratio(default_adaptive_ratio), adaptive_window(default_adaptive_window),
+		probe_period(default_probe_period), root_width(-1), before(nb_var) {
 	assert(check_nb_var_ctc_list(list));
 
 	init_impacts();
 }
 
 CtcCompo::CtcCompo(Ctc& c1, Ctc& c2, Ctc& c3, Ctc& c4, Ctc& c5, Ctc& c6, Ctc& c7, Ctc& c8, Ctc& c9, Ctc& c10, Ctc& c11, Ctc& c12, Ctc& c13, Ctc& c14, Ctc& c15, Ctc& c16, Ctc& c17, Ctc& c18, Ctc& c19, Ctc& c20, bool incremental, double ratio) :
-		Ctc(c1.nb_var),	list(Array<Ctc>(c1,c2,c3,c4,c5,c6,c7,c8,c9,c10,c11,c12,c13,c14,c15,c16,c17,c18,c19,c20)), incremental(incremental), ratio(ratio) {
+		Ctc(c1.nb_var),	list(Array<Ctc>(c1,c2,c3,c4,c5,c6,c7,c8,c9,c10,c11,c12,c13,c14,c15,c16,c17,c18,c19,c20)), incremental(incremental), ratio(ratio),
+		adaptive(false), adaptive_ratio(default_adaptive_ratio), adaptive_window(default_adaptive_window),
+		probe_period(default_probe_period), root_width(-1), before(nb_var) {
 	assert(check_nb_var_ctc_list(list));
 
 	init_impacts();
@@ -178,6 +224,40 @@ void CtcCompo::contract(IntervalVector& box) {
 	contract(box,context);
 }
 
+int CtcCompo::width_level(const IntervalVector& box) {
+	double w=box.max_diam();
+
+	if (!(root_width<POS_INFINITY))
+		root_width=w; // may still be infinite
+
+	if (!(root_width<POS_INFINITY) || w>=root_width) return 0;
+	if (w<=0) return nb_levels-1;
+
+	int l=(int) ::log2(root_width/w);
+	return l<nb_levels ? l : nb_levels-1;
+}
+
+bool CtcCompo::skip(int i, int level) {
+	Stat& s=stats[i*nb_levels+level];
+
+	if (s.nb_calls<5) return false;  // not enough statistics
+
+	double best=0;
+	for (int j=0; j<list.size(); j++) {
+		const Stat& sj=stats[j*nb_levels+level];
+		if (sj.nb_calls>0 && sj.gain/sj.time>best)
+			best=sj.gain/sj.time;
+	}
+
+	if (s.gain/s.time >= adaptive_ratio*best || s.nb_skips>=probe_period) {
+		s.nb_skips=0;
+		return false;
+	} else {
+		s.nb_skips++;
+		return true;
+	}
+}
+
 void CtcCompo::contract(IntervalVector& box, ContractContext& context) {
 
 	bool inactive = true;
@@ -186,15 +266,35 @@ void CtcCompo::contract(IntervalVector& box, ContractContext& context) {
 
 	context.impact.fill(0,nb_var-1); // always set to "all" for the moment (to be improved later)
 
+	int level=0;
+	if (adaptive) {
+		if (stats.empty()) {
+			Stat s0 = { 0.0, 0.0, 0, 0 };
+			stats.assign(list.size()*nb_levels,s0);
+		}
+		level=width_level(box);
+	}
+
 	// TODO: a more clever impact handling could be
 	// done here
 	for (int i=0; i<list.size(); i++) {
 
+		chrono::steady_clock::time_point start;
+
+		if (adaptive) {
+			if (skip(i,level)) {
+				inactive=false; // unknown
+				continue;
+			}
+			before=box;
+			start=chrono::steady_clock::now();
+		}
+
 		if (inactive) {
 
 			context.output_flags.clear();
 
-			list[i].contract(box, context);
+			CtcProfiler::contract(list[i], box, context);
 
 			if (!context.output_flags[INACTIVE]) {
 				inactive=false;
@@ -202,7 +302,23 @@ void CtcCompo::contract(IntervalVector& box, ContractContext& context) {
 				// to calculate the output flags
 			}
 		} else {
-			list[i].contract(box, context);
+			CtcProfiler::contract(list[i], box, context);
+		}
+
+		if (adaptive) {
+			double t=chrono::duration<double,micro>(chrono::steady_clock::now()-start).count();
+			double gain=0;
+			if (box.is_empty())
+				gain=nb_var; // maximal reduction
+			else
+				for (int j=0; j<nb_var; j++)
+					gain+=before[j].ratiodelta(box[j]);
+
+			double decay=1.0-1.0/adaptive_window;
+			Stat& s=stats[i*nb_levels+level];
+			s.gain = decay*s.gain + gain;
+			s.time = decay*s.time + t + 1e-3; // avoid division by zero
+			s.nb_calls++;
 		}
 
 		if (box.is_empty()) {
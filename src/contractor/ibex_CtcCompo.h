@@ -14,6 +14,8 @@
 #include "ibex_Ctc.h"
 #include "ibex_Array.h"
 
+#include <vector>
+
 namespace ibex {
 
 /** \ingroup contractor
@@ -104,10 +106,80 @@ public:
 	/** Default ratio used in incremental mode, set to 0.1. */
 	static constexpr double default_ratio = 0.1;
 
+	/**
+	 * Adaptive mode. If true, a sub-contractor is skipped when its
+	 * efficiency is low compared to the other ones. The efficiency of a
+	 * sub-contractor is the reduction of the domains (see Interval::ratiodelta)
+	 * per microsecond it has produced on the last calls (sliding window).
+	 * Statistics are separated by levels of box width (relatively to the
+	 * first box contracted), i.e., roughly, by depth in the search tree.
+	 * A skipped sub-contractor is periodically called again, to update
+	 * its statistics.
+	 *
+	 * Skipping a sub-contractor gives a (potentially) larger box, so this
+	 * mode must not be used when the composition is expected to reach a
+	 * given precision.
+	 *
+	 * Default value is false.
+	 */
+	bool adaptive;
+
+	/**
+	 * Adaptive mode: a sub-contractor is skipped if its efficiency is less
+	 * than adaptive_ratio times the best efficiency of the sub-contractors
+	 * (at the same width level).
+	 */
+	double adaptive_ratio;
+
+	/**
+	 * Adaptive mode: approximate number of last calls taken into account
+	 * in the efficiency (the weight of a call decreases exponentially
+	 * with its age).
+	 */
+	int adaptive_window;
+
+	/**
+	 * Adaptive mode: a sub-contractor skipped probe_period times
+	 * in a row is called again.
+	 */
+	int probe_period;
+
+	/** Default adaptive ratio, set to 0.01. */
+	static constexpr double default_adaptive_ratio = 0.01;
+
+	/** Default adaptive window, set to 50. */
+	static constexpr int default_adaptive_window = 50;
+
+	/** Default probe period, set to 20. */
+	static constexpr int default_probe_period = 20;
+
 protected:
 	void init_impacts();
 
 	BitSet *impacts;
+
+	/* Adaptive mode: whether the ith sub-contractor has to be skipped */
+	bool skip(int i, int level);
+
+	/* Adaptive mode: width level of a box */
+	int width_level(const IntervalVector& box);
+
+	/* Statistics of a sub-contractor at a given width level (adaptive mode) */
+	struct Stat {
+		double gain;       // decayed sum of reductions
+		double time;       // decayed sum of running times (in microseconds)
+		int nb_calls;      // number of calls
+		int nb_skips;      // number of consecutive skips
+	};
+
+	/* Number of width levels (adaptive mode) */
+	static const int nb_levels = 16;
+
+	std::vector<Stat> stats; // the stats of the ith sub-contractor at level l are in stats[i*nb_levels+l]
+
+	double root_width;       // max diameter of the first (bounded) box contracted
+
+	IntervalVector before;   // domains just before the last contraction (adaptive mode)
 };
 
 } // end namespace ibex
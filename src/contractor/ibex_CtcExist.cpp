@@ -26,13 +26,18 @@ CtcExist::CtcExist(Ctc& ctc, const BitSet& vars, const IntervalVector& init_box,
 	CtcQuantif(ctc, VarSet(ctc.nb_var,vars,true), init_box, prec, own_ctc) {
 }
 
-bool CtcExist::proceed(const IntervalVector& x_init, const IntervalVector& x_current, IntervalVector& x_res, IntervalVector& y, ContractContext& context) {
+bool CtcExist::proceed(const IntervalVector& x_init, const IntervalVector& x_current, IntervalVector& x_res, const IntervalVector& y_current,
+		stack<pair<IntervalVector,IntervalVector> >& l, bool& inactive_flag, bool& empty, int thread) {
 	IntervalVector x = x_current;
+	IntervalVector y = y_current;
 
 	// TODO: handle impact!
-	bool inactive = CtcQuantif::contract(x, y);
+	bool inactive = CtcQuantif::contract(x, y, thread);
 
 	if (x.is_empty()) {
+		// x_current contains all the solutions in x_init
+		// for y in the parent box of parameters.
+		empty = true;
 		return false;
 	}
 
@@ -41,7 +46,7 @@ bool CtcExist::proceed(const IntervalVector& x_init, const IntervalVector& x_cur
 		// ... the contractor for \exists y\in[yinit] c(x) is inactive on [x]
 		if (x==x_init) {
 			x_res =x_init;
-			context.output_flags.add(INACTIVE);
+			inactive_flag = true;
 			return true;
 		} else {
 			x_res |= x;
@@ -64,14 +69,14 @@ bool CtcExist::proceed(const IntervalVector& x_init, const IntervalVector& x_cur
 			// parameter boxes (getting quickly some estimate is important for pruning).
 
 			IntervalVector y_mid = y.mid();
-			CtcQuantif::contract(x,y_mid);  // x may be contracted here; that's why we pushed it on the stack *before* sampling.
+			CtcQuantif::contract(x,y_mid,thread);  // x may be contracted here; that's why we pushed it on the stack *before* sampling.
 
 			if (!x.is_empty()) {
 
 				x_res |= x;
 
 				if (inactive && (x==x_init)) {
-					context.output_flags.add(INACTIVE);
+					inactive_flag = true;
 					return true;
 				}
 
@@ -85,6 +90,61 @@ bool CtcExist::proceed(const IntervalVector& x_init, const IntervalVector& x_cur
 	return false;
 }
 
+void CtcExist::parallel_contract(const IntervalVector& box, IntervalVector& res, bool& inactive, BxpQuantifCache* cache) {
+	vector<IntervalVector> xs;
+	vector<IntervalVector> ys;
+
+	bool stop=false;
+
+	while (!stop && !l.empty()) {
+		xs.clear();
+		ys.clear();
+
+		// get and immediately bisect the domains of parameters
+		while (!l.empty() && (int) ys.size()<pool->size()) {
+			pair<IntervalVector,IntervalVector> cut = bsc->bisect(l.top().second);
+
+			if (!cache || !cache->contains(cut.first)) {
+				xs.push_back(l.top().first);
+				ys.push_back(cut.first);
+			}
+			if (!cache || !cache->contains(cut.second)) {
+				xs.push_back(l.top().first);
+				ys.push_back(cut.second);
+			}
+			l.pop();
+		}
+
+		int n=(int) ys.size();
+		vector<IntervalVector> r(n, res);
+		vector<stack<pair<IntervalVector,IntervalVector> > > pushed(n);
+		vector<char> stops(n);
+		vector<char> inactives(n);
+		vector<char> empties(n);
+
+		pool->run(n, [&](int i, int thread) {
+			bool in=false;
+			bool em=false;
+			stops[i] = proceed(box, xs[i], r[i], ys[i], pushed[i], in, em, thread);
+			inactives[i] = in;
+			empties[i] = em;
+		});
+
+		for (int i=0; i<n; i++) {
+			res |= r[i];
+			if (stops[i]) stop=true;
+			if (inactives[i]) inactive=true;
+			if (empties[i] && cache) cache->add(ys[i]);
+			if (!pushed[i].empty()) l.push(pushed[i].top());
+		}
+
+		if (res==box) stop=true;
+	}
+
+	// the sequential loop has nothing left to do
+	while (!l.empty()) l.pop();
+}
+
 void CtcExist::contract(IntervalVector& box) {
 	ContractContext context(box);
 	contract(box,context);
@@ -98,15 +158,17 @@ void CtcExist::contract(IntervalVector& box, ContractContext& context) {
 
 	assert(l.empty()); // old?--> even when an exception is thrown by this function, l is empty.
 
+	BxpQuantifCache* cache = CtcQuantif::cache(context);
+
 	l.push(pair<IntervalVector,IntervalVector>(box, y_init));
 	
 	IntervalVector x_save(vars.nb_var);
-	IntervalVector x(vars.nb_var);
-
-	IntervalVector y(vars.nb_param);
-	IntervalVector y_mid(vars.nb_param); // for sampling
 
 	bool stop=false;
+	bool inactive=false;
+	bool empty;
+
+	if (pool) parallel_contract(box, res, inactive, cache);
 
 	while ((!stop) && (!l.empty())) {
 
@@ -117,13 +179,22 @@ void CtcExist::contract(IntervalVector& box, ContractContext& context) {
 		
 		l.pop();
 
-		// proceed with the two sub-boxes for y
-		stop=proceed(box, x_save, res, cut.first, context);
-		if (!stop) stop=proceed(box, x_save, res, cut.second, context);
+		// proceed with the two sub-boxes for y (except those
+		// where the constraint is already known to have no solution)
+		for (int i=0; !stop && i<2; i++) {
+			const IntervalVector& y = i==0 ? cut.first : cut.second;
+			if (cache && cache->contains(y)) continue;
+
+			empty=false;
+			stop=proceed(box, x_save, res, y, l, inactive, empty, 0);
+			if (empty && cache) cache->add(y);
+		}
 	}
 
 	while (!l.empty()) l.pop();
 
+	if (inactive) context.output_flags.add(INACTIVE);
+
 	box &= res;
 
 	if (box.is_empty()) {
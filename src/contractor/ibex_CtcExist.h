@@ -66,15 +66,29 @@ private:
 	/**
 	 * Function call by contract to proceed a pair (x,y).
 	 *
-	 * The overall result x_res is updated, as well as y, and a new pair (x',y') is possibly pushed in the list "l".
+	 * The overall result x_res is updated, and a new pair (x',y') is possibly pushed in the list "l".
 	 *
 	 * \param x_init:    the initial box "x" to be contracted
 	 * \param x_current: the current box "x" generated by the branch & bound inside the contract(...) function
 	 * \param x_res:     the current state of the overall result (proj-union). Corresponds, at the end, to the result
 	 *                   of the contraction
 	 * \param y:         the current box "y"
+	 * \param l:         the stack where the new pair is pushed
+	 * \param inactive:  set to true if the contractor is proven inactive on x_init
+	 * \param empty:     set to true if there is no solution in x_current*y (hence none in x_init*y)
+	 * \param thread:    the thread number (see #set_nb_threads)
 	 */
-	bool proceed(const IntervalVector& x_init, const IntervalVector& x_current, IntervalVector& x_res, IntervalVector& y, ContractContext& context);
+	bool proceed(const IntervalVector& x_init, const IntervalVector& x_current, IntervalVector& x_res, const IntervalVector& y,
+			std::stack<std::pair<IntervalVector,IntervalVector> >& l, bool& inactive, bool& empty, int thread);
+
+	/**
+	 * Multi-threaded variant of the loop of contract (see #set_nb_threads).
+	 *
+	 * The stack is processed by rounds: pairs are popped and their parameter
+	 * boxes bisected until there is one sub-box per thread, the sub-boxes
+	 * are proceeded in parallel and the results are merged (union).
+	 */
+	void parallel_contract(const IntervalVector& x_init, IntervalVector& x_res, bool& inactive, BxpQuantifCache* cache);
 
 	/**
 	 * Stack of pairs (x,y)
@@ -9,10 +9,16 @@
 //============================================================================
 
 #include "ibex_CtcFixPoint.h"
+#include "ibex_CtcProfiler.h"
+
+#include <chrono>
+#include <algorithm>
+
+using namespace std;
 
 namespace ibex {
 
-CtcFixPoint::CtcFixPoint(Ctc& ctc, double ratio) : Ctc(ctc.nb_var), ctc(ctc), ratio(ratio) {
+CtcFixPoint::CtcFixPoint(Ctc& ctc, double ratio) : Ctc(ctc.nb_var), ctc(ctc), ratio(ratio), cutoff(0) {
 
 }
 
@@ -36,12 +42,18 @@ void CtcFixPoint::contract(IntervalVector& box, ContractContext& context) {
 	BitSet input_impact(context.impact); // saved-->useful?
 	BitSet& flags=context.output_flags;
 
+	double dist;            // relative distance between two iterations
+	double first_rate=-1;   // reduction per microsecond of the first iteration (if cutoff>0)
+
 	do {
 		old_box=box;
 
 		flags.clear();
 
-		ctc.contract(box,context);
+		chrono::steady_clock::time_point start;
+		if (cutoff>0) start=chrono::steady_clock::now();
+
+		CtcProfiler::contract(ctc, box, context);
 
 		if (box.is_empty()) {
 			flags.add(FIXPOINT);
@@ -54,7 +66,16 @@ void CtcFixPoint::contract(IntervalVector& box, ContractContext& context) {
 			if (box[i]!=old_box[i]) context.impact.add(i);
 		}
 
-	} while (!flags[FIXPOINT] && !flags[INACTIVE] && old_box.rel_distance(box)>ratio);
+		dist=old_box.rel_distance(box);
+
+		if (cutoff>0) {
+			// note: the time is bounded below by 1ns
+			double rate=dist/std::max(1e-3,chrono::duration<double,micro>(chrono::steady_clock::now()-start).count());
+			if (first_rate<0) first_rate=rate;
+			else if (rate<cutoff*first_rate) break;
+		}
+
+	} while (!flags[FIXPOINT] && !flags[INACTIVE] && dist>ratio);
 
 	bool fixpoint=flags[FIXPOINT];
 	bool inactive=flags[INACTIVE];
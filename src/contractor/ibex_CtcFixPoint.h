@@ -64,6 +64,15 @@ public:
 	 */
 	double ratio;
 
+	/**
+	 * Cut-off (adaptive stopping rule). The iteration also stops
+	 * as soon as the reduction per microsecond of the last iteration
+	 * (Hausdorff distance between two iterations, relatively to the
+	 * diameter) is less than cutoff times the one of the first iteration.
+	 * Default value is 0 (no cut-off).
+	 */
+	double cutoff;
+
 	/** Default ratio used, set to 0.1. */
 	static constexpr double default_ratio = 0.1;
 };
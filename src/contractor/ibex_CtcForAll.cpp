@@ -34,26 +34,108 @@ CtcForAll::CtcForAll(Ctc& ctc, const BitSet& vars, const IntervalVector& init_bo
 	CtcQuantif(ctc, VarSet(ctc.nb_var,vars,true), init_box, prec, own_ctc) {
 }
 
-void CtcForAll::proceed(IntervalVector& x, const IntervalVector& y, bool& is_inactive) {
+bool CtcForAll::contract_y(IntervalVector& x, const IntervalVector& y, bool prove, bool& inactive, int thread) {
 
 	IntervalVector y_tmp = y.mid();
 
 	// TODO: handle impact!
-	bool tmp_inactive = CtcQuantif::contract(x, y_tmp);
+	bool tmp_inactive = CtcQuantif::contract(x, y_tmp, thread);
 
-	if (x.is_empty()) throw ForAllEmptyBox();
+	inactive = false;
+
+	if (x.is_empty()) return false;
 
 	if (y.max_diam()>prec) {
 		assert(y.is_bisectable());
+		return true;
+	}
+
+	if (prove && tmp_inactive) {
+		// try to prove the constraint is inactive for all y in [y]
+		y_tmp = y;
+		inactive = CtcQuantif::contract(x, y_tmp, thread);
+	}
+	return false;
+}
+
+void CtcForAll::proceed(IntervalVector& x, const IntervalVector& y, bool& is_inactive, BxpQuantifCache* cache) {
+
+	// the constraint holds for all y in [y]: nothing to do
+	if (cache && cache->contains(y)) return;
+
+	bool inactive;
+
+	// with a cache, inactivity is worth proving even if the
+	// whole contractor is already known to be active.
+	if (contract_y(x, y, is_inactive || cache, inactive, 0))
 		l.push(y);
-	} else {
-
-		if (is_inactive && tmp_inactive) {
-			// try to prove the constraint is inactive for all y in [y]
-			y_tmp = y;
-			is_inactive =  CtcQuantif::contract(x, y_tmp);
-		} else {
-			is_inactive = false;
+	else {
+		if (x.is_empty()) throw ForAllEmptyBox();
+
+		is_inactive = is_inactive && inactive;
+		if (cache && inactive) cache->add(y);
+	}
+}
+
+void CtcForAll::parallel_contract(IntervalVector& box, bool& is_inactive, BxpQuantifCache* cache) {
+	vector<IntervalVector> ys;
+	vector<char> leaf;     // leaf[i]=true <=> ys[i] cannot be bisected
+
+	while (!l.empty()) {
+		ys.clear();
+		leaf.clear();
+
+		// get and immediately bisect the domains of parameters
+		while (!l.empty() && (int) ys.size()<pool->size()) {
+			try {
+				pair<IntervalVector,IntervalVector> cut = bsc->bisect(l.top());
+				l.pop();
+				ys.push_back(cut.first);
+				ys.push_back(cut.second);
+				leaf.push_back(false);
+				leaf.push_back(false);
+			} catch(NoBisectableVariableException& e) {
+				ys.push_back(l.top());
+				l.pop();
+				leaf.push_back(true);
+			}
+		}
+
+		if (cache) {
+			size_t j=0;
+			for (size_t i=0; i<ys.size(); i++) {
+				if (!cache->contains(ys[i])) {
+					ys[j]=ys[i];
+					leaf[j++]=leaf[i];
+				}
+			}
+			ys.resize(j);
+			leaf.resize(j);
+		}
+
+		int n=(int) ys.size();
+		vector<IntervalVector> xs(n, box);
+		vector<char> bisect(n);
+		vector<char> inactive(n);
+		bool prove = is_inactive || cache;
+
+		pool->run(n, [&](int i, int thread) {
+			bool in;
+			bisect[i] = contract_y(xs[i], ys[i], prove, in, thread);
+			inactive[i] = in;
+		});
+
+		for (int i=0; i<n; i++) {
+			box &= xs[i];
+			if (box.is_empty()) throw ForAllEmptyBox();
+
+			if (bisect[i]) {
+				if (leaf[i]) is_inactive = false;
+				else l.push(ys[i]);
+			} else {
+				is_inactive = is_inactive && inactive[i];
+				if (cache && inactive[i]) cache->add(ys[i]);
+			}
 		}
 	}
 }
@@ -68,10 +150,14 @@ void CtcForAll::contract(IntervalVector& box, ContractContext& context) {
 
 	assert(l.empty()); // old?--> when an exception is thrown by this function, l is flushed.
 
+	BxpQuantifCache* cache = CtcQuantif::cache(context);
+
 	l.push(y_init);
 
 	bool is_inactive = true;
 	try {
+		if (pool) parallel_contract(box, is_inactive, cache);
+
 		while (!l.empty()) {
 
 			// get and immediately bisect the domain of parameters (strategy inspired by Optimizer)
@@ -81,10 +167,10 @@ void CtcForAll::contract(IntervalVector& box, ContractContext& context) {
 				l.pop();
 
 				// proceed with the two sub-boxes for y
-				proceed(box, cut.first, is_inactive);
-				proceed(box, cut.second, is_inactive);
+				proceed(box, cut.first, is_inactive, cache);
+				proceed(box, cut.second, is_inactive, cache);
 			} catch(NoBisectableVariableException& e) { // e.g.: if y_init is degenerated
-				proceed(box, l.top(), is_inactive); // nothing should be pushed in the queue
+				proceed(box, l.top(), is_inactive, cache); // nothing should be pushed in the queue
 				l.pop();
 			}
 		}
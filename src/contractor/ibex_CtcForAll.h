@@ -66,11 +66,31 @@ private:
 	 * Function call by contract to proceed a pair (x,y).
 	 *
 	 * The overall result x is updated and, if large enough, y is pushed in the list "l".
+	 * If y is in the cache, nothing is done.
 	 *
-	 * \param x:   the current box "x". Corresponds, at the end, to the result of the contraction
-	 * \param y:   the current box "y"
+	 * \param x:     the current box "x". Corresponds, at the end, to the result of the contraction
+	 * \param y:     the current box "y"
+	 * \param cache: the parameter boxes proven inactive (NULL if none)
 	 */
-	void proceed(IntervalVector& x, const IntervalVector& y, bool& is_inactive);
+	void proceed(IntervalVector& x, const IntervalVector& y, bool& is_inactive, BxpQuantifCache* cache);
+
+	/**
+	 * Contract x with the midpoint of y and, if y is small enough and
+	 * "prove" is true, try to prove that c(x,y) holds on [x]x[y] ("inactive").
+	 *
+	 * Return true if y must be bisected further.
+	 */
+	bool contract_y(IntervalVector& x, const IntervalVector& y, bool prove, bool& inactive, int thread);
+
+	/**
+	 * Multi-threaded variant of the loop of contract (see #set_nb_threads).
+	 *
+	 * The stack is processed by rounds: boxes are popped and bisected until there
+	 * is one sub-box per thread, [x] is contracted with all the sub-boxes in parallel
+	 * and the results are intersected. The result may be slightly less contracted than
+	 * with the sequential loop, where each contraction starts from the previous one.
+	 */
+	void parallel_contract(IntervalVector& x, bool& is_inactive, BxpQuantifCache* cache);
 
 	/**
 	 * Stack of y
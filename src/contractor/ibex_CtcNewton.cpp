@@ -10,11 +10,13 @@
 
 #include "ibex_CtcNewton.h"
 #include "ibex_Exception.h"
+#include "ibex_BxpNewtonPrecond.h"
+#include "ibex_Id.h"
 
 namespace ibex {
 
 CtcNewton::CtcNewton(const Fnc& f, double ceil, double prec, double ratio) :
-		Ctc(f.nb_var()), f(f), vars(NULL), ceil(ceil), prec(prec), gauss_seidel_ratio(ratio) {
+		Ctc(f.nb_var()), f(f), vars(NULL), ceil(ceil), prec(prec), gauss_seidel_ratio(ratio), precond_id(next_bxp_id()) {
 
 	if (f.nb_var()!=f.image_dim()) {
 		not_implemented("Newton operator with rectangular systems.");
@@ -22,13 +24,18 @@ CtcNewton::CtcNewton(const Fnc& f, double ceil, double prec, double ratio) :
 }
 
 CtcNewton::CtcNewton(const Fnc& f, const VarSet& vars, double ceil, double prec, double ratio) :
-		Ctc(f.nb_var()), f(f), vars(&vars), ceil(ceil), prec(prec), gauss_seidel_ratio(ratio) {
+		Ctc(f.nb_var()), f(f), vars(&vars), ceil(ceil), prec(prec), gauss_seidel_ratio(ratio), precond_id(next_bxp_id()) {
 
 	if (vars.nb_var!=f.image_dim()) {
 		not_implemented("Newton operator with rectangular systems.");
 	}
 }
 
+void CtcNewton::add_property(const IntervalVector& init_box, BoxProperties& map) {
+	if (!((const BoxProperties&) map)[precond_id])
+		map.add(new BxpNewtonPrecond(precond_id, vars? vars->nb_var : f.nb_var()));
+}
+
 void CtcNewton::contract(IntervalVector& box) {
 	ContractContext context(box);
 	contract(box,context);
@@ -37,10 +44,29 @@ void CtcNewton::contract(IntervalVector& box) {
 void CtcNewton::contract(IntervalVector& box, ContractContext& context) {
 	if (!(box.max_diam()<=ceil)) return;
 	else {
-		if (!vars)
-			newton(f,box,prec,gauss_seidel_ratio);
-		else
-			newton(f,*vars,box,prec,gauss_seidel_ratio);
+		// read-only access: the preconditioner may be shared with other boxes
+		const BxpNewtonPrecond* p=(const BxpNewtonPrecond*) ((const BoxProperties&) context.prop)[precond_id];
+
+		if (p) {
+			const Matrix* C=p->valid? &p->C : NULL;
+
+			// the property is duplicated (if shared) only when C is recomputed
+			std::function<void(const Matrix&)> store=[&](const Matrix& C2) {
+				BxpNewtonPrecond* q=(BxpNewtonPrecond*) context.prop[precond_id];
+				q->C=C2;
+				q->valid=true;
+			};
+
+			if (!vars)
+				newton(f,box,C,store,prec,gauss_seidel_ratio);
+			else
+				newton(f,*vars,box,C,store,prec,gauss_seidel_ratio);
+		} else {
+			if (!vars)
+				newton(f,box,prec,gauss_seidel_ratio);
+			else
+				newton(f,*vars,box,prec,gauss_seidel_ratio);
+		}
 	}
 
 	if (box.is_empty()) {
@@ -46,11 +46,26 @@ public:
 			double prec=default_newton_prec,
 			double ratio=default_gauss_seidel_ratio);
 
+	/**
+	 * \brief Add BxpNewtonPrecond to the properties.
+	 *
+	 * The preconditioner calculated in a box is then reused
+	 * in the sub-boxes as long as it yields a contracting step
+	 * (see #ibex::newton(const Fnc&, IntervalVector&, Matrix&, bool&, double, double)).
+	 */
+	virtual void add_property(const IntervalVector& init_box, BoxProperties& map);
+
 	/**
 	 * \brief Contract a box.
 	 */
 	void contract(IntervalVector& box);
 
+	/**
+	 * \brief Contract a box with associated properties.
+	 *
+	 * Uses the cached preconditioner (BxpNewtonPrecond) if
+	 * it is present in the context.
+	 */
 	void contract(IntervalVector& box, ContractContext& context);
 
 	/** The function. */
@@ -74,6 +89,9 @@ public:
 	/** Initialized to 0.01 */
 	static constexpr double default_ceil = 0.01;
 
+	/** Identifying number of the BxpNewtonPrecond property. */
+	const long precond_id;
+
 };
 
 } // end namespace ibex
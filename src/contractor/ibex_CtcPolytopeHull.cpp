@@ -12,6 +12,8 @@
 
 #include "ibex_LinearizerFixed.h"
 
+#include <mutex>
+
 using namespace std;
 
 namespace ibex {
@@ -20,6 +22,16 @@ namespace {
 
 class PolytopeHullEmptyBoxException { };
 
+/*
+ * True if x is equal to the bound b, with the relative
+ * precision of the indicators (see choose_next_variable).
+ */
+bool on_bound(double x, double b) {
+	double prec_bound = 1.e-8; // relative precision for the indicators      :  compatibility for testing  BNE
+	double delta = fabs(x-b);
+	return (fabs(b) < 1 && delta < prec_bound) || (fabs(b) >= 1 && fabs(delta/b) < prec_bound);
+}
+
 }
 
 #ifndef  _IBEX_WITH_NOLP_
@@ -28,8 +40,8 @@ CtcPolytopeHull::CtcPolytopeHull(Linearizer& lr, int max_iter, int time_out, dou
 		Ctc(lr.nb_var()), lr(lr),
 		limit_diam_box(eps>limit_diam.lb()? eps : limit_diam.lb(), limit_diam.ub()),
 		mylinearsolver(nb_var, max_iter, time_out, eps),
-		contracted_vars(BitSet::all(nb_var)), own_lr(false), primal_sols(2*nb_var, nb_var),
-		primal_sol_found(2*nb_var) {
+		contracted_vars(BitSet::all(nb_var)), own_lr(false), max_iter(max_iter), time_out(time_out),
+		pool(NULL), primal_sols(2*nb_var, nb_var), primal_sol_found(2*nb_var) {
 
 }
 
@@ -37,13 +49,32 @@ CtcPolytopeHull::CtcPolytopeHull(const Matrix& A, const Vector& b, int max_iter,
 		Ctc(A.nb_cols()), lr(*new LinearizerFixed(A,b)),
 		limit_diam_box(eps>limit_diam.lb()? eps : limit_diam.lb(), limit_diam.ub()),
 		mylinearsolver(nb_var, max_iter, time_out, eps),
-		contracted_vars(BitSet::all(nb_var)), own_lr(true), primal_sols(2*nb_var, nb_var),
-		primal_sol_found(2*nb_var) {
+		contracted_vars(BitSet::all(nb_var)), own_lr(true), max_iter(max_iter), time_out(time_out),
+		pool(NULL), primal_sols(2*nb_var, nb_var), primal_sol_found(2*nb_var) {
 
 }
 
 CtcPolytopeHull::~CtcPolytopeHull() {
 	if (own_lr) delete &lr;
+	set_nb_threads(1);
+}
+
+void CtcPolytopeHull::set_nb_threads(int n) {
+	if (n<=0) n=ThreadPool::hardware_threads();
+
+	if (pool) {
+		delete pool;
+		pool=NULL;
+		for (vector<LPSolver*>::iterator it=thread_solvers.begin(); it!=thread_solvers.end(); ++it)
+			delete *it;
+		thread_solvers.clear();
+	}
+
+	if (n>1) {
+		pool=new ThreadPool(n);
+		for (int t=1; t<n; t++)
+			thread_solvers.push_back(new LPSolver(nb_var, max_iter, time_out, mylinearsolver.get_epsilon()));
+	}
 }
 
 void CtcPolytopeHull::add_property(const IntervalVector& init_box, BoxProperties& map) {
@@ -63,6 +94,10 @@ void CtcPolytopeHull::contract(IntervalVector& box, ContractContext& context) {
 	//cout << "[polytope-hull] box before LR (linear relaxation): " << box << endl;
 
 	try {
+		// The constraints of the previous call are not removed from the LP
+		// model: they are overwritten by the new ones (see LPSolver::clean_ctrs),
+		// which allows the LP solver to start from the last optimal basis.
+		mylinearsolver.clean_ctrs();
 
 		//returns the number of constraints in the linearized system
 		int cont = lr.linearize(box, mylinearsolver, context.prop);
@@ -73,19 +108,18 @@ void CtcPolytopeHull::contract(IntervalVector& box, ContractContext& context) {
 
 		if (cont==0) return;
 
-		optimizer(box);
+		if (pool)
+			parallel_optimizer(box);
+		else
+			optimizer(box);
 
 		//mylinearsolver.writeFile("LP.lp");
 		//system ("cat LP.lp");
 		//cout << "[polytope-hull] box after LR: " << box << endl;
-		mylinearsolver.clean_ctrs();
-	}
-	catch(LPException&) {
-		mylinearsolver.clean_ctrs();
 	}
+	catch(LPException&) { }
 	catch(PolytopeHullEmptyBoxException& e) {
 		box.set_empty(); // empty the box before exiting
-		mylinearsolver.clean_ctrs();
 	}
 
 	context.prop.update(BoxEvent(box,BoxEvent::CONTRACT));
@@ -232,6 +266,95 @@ void CtcPolytopeHull::optimizer(IntervalVector& box) {
 	delete[] sup_bound;
 }
 
+void CtcPolytopeHull::parallel_optimizer(IntervalVector& box) {
+
+	int nb_threads=pool->size();
+
+	// same indicators as in optimizer()
+	vector<int> inf_bound(nb_var);
+	vector<int> sup_bound(nb_var);
+
+	for (int i=0; i<nb_var; i++) {
+		inf_bound[i]=sup_bound[i]=contracted_vars[i]? 0 : 1;
+	}
+
+	// copy the linear relaxation in the LP solvers of the threads
+	pool->run(nb_threads-1, [this](int t, int) {
+		thread_solvers[t]->copy_ctrs(mylinearsolver);
+	});
+
+	std::mutex mutex;   // protects box, the indicators and the primal solutions
+	int next=0;         // next LP, in the order: min x1, max x1, min x2, ...
+	bool stop=false;
+	bool empty=false;
+
+	pool->run(nb_threads, [&](int, int t) {
+
+		LPSolver& lp=t==0? mylinearsolver : *thread_solvers[t-1];
+		IntervalVector bounds(nb_var);
+
+		while (true) {
+			int i;
+			bool left;
+			{
+				std::lock_guard<std::mutex> lock(mutex);
+
+				while (next<2*nb_var && (next%2==0? inf_bound[next/2] : sup_bound[next/2])) next++;
+
+				if (stop || next==2*nb_var) return;
+
+				i=next/2;
+				left=(next%2==0);
+				(left? inf_bound[i] : sup_bound[i])=1;
+				next++;
+				bounds=box; // the last contracted bounds
+			}
+
+			lp.set_bounds(bounds);
+
+			Interval opt;
+			LPSolver::Status_Sol stat=lp.solve_var(left? LPSolver::MINIMIZE : LPSolver::MAXIMIZE, i, opt);
+
+			std::lock_guard<std::mutex> lock(mutex);
+
+			if (stop) return;
+
+			if (stat == LPSolver::OPTIMAL_PROVED) {
+
+				if (left? opt.lb()>box[i].ub() : opt.ub()<box[i].lb()) {
+					stop=empty=true;
+					return;
+				}
+
+				int k=left? 2*i : 2*i+1;
+				primal_sols[k]=lp.get_primal_sol();
+				primal_sol_found.add(k);
+
+				if (left && opt.lb()>box[i].lb())
+					box[i]=Interval(opt.lb(),box[i].ub());
+				else if (!left && opt.ub()<box[i].ub())
+					box[i]=Interval(box[i].lb(),opt.ub());
+
+				// the bounds reached by the primal solution cannot be contracted
+				const Vector& x=primal_sols[k];
+				for (int j=0; j<nb_var; j++) {
+					if (inf_bound[j]==0 && on_bound(x[j],box[j].lb())) inf_bound[j]=1;
+					if (sup_bound[j]==0 && on_bound(x[j],box[j].ub())) sup_bound[j]=1;
+				}
+			}
+			else if (stat == LPSolver::INFEASIBLE_PROVED) {
+				stop=empty=true;
+			}
+			else if (stat == LPSolver::INFEASIBLE) {
+				// the infeasibility is found but not proved, no other call is needed
+				stop=true;
+			}
+		}
+	});
+
+	if (empty) throw PolytopeHullEmptyBoxException();
+}
+
 bool CtcPolytopeHull::choose_next_variable(IntervalVector & box, int & nexti, int & infnexti, int* inf_bound, int* sup_bound) {
 
 	bool found = false;
@@ -246,7 +369,7 @@ bool CtcPolytopeHull::choose_next_variable(IntervalVector & box, int & nexti, in
 		// called only when a primal solution is found by the LP solver (use of primal_solution)
 
 		// double prec_bound = mylinearsolver.getEpsilon(); // relative precision for the indicators TODO change with the precision of the optimizer ??
-		double prec_bound = 1.e-8; // relative precision for the indicators      :  compatibility for testing  BNE
+		// (the relative precision for the indicators is in on_bound)
 		double delta=1.e100;
 		double deltaj=delta;
 
@@ -254,8 +377,7 @@ bool CtcPolytopeHull::choose_next_variable(IntervalVector & box, int & nexti, in
 
 			if (inf_bound[j]==0) {
 				deltaj= fabs(primal_solution[j]- box[j].lb());
-				if ((fabs (box[j].lb()) < 1 && deltaj < prec_bound) ||
-						(fabs (box[j].lb()) >= 1 && fabs (deltaj /(box[j].lb())) < prec_bound))	{
+				if (on_bound(primal_solution[j], box[j].lb())) {
 					inf_bound[j]=1;
 				}
 				if (inf_bound[j]==0 && deltaj < delta) 	{
@@ -266,9 +388,7 @@ bool CtcPolytopeHull::choose_next_variable(IntervalVector & box, int & nexti, in
 			if (sup_bound[j]==0) {
 				deltaj = fabs (primal_solution[j]- box[j].ub());
 
-
-				if ((fabs (box[j].ub()) < 1 && deltaj < prec_bound) 	||
-						(fabs (box[j].ub()) >= 1 && fabs (deltaj/(box[j].ub())) < prec_bound)) {
+				if (on_bound(primal_solution[j], box[j].ub())) {
 					sup_bound[j]=1;
 				}
 				if (sup_bound[j]==0 && deltaj < delta) {
@@ -307,6 +427,8 @@ CtcPolytopeHull::~CtcPolytopeHull() { }
 
 void CtcPolytopeHull::set_contracted_vars(const BitSet& vars) { }
 
+void CtcPolytopeHull::set_nb_threads(int n) { }
+
 void CtcPolytopeHull::contract(IntervalVector& box) { }
 
 #endif /// end _IBEX_WITH_NOLP_
@@ -15,6 +15,9 @@
 #include "ibex_Ctc.h"
 #include "ibex_LPSolver.h"
 #include "ibex_BitSet.h"
+#include "ibex_ThreadPool.h"
+
+#include <vector>
 
 namespace ibex {
 
@@ -90,6 +93,19 @@ public:
 	 */
 	void set_contracted_vars(const BitSet& vars);
 
+	/**
+	 * \brief Solve the 2n LPs with several threads.
+	 *
+	 * Each thread has its own LP solver, where the linear relaxation
+	 * is copied. The bounds contracted and the primal solutions found
+	 * by one thread are shared with the other threads, so that the LPs
+	 * that cannot contract the box are still skipped (see #choose_next_variable).
+	 *
+	 * \param n - number of threads. 1 (the default) means sequential;
+	 *            n<=0 means the number of hardware threads.
+	 */
+	void set_nb_threads(int n);
+
 	/**
 	 * \brief Return the argmin of one LP problem
 	 *
@@ -119,6 +135,11 @@ protected:
 	 */
 	void optimizer(IntervalVector &box);
 
+	/**
+	 * Multi-threaded variant of optimizer (see #set_nb_threads).
+	 */
+	void parallel_optimizer(IntervalVector &box);
+
 	/**
 	 * \brief The linearization technique
 	 */
@@ -142,6 +163,19 @@ protected:
 private:
 	bool own_lr; // for memory cleanup
 
+	/*
+	 * Parameters of the LP solver (for the solvers of the threads)
+	 */
+	int max_iter;
+	int time_out;
+
+	/*
+	 * The threads (NULL if sequential) and their LP solvers
+	 * (the thread n°0 uses mylinearsolver).
+	 */
+	ThreadPool* pool;
+	std::vector<LPSolver*> thread_solvers;
+
 	/*
 	 * 2*n primal solutions (row by row).
 	 * The argmin of minimizing xi is at the (2*i)th row
@@ -0,0 +1,171 @@
+/* ============================================================================
+ * I B E X - Contractor profiler
+ * ============================================================================
+ * Copyright   : IMT Atlantique (FRANCE)
+ * License     : This program can be distributed under the terms of the GNU LGPL.
+ *               See the file COPYING.LESSER.
+ *
+ * Author(s)   : Gilles Chabert
+ * Created     : Oct 17, 2026
+ * ---------------------------------------------------------------------------- */
+
+#include "ibex_CtcProfiler.h"
+
+#include <typeinfo>
+#include <chrono>
+#include <cmath>
+#include <iomanip>
+#include <algorithm>
+#ifdef __GNUG__
+#include <cxxabi.h>
+#include <cstdlib>
+#endif
+
+using namespace std;
+
+namespace ibex {
+
+namespace {
+
+// depth of the current call (in the current thread)
+thread_local int current_depth=0;
+
+// diameters of the box before the current call at each depth (in the current thread)
+thread_local vector<vector<double> > diam_buffers;
+
+bool first_call_order(const pair<const Ctc*,CtcProfiler::Entry>* e1, const pair<const Ctc*,CtcProfiler::Entry>* e2) {
+	return e1->second.first_call < e2->second.first_call;
+}
+
+string class_name(const Ctc& c) {
+	const char* name=typeid(c).name();
+#ifdef __GNUG__
+	int status;
+	char* s=abi::__cxa_demangle(name, NULL, NULL, &status);
+	if (status==0) {
+		string res(s);
+		free(s);
+		if (res.compare(0,6,"ibex::")==0) res=res.substr(6);
+		return res;
+	}
+#endif
+	return name;
+}
+
+}
+
+CtcProfiler::CtcProfiler() : nb_started(0) {
+
+}
+
+void CtcProfiler::record(Ctc& c, IntervalVector& box, ContractContext& context) {
+
+	int depth=current_depth++;
+
+	// rank of the call, so that entries can be listed in the order of first calls
+	unsigned long rank=nb_started.fetch_add(1, std::memory_order_relaxed);
+
+	// box may be modified (copy of the diameters in the buffer of this depth)
+	if ((int) diam_buffers.size()<=depth) diam_buffers.resize(depth+1);
+	diam_buffers[depth].resize(box.size());
+	for (int j=0; j<box.size(); j++)
+		diam_buffers[depth][j]=box[j].diam();
+
+	chrono::steady_clock::time_point start=chrono::steady_clock::now();
+
+	try {
+		c.contract(box, context);
+	} catch(...) {
+		current_depth--;
+		throw;
+	}
+
+	double t=chrono::duration<double>(chrono::steady_clock::now()-start).count();
+
+	current_depth--;
+
+	bool empty=box.is_empty();
+
+	double reduction=0;
+	if (!empty) {
+		// note: the buffers may have been moved by the sub-calls
+		const vector<double>& diam=diam_buffers[depth];
+		for (int j=0; j<box.size(); j++) {
+			double d=box[j].diam();
+			if (diam[j]<POS_INFINITY && d>0)
+				reduction += ::log(diam[j]/d);
+		}
+	}
+
+	lock_guard<std::mutex> lock(mutex);
+
+	map<const Ctc*,int>::iterator it=index.find(&c);
+	if (it==index.end()) {
+		index[&c]=(int) entries.size();
+		Entry e = { class_name(c), depth, 0, 0, 0.0, 0.0, rank };
+		entries.push_back(make_pair(&c,e));
+		it=index.find(&c);
+	}
+
+	Entry& e=entries[it->second].second;
+	if (rank<e.first_call) {
+		// an earlier call has terminated after this one
+		e.first_call=rank;
+		e.depth=depth;
+	}
+	e.nb_calls++;
+	if (empty) e.nb_empty++;
+	e.time += t;
+	e.log_vol_reduction += reduction;
+}
+
+const CtcProfiler::Entry* CtcProfiler::operator[](const Ctc& c) const {
+	lock_guard<std::mutex> lock(mutex);
+	map<const Ctc*,int>::const_iterator it=index.find(&c);
+	return it==index.end() ? NULL : &entries[it->second].second;
+}
+
+int CtcProfiler::size() const {
+	lock_guard<std::mutex> lock(mutex);
+	return (int) entries.size();
+}
+
+void CtcProfiler::clear() {
+	lock_guard<std::mutex> lock(mutex);
+	entries.clear();
+	index.clear();
+}
+
+void CtcProfiler::report(ostream& os) const {
+	lock_guard<std::mutex> lock(mutex);
+
+	streamsize prec=os.precision();
+
+	os << " contractor profile:" << endl;
+	os << "   " << left << setw(40) << "contractor"
+	   << right << setw(12) << "calls"
+	   << setw(12) << "empty"
+	   << setw(12) << "time(s)"
+	   << setw(14) << "log-vol red." << endl;
+
+	// entries are created in the order of the end of the first calls
+	vector<const pair<const Ctc*,Entry>*> sorted;
+	for (vector<pair<const Ctc*,Entry> >::const_iterator it=entries.begin(); it!=entries.end(); ++it)
+		sorted.push_back(&*it);
+	stable_sort(sorted.begin(), sorted.end(), first_call_order);
+
+	for (vector<const pair<const Ctc*,Entry>*>::const_iterator it=sorted.begin(); it!=sorted.end(); ++it) {
+		const Entry& e=(*it)->second;
+		string name=string(2*e.depth,' ')+e.name;
+		os << "   " << left << setw(40) << name
+		   << right << setw(12) << e.nb_calls
+		   << setw(12) << e.nb_empty
+		   << setw(12) << setprecision(4) << e.time
+		   << setw(14) << setprecision(4) << e.log_vol_reduction << endl;
+	}
+	os << endl;
+
+	os.precision(prec);
+}
+
+} // namespace ibex
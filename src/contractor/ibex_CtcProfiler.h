@@ -0,0 +1,140 @@
+/* ============================================================================
+ * I B E X - Contractor profiler
+ * ============================================================================
+ * Copyright   : IMT Atlantique (FRANCE)
+ * License     : This program can be distributed under the terms of the GNU LGPL.
+ *               See the file COPYING.LESSER.
+ *
+ * Author(s)   : Gilles Chabert
+ * Created     : Oct 17, 2026
+ * ---------------------------------------------------------------------------- */
+
+#ifndef __IBEX_CTC_PROFILER_H__
+#define __IBEX_CTC_PROFILER_H__
+
+#include "ibex_Ctc.h"
+
+#include <map>
+#include <vector>
+#include <string>
+#include <mutex>
+#include <atomic>
+#include <iostream>
+
+namespace ibex {
+
+/**
+ * \ingroup contractor
+ *
+ * \brief Contractor profiler.
+ *
+ * Records, for each contractor instance, the number of calls, the
+ * wall time, the number of calls that resulted in an empty box and
+ * the reduction of the log-volume of the box.
+ *
+ * The profiler is enabled by setting the #ContractContext::profiler
+ * field of the context given to the root contractor (see, e.g.,
+ * #Solver::profiler). The field is inherited by the contexts of the
+ * sub-contractors. Only the calls made through #CtcProfiler::contract(Ctc&, IntervalVector&, ContractContext&)
+ * are recorded; this is what composite contractors (CtcCompo, CtcFixPoint,
+ * CtcPropag) do. When the profiler is disabled, the overhead is a
+ * pointer test.
+ *
+ * The time of a contractor includes the time of its sub-contractors.
+ *
+ * The log-volume reduction of a call is the sum of log(d/d') where
+ * d and d' are the diameters of a component before and after contraction.
+ * Components with infinite diameter before or null diameter after contraction
+ * are ignored. Calls resulting in an empty box are not counted in this sum.
+ *
+ * Can be shared by several threads.
+ */
+class CtcProfiler {
+public:
+	/**
+	 * \brief Statistics of a contractor.
+	 */
+	struct Entry {
+		/** The contractor (class) name. */
+		std::string name;
+		/** Depth of the contractor in the tree (at its first call) */
+		int depth;
+		/** Number of calls */
+		unsigned long nb_calls;
+		/** Number of calls returning an empty box. */
+		unsigned long nb_empty;
+		/** Cumulated wall time (in seconds) */
+		double time;
+		/** Cumulated log-volume reduction. */
+		double log_vol_reduction;
+		/** Rank of the first call (calls are numbered in the order they start). */
+		unsigned long first_call;
+	};
+
+	/**
+	 * \brief Create an empty profiler.
+	 */
+	CtcProfiler();
+
+	/**
+	 * \brief Call c.contract(box,context).
+	 *
+	 * The call is recorded if context.profiler is not NULL.
+	 */
+	static void contract(Ctc& c, IntervalVector& box, ContractContext& context);
+
+	/**
+	 * \brief Statistics of a contractor.
+	 *
+	 * \return NULL if c has never been called. The pointer
+	 *         is invalidated by the next recorded call.
+	 */
+	const Entry* operator[](const Ctc& c) const;
+
+	/**
+	 * \brief Number of contractors recorded.
+	 */
+	int size() const;
+
+	/**
+	 * \brief Reset all the statistics.
+	 *
+	 * Must not be called during a contraction.
+	 */
+	void clear();
+
+	/**
+	 * \brief Print the statistics.
+	 *
+	 * The contractors are listed in the order of their first
+	 * call, and indented according to their depth.
+	 */
+	void report(std::ostream& os=std::cout) const;
+
+protected:
+	void record(Ctc& c, IntervalVector& box, ContractContext& context);
+
+	/** Entries (in the order the first calls terminate). */
+	std::vector<std::pair<const Ctc*,Entry> > entries;
+
+	/** Index of a contractor in "entries". */
+	std::map<const Ctc*,int> index;
+
+	/** Number of calls started so far (gives the rank of a call). */
+	std::atomic<unsigned long> nb_started;
+
+	mutable std::mutex mutex;
+};
+
+/*================================== inline implementations ========================================*/
+
+inline void CtcProfiler::contract(Ctc& c, IntervalVector& box, ContractContext& context) {
+	if (context.profiler)
+		context.profiler->record(c, box, context);
+	else
+		c.contract(box, context);
+}
+
+} // namespace ibex
+
+#endif // __IBEX_CTC_PROFILER_H__
@@ -10,29 +10,84 @@
  * ---------------------------------------------------------------------------- */
 
 #include "ibex_CtcPropag.h"
+#include "ibex_CtcProfiler.h"
 #include "ibex_Cell.h"
 #include "ibex_Bsc.h"
 
+#include <chrono>
+
 using namespace std;
 
 namespace ibex {
 
+namespace {
+
+// weight of the past calls in the score of a contractor
+const double score_decay = 0.9;
+
+}
+
 CtcPropag::CtcPropag(const Array<Ctc>& cl, double ratio, bool incremental) :
 		  Ctc(cl), list(cl), ratio(ratio), incremental(incremental),
-		  accumulate(false), g(cl.size(), nb_var), agenda(cl.size()),
-		  active(BitSet::empty(cl.size())) {
+		  accumulate(false), priority(false), cutoff(0), g(cl.size(), nb_var, arcs(cl,true), arcs(cl,false)),
+		  agenda(cl.size()), active(BitSet::empty(cl.size())), old_box(nb_var),
+		  prio_agenda(cl.size()), score_gain(cl.size(),0.0), score_time(cl.size(),0.0),
+		  best_score(0), before(nb_var) {
 
 	assert(check_nb_var_ctc_list(cl));
 
-	for (int i=0; i<list.size(); i++)
-		for (int j=0; j<nb_var; j++) {
-			if (list[i].input && (*list[i].input)[j]) g.add_arc(i,j,true);
-			if (list[i].input && (*list[i].output)[j]) g.add_arc(i,j,false);
-		}
-
 	//cout << g << endl;
 }
 
+vector<pair<int,int> > CtcPropag::arcs(const Array<Ctc>& cl, bool incoming) {
+	vector<pair<int,int> > a;
+	for (int i=0; i<cl.size(); i++) {
+		if (!cl[i].input) continue;
+		const BitSet& vars=incoming ? *cl[i].input : *cl[i].output;
+		for (int j=0; j<cl[i].nb_var; j++)
+			if (vars[j]) a.push_back(make_pair(i,j));
+	}
+	return a;
+}
+
+void CtcPropag::push(int c) {
+	if (priority)
+		prio_agenda.push(c, score(c));
+	else
+		agenda.push(c);
+}
+
+bool CtcPropag::pop(int& c) {
+	if (!priority) {
+		if (agenda.empty()) return false;
+		agenda.pop(c);
+		return true;
+	}
+
+	if (prio_agenda.empty()) return false;
+
+	// cut the low-yield tail
+	if (prio_agenda.first_priority() < cutoff*best_score) {
+		prio_agenda.flush();
+		return false;
+	}
+
+	prio_agenda.pop(c);
+	return true;
+}
+
+void CtcPropag::flush() {
+	if (priority)
+		prio_agenda.flush();
+	else
+		agenda.flush();
+}
+
+double CtcPropag::score(int c) const {
+	// a contractor never called has the highest priority
+	return score_time[c]==0 ? POS_INFINITY : score_gain[c]/score_time[c];
+}
+
 void CtcPropag::add_property(const IntervalVector& init_box, BoxProperties& map) {
 	for (int i=0; i<list.size(); i++)
 		list[i].add_property(init_box, map);
@@ -59,18 +114,16 @@ void CtcPropag::contract(IntervalVector& box, ContractContext& context) {
 
 		for (int i=0; i<nb_var; i++) {
 			if (context.impact[i]) {
-				set<int> ctrs=g.output_ctrs(i);
-				for (set<int>::iterator c=ctrs.begin(); c!=ctrs.end(); c++)
-					agenda.push(*c);
+				const int* ctrs=g.output_ctrs(i);
+				for (int k=0; k<g.nb_output_ctrs(i); k++)
+					push(ctrs[k]);
 			}
 		}
 	} else { // push all the contractors
 		for (int i=0; i<list.size(); i++)
-			agenda.push(i);
+			push(i);
 	}
 
-	BitSet input_impact(context.impact); // save (useful?)
-
 	/*
 	 * Now, context.impact is the impact of a call to a
 	 * subcontractor.
@@ -88,6 +141,8 @@ void CtcPropag::contract(IntervalVector& box, ContractContext& context) {
 	active.fill(0,list.size()-1);
 
 
+	best_score=0;
+
 	int c; // current contractor
 
 	/*
@@ -95,7 +150,7 @@ void CtcPropag::contract(IntervalVector& box, ContractContext& context) {
 	 * - variables domains before last propagation ("fine" propagation, accumulate=true)
 	 * - variables domains before last projection ("coarse" propagation, accumulate=false)
 	 */
-	IntervalVector old_box(box);
+	old_box=box;
 
 	//   VECTOR thres(_nb_var);        // threshold for propagation
 	//   for (int i=1; i<=_nb_var; i++) {
@@ -103,17 +158,16 @@ void CtcPropag::contract(IntervalVector& box, ContractContext& context) {
 	//     if (thres(i)<w) thres(i)=w;
 	//   }
 	//cout << "=========== Start propagation ==========" << endl;
-	while (!agenda.empty()) {
-
-		agenda.pop(c);
+	while (pop(c)) {
 
-		set<int> vars=g.output_vars(c);
+		const int* vars=g.output_vars(c);
+		int nb_vars=g.nb_output_vars(c);
 
 		// ===================== fine propagation =========================
 		// reset the old box to the current domains just before contraction
 		if (!accumulate) {
-			for (set<int>::iterator v=vars.begin(); v!=vars.end(); v++) {
-				old_box[*v] = box[*v];
+			for (int k=0; k<nb_vars; k++) {
+				old_box[vars[k]] = box[vars[k]];
 			}
 		}
 		// ================================================================
@@ -122,28 +176,46 @@ void CtcPropag::contract(IntervalVector& box, ContractContext& context) {
 
 		context.output_flags.clear();
 
-		list[c].contract(box, context);
+		chrono::steady_clock::time_point start;
+		if (priority) {
+			for (int k=0; k<nb_vars; k++)
+				before[vars[k]] = box[vars[k]];
+			start=chrono::steady_clock::now();
+		}
+
+		CtcProfiler::contract(list[c], box, context);
 
 		if (box.is_empty()) {
-			agenda.flush();
+			flush();
 			//cout << "=========== End propagation ==========" << endl;
 			//cout << "   empty!" << endl;
 			return;
 		}
 
+		if (priority) {
+			double gain=0;
+			for (int k=0; k<nb_vars; k++)
+				gain += before[vars[k]].ratiodelta(box[vars[k]]);
+			score_gain[c] = score_decay*score_gain[c] + gain;
+			score_time[c] = score_decay*score_time[c] +
+					chrono::duration<double,micro>(chrono::steady_clock::now()-start).count();
+			if (score_time[c]>0 && score(c)>best_score) best_score=score(c);
+		}
+
 		if (context.output_flags[INACTIVE]) {
 			active.remove(c);
 		}
 
-		for (set<int>::iterator it=vars.begin(); it!=vars.end(); it++) {
-			int v=*it;
+		for (int k=0; k<nb_vars; k++) {
+			int v=vars[k];
 			//cout << "   " << old_box[v] << " % " << box[v] << "   " << old_box[v].ratiodelta(box[v]) << endl;
 			//if (old_box[v].rel_distance(box[v])>=ratio) {
 			if (old_box[v].ratiodelta(box[v])>=ratio) {
-				set<int> ctrs=g.output_ctrs(v);
-				for (set<int>::iterator c2=ctrs.begin(); c2!=ctrs.end(); c2++) {
-					if ((c!=*c2 && active[*c2]) || (c==*c2 && !context.output_flags[FIXPOINT]))
-						agenda.push(*c2);
+				const int* ctrs=g.output_ctrs(v);
+				for (int l=0; l<g.nb_output_ctrs(v); l++) {
+					int c2=ctrs[l];
+					if ((c!=c2 && active[c2]) || (c==c2 && !context.output_flags[FIXPOINT]))
+						push(c2);
 				}
 				// ===================== coarse propagation =========================
 				// reset the old box to the current domains just after propagation
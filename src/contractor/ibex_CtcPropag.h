@@ -81,17 +81,56 @@ public:
 	/** Accumulate residual contractions? */
 	bool accumulate;
 
+	/**
+	 * Priority mode. If true, the contractors are popped by decreasing
+	 * score instead of FIFO order. The score of a contractor is the
+	 * reduction of the domains (see Interval::ratiodelta) per microsecond
+	 * it has produced in the previous calls (with more weight on the last ones).
+	 * Default value is false.
+	 */
+	bool priority;
+
+	/**
+	 * Cut-off of the priority mode. The propagation stops as soon as
+	 * the scores of all the contractors in the agenda are less
+	 * than cutoff times the best score observed during the propagation.
+	 * Default value is 0 (no cut-off).
+	 */
+	double cutoff;
+
 	/** Default ratio used by propagation, set to 0.1. */
 	static constexpr double default_ratio = 0.01;
 
 protected:
 
+	/* Push/pop a contractor in the agenda of the current mode */
+	void push(int c);
+	bool pop(int& c);
+	void flush();
+
+	/* Score of a contractor (priority mode) */
+	double score(int c) const;
+
+	/* Arcs (ctr,var) of the constraint network */
+	static std::vector<std::pair<int,int> > arcs(const Array<Ctc>& cl, bool incoming);
+
 	DirectedHyperGraph g; // constraint network (hypergraph)
 
 	Agenda agenda;        // propagation agenda
 
 	BitSet active;      // mark active sub-contractors
 
+	IntervalVector old_box; // domains before the last projection/propagation
+
+	PriorityAgenda prio_agenda;     // propagation agenda (priority mode)
+
+	std::vector<double> score_gain; // reductions produced by each contractor (priority mode)
+
+	std::vector<double> score_time; // running time of each contractor, in microseconds (priority mode)
+
+	double best_score;              // best score during the current propagation (priority mode)
+
+	IntervalVector before;          // domains just before the last contraction (priority mode)
 
 };
 
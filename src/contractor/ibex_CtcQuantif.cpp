@@ -9,6 +9,7 @@
 
 #include "ibex_CtcQuantif.h"
 #include "ibex_CtcFwdBwd.h"
+#include "ibex_Id.h"
 
 #include <cassert>
 
@@ -16,9 +17,9 @@ namespace ibex {
 
 
 CtcQuantif::CtcQuantif(const NumConstraint& ctr, const VarSet& _vars, const IntervalVector& init_box, double prec) :
-				Ctc(_vars.nb_var), y_init(init_box),
+				Ctc(_vars.nb_var), y_init(init_box), cache_id(next_bxp_id()),
 				ctc(new CtcFwdBwd(ctr)), bsc(new LargestFirst(prec)),
-				vars(_vars), prec(prec), _own_ctc(true) {
+				vars(_vars), prec(prec), pool(NULL), _own_ctc(true), ctr(&ctr) {
 
 	assert(vars.nb_var>0);
 	assert(vars.nb_param>0); // sure?
@@ -27,27 +28,88 @@ CtcQuantif::CtcQuantif(const NumConstraint& ctr, const VarSet& _vars, const Inte
 }
 
 CtcQuantif::CtcQuantif(Ctc& ctc, const VarSet& _vars, const IntervalVector& init_box, double prec, bool own_ctc) :
-			   Ctc(_vars.nb_var), y_init(init_box),
+			   Ctc(_vars.nb_var), y_init(init_box), cache_id(next_bxp_id()),
 			   ctc(&ctc), bsc(new LargestFirst(prec)),
-			   vars(_vars), prec(prec), _own_ctc(own_ctc) {
+			   vars(_vars), prec(prec), pool(NULL), _own_ctc(own_ctc), ctr(NULL) {
 
 	assert(ctc.nb_var==_vars.nb_var+_vars.nb_param);
 
 }
 
 CtcQuantif::~CtcQuantif(){
+	clear_threads();
 	if (_own_ctc) delete ctc;
 	delete bsc;
 }
 
+void CtcQuantif::clear_threads() {
+	if (pool) {
+		delete pool;
+		pool=NULL;
+	}
+
+	if (!thread_fncs.empty()) {
+		// the contractors have been built by set_nb_threads
+		for (size_t i=0; i<thread_ctcs.size(); i++) {
+			delete thread_ctcs[i];
+			delete thread_fncs[i];
+		}
+		thread_fncs.clear();
+	}
+
+	thread_ctcs.clear();
+}
+
+void CtcQuantif::set_nb_threads(int n) {
+	if (!ctr)
+		ibex_error("CtcQuantif: set_nb_threads requires a constraint (use set_thread_ctcs instead)");
+
+	clear_threads();
+
+	if (n<=0) n=ThreadPool::hardware_threads();
+
+	for (int i=1; i<n; i++) {
+		Function* f=new Function(ctr->f, Function::COPY);
+		thread_fncs.push_back(f);
+		thread_ctcs.push_back(new CtcFwdBwd(*f, ctr->op));
+	}
+
+	if (n>1)
+		pool=new ThreadPool(n);
+}
+
+void CtcQuantif::set_thread_ctcs(const Array<Ctc>& ctcs) {
+	clear_threads();
+
+	for (int i=0; i<ctcs.size(); i++) {
+		assert(ctcs[i].nb_var==ctc->nb_var);
+		thread_ctcs.push_back(&ctcs[i]);
+	}
+
+	if (ctcs.size()>0)
+		pool=new ThreadPool(1+ctcs.size());
+}
+
+void CtcQuantif::add_property(const IntervalVector& init_box, BoxProperties& map) {
+	if (!((const BoxProperties&) map)[cache_id])
+		map.add(new BxpQuantifCache(cache_id));
+}
+
+BxpQuantifCache* CtcQuantif::cache(ContractContext& context) const {
+	return (BxpQuantifCache*) context.prop[cache_id];
+}
 
 bool CtcQuantif::contract(IntervalVector& x, IntervalVector& y) {
+	return contract(x, y, 0);
+}
+
+bool CtcQuantif::contract(IntervalVector& x, IntervalVector& y, int thread) {
 	// create the full box by concatening x and y
 	IntervalVector fullbox = vars.full_box(x,y);
 
 	ContractContext slice_context(fullbox);
 
-	ctc->contract(fullbox, slice_context);
+	(thread==0 ? ctc : thread_ctcs[thread-1])->contract(fullbox, slice_context);
 
 	x=vars.var_box(fullbox);
 	y=vars.param_box(fullbox);
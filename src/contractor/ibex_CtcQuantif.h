@@ -16,6 +16,10 @@
 #include "ibex_NumConstraint.h"
 #include "ibex_BitSet.h"
 #include "ibex_VarSet.h"
+#include "ibex_ThreadPool.h"
+#include "ibex_BxpQuantifCache.h"
+
+#include <vector>
 
 namespace ibex {
 
@@ -63,11 +67,45 @@ public:
 	 */
 	virtual ~CtcQuantif();
 
+	/**
+	 * \brief Add the cache of discarded parameter boxes (see #BxpQuantifCache).
+	 */
+	virtual void add_property(const IntervalVector& init_box, BoxProperties& map);
+
+	/**
+	 * \brief Explore the parameter domain with n threads.
+	 *
+	 * Only for a contractor built from a constraint: each thread
+	 * contracts with its own copy of the constraint (evaluating a
+	 * function is not thread-safe). If n<=0, the number of hardware
+	 * threads is taken and n=1 makes the contractor sequential again.
+	 *
+	 * \see #set_thread_ctcs(const Array<Ctc>&) for a contractor built from a contractor.
+	 */
+	void set_nb_threads(int n);
+
+	/**
+	 * \brief Explore the parameter domain with several threads.
+	 *
+	 * The parameter boxes are processed on a pool of 1+ctcs.size() threads.
+	 * The calling thread uses the contractor given to the constructor and the
+	 * ith other thread uses ctcs[i]. Each ctcs[i] must be equivalent to this
+	 * contractor but must not share any function with it.
+	 *
+	 * An empty array makes the contractor sequential again.
+	 */
+	void set_thread_ctcs(const Array<Ctc>& ctcs);
+
 	/**
 	 * \brief Initial box of the parameters (can be set dynamically)
 	 */
 	IntervalVector y_init;
 
+	/**
+	 * \brief Identifying number of the cache property.
+	 */
+	const long cache_id;
+
 protected:
 	/**
 	 * \brief Contract the "full" box (x,y)
@@ -79,6 +117,16 @@ protected:
 	 */
 	bool contract(IntervalVector& x, IntervalVector& y);
 
+	/**
+	 * \brief Contract the "full" box (x,y) in a thread of #pool.
+	 */
+	bool contract(IntervalVector& x, IntervalVector& y, int thread);
+
+	/**
+	 * \brief The cache of the current box (NULL if none).
+	 */
+	BxpQuantifCache* cache(ContractContext& context) const;
+
 	/**
 	 * \brief The Contractor.
 	 */
@@ -100,10 +148,22 @@ protected:
 	 */
 	double prec;
 
+	/**
+	 * Threads (NULL if sequential) and their contractors.
+	 */
+	ThreadPool* pool;
+	std::vector<Ctc*> thread_ctcs;
+
 private:
+	void clear_threads();
 
 	/* Information for cleanup only */
 	bool _own_ctc;
+
+	/* Constraint (NULL if built from a contractor) and the
+	 * copies built by set_nb_threads. */
+	const NumConstraint* ctr;
+	std::vector<Function*> thread_fncs;
 };
 
 #ifdef __clang__
@@ -11,13 +11,17 @@
 #include "ibex_CtcUnion.h"
 #include "ibex_CtcFwdBwd.h"
 
+#include <atomic>
+
+using namespace std;
+
 namespace ibex {
 
-CtcUnion::CtcUnion(const Array<Ctc>& list) : Ctc(list), list(list), own_sys(NULL) {
+CtcUnion::CtcUnion(const Array<Ctc>& list) : Ctc(list), list(list), own_sys(NULL), pool(NULL) {
 
 }
 
-CtcUnion::CtcUnion(const System& sys) : Ctc(sys.nb_var), list(), own_sys(new NormalizedSystem(sys)) {
+CtcUnion::CtcUnion(const System& sys) : Ctc(sys.nb_var), list(), own_sys(new NormalizedSystem(sys)), pool(NULL) {
 
 	list.resize(own_sys->nb_ctr);
 
@@ -28,98 +32,98 @@ CtcUnion::CtcUnion(const System& sys) : Ctc(sys.nb_var), list(), own_sys(new Nor
 }
 
 CtcUnion::CtcUnion(Ctc& c1, Ctc& c2) :
-		Ctc(c1.nb_var),	list(Array<Ctc>(c1,c2)), own_sys(NULL) {
+		Ctc(c1.nb_var),	list(Array<Ctc>(c1,c2)), own_sys(NULL), pool(NULL) {
 	assert(check_nb_var_ctc_list(list));
 }
 
 CtcUnion::CtcUnion(Ctc& c1, Ctc& c2, Ctc& c3) :
-		Ctc(c1.nb_var),	list(Array<Ctc>(c1,c2,c3)), own_sys(NULL) {
+		Ctc(c1.nb_var),	list(Array<Ctc>(c1,c2,c3)), own_sys(NULL), pool(NULL) {
 	assert(check_nb_var_ctc_list(list));
 }
 
 
 CtcUnion::CtcUnion(Ctc& c1, Ctc& c2, Ctc& c3, Ctc& c4) :
-		Ctc(c1.nb_var),	list(Array<Ctc>(c1,c2,c3,c4)), own_sys(NULL) {
+		Ctc(c1.nb_var),	list(Array<Ctc>(c1,c2,c3,c4)), own_sys(NULL), pool(NULL) {
 	assert(check_nb_var_ctc_list(list));
 }
 
 CtcUnion::CtcUnion(Ctc& c1, Ctc& c2, Ctc& c3, Ctc& c4, Ctc& c5) :
-		Ctc(c1.nb_var),	list(Array<Ctc>(c1,c2,c3,c4,c5)), own_sys(NULL) {
+		Ctc(c1.nb_var),	list(Array<Ctc>(c1,c2,c3,c4,c5)), own_sys(NULL), pool(NULL) {
 	assert(check_nb_var_ctc_list(list));
 }
 
 CtcUnion::CtcUnion(Ctc& c1, Ctc& c2, Ctc& c3, Ctc& c4, Ctc& c5, Ctc& c6) :
-		Ctc(c1.nb_var),	list(Array<Ctc>(c1,c2,c3,c4,c5,c6)), own_sys(NULL) {
+		Ctc(c1.nb_var),	list(Array<Ctc>(c1,c2,c3,c4,c5,c6)), own_sys(NULL), pool(NULL) {
 	assert(check_nb_var_ctc_list(list));
 }
 
 CtcUnion::CtcUnion(Ctc& c1, Ctc& c2, Ctc& c3, Ctc& c4, Ctc& c5, Ctc& c6, Ctc& c7) :
-		Ctc(c1.nb_var),	list(Array<Ctc>(c1,c2,c3,c4,c5,c6,c7)), own_sys(NULL) {
+		Ctc(c1.nb_var),	list(Array<Ctc>(c1,c2,c3,c4,c5,c6,c7)), own_sys(NULL), pool(NULL) {
 	assert(check_nb_var_ctc_list(list));
 }
 
 CtcUnion::CtcUnion(Ctc& c1, Ctc& c2, Ctc& c3, Ctc& c4, Ctc& c5, Ctc& c6, Ctc& c7, Ctc& c8) :
-		Ctc(c1.nb_var),	list(Array<Ctc>(c1,c2,c3,c4,c5,c6,c7,c8)), own_sys(NULL) {
+		Ctc(c1.nb_var),	list(Array<Ctc>(c1,c2,c3,c4,c5,c6,c7,c8)), own_sys(NULL), pool(NULL) {
 	assert(check_nb_var_ctc_list(list));
 }
 
 CtcUnion::CtcUnion(Ctc& c1, Ctc& c2, Ctc& c3, Ctc& c4, Ctc& c5, Ctc& c6, Ctc& c7, Ctc& c8, Ctc& c9) :
-		Ctc(c1.nb_var),	list(Array<Ctc>(c1,c2,c3,c4,c5,c6,c7,c8,c9)), own_sys(NULL) {
+		Ctc(c1.nb_var),	list(Array<Ctc>(c1,c2,c3,c4,c5,c6,c7,c8,c9)), own_sys(NULL), pool(NULL) {
 	assert(check_nb_var_ctc_list(list));
 }
 
 CtcUnion::CtcUnion(Ctc& c1, Ctc& c2, Ctc& c3, Ctc& c4, Ctc& c5, Ctc& c6, Ctc& c7, Ctc& c8, Ctc& c9, Ctc& c10) :
-		Ctc(c1.nb_var),	list(Array<Ctc>(c1,c2,c3,c4,c5,c6,c7,c8,c9,c10)), own_sys(NULL) {
+		Ctc(c1.nb_var),	list(Array<Ctc>(c1,c2,c3,c4,c5,c6,c7,c8,c9,c10)), own_sys(NULL), pool(NULL) {
 	assert(check_nb_var_ctc_list(list));
 }
 
 CtcUnion::CtcUnion(Ctc& c1, Ctc& c2, Ctc& c3, Ctc& c4, Ctc& c5, Ctc& c6, Ctc& c7, Ctc& c8, Ctc& c9, Ctc& c10, Ctc& c11) :
-		Ctc(c1.nb_var),	list(Array<Ctc>(c1,c2,c3,c4,c5,c6,c7,c8,c9,c10,c11)), own_sys(NULL) {
+		Ctc(c1.nb_var),	list(Array<Ctc>(c1,c2,c3,c4,c5,c6,c7,c8,c9,c10,c11)), own_sys(NULL), pool(NULL) {
 	assert(check_nb_var_ctc_list(list));
 }
 
 CtcUnion::CtcUnion(Ctc& c1, Ctc& c2, Ctc& c3, Ctc& c4, Ctc& c5, Ctc& c6, Ctc& c7, Ctc& c8, Ctc& c9, Ctc& c10, Ctc& c11, Ctc& c12) :
-		Ctc(c1.nb_var),	list(Array<Ctc>(c1,c2,c3,c4,c5,c6,c7,c8,c9,c10,c11,c12)), own_sys(NULL) {
+		Ctc(c1.nb_var),	list(Array<Ctc>(c1,c2,c3,c4,c5,c6,c7,c8,c9,c10,c11,c12)), own_sys(NULL), pool(NULL) {
 	assert(check_nb_var_ctc_list(list));
 }
 
 CtcUnion::CtcUnion(Ctc& c1, Ctc& c2, Ctc& c3, Ctc& c4, Ctc& c5, Ctc& c6, Ctc& c7, Ctc& c8, Ctc& c9, Ctc& c10, Ctc& c11, Ctc& c12, Ctc& c13) :
-		Ctc(c1.nb_var),	list(Array<Ctc>(c1,c2,c3,c4,c5,c6,c7,c8,c9,c10,c11,c12,c13)), own_sys(NULL) {
+		Ctc(c1.nb_var),	list(Array<Ctc>(c1,c2,c3,c4,c5,c6,c7,c8,c9,c10,c11,c12,c13)), own_sys(NULL), pool(NULL) {
 	assert(check_nb_var_ctc_list(list));
 }
 
 CtcUnion::CtcUnion(Ctc& c1, Ctc& c2, Ctc& c3, Ctc& c4, Ctc& c5, Ctc& c6, Ctc& c7, Ctc& c8, Ctc& c9, Ctc& c10, Ctc& c11, Ctc& c12, Ctc& c13, Ctc& c14) :
-		Ctc(c1.nb_var),	list(Array<Ctc>(c1,c2,c3,c4,c5,c6,c7,c8,c9,c10,c11,c12,c13,c14)), own_sys(NULL) {
+		Ctc(c1.nb_var),	list(Array<Ctc>(c1,c2,c3,c4,c5,c6,c7,c8,c9,c10,c11,c12,c13,c14)), own_sys(NULL), pool(NULL) {
 	assert(check_nb_var_ctc_list(list));
 }
 
 CtcUnion::CtcUnion(Ctc& c1, Ctc& c2, Ctc& c3, Ctc& c4, Ctc& c5, Ctc& c6, Ctc& c7, Ctc& c8, Ctc& c9, Ctc& c10, Ctc& c11, Ctc& c12, Ctc& c13, Ctc& c14, Ctc& c15) :
-		Ctc(c1.nb_var),	list(Array<Ctc>(c1,c2,c3,c4,c5,c6,c7,c8,c9,c10,c11,c12,c13,c14,c15)), own_sys(NULL) {
+		Ctc(c1.nb_var),	list(Array<Ctc>(c1,c2,c3,c4,c5,c6,c7,c8,c9,c10,c11,c12,c13,c14,c15)), own_sys(NULL), pool(NULL) {
 	assert(check_nb_var_ctc_list(list));
 }
 
 CtcUnion::CtcUnion(Ctc& c1, Ctc& c2, Ctc& c3, Ctc& c4, Ctc& c5, Ctc& c6, Ctc& c7, Ctc& c8, Ctc& c9, Ctc& c10, Ctc& c11, Ctc& c12, Ctc& c13, Ctc& c14, Ctc& c15, Ctc& c16) :
-		Ctc(c1.nb_var),	list(Array<Ctc>(c1,c2,c3,c4,c5,c6,c7,c8,c9,c10,c11,c12,c13,c14,c15,c16)), own_sys(NULL) {
+		Ctc(c1.nb_var),	list(Array<Ctc>(c1,c2,c3,c4,c5,c6,c7,c8,c9,c10,c11,c12,c13,c14,c15,c16)), own_sys(NULL), pool(NULL) {
 	assert(check_nb_var_ctc_list(list));
 }
 
 CtcUnion::CtcUnion(Ctc& c1, Ctc& c2, Ctc& c3, Ctc& c4, Ctc& c5, Ctc& c6, Ctc& c7, Ctc& c8, Ctc& c9, Ctc& c10, Ctc& c11, Ctc& c12, Ctc& c13, Ctc& c14, Ctc& c15, Ctc& c16, Ctc& c17) :
-		Ctc(c1.nb_var),	list(Array<Ctc>(c1,c2,c3,c4,c5,c6,c7,c8,c9,c10,c11,c12,c13,c14,c15,c16,c17)), own_sys(NULL) {
+		Ctc(c1.nb_var),	list(Array<Ctc>(c1,c2,c3,c4,c5,c6,c7,c8,c9,c10,c11,c12,c13,c14,c15,c16,c17)), own_sys(NULL), pool(NULL) {
 	assert(check_nb_var_ctc_list(list));
 }
 
 CtcUnion::CtcUnion(Ctc& c1, Ctc& c2, Ctc& c3, Ctc& c4, Ctc& c5, Ctc& c6, Ctc& c7, Ctc& c8, Ctc& c9, Ctc& c10, Ctc& c11, Ctc& c12, Ctc& c13, Ctc& c14, Ctc& c15, Ctc& c16, Ctc& c17, Ctc& c18) :
-		Ctc(c1.nb_var),	list(Array<Ctc>(c1,c2,c3,c4,c5,c6,c7,c8,c9,c10,c11,c12,c13,c14,c15,c16,c17,c18)), own_sys(NULL) {
+		Ctc(c1.nb_var),	list(Array<Ctc>(c1,c2,c3,c4,c5,c6,c7,c8,c9,c10,c11,c12,c13,c14,c15,c16,c17,c18)), own_sys(NULL), pool(NULL) {
 	assert(check_nb_var_ctc_list(list));
 }
 
 CtcUnion::CtcUnion(Ctc& c1, Ctc& c2, Ctc& c3, Ctc& c4, Ctc& c5, Ctc& c6, Ctc& c7, Ctc& c8, Ctc& c9, Ctc& c10, Ctc& c11, Ctc& c12, Ctc& c13, Ctc& c14, Ctc& c15, Ctc& c16, Ctc& c17, Ctc& c18, Ctc& c19) :
-		Ctc(c1.nb_var),	list(Array<Ctc>(c1,c2,c3,c4,c5,c6,c7,c8,c9,c10,c11,c12,c13,c14,c15,c16,c17,c18,c19)), own_sys(NULL) {
+		Ctc(c1.nb_var),	list(Array<Ctc>(c1,c2,c3,c4,c5,c6,c7,c8,c9,c10,c11,c12,c13,c14,c15,c16,c17,c18,c19)), own_sys(NULL), pool(NULL) {
 	assert(check_nb_var_ctc_list(list));
 }
 
 CtcUnion::CtcUnion(Ctc& c1, Ctc& c2, Ctc& c3, Ctc& c4, Ctc& c5, Ctc& c6, Ctc& c7, Ctc& c8, Ctc& c9, Ctc& c10, Ctc& c11, Ctc& c12, Ctc& c13, Ctc& c14, Ctc& c15, Ctc& c16, Ctc& c17, Ctc& c18, Ctc& c19, Ctc& c20) :
-		Ctc(c1.nb_var),	list(Array<Ctc>(c1,c2,c3,c4,c5,c6,c7,c8,c9,c10,c11,c12,c13,c14,c15,c16,c17,c18,c19,c20)), own_sys(NULL) {
+		Ctc(c1.nb_var),	list(Array<Ctc>(c1,c2,c3,c4,c5,c6,c7,c8,c9,c10,c11,c12,c13,c14,c15,c16,c17,c18,c19,c20)), own_sys(NULL), pool(NULL) {
 	assert(check_nb_var_ctc_list(list));
 }
 
@@ -130,6 +134,19 @@ void CtcUnion::add_property(const IntervalVector& init_box, BoxProperties& map)
 
 CtcUnion::~CtcUnion() {
 	if (own_sys) delete own_sys;
+	if (pool) delete pool;
+}
+
+void CtcUnion::set_nb_threads(int n) {
+	if (n<=0) n=ThreadPool::hardware_threads();
+
+	if (pool) {
+		delete pool;
+		pool=NULL;
+	}
+
+	if (n>1)
+		pool=new ThreadPool(n);
 }
 
 void CtcUnion::contract(IntervalVector& box) {
@@ -138,6 +155,11 @@ void CtcUnion::contract(IntervalVector& box) {
 }
 
 void CtcUnion::contract(IntervalVector& box, ContractContext& context) {
+	if (pool && list.size()>1) {
+		parallel_contract(box,context);
+		return;
+	}
+
 	IntervalVector savebox(box);
 	IntervalVector result(IntervalVector::empty(box.size()));
 
@@ -154,6 +176,9 @@ void CtcUnion::contract(IntervalVector& box, ContractContext& context) {
 			context.output_flags.add(INACTIVE);
 			break;
 		}
+
+		// the other contractors cannot enlarge the result
+		if (result==savebox) break;
 	}
 
 	box = result;
@@ -161,7 +186,44 @@ void CtcUnion::contract(IntervalVector& box, ContractContext& context) {
 	if (!context.output_flags[INACTIVE]) {
 		context.prop.update(BoxEvent(box,BoxEvent::CONTRACT));
 	}
+}
 
-} // end namespace ibex
+void CtcUnion::parallel_contract(IntervalVector& box, ContractContext& context) {
+	IntervalVector savebox(box);
 
+	// hull of the boxes contracted by each thread
+	vector<IntervalVector> hull(pool->size(), IntervalVector::empty(box.size()));
+
+	atomic<bool> inactive(false);
+	atomic<bool> stop(false); // set when the result is known to be the initial box
+
+	pool->run(list.size(), [&](int i, int t) {
+		if (stop) return;
+
+		IntervalVector b(savebox);
+		ContractContext c_context(b, context);
+
+		list[i].contract(b,c_context);
+
+		hull[t] |= b;
+
+		if (c_context.output_flags[INACTIVE]) {
+			inactive=true;
+			stop=true;
+		} else if (hull[t]==savebox)
+			stop=true;
+	});
+
+	box.set_empty();
+	for (vector<IntervalVector>::iterator it=hull.begin(); it!=hull.end(); ++it)
+		box |= *it;
+
+	if (inactive) {
+		context.output_flags.add(INACTIVE);
+	} else {
+		context.prop.update(BoxEvent(box,BoxEvent::CONTRACT));
+	}
 }
+
+} // end namespace ibex
+
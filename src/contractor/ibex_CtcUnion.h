@@ -14,6 +14,7 @@
 #include "ibex_Array.h"
 #include "ibex_Ctc.h"
 #include "ibex_NormalizedSystem.h"
+#include "ibex_ThreadPool.h"
 
 namespace ibex {
 
@@ -151,14 +152,39 @@ public:
 	 */
 	virtual void add_property(const IntervalVector& init_box, BoxProperties& map);
 
+	/**
+	 * \brief Run the sub-contractors with several threads.
+	 *
+	 * Each sub-contractor is applied to its own copy of the box and
+	 * each thread computes the hull of the boxes it has contracted.
+	 * The final box is the hull of these hulls, so the result is the
+	 * same as in sequential mode.
+	 *
+	 * The sub-contractors are run concurrently, so they must not share
+	 * any data that is modified by contraction (e.g., the same Function).
+	 *
+	 * \param n - number of threads. 1 (the default) means sequential;
+	 *            n<=0 means the number of hardware threads.
+	 */
+	void set_nb_threads(int n);
+
 	/**
 	 * \brief The list of sub-contractors.
 	 */
 	Array<Ctc> list;
 
+protected:
+
+	/**
+	 * \brief Multi-threaded variant of contract (see #set_nb_threads).
+	 */
+	void parallel_contract(IntervalVector& box, ContractContext& context);
+
 private:
 
 	NormalizedSystem* own_sys;
+
+	ThreadPool* pool;
 };
 
 } // end namespace ibex
@@ -106,8 +106,6 @@ ifstream* CovIUList::read(const char* filename, CovIUList& cov, std::stack<unsig
 
 	ifstream* f = CovList::read(filename, cov, format_id, format_version);
 
-	if (cov.size()==0) return f;
-
 	size_t nb_inner;
 
 	if (format_id.empty() || format_id.top()!=subformat_number || format_version.top()!=FORMAT_VERSION) {
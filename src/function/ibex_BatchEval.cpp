@@ -0,0 +1,139 @@
+/* ============================================================================
+ * I B E X - Function evaluation on several boxes at once
+ * ============================================================================
+ * Copyright   : IMT Atlantique (FRANCE)
+ * License     : This program can be distributed under the terms of the GNU LGPL.
+ *               See the file COPYING.LESSER.
+ *
+ * Author(s)   : Gilles Chabert
+ * Created     : Oct 17, 2026
+ * ---------------------------------------------------------------------------- */
+
+#include "ibex_Function.h"
+#include "ibex_BatchEval.h"
+
+using namespace std;
+
+namespace ibex {
+
+BatchEval::BatchEval(Eval& e) : f(e.f), _eval(e), N(0), capacity(0), lanes(NULL), empty(NULL),
+		root_args(NULL), _vectorizable(check_vectorizable()) {
+
+}
+
+BatchEval::~BatchEval() {
+	if (lanes) {
+		delete[] lanes;
+		delete[] empty;
+	}
+}
+
+bool BatchEval::check_vectorizable() const {
+	if (!f.all_args_scalar()) return false;
+
+	for (int i=0; i<f.nb_nodes(); i++) {
+		const ExprNode& e=f.node(i);
+
+		if (dynamic_cast<const ExprApply*>(&e) ||
+			dynamic_cast<const ExprIndex*>(&e) ||
+			dynamic_cast<const ExprGenericUnaryOp*>(&e) ||
+			dynamic_cast<const ExprGenericBinaryOp*>(&e))
+			return false;
+
+		if (e.dim.is_scalar()) continue;
+
+		// only the root node is allowed to be non-scalar,
+		// and only if it is a vector of scalar expressions.
+		const ExprVector* v=dynamic_cast<const ExprVector*>(&e);
+		if (i>0 || !v || !e.dim.is_vector()) return false;
+
+		for (int j=0; j<v->nb_args; j++)
+			if (!v->arg(j).dim.is_scalar()) return false;
+	}
+	return true;
+}
+
+void BatchEval::resize(int N) {
+	this->N=N;
+
+	if (N<=capacity) return;
+
+	if (lanes) {
+		delete[] lanes;
+		delete[] empty;
+	}
+
+	capacity=N;
+	lanes=new Interval[f.nb_nodes()*capacity];
+	empty=new bool[capacity];
+}
+
+void BatchEval::eval(const IntervalVector* boxes, int N, IntervalVector* out) {
+
+	if (f.expr().dim.is_matrix())
+		ibex_error("Cannot called \"eval_batch\" on a matrix-valued function");
+
+	if (!_vectorizable) {
+		for (int k=0; k<N; k++) {
+			Domain& y=_eval.eval(boxes[k]);
+			if (y.is_empty())
+				out[k].set_empty();
+			else if (y.dim.is_scalar())
+				out[k][0]=y.i();
+			else
+				out[k]=y.v();
+		}
+		return;
+	}
+
+	if (N==0) return;
+
+	resize(N);
+
+	for (int k=0; k<N; k++)
+		empty[k]=boxes[k].is_empty();
+
+	// all arguments are scalar here, so the jth variable
+	// corresponds to the jth symbol.
+	for (vector<int>::const_iterator j=f.used_vars.begin(); j!=f.used_vars.end(); ++j) {
+		Interval* x=lane(f.nodes.rank(f.arg(*j)));
+		for (int k=0; k<N; k++)
+			x[k]=boxes[k][*j];
+	}
+
+	f.forward<BatchEval>(*this);
+
+	if (f.expr().dim.is_scalar()) {
+		Interval* y=lane(0);
+		for (int k=0; k<N; k++)
+			out[k][0]=y[k];
+	} else {
+		int m=f.image_dim();
+		for (int i=0; i<m; i++) {
+			Interval* y=lane(root_args[i]);
+			for (int k=0; k<N; k++)
+				out[k][i]=y[k];
+		}
+	}
+
+	for (int k=0; k<N; k++)
+		if (empty[k]) out[k].set_empty();
+}
+
+bool BatchEval::cst_fwd(int y) {
+	const ExprConstant& c = (const ExprConstant&) f.node(y);
+	Interval* r=lane(y);
+	for (int k=0; k<N; k++)
+		r[k]=c.get_value();
+	return true;
+}
+
+bool BatchEval::vector_fwd(int* x, int y) {
+	// the root node (see check_vectorizable()):
+	// the result is directly read from the lanes of the arguments
+	assert(y==0);
+	root_args=x;
+	return true;
+}
+
+} // namespace ibex
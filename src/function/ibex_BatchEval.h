@@ -0,0 +1,185 @@
+/* ============================================================================
+ * I B E X - Function evaluation on several boxes at once
+ * ============================================================================
+ * Copyright   : IMT Atlantique (FRANCE)
+ * License     : This program can be distributed under the terms of the GNU LGPL.
+ *               See the file COPYING.LESSER.
+ *
+ * Author(s)   : Gilles Chabert
+ * Created     : Oct 17, 2026
+ * ---------------------------------------------------------------------------- */
+
+#ifndef __IBEX_BATCH_EVAL_H__
+#define __IBEX_BATCH_EVAL_H__
+
+#include "ibex_FwdAlgorithm.h"
+#include "ibex_IntervalVector.h"
+
+namespace ibex {
+
+class Function;
+class Eval;
+
+/**
+ * \ingroup symbolic
+ *
+ * \brief Evaluator of a function on a batch of boxes.
+ *
+ * The forward algorithm visits each node of the DAG only once
+ * for all the boxes: the domains of a node are stored as a contiguous
+ * array of "lanes" (one interval per box) and each operation is
+ * a simple loop over these lanes. This way, the dispatching
+ * cost is paid once per node instead of once per box.
+ *
+ * The lane representation is only possible if all the nodes
+ * are scalar, except the root node which can be a vector of
+ * scalar expressions (typical case of the function of a system of
+ * constraints). Function applications and generic operators are not
+ * handled either. In all the other cases, the boxes are
+ * simply evaluated one after the other with the basic evaluator.
+ */
+class BatchEval : public FwdAlgorithm {
+public:
+	/**
+	 * \brief Build the batch evaluator.
+	 *
+	 * The basic evaluator \a e is used as a fallback
+	 * when the function cannot be handled with lanes.
+	 */
+	BatchEval(Eval& e);
+
+	/**
+	 * \brief Delete this.
+	 */
+	~BatchEval();
+
+	/**
+	 * \brief Evaluate f on boxes[0],...,boxes[N-1].
+	 *
+	 * The result f(boxes[k]) is stored in out[k].
+	 * If boxes[k] is outside the definition domain of f,
+	 * out[k] is set to the empty vector.
+	 *
+	 * \pre f is real or vector valued and each out[k] has the
+	 *      size f.image_dim().
+	 */
+	void eval(const IntervalVector* boxes, int N, IntervalVector* out);
+
+	/**
+	 * \brief True if the function can be evaluated with lanes.
+	 */
+	bool vectorizable() const;
+
+public: // because called from CompiledFunction
+
+	       bool vector_fwd (int* x, int y);
+	inline bool apply_fwd  (int*, int)                     { assert(false); return true; }
+	inline bool idx_fwd    (int, int)                      { assert(false); return true; }
+	inline bool idx_cp_fwd (int, int)                      { assert(false); return true; }
+	inline bool symbol_fwd (int)                           { /* nothing to do */ return true; }
+	       bool cst_fwd    (int y);
+	inline bool chi_fwd    (int x1, int x2, int x3, int y) { Interval *a=lane(x1), *b=lane(x2), *c=lane(x3), *r=lane(y); for (int k=0; k<N; k++) if ((r[k]=chi(a[k],b[k],c[k])).is_empty()) empty[k]=true; return true; }
+	inline bool gen2_fwd   (int, int, int)                 { assert(false); return true; }
+	inline bool add_fwd    (int x1, int x2, int y)         { Interval *a=lane(x1), *b=lane(x2), *r=lane(y); for (int k=0; k<N; k++) if ((r[k]=a[k]+b[k]).is_empty()) empty[k]=true; return true; }
+	inline bool mul_fwd    (int x1, int x2, int y)         { Interval *a=lane(x1), *b=lane(x2), *r=lane(y); for (int k=0; k<N; k++) if ((r[k]=a[k]*b[k]).is_empty()) empty[k]=true; return true; }
+	inline bool sub_fwd    (int x1, int x2, int y)         { Interval *a=lane(x1), *b=lane(x2), *r=lane(y); for (int k=0; k<N; k++) if ((r[k]=a[k]-b[k]).is_empty()) empty[k]=true; return true; }
+	inline bool div_fwd    (int x1, int x2, int y)         { Interval *a=lane(x1), *b=lane(x2), *r=lane(y); for (int k=0; k<N; k++) if ((r[k]=a[k]/b[k]).is_empty()) empty[k]=true; return true; }
+	inline bool max_fwd    (int x1, int x2, int y)         { Interval *a=lane(x1), *b=lane(x2), *r=lane(y); for (int k=0; k<N; k++) if ((r[k]=max(a[k],b[k])).is_empty()) empty[k]=true; return true; }
+	inline bool min_fwd    (int x1, int x2, int y)         { Interval *a=lane(x1), *b=lane(x2), *r=lane(y); for (int k=0; k<N; k++) if ((r[k]=min(a[k],b[k])).is_empty()) empty[k]=true; return true; }
+	inline bool atan2_fwd  (int x1, int x2, int y)         { Interval *a=lane(x1), *b=lane(x2), *r=lane(y); for (int k=0; k<N; k++) if ((r[k]=atan2(a[k],b[k])).is_empty()) empty[k]=true; return true; }
+	inline bool gen1_fwd   (int, int)                      { assert(false); return true; }
+	inline bool minus_fwd  (int x, int y)                  { Interval *a=lane(x), *r=lane(y); for (int k=0; k<N; k++) if ((r[k]=-a[k]).is_empty()) empty[k]=true; return true; }
+	inline bool minus_V_fwd(int, int)                      { assert(false); return true; }
+	inline bool minus_M_fwd(int, int)                      { assert(false); return true; }
+	inline bool trans_V_fwd(int, int)                      { assert(false); return true; }
+	inline bool trans_M_fwd(int, int)                      { assert(false); return true; }
+	inline bool sign_fwd   (int x, int y)                  { Interval *a=lane(x), *r=lane(y); for (int k=0; k<N; k++) if ((r[k]=sign(a[k])).is_empty()) empty[k]=true; return true; }
+	inline bool abs_fwd    (int x, int y)                  { Interval *a=lane(x), *r=lane(y); for (int k=0; k<N; k++) if ((r[k]=abs(a[k])).is_empty()) empty[k]=true; return true; }
+	inline bool power_fwd  (int x, int y, int p)           { Interval *a=lane(x), *r=lane(y); for (int k=0; k<N; k++) if ((r[k]=pow(a[k],p)).is_empty()) empty[k]=true; return true; }
+	inline bool sqr_fwd    (int x, int y)                  { Interval *a=lane(x), *r=lane(y); for (int k=0; k<N; k++) if ((r[k]=sqr(a[k])).is_empty()) empty[k]=true; return true; }
+	inline bool sqrt_fwd   (int x, int y)                  { Interval *a=lane(x), *r=lane(y); for (int k=0; k<N; k++) if ((r[k]=sqrt(a[k])).is_empty()) empty[k]=true; return true; }
+	inline bool exp_fwd    (int x, int y)                  { Interval *a=lane(x), *r=lane(y); for (int k=0; k<N; k++) if ((r[k]=exp(a[k])).is_empty()) empty[k]=true; return true; }
+	inline bool log_fwd    (int x, int y)                  { Interval *a=lane(x), *r=lane(y); for (int k=0; k<N; k++) if ((r[k]=log(a[k])).is_empty()) empty[k]=true; return true; }
+	inline bool cos_fwd    (int x, int y)                  { Interval *a=lane(x), *r=lane(y); for (int k=0; k<N; k++) if ((r[k]=cos(a[k])).is_empty()) empty[k]=true; return true; }
+	inline bool sin_fwd    (int x, int y)                  { Interval *a=lane(x), *r=lane(y); for (int k=0; k<N; k++) if ((r[k]=sin(a[k])).is_empty()) empty[k]=true; return true; }
+	inline bool tan_fwd    (int x, int y)                  { Interval *a=lane(x), *r=lane(y); for (int k=0; k<N; k++) if ((r[k]=tan(a[k])).is_empty()) empty[k]=true; return true; }
+	inline bool cosh_fwd   (int x, int y)                  { Interval *a=lane(x), *r=lane(y); for (int k=0; k<N; k++) if ((r[k]=cosh(a[k])).is_empty()) empty[k]=true; return true; }
+	inline bool sinh_fwd   (int x, int y)                  { Interval *a=lane(x), *r=lane(y); for (int k=0; k<N; k++) if ((r[k]=sinh(a[k])).is_empty()) empty[k]=true; return true; }
+	inline bool tanh_fwd   (int x, int y)                  { Interval *a=lane(x), *r=lane(y); for (int k=0; k<N; k++) if ((r[k]=tanh(a[k])).is_empty()) empty[k]=true; return true; }
+	inline bool acos_fwd   (int x, int y)                  { Interval *a=lane(x), *r=lane(y); for (int k=0; k<N; k++) if ((r[k]=acos(a[k])).is_empty()) empty[k]=true; return true; }
+	inline bool asin_fwd   (int x, int y)                  { Interval *a=lane(x), *r=lane(y); for (int k=0; k<N; k++) if ((r[k]=asin(a[k])).is_empty()) empty[k]=true; return true; }
+	inline bool atan_fwd   (int x, int y)                  { Interval *a=lane(x), *r=lane(y); for (int k=0; k<N; k++) if ((r[k]=atan(a[k])).is_empty()) empty[k]=true; return true; }
+	inline bool acosh_fwd  (int x, int y)                  { Interval *a=lane(x), *r=lane(y); for (int k=0; k<N; k++) if ((r[k]=acosh(a[k])).is_empty()) empty[k]=true; return true; }
+	inline bool asinh_fwd  (int x, int y)                  { Interval *a=lane(x), *r=lane(y); for (int k=0; k<N; k++) if ((r[k]=asinh(a[k])).is_empty()) empty[k]=true; return true; }
+	inline bool atanh_fwd  (int x, int y)                  { Interval *a=lane(x), *r=lane(y); for (int k=0; k<N; k++) if ((r[k]=atanh(a[k])).is_empty()) empty[k]=true; return true; }
+	inline bool add_V_fwd  (int, int, int)                 { assert(false); return true; }
+	inline bool add_M_fwd  (int, int, int)                 { assert(false); return true; }
+	inline bool mul_SV_fwd (int, int, int)                 { assert(false); return true; }
+	inline bool mul_SM_fwd (int, int, int)                 { assert(false); return true; }
+	inline bool mul_VV_fwd (int, int, int)                 { assert(false); return true; }
+	inline bool mul_MV_fwd (int, int, int)                 { assert(false); return true; }
+	inline bool mul_VM_fwd (int, int, int)                 { assert(false); return true; }
+	inline bool mul_MM_fwd (int, int, int)                 { assert(false); return true; }
+	inline bool sub_V_fwd  (int, int, int)                 { assert(false); return true; }
+	inline bool sub_M_fwd  (int, int, int)                 { assert(false); return true; }
+
+	Function& f;
+	Eval& _eval;
+
+protected:
+	/**
+	 * Check whether the function can be handled with lanes
+	 * (see #vectorizable()).
+	 */
+	bool check_vectorizable() const;
+
+	/**
+	 * Allocate the lanes for N boxes (if necessary).
+	 */
+	void resize(int N);
+
+	/**
+	 * The lanes of the ith node.
+	 */
+	Interval* lane(int i);
+
+	/** Current number of boxes. */
+	int N;
+
+	/** Maximal number of boxes the lanes are allocated for. */
+	int capacity;
+
+	/**
+	 * The lanes of all the nodes, stored node after node:
+	 * lanes[i*capacity+k] is the domain of the ith node for the kth box.
+	 */
+	Interval* lanes;
+
+	/**
+	 * empty[k] is true if the kth box is outside the definition domain
+	 * (the result of an operation is empty for this box).
+	 */
+	bool* empty;
+
+	/** Ranks of the arguments of the root node (if the root is a vector). */
+	int* root_args;
+
+	/** Cached result of check_vectorizable(). */
+	const bool _vectorizable;
+};
+
+/* ============================================================================
+ 	 	 	 	 	 	 	 implementation
+  ============================================================================*/
+
+inline bool BatchEval::vectorizable() const {
+	return _vectorizable;
+}
+
+inline Interval* BatchEval::lane(int i) {
+	return lanes + i*capacity;
+}
+
+} // namespace ibex
+
+#endif // __IBEX_BATCH_EVAL_H__
@@ -19,7 +19,7 @@ using namespace std;
 
 namespace ibex {
 
-CompiledFunction::CompiledFunction() : n(0), n_total(0), nodes(NULL), code(NULL), nb_args(NULL), args(NULL), ptr(-1) {
+CompiledFunction::CompiledFunction() : n(0), n_total(0), nodes(NULL), code(NULL), code_end(NULL), pc(NULL), ptr(-1), buf(NULL) {
 
 }
 
@@ -29,13 +29,21 @@ void CompiledFunction::compile(Function& f) {
 	nodes = &f.nodes;
 	n_total = nodes->size();
 
-	code=new operation[n];
-	args=new int*[n];
-	nb_args=new int[n];
+	pc=new int[n];
+
+	vector<int> stream;
+	buf=&stream;
 
 	for (ptr=n-1; ptr>=0; ptr--) {
 		(*nodes)[ptr].acceptVisitor(*this);
 	}
+
+	buf=NULL;
+
+	// note: the stream is never empty (there is at least one symbol)
+	code=new int[stream.size()];
+	std::copy(stream.begin(), stream.end(), code);
+	code_end=code+stream.size();
 	//cout << f.name << " : n=" << n << " nb_args[" << 0 << "]=" << nb_args[0] << endl;
 }
 
@@ -43,9 +51,7 @@ CompiledFunction::~CompiledFunction() {
 	if (code==NULL) return; // not compiled
 
 	delete[] code;
-	for (int i=0; i<n; i++) delete[] args[i];
-	delete[] args;
-	delete[] nb_args;
+	delete[] pc;
 }
 
 Agenda* CompiledFunction::agenda(int rank) const {
@@ -59,53 +65,113 @@ Agenda* CompiledFunction::agenda(int rank) const {
 	return a;
 }
 
+std::vector<int> CompiledFunction::dependents(const ExprSymbol& x, int i, int j) const {
+	int s=nodes->rank(x);
+
+	vector<bool> marked(n,false);
+	vector<int> res;
+
+	if (s>=n) return res; // x does not appear in the expression
+
+	const int* a;
+	int tmp;
+
+	for (int r=n-1; r>=0; r--) {
+		if (r==s) { res.push_back(r); continue; }
+
+		int k=args(r,a,tmp);
+		for (int l=0; l<k && !marked[r]; l++) {
+			if (a[l]==s) {
+				// a node built on x depends on x(i,j) unless
+				// it is an index that does not contain (i,j)
+				const ExprIndex* idx=dynamic_cast<const ExprIndex*>(&(*nodes)[r]);
+				marked[r] = !idx ||
+						(idx->index.first_row()<=i && i<=idx->index.last_row() &&
+						 idx->index.first_col()<=j && j<=idx->index.last_col());
+			} else
+				marked[r]=marked[a[l]];
+		}
+		if (marked[r]) res.push_back(r);
+	}
+
+	return res;
+}
+
+int CompiledFunction::args(int i, const int*& x, int& tmp) const {
+	if (pc[i]==-1) {
+		// index with domain reference (no instruction)
+		tmp=nodes->rank(((const ExprIndex&) (*nodes)[i]).expr);
+		x=&tmp;
+		return 1;
+	}
+
+	const int* c=code+pc[i];
+	x=c+2;
+
+	switch(c[0]) {
+	case SYM:
+	case CST:    return 0;
+	case VEC:
+	case APPLY:  x=c+3; return c[2];
+	case CHI:    return 3;
+	case GEN2:
+	case ADD:    case ADD_V:  case ADD_M:
+	case MUL:    case MUL_SV: case MUL_SM: case MUL_VV: case MUL_MV: case MUL_MM: case MUL_VM:
+	case SUB:    case SUB_V:  case SUB_M:
+	case DIV:    case MAX:    case MIN:    case ATAN2:
+	             return 2;
+	default:     return 1; // unary operators (including power)
+	}
+}
+
+void CompiledFunction::emit(operation op, int nb_args, const int* args) {
+	pc[ptr]=buf->size();
+	buf->push_back(op);
+	buf->push_back(ptr);
+	if (op==VEC || op==APPLY) buf->push_back(nb_args);
+	for (int i=0; i<nb_args; i++)
+		buf->push_back(args[i]);
+}
+
 void CompiledFunction::visit(const ExprNode& e) {
 	e.acceptVisitor(*this);
 }
 
 void CompiledFunction::visit(const ExprIndex& i) {
 	if (i.index.domain_ref())
-		code[ptr]=IDX;
-	else
-		code[ptr]=IDX_CP;
-	nb_args[ptr]=1;
-	args[ptr]=new int[1];
-	args[ptr][0]=nodes->rank(i.expr);
+		// the domain of the node is a reference to
+		// a sub-domain of the argument: nothing to do.
+		pc[ptr]=-1;
+	else {
+		int x=nodes->rank(i.expr);
+		emit(IDX_CP,1,&x);
+	}
 }
 
 void CompiledFunction::visit(const ExprSymbol& v) {
-	code[ptr]=SYM;
-	nb_args[ptr]=0;
-	args[ptr]=NULL;
+	emit(SYM,0,NULL);
 }
 
 void CompiledFunction::visit(const ExprConstant& c) {
-	code[ptr]=CST;
-	nb_args[ptr]=0;
-	args[ptr]=NULL;
+	emit(CST,0,NULL);
 }
 
 void CompiledFunction::visit(const ExprNAryOp& e, operation op) {
-	code[ptr]=op;
-	nb_args[ptr]=e.nb_args;
-	args[ptr]=new int[e.nb_args];
+	int* x=new int[e.nb_args];
 	for (int i=0; i<e.nb_args; i++)
-		args[ptr][i]=nodes->rank(e.arg(i));
+		x[i]=nodes->rank(e.arg(i));
+	emit(op,e.nb_args,x);
+	delete[] x;
 }
 
 void CompiledFunction::visit(const ExprBinaryOp& b, operation op) {
-	code[ptr]=op;
-	nb_args[ptr]=2;
-	args[ptr]=new int[2];
-	args[ptr][0]=nodes->rank(b.left);
-	args[ptr][1]=nodes->rank(b.right);
+	int x[2] = { nodes->rank(b.left), nodes->rank(b.right) };
+	emit(op,2,x);
 }
 
 void CompiledFunction::visit(const ExprUnaryOp& u, operation op) {
-	code[ptr]=op;
-	nb_args[ptr]=1;
-	args[ptr]=new int[1];
-	args[ptr][0]=nodes->rank(u.expr);
+	int x=nodes->rank(u.expr);
+	emit(op,1,&x);
 }
 
 void CompiledFunction::visit(const ExprVector& e) { visit(e,VEC); }
@@ -170,7 +236,10 @@ void CompiledFunction::visit(const ExprSign& e)  { visit(e,SIGN); }
 
 void CompiledFunction::visit(const ExprAbs& e)   { visit(e,ABS); }
 
-void CompiledFunction::visit(const ExprPower& e) { visit(e,POWER); }
+void CompiledFunction::visit(const ExprPower& e) {
+	int x[2] = { nodes->rank(e.expr), e.expon }; // the exponent is stored inline
+	emit(POWER,2,x);
+}
 
 void CompiledFunction::visit(const ExprSqr& e)   { visit(e,SQR); }
 
@@ -256,11 +325,20 @@ const char* CompiledFunction::op(operation o) const {
 std::ostream& operator<<(std::ostream& os, const CompiledFunction& f) {
 	os << "================================================" << std::endl;
 	for (int i=0; i<f.n; i++) {
-		os << "  " << i << '\t' << f.op(f.code[i]) << '\t';
+		os << "  " << i << '\t';
+		if (f.pc[i]==-1) {
+			os << "[]\t(no-op)\t" << (*f.nodes)[i] << endl;
+			continue;
+		}
+		const int* c=f.code+f.pc[i];
+		os << f.op((CompiledFunction::operation) c[0]) << '\t';
+		const int* args;
+		int tmp;
+		int nb_args=f.args(i,args,tmp); // note: the exponent of "pow" is not displayed
 		os << "args=(";
-		for (int j=0; j<f.nb_args[i]; j++) {
-			os << f.args[i][j];
-			if (j<f.nb_args[i]-1) os << ",";
+		for (int j=0; j<nb_args; j++) {
+			os << args[j];
+			if (j<nb_args-1) os << ",";
 		}
 		os << ")\t" << (*f.nodes)[i];
 		os << endl;
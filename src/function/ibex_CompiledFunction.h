@@ -12,6 +12,7 @@
 #define __IBEX_COMPILED_FUNCTION_H__
 
 #include <stack>
+#include <vector>
 
 #include "ibex_Expr.h"
 #include "ibex_ExprVisitor.h"
@@ -47,32 +48,41 @@ public:
 	~CompiledFunction();
 
 	/**
-	 * Run the forward phase of a forward algorithm and
-	 * return a reference to the label
-	 * of the root node. V must be a subclass of FwdAlgorithm.
+	 * Run the forward phase of a forward algorithm.
+	 * V must be a subclass of FwdAlgorithm.
 	 * Note that the type V is just passed in order to have static linkage.
+	 *
+	 * \return false if an operation reported an empty domain
+	 *         (the remaining operations are skipped).
 	 */
 	template<class V>
-	void forward(const V& algo) const;
+	bool forward(const V& algo) const;
 
 	/**
 	 * Forward phase on a specific set of operations (in the agenda).
+	 *
+	 * \return false if an operation reported an empty domain.
 	 */
 	template<class V>
-	void forward(const V& algo, const Agenda& a) const;
+	bool forward(const V& algo, const Agenda& a) const;
 
 	/**
 	 * Run the backward phase.  V must be a subclass of BwdAlgorithm.
 	 * Note that the type V is just passed in order to have static linkage.
+	 *
+	 * \return false if an operation reported an empty domain
+	 *         (the remaining operations are skipped).
 	 */
 	template<class V>
-	void backward(const V& algo) const;
+	bool backward(const V& algo) const;
 
 	/**
 	 * Backward phase on a specific set of operations (in the agenda).
+	 *
+	 * \return false if an operation reported an empty domain.
 	 */
 	template<class V>
-	void backward(const V& algo, const Agenda& a) const;
+	bool backward(const V& algo, const Agenda& a) const;
 
 	/**
 	 * Return an agenda of all the operations
@@ -83,6 +93,17 @@ public:
 	 */
 	Agenda* agenda(int rank) const;
 
+	/**
+	 * Return the ranks of all the nodes whose domain depends on
+	 * the element (i,j) of the domain of a symbol x (including x
+	 * itself), in the order of the forward phase.
+	 *
+	 * Index nodes that do not include (i,j) are not considered
+	 * as depending on this element. The result is empty if x does
+	 * not appear in the expression.
+	 */
+	std::vector<int> dependents(const ExprSymbol& x, int i, int j) const;
+
 	/**
 	 * Print the structure to the standard output.
 	 */
@@ -90,7 +111,7 @@ public:
 
 protected:
 	typedef enum {
-		IDX,    // index with reference
+		IDX,    // index with reference (no instruction generated)
 		IDX_CP, // index with copy
 		VEC, SYM, CST, APPLY, CHI,
 		ADD, MUL, SUB, DIV, MAX, MIN, ATAN2,
@@ -157,11 +178,32 @@ private:
 	void visit(const ExprAtanh& e);
 
 private:
+	/*
+	 * Execute the forward phase of the instruction c
+	 * and return the next instruction in the stream
+	 * (NULL if the result is empty).
+	 */
 	template<class V>
-	void forward(const V& algo, int i) const;
+	const int* forward(const V& algo, const int* c) const;
 
+	/*
+	 * Execute the backward phase of the instruction c.
+	 * Return false if the result is empty.
+	 */
 	template<class V>
-	void backward(const V& algo, int i) const;
+	bool backward(const V& algo, const int* c) const;
+
+	/*
+	 * Get the subnodes of the ith node. Return their number
+	 * and set x to the array of their ranks (tmp is used as
+	 * storage if the ranks are not in the stream).
+	 */
+	int args(int i, const int*& x, int& tmp) const;
+
+	/*
+	 * Append the instruction of the current node to the stream.
+	 */
+	void emit(operation op, int nb_args, const int* args);
 
 	friend std::ostream& operator<<(std::ostream& os, const CompiledFunction& data);
 
@@ -173,168 +215,187 @@ private:
 
 	ExprSubNodes *nodes;
 
-	operation *code;
-
-	int* nb_args;
-
-	mutable int** args;
+	// The instruction stream. All the instructions are stored contiguously
+	// in the order of the forward phase (leaves first). An instruction is:
+	//
+	//    op | y | x_1 ... x_k           (unary/binary/ternary operators)
+	//    op | y | x | expon             (power)
+	//    op | y | k | x_1 ... x_k       (vector, apply)
+	//    op | y                         (symbol, constant)
+	//
+	// where y is the rank of the node and x_i the rank of its arguments.
+	// Index nodes with domain reference (no-ops) are not in the stream.
+	int* code;
+
+	// end of the stream
+	int* code_end;
+
+	// pc[i] is the offset in the stream of the instruction of the ith
+	// node or -1 if this node has no instruction.
+	int* pc;
 
 	// Node counter in Polish prefix notation
 	// (only useful during construction)
 	mutable int ptr;
+
+	// The stream being built (only useful during construction)
+	std::vector<int>* buf;
 };
 
 std::ostream& operator<<(std::ostream& os, const CompiledFunction& data);
 
 template<class V>
-inline void CompiledFunction::forward(const V& algo) const {
+inline bool CompiledFunction::forward(const V& algo) const {
 	assert(dynamic_cast<const FwdAlgorithm* >(&algo)!=NULL);
 
-	for (int i=n-1; i>=0; i--) {
-		forward(algo, i);
+	for (const int* c=code; c!=code_end; ) {
+		c=forward(algo, c);
+		if (!c) return false;
 	}
+	return true;
 }
 
 template<class V>
-inline void CompiledFunction::forward(const V& algo, const Agenda& a) const {
+inline bool CompiledFunction::forward(const V& algo, const Agenda& a) const {
 	assert(dynamic_cast<const FwdAlgorithm* >(&algo)!=NULL);
 
 	for (int i=a.first(); i!=a.end(); i=a.next(i)) {
-		forward(algo, i);
+		if (pc[i]!=-1 && !forward(algo, code+pc[i])) return false;
 	}
+	return true;
 }
 
 template<class V>
-void CompiledFunction::forward(const V& algo, int i) const {
-	switch(code[i]) {
-	case IDX:    ((V&) algo).idx_fwd    (args[i][0], i); break;
-	case IDX_CP: ((V&) algo).idx_cp_fwd (args[i][0], i); break;
-	case VEC:    ((V&) algo).vector_fwd (args[i], i); break;
-	case SYM:    ((V&) algo).symbol_fwd (i); break;
-	case CST:    ((V&) algo).cst_fwd    (i); break;
-	case APPLY:  ((V&) algo).apply_fwd  (args[i],i); break;
-	case CHI:    ((V&) algo).chi_fwd    (args[i][0], args[i][1], args[i][2], i); break;
-	case GEN2:   ((V&) algo).gen2_fwd   (args[i][0], args[i][1], i); break;
-	case ADD:    ((V&) algo).add_fwd    (args[i][0], args[i][1], i); break;
-	case ADD_V:  ((V&) algo).add_V_fwd  (args[i][0], args[i][1], i); break;
-	case ADD_M:  ((V&) algo).add_M_fwd  (args[i][0], args[i][1], i); break;
-	case MUL:    ((V&) algo).mul_fwd    (args[i][0], args[i][1], i); break;
-	case MUL_SV: ((V&) algo).mul_SV_fwd (args[i][0], args[i][1], i); break;
-	case MUL_SM: ((V&) algo).mul_SM_fwd (args[i][0], args[i][1], i); break;
-	case MUL_VV: ((V&) algo).mul_VV_fwd (args[i][0], args[i][1], i); break;
-	case MUL_MV: ((V&) algo).mul_MV_fwd (args[i][0], args[i][1], i); break;
-	case MUL_MM: ((V&) algo).mul_MM_fwd (args[i][0], args[i][1], i); break;
-	case MUL_VM: ((V&) algo).mul_VM_fwd (args[i][0], args[i][1], i); break;
-	case SUB:    ((V&) algo).sub_fwd    (args[i][0], args[i][1], i); break;
-	case SUB_V:  ((V&) algo).sub_V_fwd  (args[i][0], args[i][1], i); break;
-	case SUB_M:  ((V&) algo).sub_M_fwd  (args[i][0], args[i][1], i); break;
-	case DIV:    ((V&) algo).div_fwd    (args[i][0], args[i][1], i); break;
-	case MAX:    ((V&) algo).max_fwd    (args[i][0], args[i][1], i); break;
-	case MIN:    ((V&) algo).min_fwd    (args[i][0], args[i][1], i); break;
-	case ATAN2:  ((V&) algo).atan2_fwd  (args[i][0], args[i][1], i); break;
-	case GEN1:   ((V&) algo).gen1_fwd   (args[i][0], i); break;
-	case MINUS:  ((V&) algo).minus_fwd  (args[i][0], i); break;
-	case MINUS_V:((V&) algo).minus_V_fwd(args[i][0], i); break;
-	case MINUS_M:((V&) algo).minus_M_fwd(args[i][0], i); break;
-	case TRANS_V:((V&) algo).trans_V_fwd(args[i][0], i); break;
-	case TRANS_M:((V&) algo).trans_M_fwd(args[i][0], i); break;
-	case SIGN:   ((V&) algo).sign_fwd   (args[i][0], i); break;
-	case ABS:    ((V&) algo).abs_fwd    (args[i][0], i); break;
-	case POWER:  ((V&) algo).power_fwd  (args[i][0], i, ((const ExprPower&) (*nodes)[i]).expon); break;
-	case SQR:    ((V&) algo).sqr_fwd    (args[i][0], i); break;
-	case SQRT:   ((V&) algo).sqrt_fwd   (args[i][0], i); break;
-	case EXP:    ((V&) algo).exp_fwd    (args[i][0], i); break;
-	case LOG:    ((V&) algo).log_fwd    (args[i][0], i); break;
-	case COS:    ((V&) algo).cos_fwd    (args[i][0], i); break;
-	case SIN:    ((V&) algo).sin_fwd    (args[i][0], i); break;
-	case TAN:    ((V&) algo).tan_fwd    (args[i][0], i); break;
-	case COSH:   ((V&) algo).cosh_fwd   (args[i][0], i); break;
-	case SINH:   ((V&) algo).sinh_fwd   (args[i][0], i); break;
-	case TANH:   ((V&) algo).tanh_fwd   (args[i][0], i); break;
-	case ACOS:   ((V&) algo).acos_fwd   (args[i][0], i); break;
-	case ASIN:   ((V&) algo).asin_fwd   (args[i][0], i); break;
-	case ATAN:   ((V&) algo).atan_fwd   (args[i][0], i); break;
-	case ACOSH:  ((V&) algo).acosh_fwd  (args[i][0], i); break;
-	case ASINH:  ((V&) algo).asinh_fwd  (args[i][0], i); break;
-	case ATANH:  ((V&) algo).atanh_fwd  (args[i][0], i); break;
-	default: 	 assert(false);
+const int* CompiledFunction::forward(const V& algo, const int* c) const {
+	switch(c[0]) {
+	case IDX_CP: return ((V&) algo).idx_cp_fwd (c[2], c[1]) ? c+3 : NULL;
+	case VEC:    return ((V&) algo).vector_fwd ((int*) c+3, c[1]) ? c+3+c[2] : NULL;
+	case SYM:    return ((V&) algo).symbol_fwd (c[1]) ? c+2 : NULL;
+	case CST:    return ((V&) algo).cst_fwd    (c[1]) ? c+2 : NULL;
+	case APPLY:  return ((V&) algo).apply_fwd  ((int*) c+3, c[1]) ? c+3+c[2] : NULL;
+	case CHI:    return ((V&) algo).chi_fwd    (c[2], c[3], c[4], c[1]) ? c+5 : NULL;
+	case GEN2:   return ((V&) algo).gen2_fwd   (c[2], c[3], c[1]) ? c+4 : NULL;
+	case ADD:    return ((V&) algo).add_fwd    (c[2], c[3], c[1]) ? c+4 : NULL;
+	case ADD_V:  return ((V&) algo).add_V_fwd  (c[2], c[3], c[1]) ? c+4 : NULL;
+	case ADD_M:  return ((V&) algo).add_M_fwd  (c[2], c[3], c[1]) ? c+4 : NULL;
+	case MUL:    return ((V&) algo).mul_fwd    (c[2], c[3], c[1]) ? c+4 : NULL;
+	case MUL_SV: return ((V&) algo).mul_SV_fwd (c[2], c[3], c[1]) ? c+4 : NULL;
+	case MUL_SM: return ((V&) algo).mul_SM_fwd (c[2], c[3], c[1]) ? c+4 : NULL;
+	case MUL_VV: return ((V&) algo).mul_VV_fwd (c[2], c[3], c[1]) ? c+4 : NULL;
+	case MUL_MV: return ((V&) algo).mul_MV_fwd (c[2], c[3], c[1]) ? c+4 : NULL;
+	case MUL_MM: return ((V&) algo).mul_MM_fwd (c[2], c[3], c[1]) ? c+4 : NULL;
+	case MUL_VM: return ((V&) algo).mul_VM_fwd (c[2], c[3], c[1]) ? c+4 : NULL;
+	case SUB:    return ((V&) algo).sub_fwd    (c[2], c[3], c[1]) ? c+4 : NULL;
+	case SUB_V:  return ((V&) algo).sub_V_fwd  (c[2], c[3], c[1]) ? c+4 : NULL;
+	case SUB_M:  return ((V&) algo).sub_M_fwd  (c[2], c[3], c[1]) ? c+4 : NULL;
+	case DIV:    return ((V&) algo).div_fwd    (c[2], c[3], c[1]) ? c+4 : NULL;
+	case MAX:    return ((V&) algo).max_fwd    (c[2], c[3], c[1]) ? c+4 : NULL;
+	case MIN:    return ((V&) algo).min_fwd    (c[2], c[3], c[1]) ? c+4 : NULL;
+	case ATAN2:  return ((V&) algo).atan2_fwd  (c[2], c[3], c[1]) ? c+4 : NULL;
+	case GEN1:   return ((V&) algo).gen1_fwd   (c[2], c[1]) ? c+3 : NULL;
+	case MINUS:  return ((V&) algo).minus_fwd  (c[2], c[1]) ? c+3 : NULL;
+	case MINUS_V:return ((V&) algo).minus_V_fwd(c[2], c[1]) ? c+3 : NULL;
+	case MINUS_M:return ((V&) algo).minus_M_fwd(c[2], c[1]) ? c+3 : NULL;
+	case TRANS_V:return ((V&) algo).trans_V_fwd(c[2], c[1]) ? c+3 : NULL;
+	case TRANS_M:return ((V&) algo).trans_M_fwd(c[2], c[1]) ? c+3 : NULL;
+	case SIGN:   return ((V&) algo).sign_fwd   (c[2], c[1]) ? c+3 : NULL;
+	case ABS:    return ((V&) algo).abs_fwd    (c[2], c[1]) ? c+3 : NULL;
+	case POWER:  return ((V&) algo).power_fwd  (c[2], c[1], c[3]) ? c+4 : NULL;
+	case SQR:    return ((V&) algo).sqr_fwd    (c[2], c[1]) ? c+3 : NULL;
+	case SQRT:   return ((V&) algo).sqrt_fwd   (c[2], c[1]) ? c+3 : NULL;
+	case EXP:    return ((V&) algo).exp_fwd    (c[2], c[1]) ? c+3 : NULL;
+	case LOG:    return ((V&) algo).log_fwd    (c[2], c[1]) ? c+3 : NULL;
+	case COS:    return ((V&) algo).cos_fwd    (c[2], c[1]) ? c+3 : NULL;
+	case SIN:    return ((V&) algo).sin_fwd    (c[2], c[1]) ? c+3 : NULL;
+	case TAN:    return ((V&) algo).tan_fwd    (c[2], c[1]) ? c+3 : NULL;
+	case COSH:   return ((V&) algo).cosh_fwd   (c[2], c[1]) ? c+3 : NULL;
+	case SINH:   return ((V&) algo).sinh_fwd   (c[2], c[1]) ? c+3 : NULL;
+	case TANH:   return ((V&) algo).tanh_fwd   (c[2], c[1]) ? c+3 : NULL;
+	case ACOS:   return ((V&) algo).acos_fwd   (c[2], c[1]) ? c+3 : NULL;
+	case ASIN:   return ((V&) algo).asin_fwd   (c[2], c[1]) ? c+3 : NULL;
+	case ATAN:   return ((V&) algo).atan_fwd   (c[2], c[1]) ? c+3 : NULL;
+	case ACOSH:  return ((V&) algo).acosh_fwd  (c[2], c[1]) ? c+3 : NULL;
+	case ASINH:  return ((V&) algo).asinh_fwd  (c[2], c[1]) ? c+3 : NULL;
+	case ATANH:  return ((V&) algo).atanh_fwd  (c[2], c[1]) ? c+3 : NULL;
+	default: 	 assert(false); return NULL;
 	}
 }
 
 template<class V>
-void CompiledFunction::backward(const V& algo) const {
+bool CompiledFunction::backward(const V& algo) const {
 
 	assert(dynamic_cast<const BwdAlgorithm* >(&algo)!=NULL);
 
 	for (int i=0; i<n; i++) {
-		backward(algo, i);
+		if (pc[i]!=-1 && !backward(algo, code+pc[i])) return false;
 	}
+	return true;
 }
 
 template<class V>
-void CompiledFunction::backward(const V& algo, const Agenda& a) const {
+bool CompiledFunction::backward(const V& algo, const Agenda& a) const {
 
 	assert(dynamic_cast<const BwdAlgorithm* >(&algo)!=NULL);
 
 	for (int i=a.first(); i!=a.end(); i=a.next(i)) {
-		backward(algo, i);
+		if (pc[i]!=-1 && !backward(algo, code+pc[i])) return false;
 	}
+	return true;
 }
 
 template<class V>
-void CompiledFunction::backward(const V& algo, int i) const {
-	switch(code[i]) {
-	case IDX:    ((V&) algo).idx_bwd    (args[i][0], i); break;
-	case IDX_CP: ((V&) algo).idx_cp_bwd (args[i][0], i); break;
-	case VEC:    ((V&) algo).vector_bwd (args[i], i); break;
-	case SYM:    ((V&) algo).symbol_bwd (i); break;
-	case CST:    ((V&) algo).cst_bwd    (i); break;
-	case APPLY:  ((V&) algo).apply_bwd  (args[i], i); break;
-	case CHI:    ((V&) algo).chi_bwd    (args[i][0], args[i][1], args[i][2], i); break;
-	case GEN2:   ((V&) algo).gen2_bwd   (args[i][0], args[i][1], i); break;
-	case ADD:    ((V&) algo).add_bwd    (args[i][0], args[i][1], i); break;
-	case ADD_V:  ((V&) algo).add_V_bwd  (args[i][0], args[i][1], i); break;
-	case ADD_M:  ((V&) algo).add_M_bwd  (args[i][0], args[i][1], i); break;
-	case MUL:    ((V&) algo).mul_bwd    (args[i][0], args[i][1], i); break;
-	case MUL_SV: ((V&) algo).mul_SV_bwd (args[i][0], args[i][1], i); break;
-	case MUL_SM: ((V&) algo).mul_SM_bwd (args[i][0], args[i][1], i); break;
-	case MUL_VV: ((V&) algo).mul_VV_bwd (args[i][0], args[i][1], i); break;
-	case MUL_MV: ((V&) algo).mul_MV_bwd (args[i][0], args[i][1], i); break;
-	case MUL_MM: ((V&) algo).mul_MM_bwd (args[i][0], args[i][1], i); break;
-	case MUL_VM: ((V&) algo).mul_VM_bwd (args[i][0], args[i][1], i); break;
-	case SUB:    ((V&) algo).sub_bwd    (args[i][0], args[i][1], i); break;
-	case SUB_V:  ((V&) algo).sub_V_bwd  (args[i][0], args[i][1], i); break;
-	case SUB_M:  ((V&) algo).sub_M_bwd  (args[i][0], args[i][1], i); break;
-	case DIV:    ((V&) algo).div_bwd    (args[i][0], args[i][1], i); break;
-	case MAX:    ((V&) algo).max_bwd    (args[i][0], args[i][1], i); break;
-	case MIN:    ((V&) algo).min_bwd    (args[i][0], args[i][1], i); break;
-	case ATAN2:  ((V&) algo).atan2_bwd  (args[i][0], args[i][1], i); break;
-	case GEN1:   ((V&) algo).gen1_bwd   (args[i][0], i); break;
-	case MINUS:  ((V&) algo).minus_bwd  (args[i][0], i); break;
-	case MINUS_V:((V&) algo).minus_V_bwd(args[i][0], i); break;
-	case MINUS_M:((V&) algo).minus_M_bwd(args[i][0], i); break;
-	case TRANS_V:((V&) algo).trans_V_bwd(args[i][0], i); break;
-	case TRANS_M:((V&) algo).trans_M_bwd(args[i][0], i); break;
-	case SIGN:   ((V&) algo).sign_bwd   (args[i][0], i); break;
-	case ABS:    ((V&) algo).abs_bwd    (args[i][0], i); break;
-	case POWER:  ((V&) algo).power_bwd  (args[i][0], i, ((const ExprPower&) (*nodes)[i]).expon); break;
-	case SQR:    ((V&) algo).sqr_bwd    (args[i][0], i); break;
-	case SQRT:   ((V&) algo).sqrt_bwd   (args[i][0], i); break;
-	case EXP:    ((V&) algo).exp_bwd    (args[i][0], i); break;
-	case LOG:    ((V&) algo).log_bwd    (args[i][0], i); break;
-	case COS:    ((V&) algo).cos_bwd    (args[i][0], i); break;
-	case SIN:    ((V&) algo).sin_bwd    (args[i][0], i); break;
-	case TAN:    ((V&) algo).tan_bwd    (args[i][0], i); break;
-	case COSH:   ((V&) algo).cosh_bwd   (args[i][0], i); break;
-	case SINH:   ((V&) algo).sinh_bwd   (args[i][0], i); break;
-	case TANH:   ((V&) algo).tanh_bwd   (args[i][0], i); break;
-	case ACOS:   ((V&) algo).acos_bwd   (args[i][0], i); break;
-	case ASIN:   ((V&) algo).asin_bwd   (args[i][0], i); break;
-	case ATAN:   ((V&) algo).atan_bwd   (args[i][0], i); break;
-	case ACOSH:  ((V&) algo).acosh_bwd  (args[i][0], i); break;
-	case ASINH:  ((V&) algo).asinh_bwd  (args[i][0], i); break;
-	case ATANH:  ((V&) algo).atanh_bwd  (args[i][0], i); break;
-	default: 	 assert(false);
+bool CompiledFunction::backward(const V& algo, const int* c) const {
+	switch(c[0]) {
+	case IDX_CP: return ((V&) algo).idx_cp_bwd (c[2], c[1]);
+	case VEC:    return ((V&) algo).vector_bwd ((int*) c+3, c[1]);
+	case SYM:    return ((V&) algo).symbol_bwd (c[1]);
+	case CST:    return ((V&) algo).cst_bwd    (c[1]);
+	case APPLY:  return ((V&) algo).apply_bwd  ((int*) c+3, c[1]);
+	case CHI:    return ((V&) algo).chi_bwd    (c[2], c[3], c[4], c[1]);
+	case GEN2:   return ((V&) algo).gen2_bwd   (c[2], c[3], c[1]);
+	case ADD:    return ((V&) algo).add_bwd    (c[2], c[3], c[1]);
+	case ADD_V:  return ((V&) algo).add_V_bwd  (c[2], c[3], c[1]);
+	case ADD_M:  return ((V&) algo).add_M_bwd  (c[2], c[3], c[1]);
+	case MUL:    return ((V&) algo).mul_bwd    (c[2], c[3], c[1]);
+	case MUL_SV: return ((V&) algo).mul_SV_bwd (c[2], c[3], c[1]);
+	case MUL_SM: return ((V&) algo).mul_SM_bwd (c[2], c[3], c[1]);
+	case MUL_VV: return ((V&) algo).mul_VV_bwd (c[2], c[3], c[1]);
+	case MUL_MV: return ((V&) algo).mul_MV_bwd (c[2], c[3], c[1]);
+	case MUL_MM: return ((V&) algo).mul_MM_bwd (c[2], c[3], c[1]);
+	case MUL_VM: return ((V&) algo).mul_VM_bwd (c[2], c[3], c[1]);
+	case SUB:    return ((V&) algo).sub_bwd    (c[2], c[3], c[1]);
+	case SUB_V:  return ((V&) algo).sub_V_bwd  (c[2], c[3], c[1]);
+	case SUB_M:  return ((V&) algo).sub_M_bwd  (c[2], c[3], c[1]);
+	case DIV:    return ((V&) algo).div_bwd    (c[2], c[3], c[1]);
+	case MAX:    return ((V&) algo).max_bwd    (c[2], c[3], c[1]);
+	case MIN:    return ((V&) algo).min_bwd    (c[2], c[3], c[1]);
+	case ATAN2:  return ((V&) algo).atan2_bwd  (c[2], c[3], c[1]);
+	case GEN1:   return ((V&) algo).gen1_bwd   (c[2], c[1]);
+	case MINUS:  return ((V&) algo).minus_bwd  (c[2], c[1]);
+	case MINUS_V:return ((V&) algo).minus_V_bwd(c[2], c[1]);
+	case MINUS_M:return ((V&) algo).minus_M_bwd(c[2], c[1]);
+	case TRANS_V:return ((V&) algo).trans_V_bwd(c[2], c[1]);
+	case TRANS_M:return ((V&) algo).trans_M_bwd(c[2], c[1]);
+	case SIGN:   return ((V&) algo).sign_bwd   (c[2], c[1]);
+	case ABS:    return ((V&) algo).abs_bwd    (c[2], c[1]);
+	case POWER:  return ((V&) algo).power_bwd  (c[2], c[1], c[3]);
+	case SQR:    return ((V&) algo).sqr_bwd    (c[2], c[1]);
+	case SQRT:   return ((V&) algo).sqrt_bwd   (c[2], c[1]);
+	case EXP:    return ((V&) algo).exp_bwd    (c[2], c[1]);
+	case LOG:    return ((V&) algo).log_bwd    (c[2], c[1]);
+	case COS:    return ((V&) algo).cos_bwd    (c[2], c[1]);
+	case SIN:    return ((V&) algo).sin_bwd    (c[2], c[1]);
+	case TAN:    return ((V&) algo).tan_bwd    (c[2], c[1]);
+	case COSH:   return ((V&) algo).cosh_bwd   (c[2], c[1]);
+	case SINH:   return ((V&) algo).sinh_bwd   (c[2], c[1]);
+	case TANH:   return ((V&) algo).tanh_bwd   (c[2], c[1]);
+	case ACOS:   return ((V&) algo).acos_bwd   (c[2], c[1]);
+	case ASIN:   return ((V&) algo).asin_bwd   (c[2], c[1]);
+	case ATAN:   return ((V&) algo).atan_bwd   (c[2], c[1]);
+	case ACOSH:  return ((V&) algo).acosh_bwd  (c[2], c[1]);
+	case ASINH:  return ((V&) algo).asinh_bwd  (c[2], c[1]);
+	case ATANH:  return ((V&) algo).atanh_bwd  (c[2], c[1]);
+	default: 	 assert(false); return false;
 	}
 }
 
@@ -11,14 +11,17 @@
 
 #include "ibex_Function.h"
 #include "ibex_Eval.h"
+#include "ibex_BatchEval.h"
 
 #include <typeinfo>
+#include <algorithm>
+#include <functional>
 
 using namespace std;
 
 namespace ibex {
 
-Eval::Eval(Function& f) : f(f), d(f), fwd_agenda(NULL), bwd_agenda(NULL) {
+Eval::Eval(Function& f) : f(f), d(f), fwd_agenda(NULL), bwd_agenda(NULL), batch(NULL), context(NULL), incremental(NULL) {
 	int m=f.image_dim();
 	if (m>1) {
 		const ExprVector* vec=dynamic_cast<const ExprVector*>(&f.expr());
@@ -42,6 +45,12 @@ Eval::~Eval() {
 		delete[] fwd_agenda;
 		delete[] bwd_agenda;
 	}
+
+	if (batch!=NULL)
+		delete batch;
+
+	if (incremental!=NULL)
+		delete incremental;
 }
 
 Domain& Eval::eval(const Array<const Domain>& d2) {
@@ -54,11 +63,9 @@ Domain& Eval::eval(const Array<const Domain>& d2) {
 	//		cout << "arg[" << i << "]=" << f.arg_domains[i] << endl;
 	//	}
 
-	try {
-		f.forward<Eval>(*this);
-	} catch(EmptyBoxException&) {
+	if (!f.forward<Eval>(*this))
 		d.top->set_empty();
-	}
+
 	return *d.top;
 }
 
@@ -66,29 +73,59 @@ Domain& Eval::eval(const Array<Domain>& d2) {
 
 	d.write_arg_domains(d2);
 
-	try {
-		f.forward<Eval>(*this);
-	} catch(EmptyBoxException&) {
+	if (!f.forward<Eval>(*this))
 		d.top->set_empty();
-	}
+
 	return *d.top;
 }
 
 Domain& Eval::eval(const IntervalVector& box) {
 
+	if (incremental)
+		return incremental_eval(box);
+	else
+		return eval_nodes(box);
+}
+
+Domain& Eval::eval_nodes(const IntervalVector& box) {
+
 	d.write_arg_domains(box);
 
-	try {
-		f.forward<Eval>(*this);
-	} catch(EmptyBoxException&) {
+	if (!f.forward<Eval>(*this))
 		d.top->set_empty();
-	}
+
 	return *d.top;
 }
 
 IntervalVector Eval::eval(const IntervalVector& box, const BitSet& components) {
 
-	d.write_arg_domains(box);
+	assert(!components.empty());
+
+	if (incremental) {
+		int m=components.size();
+		IntervalVector res(m);
+
+		// all the components are calculated
+		Domain& y=incremental_eval(box);
+		if (y.is_empty())
+			res.set_empty();
+		else if (y.dim.is_scalar())
+			res[0] = y.i(); // components={0}
+		else {
+			assert(!y.dim.is_matrix());
+
+			int c;
+			for (int i=0; i<m; i++) {
+				c = (i==0 ? components.min() : components.next(c));
+				res[i] = y.v()[c];
+			}
+		}
+		return res;
+	} else
+		return eval_nodes(box, components);
+}
+
+IntervalVector Eval::eval_nodes(const IntervalVector& box, const BitSet& components) {
 
 	assert(!components.empty());
 
@@ -96,6 +133,8 @@ IntervalVector Eval::eval(const IntervalVector& box, const BitSet& components) {
 
 	IntervalVector res(m);
 
+	d.write_arg_domains(box);
+
 	if (fwd_agenda==NULL) {
 
 		assert(!f.expr().dim.is_matrix());
@@ -112,7 +151,7 @@ IntervalVector Eval::eval(const IntervalVector& box, const BitSet& components) {
 		int c;
 		for (int i=0; i<m; i++) {
 			c = (i==0 ? components.min() : components.next(c));
-			res[i] = f[c].eval(box);
+			res[i] = sub_context(f[c]).eval.eval(box).i();
 		}
 
 		return res;
@@ -126,30 +165,117 @@ IntervalVector Eval::eval(const IntervalVector& box, const BitSet& components) {
 		a.push(*(fwd_agenda[c]));
 	}
 
-	try {
-		f.cf.forward<Eval>(*this,a);
-
-		for (int i=0; i<m; i++) {
-			c = (i==0 ? components.min() : components.next(c));
-			res[i] = d[bwd_agenda[c]->first()].i();
-		}
-	} catch(EmptyBoxException&) {
+	if (!f.cf.forward<Eval>(*this,a)) {
 		d.top->set_empty();
 		res.set_empty();
+		return res;
+	}
+
+	for (int i=0; i<m; i++) {
+		c = (i==0 ? components.min() : components.next(c));
+		res[i] = d[bwd_agenda[c]->first()].i();
 	}
 
 	return res;
 }
 
-void Eval::idx_cp_fwd(int x, int y) {
+Eval::IncrementalData::IncrementalData(Function& f) : eval(new Eval(f)), box(f.nb_var()), valid(false),
+		dependents(f.nb_var()), dirty(f.nodes.size()), agenda(f.nodes.size()) {
+
+	// variables are numbered symbol by symbol, and row by row for matrices
+	int v=0;
+	for (int s=0; s<f.nb_arg(); s++) {
+		const ExprSymbol& x=f.arg(s);
+		for (int k=0; k<x.dim.size(); k++, v++) {
+			dependents[v] = f.cf.dependents(x, k/x.dim.nb_cols(), k%x.dim.nb_cols());
+		}
+	}
+}
+
+Eval::IncrementalData::~IncrementalData() {
+	delete eval;
+}
+
+void Eval::set_incremental(bool enabled) {
+	if (enabled && !incremental) {
+		incremental = new IncrementalData(f);
+		incremental->eval->context = context; // for the sub-functions
+	} else if (!enabled && incremental) {
+		delete incremental;
+		incremental = NULL;
+	}
+}
+
+Domain& Eval::incremental_eval(const IntervalVector& box) {
+
+	IncrementalData& inc=*incremental;
+	Eval& e=*inc.eval;
+
+	if (!inc.valid) {
+		Domain& y=e.eval_nodes(box);
+		inc.box=box;
+		inc.valid=!y.is_empty();
+		return y;
+	}
+
+	// collect the nodes that depend on modified variables
+	for (int v=0; v<box.size(); v++) {
+		if (box[v]!=inc.box[v]) {
+			for (vector<int>::const_iterator it=inc.dependents[v].begin(); it!=inc.dependents[v].end(); ++it) {
+				if (!inc.dirty[*it]) {
+					inc.dirty[*it]=true;
+					inc.nodes.push_back(*it);
+				}
+			}
+		}
+	}
+
+	inc.box=box;
+
+	if (inc.nodes.empty()) return *e.d.top;
+
+	// the other nodes are not touched
+	e.d.write_arg_domains(box);
+
+	// order of the forward phase
+	sort(inc.nodes.begin(), inc.nodes.end(), greater<int>());
+	for (vector<int>::const_iterator it=inc.nodes.begin(); it!=inc.nodes.end(); ++it) {
+		inc.dirty[*it]=false;
+		inc.agenda.push(*it);
+	}
+	inc.nodes.clear();
+
+	if (!f.cf.forward<Eval>(e,inc.agenda)) {
+		e.d.top->set_empty();
+		inc.valid=false;
+	}
+
+	inc.agenda.flush();
+
+	return *e.d.top;
+}
+
+void Eval::eval_batch(const IntervalVector* boxes, int N, IntervalVector* out) {
+	if (batch==NULL)
+		batch = new BatchEval(*this);
+
+	batch->eval(boxes, N, out);
+}
+
+EvalContext& Eval::sub_context(const Function& g) {
+	return context!=NULL ? context->context(g) : g.context();
+}
+
+bool Eval::idx_cp_fwd(int x, int y) {
 	assert(dynamic_cast<const ExprIndex*> (&f.node(y)));
 
 	const ExprIndex& e = (const ExprIndex&) f.node(y);
 
 	d[y] = d[x][e.index];
+	return true;
 }
 
-void Eval::apply_fwd(int* x, int y) {
+bool Eval::apply_fwd(int* x, int y) {
 	assert(dynamic_cast<const ExprApply*> (&f.node(y)));
 
 	const ExprApply& a = (const ExprApply&) f.node(y);
@@ -162,10 +288,11 @@ void Eval::apply_fwd(int* x, int y) {
 		d2.set_ref(i,d[x[i]]);
 	}
 
-	d[y] = a.func.basic_evaluator().eval(d2);
+	d[y] = sub_context(a.func).eval.eval(d2);
+	return !d[y].is_empty();
 }
 
-void Eval::vector_fwd(int* x, int y) {
+bool Eval::vector_fwd(int* x, int y) {
 	assert(dynamic_cast<const ExprVector*>(&(f.node(y))));
 
 	const ExprVector& v = (const ExprVector&) f.node(y);
@@ -212,21 +339,23 @@ void Eval::vector_fwd(int* x, int y) {
 
 		assert((v.row_vector() && j==v.dim.nb_cols()) || (!v.row_vector() && j==v.dim.nb_rows()));
 	}
-
+	return true;
 }
 
-void Eval::gen1_fwd(int x, int y) {
+bool Eval::gen1_fwd(int x, int y) {
 	assert(dynamic_cast<const ExprGenericUnaryOp*>(&(f.node(y))));
 
 	const ExprGenericUnaryOp& e = (const ExprGenericUnaryOp&) f.node(y);
 	d[y]=e.eval(d[x]);
+	return true;
 }
 
-void Eval::gen2_fwd(int x1, int x2, int y) {
+bool Eval::gen2_fwd(int x1, int x2, int y) {
 	assert(dynamic_cast<const ExprGenericBinaryOp*>(&(f.node(y))));
 
 	const ExprGenericBinaryOp& e = (const ExprGenericBinaryOp&) f.node(y);
 	d[y]=e.eval(d[x1],d[x2]);
+	return true;
 }
 
 
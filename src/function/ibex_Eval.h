@@ -13,12 +13,16 @@
 #define __IBEX_EVAL_H__
 
 #include <iostream>
+#include <vector>
 
 #include "ibex_ExprDomain.h"
+#include "ibex_Agenda.h"
 
 namespace ibex {
 
 class Function;
+class BatchEval;
+class EvalContext;
 
 /**
  * \ingroup symbolic
@@ -51,9 +55,29 @@ public:
 
 	/**
 	 * \brief Run the forward algorithm with an input box.
+	 *
+	 * \see #set_incremental(bool).
 	 */
 	Domain& eval(const IntervalVector& box);
 
+	/**
+	 * \brief Enable/disable the incremental mode.
+	 *
+	 * In incremental mode, eval(box) only recalculates the nodes that
+	 * depend on the variables whose domain has changed since the previous
+	 * call. The domains of the other nodes are kept from the previous
+	 * call. This is profitable when successive boxes only differ on few
+	 * variables (e.g., after a bisection) and the function has many
+	 * weakly coupled variables.
+	 *
+	 * The incremental evaluation has its own node domains: it does
+	 * not set #d and is not affected by the algorithms that modify #d
+	 * (HC4Revise, etc.). These algorithms resort to eval_nodes(...).
+	 *
+	 * By default, the incremental mode is disabled.
+	 */
+	void set_incremental(bool enabled);
+
 	/**
 	 * \brief Evaluate a subset of components.
 	 *
@@ -64,82 +88,137 @@ public:
 	 */
 	IntervalVector eval(const IntervalVector& box, const BitSet& components);
 
+	/**
+	 * \brief Run the forward algorithm with an input box and set #d.
+	 *
+	 * Same as eval(box) except that the incremental mode is ignored:
+	 * the domains of all the nodes (#d) are calculated. Must be called
+	 * by the algorithms that read #d afterwards (HC4Revise, Gradient, etc.).
+	 */
+	Domain& eval_nodes(const IntervalVector& box);
+
+	/**
+	 * \brief Evaluate a subset of components and set #d.
+	 *
+	 * Same as eval(box,components) except that the incremental
+	 * mode is ignored (see #eval_nodes(const IntervalVector&)).
+	 */
+	IntervalVector eval_nodes(const IntervalVector& box, const BitSet& components);
+
+	/**
+	 * \brief Evaluate f on N boxes at once.
+	 *
+	 * The result f(boxes[k]) is stored in out[k] (empty if boxes[k]
+	 * is outside the definition domain of f). Each node of the DAG is
+	 * processed once for all the boxes (see #ibex::BatchEval).
+	 *
+	 * \pre f is real or vector valued and each out[k] has the
+	 *      size f.image_dim().
+	 */
+	void eval_batch(const IntervalVector* boxes, int N, IntervalVector* out);
+
+	/**
+	 * \brief Context in which a sub-function g of f is evaluated.
+	 *
+	 * g is either a component of f or a function applied in
+	 * the expression of f. All the algorithms sharing this
+	 * evaluator (HC4Revise, Gradient, etc.) must resort to
+	 * this method instead of calling directly g.eval(...), etc.
+	 * (see #ibex::EvalContext).
+	 */
+	EvalContext& sub_context(const Function& g);
+
 protected:
 	/**
-	 * Class used internally to interrupt the forward procedure
-	 * when an empty domain occurs (<=> the input box is outside
-	 * the definition domain of the function).
+	 * Incremental version of eval(box).
 	 */
-	class EmptyBoxException { };
+	Domain& incremental_eval(const IntervalVector& box);
 
 public: // because called from CompiledFunction
 
-	       void vector_fwd (int* x, int y);
-	       void apply_fwd  (int* x, int y);
-	inline void idx_fwd    (int x, int y);
-	inline void idx_cp_fwd (int x, int y);
-	inline void symbol_fwd (int y);
-	inline void cst_fwd    (int y);
-	inline void chi_fwd    (int x1, int x2, int x3, int y);
-	inline void gen2_fwd   (int x, int x2, int y);
-	inline void add_fwd    (int x1, int x2, int y);
-	inline void mul_fwd    (int x1, int x2, int y);
-	inline void sub_fwd    (int x1, int x2, int y);
-	inline void div_fwd    (int x1, int x2, int y);
-	inline void max_fwd    (int x1, int x2, int y);
-	inline void min_fwd    (int x1, int x2, int y);
-	inline void atan2_fwd  (int x1, int x2, int y);
-	inline void gen1_fwd   (int x, int y);
-	inline void minus_fwd  (int x, int y);
-	inline void minus_V_fwd(int x, int y);
-	inline void minus_M_fwd(int x, int y);
-	inline void trans_V_fwd(int x, int y);
-	inline void trans_M_fwd(int x, int y);
-	inline void sign_fwd   (int x, int y);
-	inline void abs_fwd    (int x, int y);
-	inline void power_fwd  (int x, int y, int p);
-	inline void sqr_fwd    (int x, int y);
-	inline void sqrt_fwd   (int x, int y);
-	inline void exp_fwd    (int x, int y);
-	inline void log_fwd    (int x, int y);
-	inline void cos_fwd    (int x, int y);
-	inline void sin_fwd    (int x, int y);
-	inline void tan_fwd    (int x, int y);
-	inline void cosh_fwd   (int x, int y);
-	inline void sinh_fwd   (int x, int y);
-	inline void tanh_fwd   (int x, int y);
-	inline void acos_fwd   (int x, int y);
-	inline void asin_fwd   (int x, int y);
-	inline void atan_fwd   (int x, int y);
-	inline void acosh_fwd  (int x, int y);
-	inline void asinh_fwd  (int x, int y);
-	inline void atanh_fwd  (int x, int y);
-	inline void add_V_fwd  (int x1, int x2, int y);
-	inline void add_M_fwd  (int x1, int x2, int y);
-	inline void mul_SV_fwd (int x1, int x2, int y);
-	inline void mul_SM_fwd (int x1, int x2, int y);
-	inline void mul_VV_fwd (int x1, int x2, int y);
-	inline void mul_MV_fwd (int x1, int x2, int y);
-	inline void mul_VM_fwd (int x1, int x2, int y);
-	inline void mul_MM_fwd (int x1, int x2, int y);
-	inline void sub_V_fwd  (int x1, int x2, int y);
-	inline void sub_M_fwd  (int x1, int x2, int y);
+	       bool vector_fwd (int* x, int y);
+	       bool apply_fwd  (int* x, int y);
+	inline bool idx_fwd    (int x, int y);
+	inline bool idx_cp_fwd (int x, int y);
+	inline bool symbol_fwd (int y);
+	inline bool cst_fwd    (int y);
+	inline bool chi_fwd    (int x1, int x2, int x3, int y);
+	inline bool gen2_fwd   (int x, int x2, int y);
+	inline bool add_fwd    (int x1, int x2, int y);
+	inline bool mul_fwd    (int x1, int x2, int y);
+	inline bool sub_fwd    (int x1, int x2, int y);
+	inline bool div_fwd    (int x1, int x2, int y);
+	inline bool max_fwd    (int x1, int x2, int y);
+	inline bool min_fwd    (int x1, int x2, int y);
+	inline bool atan2_fwd  (int x1, int x2, int y);
+	inline bool gen1_fwd   (int x, int y);
+	inline bool minus_fwd  (int x, int y);
+	inline bool minus_V_fwd(int x, int y);
+	inline bool minus_M_fwd(int x, int y);
+	inline bool trans_V_fwd(int x, int y);
+	inline bool trans_M_fwd(int x, int y);
+	inline bool sign_fwd   (int x, int y);
+	inline bool abs_fwd    (int x, int y);
+	inline bool power_fwd  (int x, int y, int p);
+	inline bool sqr_fwd    (int x, int y);
+	inline bool sqrt_fwd   (int x, int y);
+	inline bool exp_fwd    (int x, int y);
+	inline bool log_fwd    (int x, int y);
+	inline bool cos_fwd    (int x, int y);
+	inline bool sin_fwd    (int x, int y);
+	inline bool tan_fwd    (int x, int y);
+	inline bool cosh_fwd   (int x, int y);
+	inline bool sinh_fwd   (int x, int y);
+	inline bool tanh_fwd   (int x, int y);
+	inline bool acos_fwd   (int x, int y);
+	inline bool asin_fwd   (int x, int y);
+	inline bool atan_fwd   (int x, int y);
+	inline bool acosh_fwd  (int x, int y);
+	inline bool asinh_fwd  (int x, int y);
+	inline bool atanh_fwd  (int x, int y);
+	inline bool add_V_fwd  (int x1, int x2, int y);
+	inline bool add_M_fwd  (int x1, int x2, int y);
+	inline bool mul_SV_fwd (int x1, int x2, int y);
+	inline bool mul_SM_fwd (int x1, int x2, int y);
+	inline bool mul_VV_fwd (int x1, int x2, int y);
+	inline bool mul_MV_fwd (int x1, int x2, int y);
+	inline bool mul_VM_fwd (int x1, int x2, int y);
+	inline bool mul_MM_fwd (int x1, int x2, int y);
+	inline bool sub_V_fwd  (int x1, int x2, int y);
+	inline bool sub_M_fwd  (int x1, int x2, int y);
 
 	Function& f;
 	ExprDomain d;
 	Agenda** fwd_agenda; // one agenda for each component
 	Agenda** bwd_agenda; // one agenda for each component
+	BatchEval* batch;    // only built if eval_batch is called
+	EvalContext* context; // the context this evaluator belongs to (NULL if default)
+
+protected:
+	// Data of the incremental mode (only built if set_incremental is called)
+	struct IncrementalData {
+		IncrementalData(Function& f);
+		~IncrementalData();
+		Eval* eval;                       // evaluator with the node domains of the last forward phase
+		IntervalVector box;               // the input box of the last forward phase
+		bool valid;                       // false if the node domains have to be recalculated
+		std::vector<std::vector<int> > dependents; // nodes depending on each variable
+		std::vector<bool> dirty;          // the nodes to recalculate
+		std::vector<int> nodes;           // the same nodes
+		Agenda agenda;                    // the same nodes, in the order of the forward phase
+	};
+	IncrementalData* incremental;
 };
 
 /* ============================================================================
  	 	 	 	 	 	 	 implementation
   ============================================================================*/
 
-inline void Eval::idx_fwd(int, int) { /* nothing to do */ }
+inline bool Eval::idx_fwd(int, int) { /* nothing to do */ return true; }
 
-inline void Eval::symbol_fwd(int) { /* nothing to do */ }
+inline bool Eval::symbol_fwd(int) { /* nothing to do */ return true; }
 
-inline void Eval::cst_fwd(int y) {
+inline bool Eval::cst_fwd(int y) {
 	const ExprConstant& c = (const ExprConstant&) f.node(y);
 	switch (c.type()) {
 	case Dim::SCALAR:       d[y].i() = c.get_value();         break;
@@ -147,52 +226,53 @@ inline void Eval::cst_fwd(int y) {
 	case Dim::COL_VECTOR:   d[y].v() = c.get_vector_value();  break;
 	case Dim::MATRIX:       d[y].m() = c.get_matrix_value();  break;
 	}
+	return true;
 }
 
-inline void Eval::chi_fwd(int x1, int x2, int x3, int y) { d[y].i() = chi(d[x1].i(),d[x2].i(),d[x3].i()); }
-inline void Eval::add_fwd(int x1, int x2, int y)   { d[y].i()=d[x1].i()+d[x2].i(); }
-inline void Eval::mul_fwd(int x1, int x2, int y)   { d[y].i()=d[x1].i()*d[x2].i(); }
-inline void Eval::sub_fwd(int x1, int x2, int y)   { d[y].i()=d[x1].i()-d[x2].i(); }
-inline void Eval::div_fwd(int x1, int x2, int y)   { d[y].i()=d[x1].i()/d[x2].i(); }
-inline void Eval::max_fwd(int x1, int x2, int y)   { d[y].i()=max(d[x1].i(),d[x2].i()); }
-inline void Eval::min_fwd(int x1, int x2, int y)   { d[y].i()=min(d[x1].i(),d[x2].i()); }
-inline void Eval::atan2_fwd(int x1, int x2, int y) { d[y].i()=atan2(d[x1].i(),d[x2].i()); }
-
-inline void Eval::minus_fwd(int x, int y)          { d[y].i()=-d[x].i(); }
-inline void Eval::minus_V_fwd(int x, int y)        { d[y].v()=-d[x].v(); }
-inline void Eval::minus_M_fwd(int x, int y)        { d[y].m()=-d[x].m(); }
-inline void Eval::sign_fwd(int x, int y)           { d[y].i()=sign(d[x].i()); }
-inline void Eval::abs_fwd(int x, int y)            { d[y].i()=abs(d[x].i()); }
-inline void Eval::power_fwd(int x, int y, int p)   { d[y].i()=pow(d[x].i(),p); }
-inline void Eval::sqr_fwd(int x, int y)            { d[y].i()=sqr(d[x].i()); }
-inline void Eval::sqrt_fwd(int x, int y)           { if ((d[y].i()=sqrt(d[x].i())).is_empty()) throw EmptyBoxException(); }
-inline void Eval::exp_fwd(int x, int y)            { d[y].i()=exp(d[x].i()); }
-inline void Eval::log_fwd(int x, int y)            { if ((d[y].i()=log(d[x].i())).is_empty()) throw EmptyBoxException(); }
-inline void Eval::cos_fwd(int x, int y)            { d[y].i()=cos(d[x].i()); }
-inline void Eval::sin_fwd(int x, int y)            { d[y].i()=sin(d[x].i()); }
-inline void Eval::tan_fwd(int x, int y)            { if ((d[y].i()=tan(d[x].i())).is_empty()) throw EmptyBoxException(); }
-inline void Eval::cosh_fwd(int x, int y)           { d[y].i()=cosh(d[x].i()); }
-inline void Eval::sinh_fwd(int x, int y)           { d[y].i()=sinh(d[x].i()); }
-inline void Eval::tanh_fwd(int x, int y)           { d[y].i()=tanh(d[x].i()); }
-inline void Eval::acos_fwd(int x, int y)           { if ((d[y].i()=acos(d[x].i())).is_empty()) throw EmptyBoxException(); }
-inline void Eval::asin_fwd(int x, int y)           { if ((d[y].i()=asin(d[x].i())).is_empty()) throw EmptyBoxException(); }
-inline void Eval::atan_fwd(int x, int y)           { d[y].i()=atan(d[x].i()); }
-inline void Eval::acosh_fwd(int x, int y)          { if ((d[y].i()=acosh(d[x].i())).is_empty()) throw EmptyBoxException(); }
-inline void Eval::asinh_fwd(int x, int y)          { d[y].i()=asinh(d[x].i()); }
-inline void Eval::atanh_fwd(int x, int y)          { if ((d[y].i()=atanh(d[x].i())).is_empty()) throw EmptyBoxException(); }
-
-inline void Eval::trans_V_fwd(int x, int y)        { d[y].v()=d[x].v(); }
-inline void Eval::trans_M_fwd(int x, int y)        { d[y].m()=d[x].m().transpose(); }
-inline void Eval::add_V_fwd(int x1, int x2, int y) { d[y].v()=d[x1].v()+d[x2].v(); }
-inline void Eval::add_M_fwd(int x1, int x2, int y) { d[y].m()=d[x1].m()+d[x2].m(); }
-inline void Eval::mul_SV_fwd(int x1, int x2, int y){ d[y].v()=d[x1].i()*d[x2].v(); }
-inline void Eval::mul_SM_fwd(int x1, int x2, int y){ d[y].m()=d[x1].i()*d[x2].m(); }
-inline void Eval::mul_VV_fwd(int x1, int x2, int y){ d[y].i()=d[x1].v()*d[x2].v(); }
-inline void Eval::mul_MV_fwd(int x1, int x2, int y){ d[y].v()=d[x1].m()*d[x2].v(); }
-inline void Eval::mul_VM_fwd(int x1, int x2, int y){ d[y].v()=d[x1].v()*d[x2].m(); }
-inline void Eval::mul_MM_fwd(int x1, int x2, int y){ d[y].m()=d[x1].m()*d[x2].m(); }
-inline void Eval::sub_V_fwd(int x1, int x2, int y) { d[y].v()=d[x1].v()-d[x2].v(); }
-inline void Eval::sub_M_fwd(int x1, int x2, int y) { d[y].m()=d[x1].m()-d[x2].m(); }
+inline bool Eval::chi_fwd(int x1, int x2, int x3, int y) { d[y].i() = chi(d[x1].i(),d[x2].i(),d[x3].i()); return true; }
+inline bool Eval::add_fwd(int x1, int x2, int y)   { d[y].i()=d[x1].i()+d[x2].i(); return true; }
+inline bool Eval::mul_fwd(int x1, int x2, int y)   { d[y].i()=d[x1].i()*d[x2].i(); return true; }
+inline bool Eval::sub_fwd(int x1, int x2, int y)   { d[y].i()=d[x1].i()-d[x2].i(); return true; }
+inline bool Eval::div_fwd(int x1, int x2, int y)   { d[y].i()=d[x1].i()/d[x2].i(); return true; }
+inline bool Eval::max_fwd(int x1, int x2, int y)   { d[y].i()=max(d[x1].i(),d[x2].i()); return true; }
+inline bool Eval::min_fwd(int x1, int x2, int y)   { d[y].i()=min(d[x1].i(),d[x2].i()); return true; }
+inline bool Eval::atan2_fwd(int x1, int x2, int y) { d[y].i()=atan2(d[x1].i(),d[x2].i()); return true; }
+
+inline bool Eval::minus_fwd(int x, int y)          { d[y].i()=-d[x].i(); return true; }
+inline bool Eval::minus_V_fwd(int x, int y)        { d[y].v()=-d[x].v(); return true; }
+inline bool Eval::minus_M_fwd(int x, int y)        { d[y].m()=-d[x].m(); return true; }
+inline bool Eval::sign_fwd(int x, int y)           { d[y].i()=sign(d[x].i()); return true; }
+inline bool Eval::abs_fwd(int x, int y)            { d[y].i()=abs(d[x].i()); return true; }
+inline bool Eval::power_fwd(int x, int y, int p)   { d[y].i()=pow(d[x].i(),p); return true; }
+inline bool Eval::sqr_fwd(int x, int y)            { d[y].i()=sqr(d[x].i()); return true; }
+inline bool Eval::sqrt_fwd(int x, int y)           { return !(d[y].i()=sqrt(d[x].i())).is_empty(); }
+inline bool Eval::exp_fwd(int x, int y)            { d[y].i()=exp(d[x].i()); return true; }
+inline bool Eval::log_fwd(int x, int y)            { return !(d[y].i()=log(d[x].i())).is_empty(); }
+inline bool Eval::cos_fwd(int x, int y)            { d[y].i()=cos(d[x].i()); return true; }
+inline bool Eval::sin_fwd(int x, int y)            { d[y].i()=sin(d[x].i()); return true; }
+inline bool Eval::tan_fwd(int x, int y)            { return !(d[y].i()=tan(d[x].i())).is_empty(); }
+inline bool Eval::cosh_fwd(int x, int y)           { d[y].i()=cosh(d[x].i()); return true; }
+inline bool Eval::sinh_fwd(int x, int y)           { d[y].i()=sinh(d[x].i()); return true; }
+inline bool Eval::tanh_fwd(int x, int y)           { d[y].i()=tanh(d[x].i()); return true; }
+inline bool Eval::acos_fwd(int x, int y)           { return !(d[y].i()=acos(d[x].i())).is_empty(); }
+inline bool Eval::asin_fwd(int x, int y)           { return !(d[y].i()=asin(d[x].i())).is_empty(); }
+inline bool Eval::atan_fwd(int x, int y)           { d[y].i()=atan(d[x].i()); return true; }
+inline bool Eval::acosh_fwd(int x, int y)          { return !(d[y].i()=acosh(d[x].i())).is_empty(); }
+inline bool Eval::asinh_fwd(int x, int y)          { d[y].i()=asinh(d[x].i()); return true; }
+inline bool Eval::atanh_fwd(int x, int y)          { return !(d[y].i()=atanh(d[x].i())).is_empty(); }
+
+inline bool Eval::trans_V_fwd(int x, int y)        { d[y].v()=d[x].v(); return true; }
+inline bool Eval::trans_M_fwd(int x, int y)        { d[y].m()=d[x].m().transpose(); return true; }
+inline bool Eval::add_V_fwd(int x1, int x2, int y) { d[y].v()=d[x1].v()+d[x2].v(); return true; }
+inline bool Eval::add_M_fwd(int x1, int x2, int y) { d[y].m()=d[x1].m()+d[x2].m(); return true; }
+inline bool Eval::mul_SV_fwd(int x1, int x2, int y){ d[y].v()=d[x1].i()*d[x2].v(); return true; }
+inline bool Eval::mul_SM_fwd(int x1, int x2, int y){ d[y].m()=d[x1].i()*d[x2].m(); return true; }
+inline bool Eval::mul_VV_fwd(int x1, int x2, int y){ d[y].i()=d[x1].v()*d[x2].v(); return true; }
+inline bool Eval::mul_MV_fwd(int x1, int x2, int y){ d[y].v()=d[x1].m()*d[x2].v(); return true; }
+inline bool Eval::mul_VM_fwd(int x1, int x2, int y){ d[y].v()=d[x1].v()*d[x2].m(); return true; }
+inline bool Eval::mul_MM_fwd(int x1, int x2, int y){ d[y].m()=d[x1].m()*d[x2].m(); return true; }
+inline bool Eval::sub_V_fwd(int x1, int x2, int y) { d[y].v()=d[x1].v()-d[x2].v(); return true; }
+inline bool Eval::sub_M_fwd(int x1, int x2, int y) { d[y].m()=d[x1].m()-d[x2].m(); return true; }
 
 } // namespace ibex
 
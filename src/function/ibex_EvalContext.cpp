@@ -0,0 +1,98 @@
+/* ============================================================================
+ * I B E X - Evaluation context of a function
+ * ============================================================================
+ * Copyright   : IMT Atlantique (FRANCE)
+ * License     : This program can be distributed under the terms of the GNU LGPL.
+ *               See the file COPYING.LESSER.
+ *
+ * Author(s)   : Gilles Chabert
+ * Created     : Oct 17, 2026
+ * ---------------------------------------------------------------------------- */
+
+#include "ibex_Function.h"
+#include "ibex_EvalContext.h"
+
+using namespace std;
+
+namespace ibex {
+
+namespace {
+
+/*
+ * Generate in advance all the sub-functions that may
+ * be generated lazily during an evaluation (this is the
+ * only part of a function which is not immutable).
+ *
+ * The components are required for:
+ * - evaluating/differentiating a subset of components when
+ *   the function is not a vector of expressions;
+ * - differentiating a vector-valued function applied
+ *   in another expression.
+ */
+void prepare(const Function& g, bool applied) {
+	if (g.image_dim()>1 && (applied || g.basic_evaluator().fwd_agenda==NULL)) {
+		g[0]; // generate all the components
+		for (int i=0; i<g.image_dim(); i++)
+			if (&g[i]!=&g) prepare(g[i], false);
+	}
+
+	for (int i=0; i<g.nodes.size(); i++) {
+		const ExprApply* a=dynamic_cast<const ExprApply*>(&g.node(i));
+		if (a) prepare(a->func, true);
+	}
+}
+
+}
+
+EvalContext::EvalContext(const Function& f) : f(f),
+		eval(*new Eval((Function&) f)),
+		hc4revise(*new HC4Revise(eval)),
+		grad(*new Gradient(eval)),
+		inhc4revise(*new InHC4Revise(eval)),
+		is_default(false) {
+	init();
+}
+
+EvalContext::EvalContext(const Function& f, bool is_default) : f(f),
+		eval(is_default ? *f._eval : *new Eval((Function&) f)),
+		hc4revise(is_default ? *f._hc4revise : *new HC4Revise(eval)),
+		grad(is_default ? *f._grad : *new Gradient(eval)),
+		inhc4revise(is_default ? *f._inhc4revise : *new InHC4Revise(eval)),
+		is_default(is_default) {
+	init();
+}
+
+void EvalContext::init() {
+	if (!is_default) {
+		eval.context = this;
+		inhc4revise.p_eval.context = this;
+		prepare(f, false);
+	}
+}
+
+EvalContext::~EvalContext() {
+	if (!is_default) {
+		for (map<const Function*, EvalContext*>::iterator it=sub.begin(); it!=sub.end(); ++it)
+			delete it->second;
+
+		delete &inhc4revise;
+		delete &grad;
+		delete &hc4revise;
+		delete &eval;
+	}
+}
+
+EvalContext& EvalContext::context(const Function& g) {
+	if (&g==&f) return *this;
+
+	if (is_default) return g.context();
+
+	map<const Function*, EvalContext*>::iterator it=sub.find(&g);
+	if (it!=sub.end()) return *it->second;
+
+	EvalContext* c=new EvalContext(g);
+	sub.insert(make_pair(&g,c));
+	return *c;
+}
+
+} // namespace ibex
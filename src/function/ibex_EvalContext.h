@@ -0,0 +1,130 @@
+/* ============================================================================
+ * I B E X - Evaluation context of a function
+ * ============================================================================
+ * Copyright   : IMT Atlantique (FRANCE)
+ * License     : This program can be distributed under the terms of the GNU LGPL.
+ *               See the file COPYING.LESSER.
+ *
+ * Author(s)   : Gilles Chabert
+ * Created     : Oct 17, 2026
+ * ---------------------------------------------------------------------------- */
+
+#ifndef __IBEX_EVAL_CONTEXT_H__
+#define __IBEX_EVAL_CONTEXT_H__
+
+#include <map>
+
+namespace ibex {
+
+class Function;
+class Eval;
+class HC4Revise;
+class Gradient;
+class InHC4Revise;
+
+/**
+ * \ingroup symbolic
+ *
+ * \brief Evaluation context of a function.
+ *
+ * A function is made of an immutable part (the DAG of
+ * the expression and its compiled version) and of a mutable
+ * part: the domains of all the nodes, that are overwritten
+ * by every forward/backward algorithm (Eval, HC4Revise, Gradient, etc.).
+ *
+ * An evaluation context gathers all the algorithms that work on
+ * a function together with their node domains. Each function owns a
+ * default context (used by f.eval(...), f.gradient(...), etc.).
+ * Other contexts can be created and passed to the overloaded
+ * variants of these methods (f.eval(box,context), etc.).
+ * Since two contexts do not share any mutable data, the same
+ * function can be evaluated simultaneously by several threads
+ * provided that each thread uses its own context.
+ *
+ * The evaluation of sub-functions (components of f and functions
+ * applied inside the expression of f) is also performed in
+ * contexts owned by this context.
+ *
+ * \warning The construction of a context is not thread-safe
+ *          (it may generate the components of f). Contexts
+ *          should therefore be created before threads are launched.
+ */
+class EvalContext {
+public:
+	/**
+	 * \brief Create a new context for f.
+	 */
+	EvalContext(const Function& f);
+
+	/**
+	 * \brief Delete this.
+	 */
+	~EvalContext();
+
+	/**
+	 * \brief Get the context of a sub-function g.
+	 *
+	 * g is either a component of f or a function applied
+	 * in the expression of f.
+	 *
+	 * If this context is the default context of f, the result
+	 * is the default context of g. Otherwise, a context owned by
+	 * this one is returned (created on first call).
+	 */
+	EvalContext& context(const Function& g);
+
+	/**
+	 * \brief The function.
+	 */
+	const Function& f;
+
+	/**
+	 * \brief The evaluator.
+	 */
+	Eval& eval;
+
+	/**
+	 * \brief The HC4Revise algorithm.
+	 */
+	HC4Revise& hc4revise;
+
+	/**
+	 * \brief The gradient calculator.
+	 */
+	Gradient& grad;
+
+	/**
+	 * \brief The InHC4Revise algorithm.
+	 */
+	InHC4Revise& inhc4revise;
+
+private:
+	friend class Function;
+
+	/**
+	 * Create either the default context of f
+	 * or a new context.
+	 */
+	EvalContext(const Function& f, bool is_default);
+
+	EvalContext(const EvalContext&); // forbidden
+
+	/**
+	 * Initialize the structure.
+	 */
+	void init();
+
+	/*
+	 * True if this is the default context of f.
+	 */
+	const bool is_default;
+
+	/*
+	 * Contexts of sub-functions (only used if is_default==false).
+	 */
+	std::map<const Function*, EvalContext*> sub;
+};
+
+} // namespace ibex
+
+#endif // __IBEX_EVAL_CONTEXT_H__
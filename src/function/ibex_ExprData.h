@@ -30,6 +30,11 @@ public:
 	 */
 	void build(ExprData<T>& data) const;
 
+	/**
+	 * \brief Create the factory.
+	 */
+	ExprDataFactory();
+
 	/**
 	 * (Does nothing)
 	 */
@@ -398,6 +403,11 @@ std::ostream& operator<<(std::ostream& os, const ExprData<T>&);
 /* ============================================================================
  	 	 	 	 	 	 	 implementation
   ============================================================================*/
+template<class T>
+ExprDataFactory<T>::ExprDataFactory() : data(NULL) {
+
+}
+
 template<class T>
 ExprDataFactory<T>::~ExprDataFactory() {
 
@@ -0,0 +1,97 @@
+/* ============================================================================
+ * I B E X - Arena of node domains
+ * ============================================================================
+ * Copyright   : IMT Atlantique (FRANCE)
+ * License     : This program can be distributed under the terms of the GNU LGPL.
+ *               See the file COPYING.LESSER.
+ *
+ * Author(s)   : Gilles Chabert
+ * Created     : Oct 17, 2026
+ * ---------------------------------------------------------------------------- */
+
+#include "ibex_Function.h"
+
+namespace ibex {
+
+ExprDomainLayout::ExprDomainLayout(const Function& f) : nb_nodes(f.nodes.size()),
+		nb_scalars(0), nb_vectors(0), nb_matrices(0), nb_rows(0), nb_entries(0) {
+
+	for (int i=0; i<nb_nodes; i++) {
+		const ExprNode& e=f.nodes[i];
+
+		// nodes with a reference domain (see ExprDomainFactory)
+		const ExprIndex* idx=dynamic_cast<const ExprIndex*>(&e);
+		if (idx && idx->index.domain_ref()) continue;
+		if (dynamic_cast<const ExprTrans*>(&e) && e.dim.is_vector()) continue;
+
+		switch(e.dim.type()) {
+		case Dim::SCALAR:
+			nb_scalars++;
+			break;
+		case Dim::ROW_VECTOR:
+		case Dim::COL_VECTOR:
+			nb_vectors++;
+			nb_entries+=e.dim.vec_size();
+			break;
+		default:
+			nb_matrices++;
+			nb_rows+=e.dim.nb_rows();
+			nb_entries+=e.dim.nb_rows()*e.dim.nb_cols();
+		}
+	}
+}
+
+template<>
+bool ExprDomainArena<Interval>::flat() {
+	return true;
+}
+
+template<>
+IntervalVector* ExprDomainArena<Interval>::new_vector(int n) {
+	assert(vectors_size<nb_vectors);
+	assert(entries_size+n<=nb_entries);
+
+	IntervalVector* v=new (&vectors[vectors_size++]) IntervalVector();
+	v->n=n;
+	v->vec=&scalars[nb_scalars+entries_size];
+	entries_size+=n;
+	return v;
+}
+
+template<>
+IntervalMatrix* ExprDomainArena<Interval>::new_matrix(int m, int n) {
+	assert(matrices_size<nb_matrices);
+	assert(rows_size+m<=nb_rows);
+
+	IntervalMatrix* M=new (&matrices[matrices_size++]) IntervalMatrix();
+	M->_nb_rows=m;
+	M->_nb_cols=n;
+	M->M=&rows[rows_size];
+	for (int i=0; i<m; i++) {
+		IntervalVector* row=new (&rows[rows_size++]) IntervalVector();
+		row->n=n;
+		row->vec=&scalars[nb_scalars+entries_size];
+		entries_size+=n;
+	}
+	return M;
+}
+
+template<>
+void ExprDomainArena<Interval>::detach() {
+	// the components belong to the scalar block
+	for (int i=0; i<vectors_size; i++) {
+		vectors[i].n=0;
+		vectors[i].vec=NULL;
+	}
+	for (int i=0; i<matrices_size; i++) {
+		matrices[i]._nb_rows=0;
+		matrices[i]._nb_cols=0;
+		matrices[i].M=NULL;
+	}
+	for (int i=0; i<rows_size; i++) {
+		rows[i].n=0;
+		rows[i].vec=NULL;
+	}
+}
+
+} // namespace ibex
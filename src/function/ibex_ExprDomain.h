@@ -2,14 +2,102 @@
 #define __IBEX_EXPR_DOMAIN__
 
 #include <iostream>
+#include <algorithm>
+#include <new>
 
 #include "ibex_ExprData.h"
+#include "ibex_Domain.h"
 
 namespace ibex {
 
+/**
+ * \brief Sizes of the node domains of a function.
+ *
+ * The nodes whose domain is a reference to another domain
+ * (indices that can be references, transposed vectors)
+ * have no payload.
+ */
+class ExprDomainLayout {
+public:
+	/** Calculate the sizes for the nodes of f. */
+	explicit ExprDomainLayout(const Function& f);
+
+	/** Number of nodes. */
+	int nb_nodes;
+	/** Number of scalar payloads. */
+	int nb_scalars;
+	/** Number of vector payloads. */
+	int nb_vectors;
+	/** Number of matrix payloads. */
+	int nb_matrices;
+	/** Total number of rows of the matrix payloads. */
+	int nb_rows;
+	/** Total number of components of the vector/matrix payloads. */
+	int nb_entries;
+};
+
+/**
+ * \brief Arena of the node domains of a function.
+ *
+ * Instead of allocating the domain of each node separately,
+ * the domains of all the nodes of a function are allocated in a
+ * few contiguous blocks: the TemplateDomain objects, the scalar
+ * payloads (packed densely) and the vector/matrix payloads
+ * (back to back).
+ *
+ * With D=Interval, the components of the vectors and the matrices
+ * are stored in the same block, right after the scalars. All the node
+ * domains can then be copied by a single block copy.
+ */
+template<class D>
+class ExprDomainArena : protected ExprDomainLayout {
+public:
+	/** Create an arena for the nodes of f. */
+	explicit ExprDomainArena(const Function& f);
+
+	/** Delete this. */
+	~ExprDomainArena();
+
+	/** Create the domain of the next node as a reference to d. */
+	TemplateDomain<D>* ref(TemplateDomain<D>& d);
+
+	/** Create the domain of the next node, with a new payload. */
+	TemplateDomain<D>* alloc(const Dim& dim);
+
+	/** Copy the payloads of another arena of the same function. */
+	void assign(const ExprDomainArena<D>& a);
+
+protected:
+	/** True if the vector/matrix components are stored in the scalar block. */
+	static bool flat();
+	/** Create a new vector payload. */
+	typename D::VECTOR* new_vector(int n);
+	/** Create a new matrix payload. */
+	typename D::MATRIX* new_matrix(int m, int n);
+	/** Detach the vector/matrix payloads from the scalar block (flat arenas). */
+	void detach();
+
+	typedef typename D::VECTOR VECTOR;
+	typedef typename D::MATRIX MATRIX;
+
+	TemplateDomain<D>* nodes;     // the domains of the nodes
+	typename D::SCALAR* scalars;  // the scalar payloads (+ the components if flat)
+	typename D::VECTOR* vectors;  // the vector payloads
+	typename D::MATRIX* matrices; // the matrix payloads
+	typename D::VECTOR* rows;     // the rows of the matrix payloads (if flat)
+	int nodes_size, scalars_size, vectors_size, matrices_size, rows_size, entries_size;
+};
+
+template<> bool ExprDomainArena<Interval>::flat();
+template<> IntervalVector* ExprDomainArena<Interval>::new_vector(int n);
+template<> IntervalMatrix* ExprDomainArena<Interval>::new_matrix(int m, int n);
+template<> void ExprDomainArena<Interval>::detach();
+
 template<class D>
 class ExprDomainFactory : public ExprDataFactory<TemplateDomain<D> > {
 public:
+	/** Create a factory that builds the domains in an arena. */
+	explicit ExprDomainFactory(ExprDomainArena<D>& arena);
 	/** Delete this. */
 	virtual ~ExprDomainFactory();
 	/** Visit an indexed expression. */
@@ -24,6 +112,9 @@ public:
 	virtual TemplateDomain<D>* init(const ExprUnaryOp& e, TemplateDomain<D>& expr_deco);
 	/** Visit a transpose. */
 	virtual TemplateDomain<D>* init(const ExprTrans& e, TemplateDomain<D>& expr_deco);
+
+protected:
+	ExprDomainArena<D>& arena;
 };
 
 /**
@@ -34,12 +125,25 @@ public:
  *
  */
 template<class D>
-class ExprTemplateDomain : public ExprData<TemplateDomain<D> > {
+class ExprTemplateDomain : private ExprDomainArena<D>, public ExprData<TemplateDomain<D> > {
 public:
 
+	/**
+	 * \brief Create the domains of the nodes of f.
+	 *
+	 * All the domains are allocated in a single arena.
+	 */
 	ExprTemplateDomain(const Function& f);
 
-	~ExprTemplateDomain();
+	/**
+	 * \brief Duplicate the domains (e.g., for another thread).
+	 */
+	ExprTemplateDomain(const ExprTemplateDomain& d);
+
+	/**
+	 * \brief Copy the domains of another object for the same function.
+	 */
+	ExprTemplateDomain& operator=(const ExprTemplateDomain& d);
 
 	// Why my compiler forces me to redeclare these functions?
 	// ------------------------------------------------------
@@ -86,9 +190,6 @@ public:
 	 * \see #ibex::ExprLabel
 	 */
 	void read_arg_domains(typename D::VECTOR& box) const;
-
-private:
-	ExprTemplateDomain(const ExprTemplateDomain&); // forbidden
 };
 
 typedef ExprTemplateDomain<Interval> ExprDomain;
@@ -96,6 +197,104 @@ typedef ExprTemplateDomain<Interval> ExprDomain;
 /* ============================================================================
  	 	 	 	 	 	 	 inline implementation
   ============================================================================*/
+template<class D>
+ExprDomainArena<D>::ExprDomainArena(const Function& f) : ExprDomainLayout(f),
+		nodes((TemplateDomain<D>*) ::operator new(nb_nodes*sizeof(TemplateDomain<D>))),
+		scalars(new typename D::SCALAR[nb_scalars + (flat()? nb_entries : 0)]),
+		vectors((typename D::VECTOR*) ::operator new(nb_vectors*sizeof(typename D::VECTOR))),
+		matrices((typename D::MATRIX*) ::operator new(nb_matrices*sizeof(typename D::MATRIX))),
+		rows((typename D::VECTOR*) ::operator new((flat()? nb_rows : 0)*sizeof(typename D::VECTOR))),
+		nodes_size(0), scalars_size(0), vectors_size(0), matrices_size(0), rows_size(0), entries_size(0) {
+
+}
+
+template<class D>
+ExprDomainArena<D>::~ExprDomainArena() {
+	for (int i=0; i<nodes_size; i++)
+		nodes[i].~TemplateDomain<D>();
+
+	detach();
+
+	for (int i=0; i<vectors_size; i++)
+		vectors[i].~VECTOR();
+	for (int i=0; i<matrices_size; i++)
+		matrices[i].~MATRIX();
+	for (int i=0; i<rows_size; i++)
+		rows[i].~VECTOR();
+
+	::operator delete(nodes);
+	delete[] scalars;
+	::operator delete(vectors);
+	::operator delete(matrices);
+	::operator delete(rows);
+}
+
+template<class D>
+TemplateDomain<D>* ExprDomainArena<D>::ref(TemplateDomain<D>& d) {
+	assert(nodes_size<nb_nodes);
+	return new (&nodes[nodes_size++]) TemplateDomain<D>(d,true);
+}
+
+template<class D>
+TemplateDomain<D>* ExprDomainArena<D>::alloc(const Dim& dim) {
+	assert(nodes_size<nb_nodes);
+	TemplateDomain<D>* node=&nodes[nodes_size++];
+
+	// note: the domain is a reference as the payload belongs to the arena.
+	switch(dim.type()) {
+	case Dim::SCALAR:
+		assert(scalars_size<nb_scalars);
+		return new (node) TemplateDomain<D>(scalars[scalars_size++]);
+	case Dim::ROW_VECTOR:
+		return new (node) TemplateDomain<D>(*new_vector(dim.nb_cols()),true);
+	case Dim::COL_VECTOR:
+		return new (node) TemplateDomain<D>(*new_vector(dim.nb_rows()),false);
+	default:
+		return new (node) TemplateDomain<D>(*new_matrix(dim.nb_rows(),dim.nb_cols()));
+	}
+}
+
+template<class D>
+void ExprDomainArena<D>::assign(const ExprDomainArena<D>& a) {
+	assert(a.nodes_size==nodes_size);
+
+	std::copy(a.scalars, a.scalars+nb_scalars+(flat()? nb_entries : 0), scalars);
+
+	if (!flat()) {
+		for (int i=0; i<vectors_size; i++)
+			vectors[i]=a.vectors[i];
+		for (int i=0; i<matrices_size; i++)
+			matrices[i]=a.matrices[i];
+	}
+}
+
+template<class D>
+bool ExprDomainArena<D>::flat() {
+	return false;
+}
+
+template<class D>
+typename D::VECTOR* ExprDomainArena<D>::new_vector(int n) {
+	assert(vectors_size<nb_vectors);
+	return new (&vectors[vectors_size++]) typename D::VECTOR(n);
+}
+
+template<class D>
+typename D::MATRIX* ExprDomainArena<D>::new_matrix(int m, int n) {
+	assert(matrices_size<nb_matrices);
+	return new (&matrices[matrices_size++]) typename D::MATRIX(m,n);
+}
+
+template<class D>
+void ExprDomainArena<D>::detach() {
+	// nothing to do: the components belong to the payloads.
+}
+
+template<class D>
+ExprDomainFactory<D>::ExprDomainFactory(ExprDomainArena<D>& arena) : arena(arena) {
+
+}
+
 template<class D>
 ExprDomainFactory<D>::~ExprDomainFactory() {
 
@@ -103,28 +302,34 @@ ExprDomainFactory<D>::~ExprDomainFactory() {
 
 template<class D>
 TemplateDomain<D>* ExprDomainFactory<D>::init(const ExprIndex& e, TemplateDomain<D>& d_expr) {
-	TemplateDomain<D> d(d_expr[e.index]); // Depending on the type of index, can be a reference or a copy.
-	return new TemplateDomain<D>(d,d.is_reference);
+	if (e.index.domain_ref()) {
+		TemplateDomain<D> d(d_expr[e.index]);
+		return arena.ref(d);
+	} else {
+		TemplateDomain<D>* d=arena.alloc(e.dim);
+		*d = d_expr[e.index];
+		return d;
+	}
 }
 
 template<class D>
 TemplateDomain<D>* ExprDomainFactory<D>::init(const ExprLeaf& e) {
-	return new TemplateDomain<D>(e.dim);
+	return arena.alloc(e.dim);
 }
 
 template<class D>
 TemplateDomain<D>* ExprDomainFactory<D>::init(const ExprNAryOp& e, Array<TemplateDomain<D> >&) {
-	return new TemplateDomain<D>(e.dim);
+	return arena.alloc(e.dim);
 }
 
 template<class D>
 TemplateDomain<D>* ExprDomainFactory<D>::init(const ExprBinaryOp& e, TemplateDomain<D>&, TemplateDomain<D>&) {
-	return new TemplateDomain<D>(e.dim);
+	return arena.alloc(e.dim);
 }
 
 template<class D>
 TemplateDomain<D>* ExprDomainFactory<D>::init(const ExprUnaryOp& e, TemplateDomain<D>&) {
-	return new TemplateDomain<D>(e.dim);
+	return arena.alloc(e.dim);
 }
 
 template<class D>
@@ -132,24 +337,31 @@ TemplateDomain<D>* ExprDomainFactory<D>::init(const ExprTrans& e, TemplateDomain
 
 	if (e.dim.is_vector()) {
 		// share references
-		return new TemplateDomain<D>(expr_deco, true);
+		return arena.ref(expr_deco);
 	} else {
 		// TODO: seems impossible to have references
 		// in case of matrices...
-		return new TemplateDomain<D>(e.dim);
+		return arena.alloc(e.dim);
 	}
 }
 
 template<class D>
-inline ExprTemplateDomain<D>::ExprTemplateDomain(const Function& f) : ExprData<TemplateDomain<D> >(f, ExprDomainFactory<D>()) {
+inline ExprTemplateDomain<D>::ExprTemplateDomain(const Function& f) : ExprDomainArena<D>(f),
+		ExprData<TemplateDomain<D> >(f, ExprDomainFactory<D>(*this)) {
 
 }
 
 template<class D>
-inline ExprTemplateDomain<D>::~ExprTemplateDomain() {
-	for (int i=0; i<ExprData<TemplateDomain<D> >::data.size(); i++) {
-		delete &ExprData<TemplateDomain<D> >::data[i];
-	}
+inline ExprTemplateDomain<D>::ExprTemplateDomain(const ExprTemplateDomain& d) : ExprDomainArena<D>(d.f),
+		ExprData<TemplateDomain<D> >(d.f, ExprDomainFactory<D>(*this)) {
+	ExprDomainArena<D>::assign(d);
+}
+
+template<class D>
+inline ExprTemplateDomain<D>& ExprTemplateDomain<D>::operator=(const ExprTemplateDomain& d) {
+	assert(&d.f==&this->f);
+	ExprDomainArena<D>::assign(d);
+	return *this;
 }
 
 template<class D>
@@ -53,7 +53,12 @@ Function::~Function() {
 		delete[] __symbol_index;
 	}
 
+	if (_native!=NULL) delete _native;
+
+	if (_hessian!=NULL) delete _hessian;
+
 	if (_eval!=NULL) {
+		delete _ctx;
 		delete _eval;
 		delete _hc4revise;
 		delete _grad;
@@ -61,6 +66,22 @@ Function::~Function() {
 	}
 }
 
+bool Function::compile_native() const {
+	if (!_native)
+		((Function*) this)->_native=NativeKernel::build(*this);
+	return _native!=NULL;
+}
+
+void Function::hessian(const IntervalVector& x, IntervalMatrix& H) const {
+	assert(x.size()==nb_var());
+	assert(H.nb_rows()==nb_var() && H.nb_cols()==nb_var());
+
+	if (!_hessian)
+		((Function*) this)->_hessian=new Hessian(*_eval);
+
+	_hessian->hessian(x,H);
+}
+
 void Function::print(std::ostream& os) const {
 	if (name!=NULL) os << name << ":";
 	os << "(";
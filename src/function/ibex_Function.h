@@ -31,6 +31,10 @@ class Eval;
 class HC4Revise;
 class Gradient;
 class InHC4Revise;
+class EvalContext;
+class NativeKernel;
+class Hessian;
+class IntervalSparseMatrix;
 
 /**
  * \ingroup function
@@ -606,24 +610,28 @@ public:
 	/**
 	 * \brief Run a forward algorithm.
 	 *
-	 * Run a forward algorithm and
-	 *
 	 * V must be a subclass of FwdAlgorithm.
 	 *
 	 * Note that the type V is just passed in order to have static linkage.
+	 *
+	 * \return false if an operation reported an empty domain
+	 *         (the algorithm is stopped at this operation).
 	 */
 	template<class V>
-	void forward(const V& algo) const;
+	bool forward(const V& algo) const;
 
 	/**
 	 * \brief Run a backward algorithm.
 	 *
-	 * V must be a subclass of FwdAlgorithm.
+	 * V must be a subclass of BwdAlgorithm.
 	 *
 	 * Note that the type V is just passed in order to have static linkage.
+	 *
+	 * \return false if an operation reported an empty domain
+	 *         (the algorithm is stopped at this operation).
 	 */
 	template<class V>
-	void backward(const V& algo) const;
+	bool backward(const V& algo) const;
 
 	/**
 	 * \brief Calculate f(box) using interval arithmetic.
@@ -642,6 +650,20 @@ public:
 	 */
 	IntervalVector eval_vector(const IntervalVector& box) const;
 
+	/**
+	 * \brief Calculate f(box) using a specific evaluation context.
+	 *
+	 * \see #ibex::EvalContext.
+	 */
+	Interval eval(const IntervalVector& box, EvalContext& context) const;
+
+	/**
+	 * \brief Calculate f(box) using a specific evaluation context.
+	 *
+	 * \see #ibex::EvalContext.
+	 */
+	IntervalVector eval_vector(const IntervalVector& box, EvalContext& context) const;
+
 	/**
 	 * \brief Calculate some components of f using interval arithmetic.
 	 *
@@ -656,6 +678,18 @@ public:
 	 */
 	virtual IntervalMatrix eval_matrix(const IntervalVector& x) const;
 
+	/**
+	 * \brief Calculate f(boxes[0]),...,f(boxes[N-1]) using interval arithmetic.
+	 *
+	 * The result f(boxes[k]) is stored in out[k]. This is faster than
+	 * N calls to #eval(const IntervalVector&) since each node of the DAG
+	 * is processed only once for all the boxes.
+	 *
+	 * \pre f must be real or vector-valued and each out[k] must have
+	 *      the size image_dim().
+	 */
+	void eval_batch(const IntervalVector* boxes, int N, IntervalVector* out) const;
+
 	/**
 	 * \brief Calculate f(box) using interval arithmetic.
 	 */
@@ -691,11 +725,41 @@ public:
 	 */
 	IntervalVector gradient(const IntervalVector& x) const;
 
+	/**
+	 * \brief Calculate the gradient of f using a specific evaluation context.
+	 *
+	 * \see #ibex::EvalContext.
+	 */
+	void gradient(const IntervalVector& x, IntervalVector& g, EvalContext& context) const;
+
+	/**
+	 * \brief Calculate both f(x) and the gradient of f.
+	 *
+	 * Faster than calling eval and gradient separately
+	 * (the evaluation is done only once).
+	 *
+	 * \pre f must be real-valued
+	 */
+	void eval_gradient(const IntervalVector& x, Interval& y, IntervalVector& g) const;
+
 	/**
 	 *\see #ibex::Fnc
 	 */
 	IntervalMatrix jacobian(const IntervalVector& x, int v=-1) const;
 
+	/**
+	 * \brief Calculate both f(x) and the Jacobian matrix of f.
+	 *
+	 * All the components are evaluated with a single forward sweep
+	 * which is then shared by the (reverse-mode) differentiation of each
+	 * component. Faster than calling eval_vector and jacobian separately.
+	 *
+	 * If x is outside the definition domain of f, y and J are set to the empty set.
+	 *
+	 * \pre f must be vector-valued (or real-valued)
+	 */
+	void eval_jacobian(const IntervalVector& x, IntervalVector& y, IntervalMatrix& J) const;
+
 	/**
 	 *\see #ibex::Fnc
 	 */
@@ -706,6 +770,13 @@ public:
 	 */
 	void jacobian(const IntervalVector& x, IntervalMatrix& J, int v=-1) const;
 
+	/**
+	 * \brief Calculate the Jacobian matrix of f using a specific evaluation context.
+	 *
+	 * \see #ibex::EvalContext.
+	 */
+	void jacobian(const IntervalVector& x, IntervalMatrix& J, EvalContext& context, int v=-1) const;
+
 	/**
 	 *\see #ibex::Fnc
 	 */
@@ -716,6 +787,42 @@ public:
 	 */
 	virtual void jacobian(const IntervalVector& x, IntervalMatrix& J, const BitSet& components, int v=-1) const;
 
+	/**
+	 * \brief Calculate the Jacobian matrix of f in a sparse matrix.
+	 *
+	 * Only the structurally nonzero entries are calculated.
+	 *
+	 * \param J - either a 0x0 matrix (it is then initialized with the structure)
+	 *            or a copy of jacobian_structure().
+	 */
+	void jacobian(const IntervalVector& x, IntervalSparseMatrix& J) const;
+
+	/**
+	 * \brief The structure of the Jacobian matrix.
+	 *
+	 * Calculated once for all when the function is built.
+	 * \see #ibex::Gradient::jacobian_structure().
+	 */
+	const IntervalSparseMatrix& jacobian_structure() const;
+
+	/**
+	 * \brief Calculate the Hessian matrix of f.
+	 *
+	 * The Hessian is calculated by automatic differentiation (see
+	 * #ibex::Hessian). The calculator is built on the first call.
+	 *
+	 * \param H - where the Hessian has to be stored (output parameter).
+	 *
+	 * \pre f must be real-valued
+	 */
+	void hessian(const IntervalVector& x, IntervalMatrix& H) const;
+
+	/**
+	 * \brief Calculate the Hessian matrix of f.
+	 * \pre f must be real-valued
+	 */
+	IntervalMatrix hessian(const IntervalVector& x) const;
+
 	/**
 	 *\see #ibex::Fnc
 	 */
@@ -765,6 +872,20 @@ public:
 	 */
 	bool backward(const IntervalMatrix& y, IntervalVector& x) const;
 
+	/**
+	 * \brief Project f(x)=y onto x using a specific evaluation context.
+	 *
+	 * \see #ibex::EvalContext.
+	 */
+	bool backward(const Domain& y, IntervalVector& x, EvalContext& context) const;
+
+	/**
+	 * \brief Project f(x)=y onto x using a specific evaluation context.
+	 *
+	 * \see #ibex::EvalContext.
+	 */
+	bool backward(const Interval& y, IntervalVector& x, EvalContext& context) const;
+
 	/**
 	 * \brief Inner projection f(x)=y onto x.
 	 */
@@ -813,6 +934,34 @@ public:
 	 */
 	InHC4Revise& inhc4revise() const;
 
+	/**
+	 * \brief Get the default evaluation context.
+	 *
+	 * This is the context used by all the methods (eval, gradient, etc.)
+	 * that do not take a context in argument.
+	 *
+	 * \see #ibex::EvalContext.
+	 */
+	EvalContext& context() const;
+
+	/**
+	 * \brief Generate and load native kernels for this function.
+	 *
+	 * If it succeeds, eval, gradient and backward (with a real-valued
+	 * image) are then performed by compiled code instead of the
+	 * generic forward/backward algorithms (see #ibex::NativeKernel).
+	 *
+	 * \return false if the function is not supported (only real-valued
+	 *         functions with scalar arguments are) or if the compilation
+	 *         failed. The function is then left unchanged.
+	 */
+	bool compile_native() const;
+
+	/**
+	 * \brief True if native kernels are used.
+	 */
+	bool is_native() const;
+
 	/**
 	 * \brief True if all the arguments are scalar
 	 *
@@ -876,6 +1025,7 @@ protected:
 
 private:
 	friend class VarSet;
+	friend class EvalContext;
 
 	void build_from_string(const Array<const char*>& x, const char* y, const char* name=NULL);
 
@@ -913,6 +1063,9 @@ private:
 	// TODO: actually never used if f is vector/matrix valued
 	Gradient *_grad;
 	InHC4Revise *_inhc4revise;
+	EvalContext *_ctx;                          // default context (wraps the four objects above)
+	NativeKernel *_native;                      // only built by compile_native()
+	Hessian *_hessian;                          // only built by hessian()
 };
 
 } // end namespace
@@ -921,6 +1074,9 @@ private:
 #include "ibex_Gradient.h"
 #include "ibex_HC4Revise.h"
 #include "ibex_InHC4Revise.h"
+#include "ibex_EvalContext.h"
+#include "ibex_NativeKernel.h"
+#include "ibex_Hessian.h"
 #include "ibex_VarSet.h"
 
 namespace ibex {
@@ -974,8 +1130,12 @@ inline bool Function::all_args_scalar() const {
 }
 
 template<class V>
-inline void Function::forward(const V& algo) const {
-	cf.forward<V>(algo);
+inline bool Function::forward(const V& algo) const {
+	return cf.forward<V>(algo);
+}
+
+inline void Function::eval_batch(const IntervalVector* boxes, int N, IntervalVector* out) const {
+	((Function*) this)->_eval->eval_batch(boxes,N,out);
 }
 
 inline Domain& Function::eval_domain(const IntervalVector& box) const {
@@ -991,7 +1151,7 @@ inline Domain& Function::eval_domain(const Array<Domain>& d) const {
 }
 
 inline Interval Function::eval(const IntervalVector& box) const {
-	return eval_domain(box).i();
+	return _native ? _native->eval(box) : eval_domain(box).i();
 }
 
 inline Interval Function::eval(int i, const IntervalVector& box) const {
@@ -1006,6 +1166,16 @@ inline IntervalVector Function::eval_vector(const IntervalVector& box, const Bit
 	return ((Function*) this)->_eval->eval(box,components);
 }
 
+inline Interval Function::eval(const IntervalVector& box, EvalContext& context) const {
+	return _native ? _native->eval(box) : context.eval.eval(box).i();
+}
+
+inline IntervalVector Function::eval_vector(const IntervalVector& box, EvalContext& context) const {
+	return expr().dim.is_scalar() ?
+			IntervalVector(1,eval(box,context)) :
+			context.eval.eval(box, BitSet::all(image_dim()));
+}
+
 inline IntervalMatrix Function::eval_matrix(const IntervalVector& box) const {
 	switch (expr().dim.type()) {
 	case Dim::SCALAR     :
@@ -1029,12 +1199,15 @@ inline IntervalMatrix Function::eval_matrix(const IntervalVector& box) const {
 
 
 template<class V>
-inline void Function::backward(const V& algo) const {
-	cf.backward<V>(algo);
+inline bool Function::backward(const V& algo) const {
+	return cf.backward<V>(algo);
 }
 
 inline bool Function::backward(const Domain& y, IntervalVector& x) const {
-	return ((Function*) this)->_hc4revise->proj(y,x);
+	if (_native && y.dim.is_scalar())
+		return _native->backward(y.i(),x);
+	else
+		return ((Function*) this)->_hc4revise->proj(y,x);
 }
 
 inline bool Function::backward(const Interval& y, IntervalVector& x) const {
@@ -1050,6 +1223,17 @@ inline bool Function::backward(const IntervalMatrix& y, IntervalVector& x) const
 	return backward(Domain((IntervalMatrix&) y),x); // y will not be modified
 }
 
+inline bool Function::backward(const Domain& y, IntervalVector& x, EvalContext& context) const {
+	if (_native && y.dim.is_scalar())
+		return _native->backward(y.i(),x);
+	else
+		return context.hc4revise.proj(y,x);
+}
+
+inline bool Function::backward(const Interval& y, IntervalVector& x, EvalContext& context) const {
+	return backward(Domain((Interval&) y),x,context); // y will not be modified
+}
+
 inline void Function::ibwd(const Domain& y, IntervalVector& x) const {
 	((Function*) this)->_inhc4revise->iproj(y,x);
 }
@@ -1073,7 +1257,10 @@ inline void Function::print_expr(std::ostream& os) const {
 inline void Function::gradient(const IntervalVector& x, IntervalVector& g) const {
 	assert(g.size()==nb_var());
 	assert(x.size()==nb_var());
-	_grad->gradient(x,g);
+	if (_native)
+		_native->gradient(x,g);
+	else
+		_grad->gradient(x,g);
 //	if (!df) ((Function*) this)->df=new Function(*this,DIFF);
 //	g=df->eval_vector(x);
 }
@@ -1084,6 +1271,32 @@ inline IntervalVector Function::gradient(const IntervalVector& x) const {
 	return g;
 }
 
+inline void Function::gradient(const IntervalVector& x, IntervalVector& g, EvalContext& context) const {
+	assert(g.size()==nb_var());
+	assert(x.size()==nb_var());
+	if (_native)
+		_native->gradient(x,g);
+	else
+		context.grad.gradient(x,g);
+}
+
+inline void Function::eval_gradient(const IntervalVector& x, Interval& y, IntervalVector& g) const {
+	assert(g.size()==nb_var());
+	assert(x.size()==nb_var());
+	if (_native) {
+		y=_native->eval(x);
+		if (y.is_empty()) g.set_empty();
+		else _native->gradient(x,g);
+	} else
+		_grad->eval_gradient(x,y,g);
+}
+
+inline void Function::eval_jacobian(const IntervalVector& x, IntervalVector& y, IntervalMatrix& J) const {
+	assert(y.size()==image_dim());
+	assert(J.nb_rows()==image_dim() && J.nb_cols()==nb_var());
+	_grad->eval_jacobian(x,y,J);
+}
+
 inline IntervalMatrix Function::jacobian(const IntervalVector& x, int v) const {
 	return Fnc::jacobian(x, v);
 }
@@ -1097,6 +1310,10 @@ inline void Function::jacobian(const IntervalVector& x, IntervalMatrix& J, int v
 	// <=> 	_grad->jacobian(x,J,v);
 }
 
+inline void Function::jacobian(const IntervalVector& x, IntervalMatrix& J, EvalContext& context, int v) const {
+	context.grad.jacobian(x,J,v);
+}
+
 inline void Function::jacobian(const IntervalVector& full_box, IntervalMatrix& J_var, IntervalMatrix& J_param, const VarSet& set) const {
 	Fnc::jacobian(full_box, J_var, J_param, set);
 }
@@ -1105,6 +1322,14 @@ inline void Function::jacobian(const IntervalVector& x, IntervalMatrix& J, const
 	_grad->jacobian(x, J, components, v);
 }
 
+inline void Function::jacobian(const IntervalVector& x, IntervalSparseMatrix& J) const {
+	_grad->jacobian(x, J);
+}
+
+inline const IntervalSparseMatrix& Function::jacobian_structure() const {
+	return _grad->jacobian_structure();
+}
+
 inline void Function::hansen_matrix(const IntervalVector& x, IntervalMatrix& H) const {
 	Fnc::hansen_matrix(x, H);
 }
@@ -1141,6 +1366,20 @@ inline InHC4Revise& Function::inhc4revise() const {
 	return *_inhc4revise;
 }
 
+inline EvalContext& Function::context() const {
+	return *_ctx;
+}
+
+inline IntervalMatrix Function::hessian(const IntervalVector& x) const {
+	IntervalMatrix H(nb_var(),nb_var());
+	hessian(x,H);
+	return H;
+}
+
+inline bool Function::is_native() const {
+	return _native!=NULL;
+}
+
 inline std::ostream& operator<<(std::ostream& os, const Function& f) {
 	f.print(os);
 	return os;
@@ -19,162 +19,165 @@ namespace ibex {
 /**
  * \ingroup symbolic
  * \brief Interface for forward algorithms.
+ *
+ * Each operation returns false if it produces an empty domain.
+ * The forward phase is then interrupted (see #ibex::CompiledFunction).
  */
 class FwdAlgorithm {
 protected:
 
 	/** TO BE DEFINED (by the subclass) */
-	void idx_fwd(int x, int y);
+	bool idx_fwd(int x, int y);
 
 	/** TO BE DEFINED (by the subclass) */
-	void idx_cp_fwd(int x, int y);
+	bool idx_cp_fwd(int x, int y);
 
 	/** TO BE DEFINED (by the subclass) */
-	void symbol_fwd(int y);
+	bool symbol_fwd(int y);
 
 	/** TO BE DEFINED (by the subclass) */
-	void cst_fwd(int y);
+	bool cst_fwd(int y);
 
 	/*==================== n-ary operators =========================*/
 	/** TO BE DEFINED (by the subclass) */
-	void vector_fwd(int* x, int y);
+	bool vector_fwd(int* x, int y);
 
 	/** TO BE DEFINED (by the subclass) */
-	void apply_fwd(int* x, int y);
+	bool apply_fwd(int* x, int y);
 
 	/** TO BE DEFINED (by the subclass) */
-	void chi_fwd(int a, int b, int c, int y);
+	bool chi_fwd(int a, int b, int c, int y);
 
 	/*==================== binary operators =========================*/
 	/** TO BE DEFINED (by the subclass) */
-	void gen2_fwd(int x, int y);
+	bool gen2_fwd(int x, int y);
 
 	/** TO BE DEFINED (by the subclass) */
-	void add_fwd(int x1, int x2, int y);
+	bool add_fwd(int x1, int x2, int y);
 
 	/** TO BE DEFINED (by the subclass) */
-	void add_V_fwd(int x1, int x2, int y);
+	bool add_V_fwd(int x1, int x2, int y);
 
 	/** TO BE DEFINED (by the subclass) */
-	void add_M_fwd(int x1, int x2, int y);
+	bool add_M_fwd(int x1, int x2, int y);
 
 	/** TO BE DEFINED (by the subclass) */
-	void mul_fwd(int x1, int x2, int y);
+	bool mul_fwd(int x1, int x2, int y);
 
 	/** TO BE DEFINED (by the subclass) */
-	void mul_SV_fwd(int x1, int x2, int y);
+	bool mul_SV_fwd(int x1, int x2, int y);
 
 	/** TO BE DEFINED (by the subclass) */
-	void mul_SM_fwd(int x1, int x2, int y);
+	bool mul_SM_fwd(int x1, int x2, int y);
 
 	/** TO BE DEFINED (by the subclass) */
-	void mul_VV_fwd(int x1, int x2, int y);
+	bool mul_VV_fwd(int x1, int x2, int y);
 
 	/** TO BE DEFINED (by the subclass) */
-	void mul_MV_fwd(int x1, int x2, int y);
+	bool mul_MV_fwd(int x1, int x2, int y);
 
 	/** TO BE DEFINED (by the subclass) */
-	void mul_VM_fwd(int x1, int x2, int y);
+	bool mul_VM_fwd(int x1, int x2, int y);
 
 	/** TO BE DEFINED (by the subclass) */
-	void mul_MM_fwd(int x1, int x2, int y);
+	bool mul_MM_fwd(int x1, int x2, int y);
 
 	/** TO BE DEFINED (by the subclass) */
-	void sub_fwd(int x1, int x2, int y);
+	bool sub_fwd(int x1, int x2, int y);
 
 	/** TO BE DEFINED (by the subclass) */
-	void sub_V_fwd(int x1, int x2, int y);
+	bool sub_V_fwd(int x1, int x2, int y);
 
 	/** TO BE DEFINED (by the subclass) */
-	void sub_M_fwd(int x1, int x2, int y);
+	bool sub_M_fwd(int x1, int x2, int y);
 
 	/** TO BE DEFINED (by the subclass) */
-	void div_fwd(int x1, int x2, int y);
+	bool div_fwd(int x1, int x2, int y);
 
 	/** TO BE DEFINED (by the subclass) */
-	void max_fwd(int x1, int x2, int y);
+	bool max_fwd(int x1, int x2, int y);
 
 	/** TO BE DEFINED (by the subclass) */
-	void min_fwd(int x1, int x2, int y);
+	bool min_fwd(int x1, int x2, int y);
 
 	/** TO BE DEFINED (by the subclass) */
-	void atan2_fwd(int x1, int x2, int y);
+	bool atan2_fwd(int x1, int x2, int y);
 
 	/*==================== unary operators =========================*/
 	/** TO BE DEFINED (by the subclass) */
-	void gen1_fwd(int x, int y);
+	bool gen1_fwd(int x, int y);
 
 	/** TO BE DEFINED (by the subclass) */
-	void minus_fwd(int x, int y);
+	bool minus_fwd(int x, int y);
 
 	/** TO BE DEFINED (by the subclass) */
-	void minus_V_fwd(int x, int y);
+	bool minus_V_fwd(int x, int y);
 
 	/** TO BE DEFINED (by the subclass) */
-	void minus_M_fwd(int x, int y);
+	bool minus_M_fwd(int x, int y);
 
 	/** TO BE DEFINED (by the subclass) */
-	void trans_V_fwd(int x, int y);
+	bool trans_V_fwd(int x, int y);
 
 	/** TO BE DEFINED (by the subclass) */
-	void trans_M_fwd(int x, int y);
+	bool trans_M_fwd(int x, int y);
 
 	/** TO BE DEFINED (by the subclass) */
-	void sign_fwd(int x, int y);
+	bool sign_fwd(int x, int y);
 
 	/** TO BE DEFINED (by the subclass) */
-	void abs_fwd(int x, int y);
+	bool abs_fwd(int x, int y);
 
 	/** TO BE DEFINED (by the subclass) */
-	void power_fwd(int x, int y, int p);
+	bool power_fwd(int x, int y, int p);
 
 	/** TO BE DEFINED (by the subclass) */
-	void sqr_fwd(int x, int y);
+	bool sqr_fwd(int x, int y);
 
 	/** TO BE DEFINED (by the subclass) */
-	void sqrt_fwd(int x, int y);
+	bool sqrt_fwd(int x, int y);
 
 	/** TO BE DEFINED (by the subclass) */
-	void exp_fwd(int x, int y);
+	bool exp_fwd(int x, int y);
 
 	/** TO BE DEFINED (by the subclass) */
-	void log_fwd(int x, int y);
+	bool log_fwd(int x, int y);
 
 	/** TO BE DEFINED (by the subclass) */
-	void cos_fwd(int x, int y);
+	bool cos_fwd(int x, int y);
 
 	/** TO BE DEFINED (by the subclass) */
-	void sin_fwd(int x, int y);
+	bool sin_fwd(int x, int y);
 
 	/** TO BE DEFINED (by the subclass) */
-	void tan_fwd(int x, int y);
+	bool tan_fwd(int x, int y);
 
 	/** TO BE DEFINED (by the subclass) */
-	void cosh_fwd(int x, int y);
+	bool cosh_fwd(int x, int y);
 
 	/** TO BE DEFINED (by the subclass) */
-	void sinh_fwd(int x, int y);
+	bool sinh_fwd(int x, int y);
 
 	/** TO BE DEFINED (by the subclass) */
-	void tanh_fwd(int x, int y);
+	bool tanh_fwd(int x, int y);
 
 	/** TO BE DEFINED (by the subclass) */
-	void acos_fwd(int x, int y);
+	bool acos_fwd(int x, int y);
 
 	/** TO BE DEFINED (by the subclass) */
-	void asin_fwd(int x, int y);
+	bool asin_fwd(int x, int y);
 
 	/** TO BE DEFINED (by the subclass) */
-	void atan_fwd(int x, int y);
+	bool atan_fwd(int x, int y);
 
 	/** TO BE DEFINED (by the subclass) */
-	void acosh_fwd(int x, int y);
+	bool acosh_fwd(int x, int y);
 
 	/** TO BE DEFINED (by the subclass) */
-	void asinh_fwd(int x, int y);
+	bool asinh_fwd(int x, int y);
 
 	/** TO BE DEFINED (by the subclass) */
-	void atanh_fwd(int x, int y);
+	bool atanh_fwd(int x, int y);
 };
 
 } // namespace ibex
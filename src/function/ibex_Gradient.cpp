@@ -33,6 +33,32 @@ Gradient::Gradient(Eval& e): f(e.f), _eval(e), d(e.d), g(f),
 	for (int i=0; i<f.image_dim(); i++) {
 		is_linear[i]=!coeff_matrix[i].is_unbounded();
 	}
+
+	int m=f.image_dim();
+	int n=f.nb_var();
+
+	// The structure of the Jacobian. A zero coefficient means
+	// that the component does not depend on the variable.
+	vector<int> row_ptr(1,0);
+	vector<int> col_ind;
+	for (int i=0; i<m; i++) {
+		for (int j=0; j<n; j++)
+			if (coeff_matrix[i][j]!=Interval::ZERO) col_ind.push_back(j);
+		row_ptr.push_back((int) col_ind.size());
+	}
+	jac_structure = IntervalSparseMatrix(m, n, row_ptr, col_ind);
+
+	for (int i=0; i<m; i++) {
+		if (is_linear[i])
+			for (int k=jac_structure.row_begin(i); k<jac_structure.row_end(i); k++)
+				jac_structure[k]=coeff_matrix[i][jac_structure.col(k)];
+	}
+
+	if (!f.all_args_scalar()) {
+		for (int s=0; s<f.nb_arg(); s++)
+			for (int k=0; k<f.arg(s).dim.size(); k++)
+				var_pos.push_back(make_pair(s,k));
+	}
 }
 
 Gradient::~Gradient() {
@@ -66,11 +92,16 @@ void Gradient::gradient(const IntervalVector& box, IntervalVector& gbox) {
 		ibex_error("Cannot called \"gradient\" on a vector-valued function");
 	}
 
-	if (_eval.eval(box).is_empty()) {
+	if (_eval.eval_nodes(box).is_empty()) {
 		// outside definition domain -> empty gradient
 		gbox.set_empty(); return;
 	}
 
+	gradient(gbox);
+}
+
+void Gradient::gradient(IntervalVector& gbox) {
+
 	gbox.clear();
 
 	g.write_arg_domains(gbox);
@@ -84,8 +115,31 @@ void Gradient::gradient(const IntervalVector& box, IntervalVector& gbox) {
 	g.read_arg_domains(gbox);
 }
 
+void Gradient::eval_gradient(const IntervalVector& box, Interval& y, IntervalVector& gbox) {
+
+	if (!f.expr().dim.is_scalar()) {
+		ibex_error("Cannot called \"gradient\" on a vector-valued function");
+	}
+
+	y=_eval.eval_nodes(box).i();
+
+	if (y.is_empty()) {
+		// outside definition domain -> empty gradient
+		gbox.set_empty(); return;
+	}
+
+	gradient(gbox);
+}
+
+void Gradient::eval_jacobian(const IntervalVector& box, IntervalVector& y, IntervalMatrix& J) {
+	jacobian(box, J, BitSet::all(f.image_dim()), -1, &y);
+}
 
 void Gradient::jacobian(const IntervalVector& box, IntervalMatrix& J, const BitSet& components, int v) {
+	jacobian(box, J, components, v, NULL);
+}
+
+void Gradient::jacobian(const IntervalVector& box, IntervalMatrix& J, const BitSet& components, int v, IntervalVector* y) {
 
 	int n=f.nb_var();
 	int m=components.size();
@@ -100,6 +154,7 @@ void Gradient::jacobian(const IntervalVector& box, IntervalMatrix& J, const BitS
 	assert(J.nb_cols()==n);
 	assert(box.size()==n);
 	assert(!components.empty());
+	assert(!y || y->size()==m);
 
 
 	int c; // constraint number
@@ -125,12 +180,19 @@ void Gradient::jacobian(const IntervalVector& box, IntervalMatrix& J, const BitS
 			nonlinear_components.add(c);
 	}
 
-	if (nonlinear_components.empty()) return;
+	// note: the values of all the required components are calculated
+	// if y is not NULL, even if they are linear.
+	if (nonlinear_components.empty() && !y) return;
 	// ============================================================================
 
 	if (f.image_dim()==1) {
 
-		gradient(box,J[0]);
+		if (nonlinear_components.empty())
+			(*y)[0]=_eval.eval_nodes(box).i();
+		else {
+			gradient(box,J[0]);
+			if (y) (*y)[0]=d.top->i();
+		}
 
 	} else if(_eval.fwd_agenda!=NULL) {
 
@@ -142,7 +204,15 @@ void Gradient::jacobian(const IntervalVector& box, IntervalMatrix& J, const BitS
 		//   forward phase (in the backward phase, each components are handled
 		//   separately so that shared subexpressions are treated as if they were separate).
 
-		if (_eval.eval(box,nonlinear_components).is_empty()) {
+		// the forward sweep is shared by all the components
+		if (y) {
+			*y=_eval.eval_nodes(box,components);
+			if (y->is_empty()) {
+				// outside definition domain -> empty jacobian
+				J.set_empty();
+				return;
+			}
+		} else if (_eval.eval_nodes(box,nonlinear_components).is_empty()) {
 			// outside definition domain -> empty jacobian
 			J.set_empty();
 			return;
@@ -192,17 +262,41 @@ void Gradient::jacobian(const IntervalVector& box, IntervalMatrix& J, const BitS
 		// We chose option 1 since option 2 is already what is done
 		// when f is a vector of expressions (the most frequent case).
 		// ======================== option 1 =============================
+		bool empty_jacobian=false; // only when y is not NULL
+
 		for (int i=0; i<m; i++) {
 			c=i==0? components.min() : components.next(c);
 
-			f[c].gradient(box,J[i]);
+			Gradient& grad_c=_eval.sub_context(f[c]).grad;
+
+			if (empty_jacobian) {
+				// we still need the values of the remaining components
+				(*y)[i]=grad_c._eval.eval(box).i();
+				if ((*y)[i].is_empty()) {
+					y->set_empty();
+					return;
+				}
+				continue;
+			}
+
+			if (y)
+				grad_c.eval_gradient(box,(*y)[i],J[i]);
+			else
+				grad_c.gradient(box,J[i]);
 
 			if (J[i].is_empty()) {
-				J.set_empty();
-				return;
+				if (!y || (*y)[i].is_empty()) {
+					// outside definition domain
+					J.set_empty();
+					if (y) y->set_empty();
+					return;
+				}
+				empty_jacobian=true;
 			}
 		}
 
+		if (empty_jacobian) J.set_empty();
+
 		// ======================== option 2 =============================
 //		if (_eval.eval(box).is_empty()) {
 //			// outside definition domain -> empty jacobian
@@ -231,6 +325,116 @@ void Gradient::jacobian(const IntervalVector& box, IntervalMatrix& J, const BitS
 	}
 }
 
+bool Gradient::read_row(int i, IntervalSparseMatrix& J) {
+	for (int k=J.row_begin(i); k<J.row_end(i); k++) {
+		int j=J.col(k);
+		if (var_pos.empty())
+			J[k]=g.args[j].i();
+		else {
+			const Domain& gx=g.args[var_pos[j].first];
+			int p=var_pos[j].second;
+			switch (gx.dim.type()) {
+			case Dim::SCALAR:     J[k]=gx.i(); break;
+			case Dim::ROW_VECTOR:
+			case Dim::COL_VECTOR: J[k]=gx.v()[p]; break;
+			case Dim::MATRIX:     J[k]=gx.m()[p/gx.dim.nb_cols()][p%gx.dim.nb_cols()]; break;
+			}
+		}
+		if (J[k].is_empty()) return false;
+	}
+	return true;
+}
+
+void Gradient::jacobian(const IntervalVector& box, IntervalSparseMatrix& J) {
+
+	if (f.expr().dim.is_matrix()) {
+		ibex_error("Cannot called \"jacobian\" on a matrix-valued function");
+	}
+
+	int m=f.image_dim();
+
+	if (J.nb_rows()!=m || J.nnz()!=jac_structure.nnz())
+		J=jac_structure;
+	else if (J.is_empty())
+		J.clear();
+
+	assert(J.same_structure(jac_structure));
+
+	// note: structurally zero entries are never
+	// written (no gradient symbol is cleared).
+	BitSet nonlinear_components=BitSet::empty(m);
+
+	for (int i=0; i<m; i++) {
+		if (is_linear[i])
+			for (int k=J.row_begin(i); k<J.row_end(i); k++)
+				J[k]=jac_structure[k];
+		else
+			nonlinear_components.add(i);
+	}
+
+	if (nonlinear_components.empty()) return;
+
+	if (m==1) {
+
+		if (!f.expr().dim.is_scalar()) {
+			ibex_error("Cannot called \"gradient\" on a vector-valued function");
+		}
+
+		if (_eval.eval_nodes(box).is_empty()) {
+			J.set_empty();
+			return;
+		}
+
+		// the forward phase clears the gradient of all the
+		// nodes, including the symbols.
+		f.forward<Gradient>(*this);
+
+		g.top->i()=1.0;
+
+		f.backward<Gradient>(*this);
+
+		if (!read_row(0,J)) J.set_empty();
+
+	} else if (_eval.fwd_agenda!=NULL) {
+
+		if (_eval.eval_nodes(box,nonlinear_components).is_empty()) {
+			J.set_empty();
+			return;
+		}
+
+		for (BitSet::const_iterator c=nonlinear_components.begin(); c!=nonlinear_components.end(); ++c) {
+
+			f.cf.forward<Gradient>(*this, *(_eval.fwd_agenda)[c]);
+
+			g[_eval.bwd_agenda[c]->first()].i() = 1.0;
+
+			f.cf.backward<Gradient>(*this, *(_eval.bwd_agenda)[c]);
+
+			if (!read_row(c,J)) {
+				J.set_empty();
+				return;
+			}
+		}
+	} else {
+		// see the dense version (option 1). The gradient of each component
+		// is calculated in a dense vector.
+		IntervalVector row(f.nb_var());
+
+		for (BitSet::const_iterator c=nonlinear_components.begin(); c!=nonlinear_components.end(); ++c) {
+
+			_eval.sub_context(f[c]).grad.gradient(box,row);
+
+			if (row.is_empty()) {
+				J.set_empty();
+				return;
+			}
+
+			for (int k=J.row_begin(c); k<J.row_end(c); k++)
+				J[k]=row[J.col(k)];
+		}
+	}
+}
+
 void Gradient::jacobian(const IntervalVector& box, IntervalMatrix& J, int v) {
 	jacobian(box,J, BitSet::all(f.image_dim()), v);
 }
@@ -250,7 +454,7 @@ void Gradient::jacobian(const Array<Domain>& d, IntervalMatrix& J) {
 		if (fi!=NULL) {
 			// if this is a Function object we can
 			// directly calculate the gradient with d
-			fi->deriv_calculator().gradient(d,J[i]);
+			_eval.sub_context(*fi).grad.gradient(d,J[i]);
 		} else {
 			// otherwise we must give a box in argument
 			// TODO add gradient with Array<Domain> in argument
@@ -269,25 +473,27 @@ void Gradient::jacobian(const Array<Domain>& d, IntervalMatrix& J) {
 	// TODO
 }
 
-void Gradient::vector_fwd(int* x, int y) {
+bool Gradient::vector_fwd(int* x, int y) {
 	const ExprVector& v = (const ExprVector&) f.node(y);
 
 	if (v.dim.is_vector())
 		g[y].v().clear();
 	else
 		g[y].m().clear();
+	return true;
 }
 
-void Gradient::idx_cp_bwd(int x, int y) {
+bool Gradient::idx_cp_bwd(int x, int y) {
 	assert(dynamic_cast<const ExprIndex*> (&f.node(y)));
 
 	const ExprIndex& e = (const ExprIndex&) f.node(y);
 	Domain gx=g[x][e.index];
 	gx = gx + g[y];
 	g[x].put(e.index.first_row(), e.index.first_col(), gx);
+	return true;
 }
 
-void Gradient::vector_bwd(int* x, int y) {
+bool Gradient::vector_bwd(int* x, int y) {
 	assert(dynamic_cast<const ExprVector*>(&(f.node(y))));
 
 	const ExprVector& v = (const ExprVector&) f.node(y);
@@ -332,9 +538,10 @@ void Gradient::vector_bwd(int* x, int y) {
 			}
 		}
 	}
+	return true;
 }
 
-void Gradient::apply_bwd(int* x, int y) {
+bool Gradient::apply_bwd(int* x, int y) {
 
 	const ExprApply& a = (const ExprApply&) f.node(y);
 
@@ -355,7 +562,7 @@ void Gradient::apply_bwd(int* x, int y) {
 	IntervalVector tmp_g(n);
 
 	if (a.func.expr().dim.is_scalar()) {
-		a.func.deriv_calculator().gradient(d2,tmp_g);
+		_eval.sub_context(a.func).grad.gradient(d2,tmp_g);
 		//cout << "tmp-g=" << tmp_g << endl;
 		tmp_g *= g[y].i();   // pre-multiplication by y.g
 		tmp_g += old_g;      // addition to the old value of g
@@ -365,14 +572,15 @@ void Gradient::apply_bwd(int* x, int y) {
 			not_implemented("automatic differentiation of matrix-valued function");
 		int m=a.func.expr().dim.vec_size();
 		IntervalMatrix J(m,n);
-		a.func.deriv_calculator().jacobian(d2,J);
+		_eval.sub_context(a.func).grad.jacobian(d2,J);
 		tmp_g = g[y].v()*J; // pre-multiplication by y.g
 		tmp_g += old_g;
 		load(g2,tmp_g);
 	}
+	return true;
 }
 
-void Gradient::chi_bwd(int a, int b, int c, int y) {
+bool Gradient::chi_bwd(int a, int b, int c, int y) {
 	Interval ga,gb,gc;
 
 	if (d[a].i().ub()<0) {
@@ -406,10 +614,11 @@ void Gradient::chi_bwd(int a, int b, int c, int y) {
 	g[a].i() += g[y].i() * ga;
 	g[b].i() += g[y].i() * gb;
 	g[c].i() += g[y].i() * gc;
+	return true;
 }
 
 
-void Gradient::max_bwd(int x1, int x2, int y) {
+bool Gradient::max_bwd(int x1, int x2, int y) {
 	Interval gx1,gx2;
 
 	if (d[x1].i().lb() > d[x2].i().ub()) {
@@ -426,9 +635,10 @@ void Gradient::max_bwd(int x1, int x2, int y) {
 
 	g[x1].i() += g[y].i() * gx1;
 	g[x2].i() += g[y].i() * gx2;
+	return true;
 }
 
-void Gradient::min_bwd(int x1, int x2, int y) {
+bool Gradient::min_bwd(int x1, int x2, int y) {
 	Interval gx1,gx2;
 
 	if (d[x1].i().lb() > d[x2].i().ub()) {
@@ -445,34 +655,40 @@ void Gradient::min_bwd(int x1, int x2, int y) {
 
 	g[x1].i() += g[y].i() * gx1;
 	g[x2].i() += g[y].i() * gx2;
+	return true;
 }
 
-void Gradient::sign_bwd(int x, int y) {
+bool Gradient::sign_bwd(int x, int y) {
 	if (d[x].i().contains(0)) g[x].i() += g[y].i()*Interval::POS_REALS;
 	else ; // nothing to do: derivative is zero
+	return true;
 }
 
-void Gradient::abs_bwd (int x, int y) {
+bool Gradient::abs_bwd (int x, int y) {
 	if (d[x].i().lb()>0) g[x].i() += 1.0*g[y].i();
 	else if (d[x].i().ub()<0) g[x].i() += -1.0*g[y].i();
 	else g[x].i() += Interval(-1,1)*g[y].i();
+	return true;
 }
 
-void Gradient::atan2_bwd(int x1, int x2, int y) {
+bool Gradient::atan2_bwd(int x1, int x2, int y) {
     g[x1].i() += g[y].i() * d[x2].i() / (sqr(d[x2].i()) + sqr(d[x1].i()));
     g[x2].i() += g[y].i() * - d[x1].i() / (sqr(d[x2].i()) + sqr(d[x1].i()));
+	return true;
 }
 
-void Gradient::gen2_bwd(int x1, int x2, int y) {
+bool Gradient::gen2_bwd(int x1, int x2, int y) {
 	/* TODO */
+	return true;
 }
 
-void Gradient::gen1_bwd(int x, int y) {
+bool Gradient::gen1_bwd(int x, int y) {
 	assert(dynamic_cast<const ExprGenericUnaryOp*>(&(f.node(y))));
 
 	const ExprGenericUnaryOp& e = (const ExprGenericUnaryOp&) f.node(y);
 
 	g[x] = g[x] + e.num_diff(d[x],g[y]); // TODO: implement += for Domain?
+	return true;
 }
 
 } // namespace ibex
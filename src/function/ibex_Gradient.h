@@ -13,6 +13,7 @@
 #define __IBEX_GRADIENT_H__
 
 #include "ibex_Eval.h"
+#include "ibex_IntervalSparseMatrix.h"
 #include "ibex_BwdAlgorithm.h"
 #include "ibex_Agenda.h"
 
@@ -71,113 +72,173 @@ public:
 	 */
 	void jacobian(const Array<Domain>& d, IntervalMatrix& J);
 
+	/**
+	 * \brief Calculate the Jacobian of f on the box \a box in a sparse matrix.
+	 *
+	 * Only the nonzero entries of the structure (see #jacobian_structure())
+	 * are calculated.
+	 *
+	 * \param J - either a 0x0 matrix (it is then initialized with the structure)
+	 *            or a matrix with the structure of the Jacobian.
+	 */
+	void jacobian(const IntervalVector& box, IntervalSparseMatrix& J);
+
+	/**
+	 * \brief The structure of the Jacobian matrix.
+	 *
+	 * The structure is calculated once for all, when f is compiled
+	 * (an entry (i,j) is structurally zero if the ith component does not
+	 * depend on the jth variable). The entries of the linear components are
+	 * set to their (constant) values and all the other ones to zero.
+	 */
+	const IntervalSparseMatrix& jacobian_structure() const;
+
+	/**
+	 * \brief Calculate both f(box) and the gradient of f on \a box.
+	 *
+	 * The evaluation is done only once (the forward phase of
+	 * the gradient uses the domains of the evaluation).
+	 */
+	void eval_gradient(const IntervalVector& box, Interval& y, IntervalVector& g);
+
+	/**
+	 * \brief Calculate both f(box) and the Jacobian of f on \a box.
+	 *
+	 * All the components are evaluated with a single forward sweep
+	 * and the Jacobian is then obtained by reverse-mode differentiation
+	 * of each component on the same domains.
+	 *
+	 * If box is outside the definition domain of f, both y and J are set to
+	 * the empty set.
+	 */
+	void eval_jacobian(const IntervalVector& box, IntervalVector& y, IntervalMatrix& J);
+
 	/* ====================================== Forward =================================== */
 
-	inline void idx_fwd(int , int ) { /* nothing to do */ }
-	       void idx_cp_fwd(int , int y)       { g[y].clear(); }
-	       void vector_fwd(int* x, int y);
-	       void cst_fwd(int y)                { g[y].clear(); }
-	       void symbol_fwd(int y)             { g[y].clear(); }
-	       void apply_fwd(int*, int y)        { g[y].clear(); }
-	inline void chi_fwd(int, int, int, int y) { g[y].i()=0; }
-	inline void gen2_fwd(int, int, int y)     { g[y].clear(); }
-	inline void add_fwd(int, int, int y)      { g[y].i()=0; }
-	inline void mul_fwd(int, int, int y)      { g[y].i()=0; }
-	inline void sub_fwd(int, int, int y)      { g[y].i()=0; }
-	inline void div_fwd(int, int, int y)      { g[y].i()=0; }
-	inline void max_fwd(int, int, int y)      { g[y].i()=0; }
-	inline void min_fwd(int, int, int y)      { g[y].i()=0; }
-	inline void atan2_fwd(int, int, int y)    { g[y].i()=0; }
-	inline void gen1_fwd(int, int y)          { g[y].clear(); }
-	inline void minus_fwd(int, int y)         { g[y].i()=0; }
-	inline void minus_V_fwd(int, int y)       { g[y].v().clear(); }
-	inline void minus_M_fwd(int, int y)       { g[y].m().clear(); }
-	inline void trans_V_fwd(int, int y)       { g[y].v().clear(); }
-	inline void trans_M_fwd(int, int y)       { g[y].m().clear(); }
-	inline void sign_fwd(int, int y)          { g[y].i()=0; }
-	inline void abs_fwd(int, int y)           { g[y].i()=0; }
-	inline void power_fwd(int, int y, int)    { g[y].i()=0; }
-	inline void sqr_fwd(int, int y)           { g[y].i()=0; }
-	inline void sqrt_fwd(int, int y)          { g[y].i()=0; }
-	inline void exp_fwd(int, int y)           { g[y].i()=0; }
-	inline void log_fwd(int, int y)           { g[y].i()=0; }
-	inline void cos_fwd(int, int y)           { g[y].i()=0; }
-	inline void sin_fwd(int, int y)           { g[y].i()=0; }
-	inline void tan_fwd(int, int y)           { g[y].i()=0; }
-	inline void cosh_fwd(int, int y)          { g[y].i()=0; }
-	inline void sinh_fwd(int, int y)          { g[y].i()=0; }
-	inline void tanh_fwd(int, int y)          { g[y].i()=0; }
-	inline void acos_fwd(int, int y)          { g[y].i()=0; }
-	inline void asin_fwd(int, int y)          { g[y].i()=0; }
-	inline void atan_fwd(int, int y)          { g[y].i()=0; }
-	inline void acosh_fwd(int, int y)         { g[y].i()=0; }
-	inline void asinh_fwd(int, int y)         { g[y].i()=0; }
-	inline void atanh_fwd(int, int y)         { g[y].i()=0; }
-	inline void add_V_fwd(int, int, int y)    { g[y].v().clear(); }
-	inline void add_M_fwd(int, int, int y)    { g[y].m().clear(); }
-	inline void mul_SV_fwd(int, int, int y)   { g[y].v().clear(); }
-	inline void mul_SM_fwd(int, int, int y)   { g[y].m().clear(); }
-	inline void mul_VV_fwd(int, int, int y)   { g[y].i()=0; }
-	inline void mul_MV_fwd(int, int, int y)   { g[y].v().clear(); }
-	inline void mul_VM_fwd(int, int, int y)   { g[y].v().clear(); }
-	inline void mul_MM_fwd(int, int, int y)   { g[y].m().clear(); }
-	inline void sub_V_fwd(int, int, int y)    { g[y].v().clear(); }
-	inline void sub_M_fwd(int, int, int y)    { g[y].m().clear(); }
+	inline bool idx_fwd(int , int ) { /* nothing to do */ return true; }
+	       bool idx_cp_fwd(int , int y)       { g[y].clear(); return true; }
+	       bool vector_fwd(int* x, int y);
+	       bool cst_fwd(int y)                { g[y].clear(); return true; }
+	       bool symbol_fwd(int y)             { g[y].clear(); return true; }
+	       bool apply_fwd(int*, int y)        { g[y].clear(); return true; }
+	inline bool chi_fwd(int, int, int, int y) { g[y].i()=0; return true; }
+	inline bool gen2_fwd(int, int, int y)     { g[y].clear(); return true; }
+	inline bool add_fwd(int, int, int y)      { g[y].i()=0; return true; }
+	inline bool mul_fwd(int, int, int y)      { g[y].i()=0; return true; }
+	inline bool sub_fwd(int, int, int y)      { g[y].i()=0; return true; }
+	inline bool div_fwd(int, int, int y)      { g[y].i()=0; return true; }
+	inline bool max_fwd(int, int, int y)      { g[y].i()=0; return true; }
+	inline bool min_fwd(int, int, int y)      { g[y].i()=0; return true; }
+	inline bool atan2_fwd(int, int, int y)    { g[y].i()=0; return true; }
+	inline bool gen1_fwd(int, int y)          { g[y].clear(); return true; }
+	inline bool minus_fwd(int, int y)         { g[y].i()=0; return true; }
+	inline bool minus_V_fwd(int, int y)       { g[y].v().clear(); return true; }
+	inline bool minus_M_fwd(int, int y)       { g[y].m().clear(); return true; }
+	inline bool trans_V_fwd(int, int y)       { g[y].v().clear(); return true; }
+	inline bool trans_M_fwd(int, int y)       { g[y].m().clear(); return true; }
+	inline bool sign_fwd(int, int y)          { g[y].i()=0; return true; }
+	inline bool abs_fwd(int, int y)           { g[y].i()=0; return true; }
+	inline bool power_fwd(int, int y, int)    { g[y].i()=0; return true; }
+	inline bool sqr_fwd(int, int y)           { g[y].i()=0; return true; }
+	inline bool sqrt_fwd(int, int y)          { g[y].i()=0; return true; }
+	inline bool exp_fwd(int, int y)           { g[y].i()=0; return true; }
+	inline bool log_fwd(int, int y)           { g[y].i()=0; return true; }
+	inline bool cos_fwd(int, int y)           { g[y].i()=0; return true; }
+	inline bool sin_fwd(int, int y)           { g[y].i()=0; return true; }
+	inline bool tan_fwd(int, int y)           { g[y].i()=0; return true; }
+	inline bool cosh_fwd(int, int y)          { g[y].i()=0; return true; }
+	inline bool sinh_fwd(int, int y)          { g[y].i()=0; return true; }
+	inline bool tanh_fwd(int, int y)          { g[y].i()=0; return true; }
+	inline bool acos_fwd(int, int y)          { g[y].i()=0; return true; }
+	inline bool asin_fwd(int, int y)          { g[y].i()=0; return true; }
+	inline bool atan_fwd(int, int y)          { g[y].i()=0; return true; }
+	inline bool acosh_fwd(int, int y)         { g[y].i()=0; return true; }
+	inline bool asinh_fwd(int, int y)         { g[y].i()=0; return true; }
+	inline bool atanh_fwd(int, int y)         { g[y].i()=0; return true; }
+	inline bool add_V_fwd(int, int, int y)    { g[y].v().clear(); return true; }
+	inline bool add_M_fwd(int, int, int y)    { g[y].m().clear(); return true; }
+	inline bool mul_SV_fwd(int, int, int y)   { g[y].v().clear(); return true; }
+	inline bool mul_SM_fwd(int, int, int y)   { g[y].m().clear(); return true; }
+	inline bool mul_VV_fwd(int, int, int y)   { g[y].i()=0; return true; }
+	inline bool mul_MV_fwd(int, int, int y)   { g[y].v().clear(); return true; }
+	inline bool mul_VM_fwd(int, int, int y)   { g[y].v().clear(); return true; }
+	inline bool mul_MM_fwd(int, int, int y)   { g[y].m().clear(); return true; }
+	inline bool sub_V_fwd(int, int, int y)    { g[y].v().clear(); return true; }
+	inline bool sub_M_fwd(int, int, int y)    { g[y].m().clear(); return true; }
 
 	/* ====================================== Backward =================================== */
 
-	inline void idx_bwd    (int, int) { }
-	       void idx_cp_bwd (int, int);
-	       void vector_bwd (int* x, int y);
-	inline void symbol_bwd (int) { /*cout << "symbol bwd=" << g[y].v() << endl;*/ /* nothing to do */ }
-	inline void cst_bwd    (int) { /* nothing to do */ }
-	       void apply_bwd  (int* x, int y);
-	       void chi_bwd    (int x1, int x2, int x3, int y);
-	       void gen2_bwd   (int x1, int x2, int y);
-	inline void add_bwd    (int x1, int x2, int y) { g[x1].i() += g[y].i();  g[x2].i() += g[y].i(); }
-	inline void mul_bwd    (int x1, int x2, int y) { g[x1].i() += g[y].i() * d[x2].i(); g[x2].i() += g[y].i() * d[x1].i(); }
-	inline void sub_bwd    (int x1, int x2, int y) { g[x1].i() += g[y].i();  g[x2].i() += -g[y].i(); }
-	inline void div_bwd    (int x1, int x2, int y) { g[x1].i() += g[y].i() / d[x2].i(); g[x2].i() += g[y].i()*(-d[x1].i())/sqr(d[x2].i()); }
-	       void max_bwd    (int x1, int x2, int y);
-	       void min_bwd    (int x1, int x2, int y);
-	       void atan2_bwd  (int x1, int x2, int y);
-	       void gen1_bwd   (int x, int y);
-	inline void minus_bwd  (int x, int y) { g[x].i() += -1.0*g[y].i(); }
-	inline void minus_V_bwd(int x, int y) { g[x].v() += -1.0*g[y].v(); }
-	inline void minus_M_bwd(int x, int y) { g[x].m() += -1.0*g[y].m(); }
-        inline void trans_V_bwd(int, int) { /* nothing to do because g[x].v() is a reference to g[y].v() */ }
-        inline void trans_M_bwd(int x, int y) { g[x].m() += g[y].m().transpose(); }
-	       void sign_bwd   (int x, int y);
-	       void abs_bwd    (int x, int y);
-	inline void power_bwd  (int x, int y, int p) { g[x].i() += g[y].i() * p * pow(d[x].i(), p-1); }
-	inline void sqr_bwd   (int x, int y) { g[x].i() += g[y].i() * 2.0 * d[x].i(); }
-	inline void sqrt_bwd  (int x, int y) { g[x].i() += g[y].i() * 0.5 / sqrt(d[x].i());  }
-	inline void exp_bwd   (int x, int y) { g[x].i() += g[y].i() * exp(d[x].i()); }
-	inline void log_bwd   (int x, int y) { g[x].i() += g[y].i() / d[x].i(); }
-	inline void cos_bwd   (int x, int y) { g[x].i() += g[y].i() * -sin(d[x].i()); }
-	inline void sin_bwd   (int x, int y) { g[x].i() += g[y].i() * cos(d[x].i()); }
-	inline void tan_bwd   (int x, int y) { g[x].i() += g[y].i() * (1.0 + sqr(tan(d[x].i()))); }
-	inline void cosh_bwd  (int x, int y) { g[x].i() += g[y].i() * sinh(d[x].i()); }
-	inline void sinh_bwd  (int x, int y) { g[x].i() += g[y].i() * cosh(d[x].i()); }
-	inline void tanh_bwd  (int x, int y) { g[x].i() += g[y].i() * (1.0 - sqr(tanh(d[x].i()))); }
-	inline void acos_bwd  (int x, int y) { g[x].i() += g[y].i() * -1.0 / sqrt(1.0-sqr(d[x].i())); }
-	inline void asin_bwd  (int x, int y) { g[x].i() += g[y].i() * 1.0 / sqrt(1.0-sqr(d[x].i())); }
-	inline void atan_bwd  (int x, int y) { g[x].i() += g[y].i() * 1.0 / (1.0+sqr(d[x].i())); }
-	inline void acosh_bwd (int x, int y) { g[x].i() += g[y].i() * 1.0 / sqrt(sqr(d[x].i()) -1.0); }
-	inline void asinh_bwd (int x, int y) { g[x].i() += g[y].i() * 1.0 / sqrt(1.0+sqr(d[x].i())); }
-	inline void atanh_bwd (int x, int y) { g[x].i() += g[y].i() * 1.0 / (1.0-sqr(d[x].i())); }
-
-	inline void add_V_bwd (int x1, int x2, int y) { g[x1].v() += g[y].v();        g[x2].v() += g[y].v(); }
-	inline void add_M_bwd (int x1, int x2, int y) { g[x1].m() += g[y].m();        g[x2].m() += g[y].m(); }
-	inline void mul_SV_bwd(int x1, int x2, int y) { g[x1].i() += g[y].v()*d[x2].v(); g[x2].v() += d[x1].i()*g[y].v(); }
-	inline void mul_SM_bwd(int x1, int x2, int y) { for (int i=0; i<d[y].m().nb_rows(); i++) g[x1].i()+=g[y].m()[i]*d[x2].m()[i]; g[x2].m() += d[x1].i()*g[y].m();  }
-	inline void mul_VV_bwd(int x1, int x2, int y) { g[x1].v() += g[y].i()*d[x2].v(); g[x2].v() += g[y].i()*d[x1].v(); }
-	inline void mul_MV_bwd(int x1, int x2, int y) { g[x1].m() += outer_product(g[y].v(),d[x2].v()); g[x2].v() += d[x1].m().transpose()*g[y].v(); }
-	inline void mul_MM_bwd(int x1, int x2, int y) { g[x1].m() += g[y].m()*d[x2].m().transpose(); g[x2].m() += d[x1].m().transpose()*g[y].m(); }
-	inline void mul_VM_bwd(int x1, int x2, int y) { g[x1].v() += d[x2].m()*g[y].v(); g[x2].m() += outer_product(d[x1].v(),g[y].v()); }
-	inline void sub_V_bwd (int x1, int x2, int y) { g[x1].v() += g[y].v(); g[x2].v() -= g[y].v(); }
-	inline void sub_M_bwd (int x1, int x2, int y) { g[x1].m() += g[y].m(); g[x2].m() -= g[y].m(); }
+	inline bool idx_bwd    (int, int) { return true; }
+	       bool idx_cp_bwd (int, int);
+	       bool vector_bwd (int* x, int y);
+	inline bool symbol_bwd (int) { /*cout << "symbol bwd=" << g[y].v() << endl;*/ /* nothing to do */ return true; }
+	inline bool cst_bwd    (int) { /* nothing to do */ return true; }
+	       bool apply_bwd  (int* x, int y);
+	       bool chi_bwd    (int x1, int x2, int x3, int y);
+	       bool gen2_bwd   (int x1, int x2, int y);
+	inline bool add_bwd    (int x1, int x2, int y) { g[x1].i() += g[y].i();  g[x2].i() += g[y].i(); return true; }
+	inline bool mul_bwd    (int x1, int x2, int y) { g[x1].i() += g[y].i() * d[x2].i(); g[x2].i() += g[y].i() * d[x1].i(); return true; }
+	inline bool sub_bwd    (int x1, int x2, int y) { g[x1].i() += g[y].i();  g[x2].i() += -g[y].i(); return true; }
+	inline bool div_bwd    (int x1, int x2, int y) { g[x1].i() += g[y].i() / d[x2].i(); g[x2].i() += g[y].i()*(-d[x1].i())/sqr(d[x2].i()); return true; }
+	       bool max_bwd    (int x1, int x2, int y);
+	       bool min_bwd    (int x1, int x2, int y);
+	       bool atan2_bwd  (int x1, int x2, int y);
+	       bool gen1_bwd   (int x, int y);
+	inline bool minus_bwd  (int x, int y) { g[x].i() += -1.0*g[y].i(); return true; }
+	inline bool minus_V_bwd(int x, int y) { g[x].v() += -1.0*g[y].v(); return true; }
+	inline bool minus_M_bwd(int x, int y) { g[x].m() += -1.0*g[y].m(); return true; }
+        inline bool trans_V_bwd(int, int) { /* nothing to do because g[x].v() is a reference to g[y].v() */ return true; }
+        inline bool trans_M_bwd(int x, int y) { g[x].m() += g[y].m().transpose(); return true; }
+	       bool sign_bwd   (int x, int y);
+	       bool abs_bwd    (int x, int y);
+	inline bool power_bwd  (int x, int y, int p) { g[x].i() += g[y].i() * p * pow(d[x].i(), p-1); return true; }
+	inline bool sqr_bwd   (int x, int y) { g[x].i() += g[y].i() * 2.0 * d[x].i(); return true; }
+	inline bool sqrt_bwd  (int x, int y) { g[x].i() += g[y].i() * 0.5 / sqrt(d[x].i()); return true; }
+	inline bool exp_bwd   (int x, int y) { g[x].i() += g[y].i() * exp(d[x].i()); return true; }
+	inline bool log_bwd   (int x, int y) { g[x].i() += g[y].i() / d[x].i(); return true; }
+	inline bool cos_bwd   (int x, int y) { g[x].i() += g[y].i() * -sin(d[x].i()); return true; }
+	inline bool sin_bwd   (int x, int y) { g[x].i() += g[y].i() * cos(d[x].i()); return true; }
+	inline bool tan_bwd   (int x, int y) { g[x].i() += g[y].i() * (1.0 + sqr(tan(d[x].i()))); return true; }
+	inline bool cosh_bwd  (int x, int y) { g[x].i() += g[y].i() * sinh(d[x].i()); return true; }
+	inline bool sinh_bwd  (int x, int y) { g[x].i() += g[y].i() * cosh(d[x].i()); return true; }
+	inline bool tanh_bwd  (int x, int y) { g[x].i() += g[y].i() * (1.0 - sqr(tanh(d[x].i()))); return true; }
+	inline bool acos_bwd  (int x, int y) { g[x].i() += g[y].i() * -1.0 / sqrt(1.0-sqr(d[x].i())); return true; }
+	inline bool asin_bwd  (int x, int y) { g[x].i() += g[y].i() * 1.0 / sqrt(1.0-sqr(d[x].i())); return true; }
+	inline bool atan_bwd  (int x, int y) { g[x].i() += g[y].i() * 1.0 / (1.0+sqr(d[x].i())); return true; }
+	inline bool acosh_bwd (int x, int y) { g[x].i() += g[y].i() * 1.0 / sqrt(sqr(d[x].i()) -1.0); return true; }
+	inline bool asinh_bwd (int x, int y) { g[x].i() += g[y].i() * 1.0 / sqrt(1.0+sqr(d[x].i())); return true; }
+	inline bool atanh_bwd (int x, int y) { g[x].i() += g[y].i() * 1.0 / (1.0-sqr(d[x].i())); return true; }
+
+	inline bool add_V_bwd (int x1, int x2, int y) { g[x1].v() += g[y].v();        g[x2].v() += g[y].v(); return true; }
+	inline bool add_M_bwd (int x1, int x2, int y) { g[x1].m() += g[y].m();        g[x2].m() += g[y].m(); return true; }
+	inline bool mul_SV_bwd(int x1, int x2, int y) { g[x1].i() += g[y].v()*d[x2].v(); g[x2].v() += d[x1].i()*g[y].v(); return true; }
+	inline bool mul_SM_bwd(int x1, int x2, int y) { for (int i=0; i<d[y].m().nb_rows(); i++) g[x1].i()+=g[y].m()[i]*d[x2].m()[i]; g[x2].m() += d[x1].i()*g[y].m(); return true; }
+	inline bool mul_VV_bwd(int x1, int x2, int y) { g[x1].v() += g[y].i()*d[x2].v(); g[x2].v() += g[y].i()*d[x1].v(); return true; }
+	inline bool mul_MV_bwd(int x1, int x2, int y) { g[x1].m() += outer_product(g[y].v(),d[x2].v()); g[x2].v() += d[x1].m().transpose()*g[y].v(); return true; }
+	inline bool mul_MM_bwd(int x1, int x2, int y) { g[x1].m() += g[y].m()*d[x2].m().transpose(); g[x2].m() += d[x1].m().transpose()*g[y].m(); return true; }
+	inline bool mul_VM_bwd(int x1, int x2, int y) { g[x1].v() += d[x2].m()*g[y].v(); g[x2].m() += outer_product(d[x1].v(),g[y].v()); return true; }
+	inline bool sub_V_bwd (int x1, int x2, int y) { g[x1].v() += g[y].v(); g[x2].v() -= g[y].v(); return true; }
+	inline bool sub_M_bwd (int x1, int x2, int y) { g[x1].m() += g[y].m(); g[x2].m() -= g[y].m(); return true; }
+
+protected:
+	/**
+	 * Calculate some components of the Jacobian and, if y is not NULL,
+	 * the value of these components.
+	 */
+	void jacobian(const IntervalVector& box, IntervalMatrix& J, const BitSet& components, int v, IntervalVector* y);
 
+	/**
+	 * Calculate the gradient, once the evaluation is done.
+	 */
+	void gradient(IntervalVector& g);
+
+	/**
+	 * Read the nonzero entries of the ith row of J in the
+	 * gradient of the arguments. Return false if one is empty.
+	 */
+	bool read_row(int i, IntervalSparseMatrix& J);
+
+public:
 	Function& f;
 	Eval& _eval;
 	ExprDomain& d;
@@ -187,8 +248,19 @@ public:
 	IntervalMatrix coeff_matrix;
 	// True if the ith component is linear (wrt all variables)
 	bool *is_linear;
+	// Structure of the Jacobian
+	IntervalSparseMatrix jac_structure;
+	// For each variable, the argument and the position in this
+	// argument (only used if some arguments are not scalar).
+	std::vector<std::pair<int,int> > var_pos;
 };
 
+/*================================== inline implementations ========================================*/
+
+inline const IntervalSparseMatrix& Gradient::jacobian_structure() const {
+	return jac_structure;
+}
+
 } // namespace ibex
 
 #endif // __IBEX_GRADIENT_H__
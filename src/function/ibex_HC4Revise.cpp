@@ -20,11 +20,14 @@ HC4Revise::HC4Revise(Eval& e) : f(e.f), eval(e), d(e.d) {
 bool HC4Revise::proj(const Domain& y, Array<Domain>& x) {
 	eval.eval(x);
 
-	bool is_inner=backward(y);
+	bool is_inner;
+
+	if (!backward(y,is_inner))
+		return false;
 
 	d.read_arg_domains(x);
 
-	return is_inner;
+	return true;
 //	return proj(y,(const Array<const Domain>&) x);
 }
 
@@ -32,59 +35,58 @@ bool HC4Revise::proj(const Domain& y, Array<Domain>& x) {
 //}
 
 bool HC4Revise::proj(const Domain& y, IntervalVector& x) {
-	eval.eval(x);
+	eval.eval_nodes(x);
 	//std::cout << "forward:" << std::endl; f.cf.print(d);
 
-	bool is_inner=false;
+	bool is_inner;
 
-	try {
-		is_inner = backward(y);
-
-		d.read_arg_domains(x);
-
-		return is_inner;
-
-	} catch(EmptyBoxException&) {
+	if (!backward(y,is_inner)) {
 		x.set_empty();
 		return false;
 	}
+
+	d.read_arg_domains(x);
+
+	return is_inner;
 }
 
-bool HC4Revise::backward(const Domain& y) {
+bool HC4Revise::backward(const Domain& y, bool& is_inner) {
 
 	Domain& root=*d.top;
 
+	is_inner=false;
+
 	if (root.is_empty())
-		throw EmptyBoxException();
+		return false;
 
 	switch(y.dim.type()) {
-	case Dim::SCALAR:       if (root.i().is_subset(y.i())) return true; break;
+	case Dim::SCALAR:       is_inner=root.i().is_subset(y.i()); break;
 	case Dim::ROW_VECTOR:
-	case Dim::COL_VECTOR:   if (root.v().is_subset(y.v())) return true; break;
-	case Dim::MATRIX:       if (root.m().is_subset(y.m())) return true; break;
+	case Dim::COL_VECTOR:   is_inner=root.v().is_subset(y.v()); break;
+	case Dim::MATRIX:       is_inner=root.m().is_subset(y.m()); break;
 	}
 
+	if (is_inner) return true;
+
 	root &= y;
 
 	if (root.is_empty())
-		throw EmptyBoxException();
-
-	// may throw an EmptyBoxException().
-	eval.f.backward<HC4Revise>(*this);
+		return false;
 
-	return false;
+	return eval.f.backward<HC4Revise>(*this);
 	//std::cout << "backward:" << std::endl; f.cf.print();
 }
 
-void HC4Revise::idx_cp_bwd(int x, int y) {
+bool HC4Revise::idx_cp_bwd(int x, int y) {
 	assert(dynamic_cast<const ExprIndex*> (&f.node(y)));
 
 	const ExprIndex& e = (const ExprIndex&) f.node(y);
 
 	d[x].put(e.index.first_row(), e.index.first_col(), d[y]);
+	return true;
 }
 
-void HC4Revise::apply_bwd(int* x, int y) {
+bool HC4Revise::apply_bwd(int* x, int y) {
 	assert(dynamic_cast<const ExprApply*> (&f.node(y)));
 
 	const ExprApply& a = (const ExprApply&) f.node(y);
@@ -97,14 +99,10 @@ void HC4Revise::apply_bwd(int* x, int y) {
 		d2.set_ref(i,d[x[i]]);
 	}
 
-	// if next instruction throws an EmptyBoxException,
-	// it will be caught by proj(...,IntervalVector& x).
-	// (it is a protected function, not called outside of the class
-	// so there is no risk)
-	a.func.hc4revise().proj(d[y],d2);
+	return eval.sub_context(a.func).hc4revise.proj(d[y],d2);
 }
 
-void HC4Revise::vector_bwd(int* x, int y) {
+bool HC4Revise::vector_bwd(int* x, int y) {
 	assert(dynamic_cast<const ExprVector*>(&(f.node(y))));
 
 	const ExprVector& v = (const ExprVector&) f.node(y);
@@ -117,11 +115,11 @@ void HC4Revise::vector_bwd(int* x, int y) {
 		for (int i=0; i<v.length(); i++) {
 			if (v.arg(i).dim.is_vector()) {
 				if ((d[x[i]].v() &= d[y].v().subvector(j,j+v.arg(i).dim.vec_size())).is_empty())
-						throw EmptyBoxException();
+						return false;
 				j+=v.arg(i).dim.vec_size();
 			} else {
 				if ((d[x[i]].i() &= d[y].v()[j]).is_empty())
-					throw EmptyBoxException();
+					return false;
 				j++;
 			}
 		}
@@ -133,11 +131,11 @@ void HC4Revise::vector_bwd(int* x, int y) {
 			for (int i=0; i<v.length(); i++) {
 				if (v.arg(i).dim.is_matrix()) {
 					if ((d[x[i]].m()&=d[y].m().submatrix(0,v.dim.nb_rows(),j,v.arg(i).dim.nb_cols())).is_empty())
-						throw EmptyBoxException();
+						return false;
 					j+=v.arg(i).dim.nb_cols();
 				} else if (v.arg(i).dim.is_vector()) {
 					if ((d[x[i]].v()&=d[y].m().col(j)).is_empty())
-						throw EmptyBoxException();
+						return false;
 					j++;
 				}
 			}
@@ -145,32 +143,33 @@ void HC4Revise::vector_bwd(int* x, int y) {
 			for (int i=0; i<v.length(); i++) {
 				if (v.arg(i).dim.is_matrix()) {
 					if ((d[x[i]].m()&=d[y].m().submatrix(j,v.arg(i).dim.nb_rows(),0,v.dim.nb_cols())).is_empty())
-						throw EmptyBoxException();
+						return false;
 					j+=v.arg(i).dim.nb_rows();
 				} else if (v.arg(i).dim.is_vector()) {
 					if ((d[x[i]].v()&=d[y].m().row(j)).is_empty())
-						throw EmptyBoxException();
+						return false;
 					j++;
 				}
 			}
 		}
 	}
+	return true;
 }
 
-void HC4Revise::gen2_bwd(int x1, int x2, int y) {
+bool HC4Revise::gen2_bwd(int x1, int x2, int y) {
 	assert(dynamic_cast<const ExprGenericBinaryOp*>(&(f.node(y))));
 
 	const ExprGenericBinaryOp& e = (const ExprGenericBinaryOp&) f.node(y);
 	e.bwd(d[y], d[x1], d[x2]);
-	if (d[x1].is_empty() || d[x2].is_empty()) throw EmptyBoxException();
+	return !d[x1].is_empty() && !d[x2].is_empty();
 }
 
-void HC4Revise::gen1_bwd(int x, int y) {
+bool HC4Revise::gen1_bwd(int x, int y) {
 	assert(dynamic_cast<const ExprGenericUnaryOp*>(&(f.node(y))));
 
 	const ExprGenericUnaryOp& e = (const ExprGenericUnaryOp&) f.node(y);
 	e.bwd(d[y], d[x]);
-	if (d[x].is_empty()) throw EmptyBoxException();
+	return !d[x].is_empty();
 }
 
 
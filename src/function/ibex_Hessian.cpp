@@ -0,0 +1,515 @@
+/* ============================================================================
+ * I B E X - Hessian of a function
+ * ============================================================================
+ * Copyright   : IMT Atlantique (FRANCE)
+ * License     : This program can be distributed under the terms of the GNU LGPL.
+ *               See the file COPYING.LESSER.
+ *
+ * Author(s)   : Gilles Chabert
+ * Created     : Oct 17, 2026
+ * ---------------------------------------------------------------------------- */
+
+#include "ibex_Function.h"
+#include "ibex_Hessian.h"
+#include "ibex_ExprLinearity.h"
+
+using namespace std;
+
+namespace ibex {
+
+namespace {
+
+/*
+ * Same as Eval::vector_fwd, on the domains D.
+ */
+void vector_copy(const ExprVector& v, ExprDomain& D, int* x, int y) {
+	int j=0;
+
+	if (v.dim.is_vector()) {
+		for (int i=0; i<v.length(); i++) {
+			if (v.arg(i).dim.is_vector()) {
+				D[y].v().put(j,D[x[i]].v());
+				j+=v.arg(i).dim.vec_size();
+			} else {
+				D[y].v()[j]=D[x[i]].i();
+				j++;
+			}
+		}
+	}
+	else {
+		if (v.row_vector()) {
+			for (int i=0; i<v.length(); i++) {
+				if (v.arg(i).dim.is_matrix()) {
+					D[y].m().put(0,j,D[x[i]].m());
+					j+=v.arg(i).dim.nb_cols();
+				} else if (v.arg(i).dim.is_vector()) {
+					D[y].m().set_col(j,D[x[i]].v());
+					j++;
+				}
+			}
+		} else {
+			for (int i=0; i<v.length(); i++) {
+				if (v.arg(i).dim.is_matrix()) {
+					D[y].m().put(j,0,D[x[i]].m());
+					j+=v.arg(i).dim.nb_rows();
+				} else if (v.arg(i).dim.is_vector()) {
+					D[y].m().set_row(j,D[x[i]].v());
+					j++;
+				}
+			}
+		}
+	}
+}
+
+/*
+ * Same as Gradient::vector_bwd, on the adjoints G.
+ */
+void vector_add(const ExprVector& v, ExprDomain& G, int* x, int y) {
+	int j=0;
+
+	if (v.dim.is_vector()) {
+		for (int i=0; i<v.length(); i++) {
+			if (v.arg(i).dim.is_vector()) {
+				G[x[i]].v()+=G[y].v().subvector(j,j+v.arg(i).dim.vec_size()-1);
+				j+=v.arg(i).dim.vec_size();
+			} else {
+				G[x[i]].i()+=G[y].v()[j];
+				j++;
+			}
+		}
+	}
+	else {
+		if (v.row_vector()) {
+			for (int i=0; i<v.length(); i++) {
+				if (v.arg(i).dim.is_matrix()) {
+					G[x[i]].m()+=G[y].m().submatrix(0,v.dim.nb_rows()-1,j,j+v.arg(i).dim.nb_cols()-1);
+					j+=v.arg(i).dim.nb_cols();
+				} else if (v.arg(i).dim.is_vector()) {
+					G[x[i]].v()+=G[y].m().col(j);
+					j++;
+				}
+			}
+		} else {
+			for (int i=0; i<v.length(); i++) {
+				if (v.arg(i).dim.is_matrix()) {
+					G[x[i]].m()+=G[y].m().submatrix(j,j+v.arg(i).dim.nb_rows()-1,0,v.dim.nb_cols()-1);
+					j+=v.arg(i).dim.nb_rows();
+				} else if (v.arg(i).dim.is_vector()) {
+					G[x[i]].v()+=G[y].m().row(j);
+					j++;
+				}
+			}
+		}
+	}
+}
+
+/*
+ * Same as Gradient::idx_cp_bwd, on the adjoints G.
+ */
+void index_add(const ExprIndex& e, ExprDomain& G, int x, int y) {
+	Domain gx=G[x][e.index];
+	gx = gx + G[y];
+	G[x].put(e.index.first_row(), e.index.first_col(), gx);
+}
+
+}
+
+Hessian::Hessian(Eval& e) : f(e.f), _eval(e), d(e.d), t(f), g(f), h(f) {
+
+	if (!f.expr().dim.is_scalar())
+		return; // only sub-sweeps are performed in this case
+
+	// A finite coefficient means that the partial
+	// derivative is constant (or zero).
+	ExprLinearity el(f.args(),f.expr());
+	IntervalVector coeff=el.coeff_vector(f.expr());
+
+	for (int j=0; j<f.nb_var(); j++)
+		if (coeff[j].is_unbounded()) nonlinear_vars.push_back(j);
+}
+
+Hessian::~Hessian() {
+	for (map<const Function*, Hessian*>::iterator it=sub.begin(); it!=sub.end(); ++it)
+		delete it->second;
+}
+
+void Hessian::hessian(const IntervalVector& box, IntervalMatrix& H) {
+
+	if (!f.expr().dim.is_scalar()) {
+		ibex_error("Cannot called \"hessian\" on a vector-valued function");
+	}
+
+	int n=f.nb_var();
+
+	assert(H.nb_rows()==n && H.nb_cols()==n);
+
+	H.clear();
+
+	if (nonlinear_vars.empty()) return;
+
+	if (_eval.eval_nodes(box).is_empty()) {
+		// outside definition domain -> empty Hessian
+		H.set_empty(); return;
+	}
+
+	IntervalVector tbox(n, Interval::ZERO);
+	IntervalVector col(n);
+
+	for (vector<int>::const_iterator k=nonlinear_vars.begin(); k!=nonlinear_vars.end(); ++k) {
+
+		tbox[*k]=1.0;
+		t.write_arg_domains(tbox);
+		tbox[*k]=0.0;
+
+		// the forward phase clears the adjoints of all the nodes
+		f.forward<Hessian>(*this);
+
+		g.top->i()=1.0;
+		h.top->i()=0.0;
+
+		f.backward<Hessian>(*this);
+
+		h.read_arg_domains(col);
+
+		if (col.is_empty()) {
+			H.set_empty();
+			return;
+		}
+
+		for (vector<int>::const_iterator i=nonlinear_vars.begin(); i!=nonlinear_vars.end(); ++i)
+			H[*i][*k]=col[*i];
+	}
+
+	// H_ij and H_ji are two enclosures of the same quantity
+	for (vector<int>::const_iterator i=nonlinear_vars.begin(); i!=nonlinear_vars.end(); ++i)
+		for (vector<int>::const_iterator k=nonlinear_vars.begin(); k!=i; ++k) {
+			Interval hik=H[*i][*k] & H[*k][*i];
+			H[*i][*k]=hik;
+			H[*k][*i]=hik;
+		}
+}
+
+bool Hessian::forward(const Array<const Domain>& dx, const Array<const Domain>& tx) {
+	if (_eval.eval(dx).is_empty()) return false;
+
+	t.write_arg_domains(tx);
+
+	return f.forward<Hessian>(*this);
+}
+
+void Hessian::backward(const Domain& gy, const Domain& hy, Array<Domain>& gx, Array<Domain>& hx) {
+	*g.top = gy;
+	*h.top = hy;
+
+	f.backward<Hessian>(*this);
+
+	for (int i=0; i<f.nb_arg(); i++) {
+		gx[i] = gx[i] + g.args[i];
+		hx[i] = hx[i] + h.args[i];
+	}
+}
+
+Hessian& Hessian::sub_hessian(const Function& func) {
+	map<const Function*, Hessian*>::iterator it=sub.find(&func);
+	if (it!=sub.end()) return *it->second;
+
+	Hessian* hs=new Hessian(_eval.sub_context(func).eval);
+	sub.insert(make_pair(&func,hs));
+	return *hs;
+}
+
+bool Hessian::idx_cp_fwd(int x, int y) {
+	assert(dynamic_cast<const ExprIndex*> (&f.node(y)));
+
+	const ExprIndex& e = (const ExprIndex&) f.node(y);
+
+	t[y] = t[x][e.index];
+	clear_adj(y);
+	return true;
+}
+
+bool Hessian::vector_fwd(int* x, int y) {
+	assert(dynamic_cast<const ExprVector*>(&(f.node(y))));
+
+	vector_copy((const ExprVector&) f.node(y), t, x, y);
+	clear_adj(y);
+	return true;
+}
+
+bool Hessian::apply_fwd(int* x, int y) {
+	assert(dynamic_cast<const ExprApply*> (&f.node(y)));
+
+	const ExprApply& a = (const ExprApply&) f.node(y);
+
+	Array<const Domain> d2(a.func.nb_arg());
+	Array<const Domain> t2(a.func.nb_arg());
+
+	for (int i=0; i<a.func.nb_arg(); i++) {
+		d2.set_ref(i,d[x[i]]);
+		t2.set_ref(i,t[x[i]]);
+	}
+
+	Hessian& hs=sub_hessian(a.func);
+
+	if (!hs.forward(d2,t2)) return false;
+
+	t[y] = *hs.t.top;
+	clear_adj(y);
+	return true;
+}
+
+bool Hessian::max_fwd(int x1, int x2, int y) {
+	if (d[x1].i().lb() > d[x2].i().ub())
+		t[y].i()=t[x1].i();
+	else if (d[x2].i().lb() > d[x1].i().ub())
+		t[y].i()=t[x2].i();
+	else
+		t[y].i()=t[x1].i() | t[x2].i();
+	clear_adj(y);
+	return true;
+}
+
+bool Hessian::min_fwd(int x1, int x2, int y) {
+	if (d[x1].i().lb() > d[x2].i().ub())
+		t[y].i()=t[x2].i();
+	else if (d[x2].i().lb() > d[x1].i().ub())
+		t[y].i()=t[x1].i();
+	else
+		t[y].i()=t[x1].i() | t[x2].i();
+	clear_adj(y);
+	return true;
+}
+
+bool Hessian::atan2_fwd(int x1, int x2, int y) {
+	Interval r=sqr(d[x1].i())+sqr(d[x2].i());
+	t[y].i()=(d[x2].i()*t[x1].i() - d[x1].i()*t[x2].i())/r;
+	clear_adj(y);
+	return true;
+}
+
+bool Hessian::sign_fwd(int x, int y) {
+	// see Gradient::sign_bwd
+	return unary_fwd(x, y, d[x].i().contains(0) ? Interval::POS_REALS : Interval::ZERO);
+}
+
+bool Hessian::abs_fwd(int x, int y) {
+	if (d[x].i().lb()>0) return unary_fwd(x, y, Interval::ONE);
+	else if (d[x].i().ub()<0) return unary_fwd(x, y, -Interval::ONE);
+	else return unary_fwd(x, y, Interval(-1,1));
+}
+
+bool Hessian::idx_cp_bwd(int x, int y) {
+	assert(dynamic_cast<const ExprIndex*> (&f.node(y)));
+
+	const ExprIndex& e = (const ExprIndex&) f.node(y);
+
+	index_add(e, g, x, y);
+	index_add(e, h, x, y);
+	return true;
+}
+
+bool Hessian::vector_bwd(int* x, int y) {
+	assert(dynamic_cast<const ExprVector*>(&(f.node(y))));
+
+	const ExprVector& v = (const ExprVector&) f.node(y);
+
+	vector_add(v, g, x, y);
+	vector_add(v, h, x, y);
+	return true;
+}
+
+bool Hessian::apply_bwd(int* x, int y) {
+
+	const ExprApply& a = (const ExprApply&) f.node(y);
+
+	Array<const Domain> d2(a.func.nb_arg());
+	Array<const Domain> t2(a.func.nb_arg());
+	Array<Domain> g2(a.func.nb_arg());
+	Array<Domain> h2(a.func.nb_arg());
+
+	for (int i=0; i<a.func.nb_arg(); i++) {
+		d2.set_ref(i,d[x[i]]);
+		t2.set_ref(i,t[x[i]]);
+		g2.set_ref(i,g[x[i]]);
+		h2.set_ref(i,h[x[i]]);
+	}
+
+	Hessian& hs=sub_hessian(a.func);
+
+	// the sub-function may have been evaluated elsewhere
+	// since the forward sweep
+	if (!hs.forward(d2,t2)) return false;
+
+	hs.backward(g[y], h[y], g2, h2);
+	return true;
+}
+
+bool Hessian::binary_bwd(int x1, int x2, int y, const Interval& d1, const Interval& d2,
+		const Interval& d11, const Interval& d12, const Interval& d22) {
+	g[x1].i() += g[y].i()*d1;
+	g[x2].i() += g[y].i()*d2;
+	h[x1].i() += h[y].i()*d1 + g[y].i()*(d11*t[x1].i() + d12*t[x2].i());
+	h[x2].i() += h[y].i()*d2 + g[y].i()*(d12*t[x1].i() + d22*t[x2].i());
+	return true;
+}
+
+bool Hessian::mul_bwd(int x1, int x2, int y) {
+	return binary_bwd(x1, x2, y, d[x2].i(), d[x1].i(), Interval::ZERO, Interval::ONE, Interval::ZERO);
+}
+
+bool Hessian::div_bwd(int x1, int x2, int y) {
+	const Interval& a=d[x1].i();
+	const Interval& b=d[x2].i();
+	Interval b2=sqr(b);
+	return binary_bwd(x1, x2, y, 1.0/b, -a/b2, Interval::ZERO, -1.0/b2, 2.0*a/(b2*b));
+}
+
+bool Hessian::max_bwd(int x1, int x2, int y) {
+	if (d[x1].i().lb() > d[x2].i().ub())
+		return binary_bwd(x1, x2, y, Interval::ONE, Interval::ZERO, Interval::ZERO, Interval::ZERO, Interval::ZERO);
+	else if (d[x2].i().lb() > d[x1].i().ub())
+		return binary_bwd(x1, x2, y, Interval::ZERO, Interval::ONE, Interval::ZERO, Interval::ZERO, Interval::ZERO);
+	else // kink: max(x1,x2)=(x1+x2+|x1-x2|)/2
+		return binary_bwd(x1, x2, y, Interval(0,1), Interval(0,1), Interval::POS_REALS, Interval::NEG_REALS, Interval::POS_REALS);
+}
+
+bool Hessian::min_bwd(int x1, int x2, int y) {
+	if (d[x1].i().lb() > d[x2].i().ub())
+		return binary_bwd(x1, x2, y, Interval::ZERO, Interval::ONE, Interval::ZERO, Interval::ZERO, Interval::ZERO);
+	else if (d[x2].i().lb() > d[x1].i().ub())
+		return binary_bwd(x1, x2, y, Interval::ONE, Interval::ZERO, Interval::ZERO, Interval::ZERO, Interval::ZERO);
+	else // kink: min(x1,x2)=(x1+x2-|x1-x2|)/2
+		return binary_bwd(x1, x2, y, Interval(0,1), Interval(0,1), Interval::NEG_REALS, Interval::POS_REALS, Interval::NEG_REALS);
+}
+
+bool Hessian::atan2_bwd(int x1, int x2, int y) {
+	const Interval& a=d[x1].i();
+	const Interval& b=d[x2].i();
+	Interval r=sqr(a)+sqr(b);
+	Interval r2=sqr(r);
+	return binary_bwd(x1, x2, y, b/r, -a/r, -2.0*a*b/r2, (sqr(a)-sqr(b))/r2, 2.0*a*b/r2);
+}
+
+bool Hessian::sign_bwd(int x, int y) {
+	if (d[x].i().contains(0))
+		return unary_bwd(x, y, Interval::POS_REALS, Interval::ALL_REALS);
+	else
+		return true; // derivatives are zero
+}
+
+bool Hessian::abs_bwd(int x, int y) {
+	if (d[x].i().lb()>0) return unary_bwd(x, y, Interval::ONE, Interval::ZERO);
+	else if (d[x].i().ub()<0) return unary_bwd(x, y, -Interval::ONE, Interval::ZERO);
+	else return unary_bwd(x, y, Interval(-1,1), Interval::POS_REALS);
+}
+
+bool Hessian::power_bwd(int x, int y, int p) {
+	switch (p) {
+	case 0:  return true;
+	case 1:  return unary_bwd(x, y, Interval::ONE, Interval::ZERO);
+	default: return unary_bwd(x, y, p*pow(d[x].i(),p-1), (p*(p-1))*pow(d[x].i(),p-2));
+	}
+}
+
+bool Hessian::tan_bwd(int x, int y) {
+	Interval d1=1.0+sqr(d[y].i());
+	return unary_bwd(x, y, d1, 2.0*d[y].i()*d1);
+}
+
+bool Hessian::tanh_bwd(int x, int y) {
+	Interval d1=1.0-sqr(d[y].i());
+	return unary_bwd(x, y, d1, -2.0*d[y].i()*d1);
+}
+
+bool Hessian::acos_bwd(int x, int y) {
+	Interval u=1.0-sqr(d[x].i());
+	Interval s=sqrt(u);
+	return unary_bwd(x, y, -1.0/s, -d[x].i()/(u*s));
+}
+
+bool Hessian::asin_bwd(int x, int y) {
+	Interval u=1.0-sqr(d[x].i());
+	Interval s=sqrt(u);
+	return unary_bwd(x, y, 1.0/s, d[x].i()/(u*s));
+}
+
+bool Hessian::atan_bwd(int x, int y) {
+	Interval u=1.0+sqr(d[x].i());
+	return unary_bwd(x, y, 1.0/u, -2.0*d[x].i()/sqr(u));
+}
+
+bool Hessian::acosh_bwd(int x, int y) {
+	Interval u=sqr(d[x].i())-1.0;
+	Interval s=sqrt(u);
+	return unary_bwd(x, y, 1.0/s, -d[x].i()/(u*s));
+}
+
+bool Hessian::asinh_bwd(int x, int y) {
+	Interval u=1.0+sqr(d[x].i());
+	Interval s=sqrt(u);
+	return unary_bwd(x, y, 1.0/s, -d[x].i()/(u*s));
+}
+
+bool Hessian::atanh_bwd(int x, int y) {
+	Interval u=1.0-sqr(d[x].i());
+	return unary_bwd(x, y, 1.0/u, 2.0*d[x].i()/sqr(u));
+}
+
+/*
+ * For a bilinear operator y=B(x1,x2), the adjoints are
+ *   g1 += B1(gy,d2)   and   g2 += B2(d1,gy)
+ * (see Gradient) and their tangents
+ *   h1 += B1(hy,d2) + B1(gy,t2)   and   h2 += B2(d1,hy) + B2(t1,gy).
+ */
+
+bool Hessian::mul_SV_bwd(int x1, int x2, int y) {
+	g[x1].i() += g[y].v()*d[x2].v();
+	h[x1].i() += h[y].v()*d[x2].v() + g[y].v()*t[x2].v();
+	g[x2].v() += d[x1].i()*g[y].v();
+	h[x2].v() += d[x1].i()*h[y].v() + t[x1].i()*g[y].v();
+	return true;
+}
+
+bool Hessian::mul_SM_bwd(int x1, int x2, int y) {
+	for (int i=0; i<d[y].m().nb_rows(); i++) {
+		g[x1].i() += g[y].m()[i]*d[x2].m()[i];
+		h[x1].i() += h[y].m()[i]*d[x2].m()[i] + g[y].m()[i]*t[x2].m()[i];
+	}
+	g[x2].m() += d[x1].i()*g[y].m();
+	h[x2].m() += d[x1].i()*h[y].m() + t[x1].i()*g[y].m();
+	return true;
+}
+
+bool Hessian::mul_VV_bwd(int x1, int x2, int y) {
+	g[x1].v() += g[y].i()*d[x2].v();
+	h[x1].v() += h[y].i()*d[x2].v() + g[y].i()*t[x2].v();
+	g[x2].v() += g[y].i()*d[x1].v();
+	h[x2].v() += h[y].i()*d[x1].v() + g[y].i()*t[x1].v();
+	return true;
+}
+
+bool Hessian::mul_MV_bwd(int x1, int x2, int y) {
+	g[x1].m() += outer_product(g[y].v(),d[x2].v());
+	h[x1].m() += outer_product(h[y].v(),d[x2].v()) + outer_product(g[y].v(),t[x2].v());
+	g[x2].v() += d[x1].m().transpose()*g[y].v();
+	h[x2].v() += d[x1].m().transpose()*h[y].v() + t[x1].m().transpose()*g[y].v();
+	return true;
+}
+
+bool Hessian::mul_VM_bwd(int x1, int x2, int y) {
+	g[x1].v() += d[x2].m()*g[y].v();
+	h[x1].v() += d[x2].m()*h[y].v() + t[x2].m()*g[y].v();
+	g[x2].m() += outer_product(d[x1].v(),g[y].v());
+	h[x2].m() += outer_product(d[x1].v(),h[y].v()) + outer_product(t[x1].v(),g[y].v());
+	return true;
+}
+
+bool Hessian::mul_MM_bwd(int x1, int x2, int y) {
+	g[x1].m() += g[y].m()*d[x2].m().transpose();
+	h[x1].m() += h[y].m()*d[x2].m().transpose() + g[y].m()*t[x2].m().transpose();
+	g[x2].m() += d[x1].m().transpose()*g[y].m();
+	h[x2].m() += d[x1].m().transpose()*h[y].m() + t[x1].m().transpose()*g[y].m();
+	return true;
+}
+
+} // namespace ibex
@@ -0,0 +1,250 @@
+/* ============================================================================
+ * I B E X - Hessian of a function
+ * ============================================================================
+ * Copyright   : IMT Atlantique (FRANCE)
+ * License     : This program can be distributed under the terms of the GNU LGPL.
+ *               See the file COPYING.LESSER.
+ *
+ * Author(s)   : Gilles Chabert
+ * Created     : Oct 17, 2026
+ * ---------------------------------------------------------------------------- */
+
+#ifndef __IBEX_HESSIAN_H__
+#define __IBEX_HESSIAN_H__
+
+#include "ibex_Eval.h"
+#include "ibex_BwdAlgorithm.h"
+#include "ibex_Exception.h"
+
+#include <map>
+#include <vector>
+
+namespace ibex {
+
+/**
+ * \ingroup symbolic
+ * \brief Calculates the Hessian matrix of a real-valued function.
+ *
+ * The Hessian is calculated by automatic differentiation in
+ * "forward-over-reverse" mode, directly on the compiled function:
+ * for each variable x_k, a forward sweep propagates the derivatives
+ * of all the nodes w.r.t. x_k (the "tangents") and a backward sweep
+ * propagates the adjoints (the gradient) together with their derivatives
+ * w.r.t. x_k. The latter give the kth column of the Hessian matrix.
+ *
+ * This avoids symbolic differentiation (and the related expression
+ * blow-up). Only the variables on which the function depends
+ * nonlinearly give a sweep (the other rows/columns are zero) and
+ * the symmetry of the matrix is used to intersect the two
+ * enclosures of each entry H_ij and H_ji.
+ *
+ * \note chi, generic operators are not supported.
+ */
+class Hessian : public FwdAlgorithm, public BwdAlgorithm {
+
+public:
+	/**
+	 * \brief Build the Hessian algorithm.
+	 *
+	 * Like #ibex::Gradient, the data of the evaluator is shared.
+	 */
+	Hessian(Eval& eval);
+
+	/**
+	 * \brief Delete this.
+	 */
+	~Hessian();
+
+	/**
+	 * \brief Calculate the Hessian matrix of f on the box \a box and store the result in \a H.
+	 *
+	 * If box is outside the definition domain of f, H is set to the empty matrix.
+	 */
+	void hessian(const IntervalVector& box, IntervalMatrix& H);
+
+	/* ====================================== Forward =================================== */
+
+	inline bool idx_fwd(int , int ) { /* nothing to do */ return true; }
+	       bool idx_cp_fwd(int x, int y);
+	       bool vector_fwd(int* x, int y);
+	inline bool cst_fwd(int y)                     { t[y].clear(); clear_adj(y); return true; }
+	inline bool symbol_fwd(int y)                  { /* the tangent is set by the caller */ clear_adj(y); return true; }
+	       bool apply_fwd(int* x, int y);
+	inline bool chi_fwd(int, int, int, int)        { not_implemented("Hessian of \"chi\""); return true; }
+	inline bool gen2_fwd(int, int, int)            { not_implemented("Hessian of binary generic operator"); return true; }
+	inline bool add_fwd(int x1, int x2, int y)     { t[y].i()=t[x1].i()+t[x2].i(); clear_adj(y); return true; }
+	inline bool mul_fwd(int x1, int x2, int y)     { t[y].i()=t[x1].i()*d[x2].i()+d[x1].i()*t[x2].i(); clear_adj(y); return true; }
+	inline bool sub_fwd(int x1, int x2, int y)     { t[y].i()=t[x1].i()-t[x2].i(); clear_adj(y); return true; }
+	inline bool div_fwd(int x1, int x2, int y)     { t[y].i()=t[x1].i()/d[x2].i()-t[x2].i()*d[x1].i()/sqr(d[x2].i()); clear_adj(y); return true; }
+	       bool max_fwd(int x1, int x2, int y);
+	       bool min_fwd(int x1, int x2, int y);
+	       bool atan2_fwd(int x1, int x2, int y);
+	inline bool gen1_fwd(int, int)                 { not_implemented("Hessian of unary generic operator"); return true; }
+	inline bool minus_fwd(int x, int y)            { t[y].i()=-t[x].i(); clear_adj(y); return true; }
+	inline bool minus_V_fwd(int x, int y)          { t[y].v()=-t[x].v(); clear_adj(y); return true; }
+	inline bool minus_M_fwd(int x, int y)          { t[y].m()=-t[x].m(); clear_adj(y); return true; }
+	inline bool trans_V_fwd(int, int)              { /* nothing to do: t[y].v() is a reference to t[x].v() */ return true; }
+	inline bool trans_M_fwd(int x, int y)          { t[y].m()=t[x].m().transpose(); clear_adj(y); return true; }
+	       bool sign_fwd(int x, int y);
+	       bool abs_fwd(int x, int y);
+	inline bool power_fwd(int x, int y, int p)     { return unary_fwd(x, y, p==0? Interval::ZERO : p*pow(d[x].i(),p-1)); }
+	inline bool sqr_fwd(int x, int y)              { return unary_fwd(x, y, 2.0*d[x].i()); }
+	inline bool sqrt_fwd(int x, int y)             { return unary_fwd(x, y, 0.5/sqrt(d[x].i())); }
+	inline bool exp_fwd(int x, int y)              { return unary_fwd(x, y, d[y].i()); }
+	inline bool log_fwd(int x, int y)              { return unary_fwd(x, y, 1.0/d[x].i()); }
+	inline bool cos_fwd(int x, int y)              { return unary_fwd(x, y, -sin(d[x].i())); }
+	inline bool sin_fwd(int x, int y)              { return unary_fwd(x, y, cos(d[x].i())); }
+	inline bool tan_fwd(int x, int y)              { return unary_fwd(x, y, 1.0+sqr(d[y].i())); }
+	inline bool cosh_fwd(int x, int y)             { return unary_fwd(x, y, sinh(d[x].i())); }
+	inline bool sinh_fwd(int x, int y)             { return unary_fwd(x, y, cosh(d[x].i())); }
+	inline bool tanh_fwd(int x, int y)             { return unary_fwd(x, y, 1.0-sqr(d[y].i())); }
+	inline bool acos_fwd(int x, int y)             { return unary_fwd(x, y, -1.0/sqrt(1.0-sqr(d[x].i()))); }
+	inline bool asin_fwd(int x, int y)             { return unary_fwd(x, y, 1.0/sqrt(1.0-sqr(d[x].i()))); }
+	inline bool atan_fwd(int x, int y)             { return unary_fwd(x, y, 1.0/(1.0+sqr(d[x].i()))); }
+	inline bool acosh_fwd(int x, int y)            { return unary_fwd(x, y, 1.0/sqrt(sqr(d[x].i())-1.0)); }
+	inline bool asinh_fwd(int x, int y)            { return unary_fwd(x, y, 1.0/sqrt(1.0+sqr(d[x].i()))); }
+	inline bool atanh_fwd(int x, int y)            { return unary_fwd(x, y, 1.0/(1.0-sqr(d[x].i()))); }
+	inline bool add_V_fwd(int x1, int x2, int y)   { t[y].v()=t[x1].v()+t[x2].v(); clear_adj(y); return true; }
+	inline bool add_M_fwd(int x1, int x2, int y)   { t[y].m()=t[x1].m()+t[x2].m(); clear_adj(y); return true; }
+	inline bool mul_SV_fwd(int x1, int x2, int y)  { t[y].v()=t[x1].i()*d[x2].v()+d[x1].i()*t[x2].v(); clear_adj(y); return true; }
+	inline bool mul_SM_fwd(int x1, int x2, int y)  { t[y].m()=t[x1].i()*d[x2].m()+d[x1].i()*t[x2].m(); clear_adj(y); return true; }
+	inline bool mul_VV_fwd(int x1, int x2, int y)  { t[y].i()=t[x1].v()*d[x2].v()+d[x1].v()*t[x2].v(); clear_adj(y); return true; }
+	inline bool mul_MV_fwd(int x1, int x2, int y)  { t[y].v()=t[x1].m()*d[x2].v()+d[x1].m()*t[x2].v(); clear_adj(y); return true; }
+	inline bool mul_VM_fwd(int x1, int x2, int y)  { t[y].v()=t[x1].v()*d[x2].m()+d[x1].v()*t[x2].m(); clear_adj(y); return true; }
+	inline bool mul_MM_fwd(int x1, int x2, int y)  { t[y].m()=t[x1].m()*d[x2].m()+d[x1].m()*t[x2].m(); clear_adj(y); return true; }
+	inline bool sub_V_fwd(int x1, int x2, int y)   { t[y].v()=t[x1].v()-t[x2].v(); clear_adj(y); return true; }
+	inline bool sub_M_fwd(int x1, int x2, int y)   { t[y].m()=t[x1].m()-t[x2].m(); clear_adj(y); return true; }
+
+	/* ====================================== Backward =================================== */
+
+	inline bool idx_bwd    (int, int) { return true; }
+	       bool idx_cp_bwd (int x, int y);
+	       bool vector_bwd (int* x, int y);
+	inline bool symbol_bwd (int) { /* nothing to do */ return true; }
+	inline bool cst_bwd    (int) { /* nothing to do */ return true; }
+	       bool apply_bwd  (int* x, int y);
+	inline bool chi_bwd    (int, int, int, int) { not_implemented("Hessian of \"chi\""); return true; }
+	inline bool gen2_bwd   (int, int, int)      { not_implemented("Hessian of binary generic operator"); return true; }
+	inline bool add_bwd    (int x1, int x2, int y) { g[x1].i() += g[y].i(); h[x1].i() += h[y].i(); g[x2].i() += g[y].i(); h[x2].i() += h[y].i(); return true; }
+	inline bool sub_bwd    (int x1, int x2, int y) { g[x1].i() += g[y].i(); h[x1].i() += h[y].i(); g[x2].i() -= g[y].i(); h[x2].i() -= h[y].i(); return true; }
+	       bool mul_bwd    (int x1, int x2, int y);
+	       bool div_bwd    (int x1, int x2, int y);
+	       bool max_bwd    (int x1, int x2, int y);
+	       bool min_bwd    (int x1, int x2, int y);
+	       bool atan2_bwd  (int x1, int x2, int y);
+	inline bool gen1_bwd   (int, int) { not_implemented("Hessian of unary generic operator"); return true; }
+	inline bool minus_bwd  (int x, int y) { g[x].i() -= g[y].i(); h[x].i() -= h[y].i(); return true; }
+	inline bool minus_V_bwd(int x, int y) { g[x].v() -= g[y].v(); h[x].v() -= h[y].v(); return true; }
+	inline bool minus_M_bwd(int x, int y) { g[x].m() -= g[y].m(); h[x].m() -= h[y].m(); return true; }
+	inline bool trans_V_bwd(int, int)     { /* nothing to do: g[x].v() is a reference to g[y].v() */ return true; }
+	inline bool trans_M_bwd(int x, int y) { g[x].m() += g[y].m().transpose(); h[x].m() += h[y].m().transpose(); return true; }
+	       bool sign_bwd   (int x, int y);
+	       bool abs_bwd    (int x, int y);
+	       bool power_bwd  (int x, int y, int p);
+	inline bool sqr_bwd    (int x, int y) { return unary_bwd(x, y, 2.0*d[x].i(), Interval(2.0)); }
+	inline bool sqrt_bwd   (int x, int y) { return unary_bwd(x, y, 0.5/d[y].i(), -0.25/(d[x].i()*d[y].i())); }
+	inline bool exp_bwd    (int x, int y) { return unary_bwd(x, y, d[y].i(), d[y].i()); }
+	inline bool log_bwd    (int x, int y) { return unary_bwd(x, y, 1.0/d[x].i(), -1.0/sqr(d[x].i())); }
+	inline bool cos_bwd    (int x, int y) { return unary_bwd(x, y, -sin(d[x].i()), -d[y].i()); }
+	inline bool sin_bwd    (int x, int y) { return unary_bwd(x, y, cos(d[x].i()), -d[y].i()); }
+	       bool tan_bwd    (int x, int y);
+	inline bool cosh_bwd   (int x, int y) { return unary_bwd(x, y, sinh(d[x].i()), d[y].i()); }
+	inline bool sinh_bwd   (int x, int y) { return unary_bwd(x, y, cosh(d[x].i()), d[y].i()); }
+	       bool tanh_bwd   (int x, int y);
+	       bool acos_bwd   (int x, int y);
+	       bool asin_bwd   (int x, int y);
+	       bool atan_bwd   (int x, int y);
+	       bool acosh_bwd  (int x, int y);
+	       bool asinh_bwd  (int x, int y);
+	       bool atanh_bwd  (int x, int y);
+	inline bool add_V_bwd  (int x1, int x2, int y) { g[x1].v() += g[y].v(); h[x1].v() += h[y].v(); g[x2].v() += g[y].v(); h[x2].v() += h[y].v(); return true; }
+	inline bool add_M_bwd  (int x1, int x2, int y) { g[x1].m() += g[y].m(); h[x1].m() += h[y].m(); g[x2].m() += g[y].m(); h[x2].m() += h[y].m(); return true; }
+	       bool mul_SV_bwd (int x1, int x2, int y);
+	       bool mul_SM_bwd (int x1, int x2, int y);
+	       bool mul_VV_bwd (int x1, int x2, int y);
+	       bool mul_MV_bwd (int x1, int x2, int y);
+	       bool mul_VM_bwd (int x1, int x2, int y);
+	       bool mul_MM_bwd (int x1, int x2, int y);
+	inline bool sub_V_bwd  (int x1, int x2, int y) { g[x1].v() += g[y].v(); h[x1].v() += h[y].v(); g[x2].v() -= g[y].v(); h[x2].v() -= h[y].v(); return true; }
+	inline bool sub_M_bwd  (int x1, int x2, int y) { g[x1].m() += g[y].m(); h[x1].m() += h[y].m(); g[x2].m() -= g[y].m(); h[x2].m() -= h[y].m(); return true; }
+
+protected:
+	/**
+	 * Forward sweep on the domains dx of the arguments, with
+	 * the tangents tx. Return false if dx is outside the definition
+	 * domain of f.
+	 */
+	bool forward(const Array<const Domain>& dx, const Array<const Domain>& tx);
+
+	/**
+	 * Backward sweep (after a forward sweep) with the adjoint gy of the
+	 * result and its tangent hy. The adjoints and their tangents are added
+	 * to gx and hx.
+	 */
+	void backward(const Domain& gy, const Domain& hy, Array<Domain>& gx, Array<Domain>& hx);
+
+	/**
+	 * The Hessian calculator of a function applied in f.
+	 */
+	Hessian& sub_hessian(const Function& g);
+
+	/**
+	 * Clear the adjoint and its tangent.
+	 */
+	void clear_adj(int y);
+
+	/**
+	 * Forward sweep of y=phi(x) where phi'(x)=d1.
+	 */
+	bool unary_fwd(int x, int y, const Interval& d1);
+
+	/**
+	 * Backward sweep of y=phi(x) where phi'(x)=d1 and phi''(x)=d2.
+	 */
+	bool unary_bwd(int x, int y, const Interval& d1, const Interval& d2);
+
+	/**
+	 * Backward sweep of y=phi(x1,x2), where (d1,d2) is the gradient
+	 * of phi and (d11,d12,d22) the Hessian of phi.
+	 */
+	bool binary_bwd(int x1, int x2, int y, const Interval& d1, const Interval& d2,
+			const Interval& d11, const Interval& d12, const Interval& d22);
+
+public:
+	Function& f;
+	Eval& _eval;
+	ExprDomain& d;
+	ExprDomain t; // tangents
+	ExprDomain g; // adjoints
+	ExprDomain h; // tangents of adjoints
+	// variables on which f depends nonlinearly
+	std::vector<int> nonlinear_vars;
+
+protected:
+	// Hessian calculators of applied functions
+	std::map<const Function*, Hessian*> sub;
+};
+
+/*================================== inline implementations ========================================*/
+
+inline void Hessian::clear_adj(int y) {
+	g[y].clear();
+	h[y].clear();
+}
+
+inline bool Hessian::unary_fwd(int x, int y, const Interval& d1) {
+	t[y].i() = d1*t[x].i();
+	g[y].i() = 0;
+	h[y].i() = 0;
+	return true;
+}
+
+inline bool Hessian::unary_bwd(int x, int y, const Interval& d1, const Interval& d2) {
+	g[x].i() += g[y].i()*d1;
+	h[x].i() += h[y].i()*d1 + g[y].i()*d2*t[x].i();
+	return true;
+}
+
+} // namespace ibex
+
+#endif // __IBEX_HESSIAN_H__
@@ -0,0 +1,240 @@
+/* ============================================================================
+ * I B E X - Native (compiled) kernels of a function
+ * ============================================================================
+ * Copyright   : IMT Atlantique (FRANCE)
+ * License     : This program can be distributed under the terms of the GNU LGPL.
+ *               See the file COPYING.LESSER.
+ *
+ * Author(s)   : Gilles Chabert
+ * Created     : Oct 17, 2026
+ * ---------------------------------------------------------------------------- */
+
+#include "ibex_NativeKernel.h"
+#include "ibex_Function.h"
+#include "ibex_Expr2Cpp.h"
+#include "ibex_Setting.h"
+
+#include <sstream>
+#include <fstream>
+#include <iomanip>
+#include <cstdio>
+#include <cstdlib>
+
+#include <vector>
+#include <cerrno>
+
+#ifndef _WIN32
+#include <dlfcn.h>
+#include <unistd.h>
+#include <fcntl.h>
+#include <sys/stat.h>
+#include <sys/types.h>
+#include <sys/wait.h>
+#endif
+
+using namespace std;
+
+namespace ibex {
+
+namespace {
+
+const char* env_or(const char* var, const char* def) {
+	const char* val=getenv(var);
+	return (val && *val) ? val : def;
+}
+
+// split a list of words separated by blanks
+vector<string> split(const string& s) {
+	vector<string> words;
+	istringstream in(s);
+	string w;
+	while (in >> w) words.push_back(w);
+	return words;
+}
+
+// FNV-1a hash
+unsigned long long fnv_hash(const string& s) {
+	unsigned long long h=14695981039346656037ULL;
+	for (size_t i=0; i<s.size(); i++) {
+		h ^= (unsigned char) s[i];
+		h *= 1099511628211ULL;
+	}
+	return h;
+}
+
+#ifndef _WIN32
+
+// true if the file exists, is of the given type (S_IFDIR, S_IFREG),
+// is owned by the current user and is not writable by anybody else
+// (symbolic links are rejected).
+bool is_safe(const string& path, mode_t type) {
+	struct stat st;
+	return lstat(path.c_str(), &st)==0
+			&& (st.st_mode & S_IFMT)==type
+			&& st.st_uid==geteuid()
+			&& (st.st_mode & (S_IWGRP | S_IWOTH))==0;
+}
+
+// the cache directory (empty string if none can be safely used)
+string cache_dir() {
+	string dir;
+
+	const char* var=getenv("IBEX_NATIVE_CACHE");
+	if (var && *var)
+		dir=var;
+	else {
+		string base;
+		if ((var=getenv("XDG_CACHE_HOME")) && *var)
+			base=var;
+		else if ((var=getenv("HOME")) && *var)
+			base=string(var)+"/.cache";
+		else
+			return "";
+		if (mkdir(base.c_str(), 0700)!=0 && errno!=EEXIST)
+			return "";
+		dir=base+"/ibex";
+	}
+
+	if (mkdir(dir.c_str(), 0700)!=0 && errno!=EEXIST)
+		return "";
+
+	return is_safe(dir, S_IFDIR) ? dir : "";
+}
+
+// run a command (no shell involved) and return true if it succeeded
+bool run(const vector<string>& args) {
+	vector<char*> argv;
+	for (size_t i=0; i<args.size(); i++)
+		argv.push_back((char*) args[i].c_str());
+	argv.push_back(NULL);
+
+	pid_t pid=fork();
+	if (pid==-1) return false;
+
+	if (pid==0) {
+		int null=open("/dev/null", O_WRONLY);
+		if (null!=-1) {
+			dup2(null, STDOUT_FILENO);
+			dup2(null, STDERR_FILENO);
+		}
+		execvp(argv[0], &argv[0]);
+		_exit(127);
+	}
+
+	int status;
+	while (waitpid(pid, &status, 0)==-1)
+		if (errno!=EINTR) return false;
+
+	return WIFEXITED(status) && WEXITSTATUS(status)==0;
+}
+
+#endif
+
+}
+
+NativeKernel::NativeKernel(const string& path, void* handle) : path(path), handle(handle), _eval(NULL), _proj(NULL), _grad(NULL) {
+
+}
+
+#ifdef _WIN32
+
+NativeKernel* NativeKernel::build(const Function&) {
+	return NULL; // not supported
+}
+
+NativeKernel::~NativeKernel() { }
+
+#else
+
+NativeKernel* NativeKernel::build(const Function& f) {
+
+	stringstream code;
+	if (!Expr2Cpp().print(code, f.args(), f.expr()))
+		return NULL;
+
+	string cxx=env_or("CXX","c++");
+	string flags=string("-std=c++11 -O2 -fPIC -shared ") + _IBEX_NATIVE_CXXFLAGS_;
+
+	// the key includes the compilation command
+	stringstream key;
+	key << hex << setfill('0') << setw(16) << fnv_hash(code.str()+cxx+flags);
+
+	string dir=cache_dir();
+	if (dir.empty()) return NULL;
+
+	string base=dir+"/ibex_"+key.str();
+	string so=base+".so";
+
+	struct stat st;
+	if (lstat(so.c_str(), &st)!=0) {
+		// temporary files, renamed at the end so that
+		// another process never loads a partial shared object
+		stringstream tmp;
+		tmp << base << "." << getpid();
+		string src=tmp.str()+".cpp";
+		string obj=tmp.str()+".tmp";
+		{
+			ofstream out(src.c_str());
+			out << code.str();
+			if (!out) return NULL;
+		}
+
+		vector<string> args=split(cxx);
+		vector<string> options=split(flags);
+		args.insert(args.end(), options.begin(), options.end());
+		args.push_back("-o");
+		args.push_back(obj);
+		args.push_back(src);
+
+		bool ok=!args.empty() && run(args) && rename(obj.c_str(), so.c_str())==0;
+		remove(src.c_str());
+		if (!ok) {
+			remove(obj.c_str());
+			return NULL;
+		}
+	}
+
+	// never load a file that someone else could have written
+	if (!is_safe(so, S_IFREG)) return NULL;
+
+	void* handle=dlopen(so.c_str(), RTLD_NOW | RTLD_LOCAL);
+	if (!handle) return NULL;
+
+	NativeKernel* k=new NativeKernel(so, handle);
+	k->_eval=(eval_kernel) dlsym(handle, "ibex_native_eval");
+	k->_proj=(proj_kernel) dlsym(handle, "ibex_native_proj");
+	k->_grad=(grad_kernel) dlsym(handle, "ibex_native_gradient");
+
+	if (!k->_eval || !k->_proj || !k->_grad) {
+		delete k;
+		return NULL;
+	}
+
+	return k;
+}
+
+NativeKernel::~NativeKernel() {
+	dlclose(handle);
+}
+
+#endif
+
+Interval NativeKernel::eval(const IntervalVector& box) const {
+	Interval y;
+	_eval(&box[0], &y);
+	return y;
+}
+
+bool NativeKernel::backward(const Interval& y, IntervalVector& x) const {
+	switch (_proj(&y, &x[0])) {
+	case -1: x.set_empty(); return false;
+	case 1:  return true;
+	default: return false;
+	}
+}
+
+void NativeKernel::gradient(const IntervalVector& x, IntervalVector& g) const {
+	_grad(&x[0], &g[0]);
+}
+
+} // namespace ibex
@@ -0,0 +1,100 @@
+/* ============================================================================
+ * I B E X - Native (compiled) kernels of a function
+ * ============================================================================
+ * Copyright   : IMT Atlantique (FRANCE)
+ * License     : This program can be distributed under the terms of the GNU LGPL.
+ *               See the file COPYING.LESSER.
+ *
+ * Author(s)   : Gilles Chabert
+ * Created     : Oct 17, 2026
+ * ---------------------------------------------------------------------------- */
+
+#ifndef __IBEX_NATIVE_KERNEL_H__
+#define __IBEX_NATIVE_KERNEL_H__
+
+#include "ibex_IntervalVector.h"
+
+#include <string>
+
+namespace ibex {
+
+class Function;
+
+/**
+ * \ingroup symbolic
+ *
+ * \brief Native kernels of a function.
+ *
+ * The C++ code of the forward evaluation, the HC4Revise projection
+ * and the gradient of a function f is generated (see #ibex::Expr2Cpp),
+ * compiled as a shared object with the local C++ compiler and loaded
+ * with dlopen. This removes the interpretive dispatch of
+ * #ibex::CompiledFunction.
+ *
+ * Shared objects are cached on disk, in a directory given by the
+ * environment variable IBEX_NATIVE_CACHE (default: "$XDG_CACHE_HOME/ibex"
+ * or "~/.cache/ibex"), under a name obtained by hashing the generated code.
+ * The directory and the shared objects must be owned by the current user
+ * and not be writable by others, otherwise they are not used. The compiler
+ * is given by the environment variable CXX (default: "c++"); it is run
+ * directly (not through a shell).
+ *
+ * The shared object resolves the symbols of the interval library
+ * from the running program. With a static Ibex library, the program
+ * must therefore be linked with "-rdynamic".
+ *
+ * Use #ibex::Function::compile_native() to create a kernel.
+ */
+class NativeKernel {
+public:
+	/**
+	 * \brief Try to build the native kernels of f.
+	 *
+	 * \return NULL if f is not supported or if the compilation
+	 *         or the loading failed.
+	 */
+	static NativeKernel* build(const Function& f);
+
+	/**
+	 * \brief Unload the shared object.
+	 */
+	~NativeKernel();
+
+	/**
+	 * \brief Return f(box).
+	 */
+	Interval eval(const IntervalVector& box) const;
+
+	/**
+	 * \brief Project f(x)=y onto x (HC4Revise).
+	 *
+	 * Same semantic as #ibex::Function::backward(const Interval&, IntervalVector&).
+	 */
+	bool backward(const Interval& y, IntervalVector& x) const;
+
+	/**
+	 * \brief Calculate the gradient of f at x.
+	 */
+	void gradient(const IntervalVector& x, IntervalVector& g) const;
+
+	/**
+	 * \brief The path of the shared object.
+	 */
+	const std::string path;
+
+private:
+	NativeKernel(const std::string& path, void* handle);
+
+	typedef void (*eval_kernel)(const Interval* x, Interval* y);
+	typedef int  (*proj_kernel)(const Interval* y, Interval* x);
+	typedef void (*grad_kernel)(const Interval* x, Interval* g);
+
+	void* handle;
+	eval_kernel _eval;
+	proj_kernel _proj;
+	grad_kernel _grad;
+};
+
+} // namespace ibex
+
+#endif // __IBEX_NATIVE_KERNEL_H__
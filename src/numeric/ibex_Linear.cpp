@@ -301,11 +301,10 @@ bool full_rank(const IntervalMatrix& A) {
 	 }
 }
 
-void precond(IntervalMatrix& A) {
-	int n=(A.nb_rows());
-	assert(n == A.nb_cols()); //throw NotSquareMatrixException();  // not well-constraint problem
+namespace {
 
-	Matrix C(n,n);
+// Inverse of Mid([A]), Inf([A]) or Sup([A]) (in priority)
+void precond_matrix(const IntervalMatrix& A, Matrix& C) {
 	try { real_inverse(A.mid(), C); }
 	catch (SingularMatrixException&) {
 		try { real_inverse(A.lb(), C); }
@@ -313,23 +312,42 @@ void precond(IntervalMatrix& A) {
 			real_inverse(A.ub(), C);
 		}
 	}
+}
+
+}
+
+void precond(IntervalMatrix& A) {
+	int n=(A.nb_rows());
+	assert(n == A.nb_cols()); //throw NotSquareMatrixException();  // not well-constraint problem
+
+	Matrix C(n,n);
+	precond_matrix(A,C);
 
 	A = C*A;
 }
 
+void precond(IntervalMatrix& A, IntervalVector& b, Matrix& C) {
+	int n=(A.nb_rows());
+	assert(n == A.nb_cols()); //throw NotSquareMatrixException();  // not well-constraint problem
+	assert(n == b.size());
+
+	Matrix C2(n,n);
+	precond_matrix(A,C2);
+
+	A = C2*A;
+	b = C2*b;
+
+	if (C.nb_rows()!=n || C.nb_cols()!=n) C.resize(n,n);
+	C = C2;
+}
+
 void precond(IntervalMatrix& A, IntervalVector& b) {
 	int n=(A.nb_rows());
 	assert(n == A.nb_cols()); //throw NotSquareMatrixException();  // not well-constraint problem
 	assert(n == b.size());
 
 	Matrix C(n,n);
-	try { real_inverse(A.mid(), C); }
-	catch (SingularMatrixException&) {
-		try { real_inverse(A.lb(), C); }
-		catch (SingularMatrixException&) {
-			real_inverse(A.ub(), C);
-		}
-	}
+	precond_matrix(A,C);
 
 	//   cout << "A=" << (A.nb_cols()) << "x" << (A.nb_rows()) << "  " << "b=" << (b.size()) << "  " << "C="
 	//        << (C.nb_cols()) << "x" << (C.nb_rows()) << endl;
@@ -368,6 +386,39 @@ void gauss_seidel(const IntervalMatrix& A, const IntervalVector& b, IntervalVect
 	} while (red >= ratio);
 }
 
+void gauss_seidel(const IntervalSparseMatrix& A, const IntervalVector& b, IntervalVector& x, double ratio) {
+	int m=(A.nb_rows());
+	int n=(A.nb_cols());
+	assert(x.size()==n);
+	assert(b.size()==m);
+
+	double red;
+	Interval old, proj, tmp;
+	int i;
+
+	do {
+		red = 0;
+		for (int r=0; r<m; r++) {
+			i=r % n; // in case m>n
+			old = x[i];
+			proj = b[r];
+			tmp = Interval::ZERO;
+
+			for (int k=A.row_begin(r); k<A.row_end(r); k++) {
+				if (A.col(k)!=i) proj -= A[k]*x[A.col(k)];
+				else tmp=A[k];
+			}
+
+			bwd_mul(proj,tmp,x[i]);
+
+			if (x[i].is_empty()) { x.set_empty(); return; }
+
+			double gain=old.rel_distance(x[i]);
+			if (gain>red) red=gain;
+		}
+	} while (red >= ratio);
+}
+
 bool inflating_gauss_seidel(const IntervalMatrix& A, const IntervalVector& b, IntervalVector& x, double min_dist, double mu_max) {
 	int n=(A.nb_rows());
 	assert(n == (A.nb_cols()));
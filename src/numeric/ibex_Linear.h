@@ -12,6 +12,7 @@
 #define __IBEX_LINEAR_H__
 
 #include "ibex_IntervalMatrix.h"
+#include "ibex_IntervalSparseMatrix.h"
 #include "ibex_LinearException.h"
 
 /** \file */
@@ -164,6 +165,20 @@ void precond_rohn_inverse(const IntervalMatrix& A, IntervalMatrix& invA);
  */
 void precond(IntervalMatrix& A, IntervalVector& b);
 
+/**
+ * \brief Preconditions system \f$[A]x=[b]\f$ and return the preconditioner.
+ *
+ * Same as #precond(IntervalMatrix&, IntervalVector&) but the real matrix
+ * \f$C^{-1}\f$ is also returned, so that it can be applied later
+ * to another system.
+ *
+ * \param C (output)  - The preconditioning matrix \f$C^{-1}\f$ (resized if necessary).
+ *
+ * \throw SingularMatrixException if no real matrix extracted from [A] could be inversed successfully.
+ *                                In this case, A, b and C are not modified.
+ */
+void precond(IntervalMatrix& A, IntervalVector& b, Matrix& C);
+
 /**
  * \brief Precondition the matrix \f$[A]\f$.
  *
@@ -196,6 +211,14 @@ void precond(IntervalMatrix& A);
  */
 void gauss_seidel(const IntervalMatrix& A, const IntervalVector& b, IntervalVector& x, double ratio=0.01);
 
+/**
+ * \brief Gauss-Seidel algorithm (sparse variant).
+ *
+ * Same as gauss_seidel(const IntervalMatrix&, const IntervalVector&, IntervalVector&, double)
+ * except that only the nonzero entries of A are considered.
+ */
+void gauss_seidel(const IntervalSparseMatrix& A, const IntervalVector& b, IntervalVector& x, double ratio=0.01);
+
 /**
  * \brief Gauss-Seidel algorithm (inflating variant).<br>
  *
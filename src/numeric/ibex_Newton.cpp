@@ -34,7 +34,16 @@ namespace {
 //
 }
 
-bool newton(const Fnc& f, const VarSet* vars, IntervalVector& full_box, double prec, double ratio_gauss_seidel) {
+/*
+ * If C is not NULL, C is a preconditioning matrix that is used instead of the
+ * inverse of mid(J) as long as the Newton step it yields reduces the box by more
+ * than prec. Otherwise, it is recomputed and the step is done again, unless C
+ * has already been recomputed or has already reduced the box in this call
+ * (the iteration has then converged).
+ * C is only read: a recomputed preconditioner is given to "store" (if not NULL)
+ * and then used for the next steps.
+ */
+bool newton(const Fnc& f, const VarSet* vars, IntervalVector& full_box, double prec, double ratio_gauss_seidel, const Matrix* C, const std::function<void(const Matrix&)>* store) {
 	int n=vars? vars->nb_var : f.nb_var();
 	int m=f.image_dim();
 	assert(full_box.size()==f.nb_var());
@@ -56,6 +65,8 @@ bool newton(const Fnc& f, const VarSet* vars, IntervalVector& full_box, double p
 	IntervalVector mid(n);
 	IntervalVector Fmid(m);
 	bool reducted=false;
+	bool C_tested=false; // C has been recomputed or has reduced the box
+	Matrix* C_new=NULL;  // recomputed preconditioner
 	double gain;
 
 	IntervalVector& box = vars ? *new IntervalVector(vars->var_box(full_box)) : full_box;
@@ -95,10 +106,42 @@ bool newton(const Fnc& f, const VarSet* vars, IntervalVector& full_box, double p
 		if (y==y1) break;
 		y1=y;
 
-		try {
-			precond(J, Fmid);
+		bool cached = C!=NULL;
+
+		if (cached) {
+			IntervalVector y2(y);
+			try {
+				gauss_seidel((*C)*J, (*C)*Fmid, y2, ratio_gauss_seidel);
+			} catch (LinearException& ) {
+				cached=false;
+			}
+
+			if (cached && !y2.is_empty()) {
+				// check that the step is still contracting
+				IntervalVector box2=mid-y2;
+				if (!(box2 &= box).is_empty() && box.maxdelta(box2) < prec && !C_tested)
+					cached=false;
+			}
+
+			if (cached) {
+				y=y2;
+				C_tested=true;
+			}
+		}
 
-			gauss_seidel(J, Fmid, y, ratio_gauss_seidel);
+		try {
+			if (!cached) {
+				if (store) {
+					if (!C_new) C_new=new Matrix(n,n);
+					precond(J, Fmid, *C_new);
+					(*store)(*C_new);
+					C=C_new;
+					C_tested=true;
+				} else
+					precond(J, Fmid);
+
+				gauss_seidel(J, Fmid, y, ratio_gauss_seidel);
+			}
 
 			if (y.is_empty()) {
 				reducted=true;
@@ -138,15 +181,25 @@ bool newton(const Fnc& f, const VarSet* vars, IntervalVector& full_box, double p
 		delete &full_mid;
 	}
 
+	if (C_new) delete C_new;
+
 	return reducted;
 }
 
 bool newton(const Fnc& f, IntervalVector& box, double prec, double ratio_gauss_seidel) {
-	return newton(f,NULL,box,prec,ratio_gauss_seidel);
+	return newton(f,NULL,box,prec,ratio_gauss_seidel,NULL,NULL);
 }
 
 bool newton(const Fnc& f, const VarSet& vars, IntervalVector& full_box, double prec, double ratio_gauss_seidel) {
-	return newton(f,&vars,full_box,prec,ratio_gauss_seidel);
+	return newton(f,&vars,full_box,prec,ratio_gauss_seidel,NULL,NULL);
+}
+
+bool newton(const Fnc& f, IntervalVector& box, const Matrix* C, const std::function<void(const Matrix&)>& store, double prec, double ratio_gauss_seidel) {
+	return newton(f,NULL,box,prec,ratio_gauss_seidel,C,&store);
+}
+
+bool newton(const Fnc& f, const VarSet& vars, IntervalVector& full_box, const Matrix* C, const std::function<void(const Matrix&)>& store, double prec, double ratio_gauss_seidel) {
+	return newton(f,&vars,full_box,prec,ratio_gauss_seidel,C,&store);
 }
 
 bool inflating_newton(const Fnc& f, const VarSet* vars, const IntervalVector& full_box, IntervalVector& box_existence, IntervalVector& box_unicity, int k_max, double mu_max, double delta, double chi) {
@@ -14,6 +14,8 @@
 #include "ibex_Fnc.h"
 #include "ibex_VarSet.h"
 
+#include <functional>
+
 namespace ibex {
 
 /**
@@ -51,6 +53,32 @@ bool newton(const Fnc& f, IntervalVector& box, double prec=default_newton_prec,
  */
 bool newton(const Fnc& f, const VarSet& vars, IntervalVector& full_box, double prec=default_newton_prec, double gauss_seidel_ratio=default_gauss_seidel_ratio);
 
+/**
+ * \brief Newton with a cached preconditioner.
+ *
+ * Same as #ibex::newton(const Fnc&, IntervalVector&, double, double) except that
+ * the preconditioning matrix (the inverse of the midpoint of the Hansen matrix) is
+ * not recalculated at each step. The matrix \a C is used instead as long as the
+ * Newton step it yields reduces the box by more than \a prec (or proves that there
+ * is no solution). When it does not, the preconditioner is recalculated, given to
+ * \a store and the step is done again. This is not done in the last (non-contracting)
+ * step if C has already reduced the box or has been recalculated during the iteration.
+ *
+ * This typically allows to reuse the preconditioner of a parent box in the
+ * search tree (see #ibex::CtcNewton). \a C is not modified, so that a shared
+ * preconditioner is only duplicated when it actually changes.
+ *
+ * \param C     - The preconditioning matrix. If NULL, the preconditioner is
+ *                calculated (like in the standard Newton iteration).
+ * \param store - Called with the new preconditioner each time it is recalculated.
+ */
+bool newton(const Fnc& f, IntervalVector& box, const Matrix* C, const std::function<void(const Matrix&)>& store, double prec=default_newton_prec, double gauss_seidel_ratio=default_gauss_seidel_ratio);
+
+/**
+ * \brief Newton on a subset of variables with a cached preconditioner.
+ */
+bool newton(const Fnc& f, const VarSet& vars, IntervalVector& full_box, const Matrix* C, const std::function<void(const Matrix&)>& store, double prec=default_newton_prec, double gauss_seidel_ratio=default_gauss_seidel_ratio);
+
 /**
  * \ingroup numeric
  *
@@ -10,34 +10,92 @@
 
 #include "ibex_SepUnion.h"
 #include <cassert>
+#include <atomic>
+
+using namespace std;
 
 namespace ibex {
 
-SepUnion::SepUnion(const Array<Sep>& list) : Sep(list[0].nb_var), list(list) {
+SepUnion::SepUnion(const Array<Sep>& list) : Sep(list[0].nb_var), list(list), pool(NULL) {
 
 }
 
-SepUnion::SepUnion(Sep& s1, Sep& s2) : Sep(s1.nb_var), list(Array<Sep>(s1,s2)) {
+SepUnion::SepUnion(Sep& s1, Sep& s2) : Sep(s1.nb_var), list(Array<Sep>(s1,s2)), pool(NULL) {
+
+}
+
+SepUnion::SepUnion(Sep& s1, Sep& s2, Sep& s3) : Sep(s1.nb_var), list(Array<Sep>(s1,s2,s3)), pool(NULL) {
+
+}
 
+SepUnion::~SepUnion() {
+	if (pool) delete pool;
 }
 
-SepUnion::SepUnion(Sep& s1, Sep& s2, Sep& s3) : Sep(s1.nb_var), list(Array<Sep>(s1,s2,s3)) {
+void SepUnion::set_nb_threads(int n) {
+	if (n<=0) n=ThreadPool::hardware_threads();
+
+	if (pool) {
+		delete pool;
+		pool=NULL;
+	}
 
+	if (n>1)
+		pool=new ThreadPool(n);
 }
 
 void SepUnion::separate(IntervalVector &x_in, IntervalVector &x_out){
 	assert(x_in==x_out);
+
+	if (pool && list.size()>1) {
+		parallel_separate(x_in,x_out);
+		return;
+	}
+
 	IntervalVector result_x_out(IntervalVector::empty(x_out.size()));
     IntervalVector savebox(x_out);
-
     for (int i=0; i<list.size(); i++) {
     	if (i>0) x_out=savebox;
     	x_out &= x_in;
     	list[i].separate(x_in,x_out);
     	result_x_out |= x_out;
+
+    	// the other separators can neither enlarge x_out nor contract x_in
+    	if (x_in.is_empty() && result_x_out==savebox) break;
     }
     x_out = result_x_out;
+}
+
+void SepUnion::parallel_separate(IntervalVector &x_in, IntervalVector &x_out) {
+	IntervalVector savebox(x_out);
+
+	// intersection of the inner boxes and hull of the outer boxes of each thread
+	vector<IntervalVector> in(pool->size(), savebox);
+	vector<IntervalVector> out(pool->size(), IntervalVector::empty(savebox.size()));
+
+	atomic<bool> in_empty(false);
+	atomic<bool> out_full(false);
+
+	pool->run(list.size(), [&](int i, int t) {
+		if (in_empty && out_full) return;
+
+		IntervalVector b_in(savebox);
+		IntervalVector b_out(savebox);
+
+		list[i].separate(b_in,b_out);
+
+		in[t] &= b_in;
+		out[t] |= b_out;
+
+		if (in[t].is_empty()) in_empty=true;
+		if (out[t]==savebox) out_full=true;
+	});
 
+	x_out.set_empty();
+	for (int t=0; t<pool->size(); t++) {
+		x_in &= in[t];
+		x_out |= out[t];
+	}
 }
 
 } // end namespace ibex
@@ -13,6 +13,7 @@
 
 #include "ibex_Sep.h"
 #include "ibex_Array.h"
+#include "ibex_ThreadPool.h"
 
 namespace ibex {
 
@@ -68,15 +69,45 @@ public:
 	 */
     SepUnion(Sep& c1, Sep& c2, Sep& c3, Sep& c4, Sep& c5, Sep& c6);
 
+    /**
+     * \brief Delete this.
+     */
+    ~SepUnion();
+
     /**
      * \brief Separate a box.
      */
    virtual void separate(IntervalVector &x_in, IntervalVector &x_out);
 
+    /**
+     * \brief Run the sub-separators with several threads.
+     *
+     * Each sub-separator is applied to its own copy of the box. The
+     * outer boxes are merged by hull and the inner boxes by intersection.
+     * Contrary to the sequential mode, the inner contraction of a
+     * sub-separator is not propagated to the next ones, so the result
+     * may be slightly less accurate.
+     *
+     * The sub-separators are run concurrently, so they must not share
+     * any data that is modified by separation (e.g., the same Function).
+     *
+     * \param n - number of threads. 1 (the default) means sequential;
+     *            n<=0 means the number of hardware threads.
+     */
+    void set_nb_threads(int n);
+
     /**
      * \brief The list of sub-separators.
 	 */
     Array<Sep> list;
+
+protected:
+    /**
+     * \brief Multi-threaded variant of separate (see #set_nb_threads).
+     */
+    void parallel_separate(IntervalVector &x_in, IntervalVector &x_out);
+
+    ThreadPool* pool;
 };
 
 } // end namespace ibex
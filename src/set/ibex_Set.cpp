@@ -231,10 +231,6 @@ std::ostream& operator<<(std::ostream& os, const Set& set) {
 
 class BxpNodeAndDist : public Bxp {
 public:
-	BxpNodeAndDist(const IntervalVector& root_box, const Vector& pt, SetNode* _node) : Bxp(next_id()), pt(pt), node(_node) {
-		set_dist(root_box,pt);
-	}
-
 	BxpNodeAndDist(long id, const IntervalVector& box, const Vector& pt, SetNode* _node) : Bxp(id), pt(pt), node(_node) {
 		set_dist(box,pt);
 	}
@@ -288,13 +284,13 @@ public:
 
 double Set::dist(const Vector& pt, bool inside) const {
 
-	long key = next_id();
+	long key = next_bxp_id();
 
 
 	//int count=0; // for stats
 
 	Cell* root_cell =new Cell(Rn);
-	BxpNodeAndDist* nad=new BxpNodeAndDist(Rn,pt,root);
+	BxpNodeAndDist* nad=new BxpNodeAndDist(key,Rn,pt,root);
 	root_cell->prop.add(nad);
 
 	//count++;
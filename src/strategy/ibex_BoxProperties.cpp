@@ -11,6 +11,7 @@
 #include "ibex_BoxProperties.h"
 
 #include <algorithm>
+#include <cassert>
 
 using namespace std;
 
@@ -41,12 +42,10 @@ int BoxProperties::topo_sort_rec(const Bxp& el, Map<int,false>& level) const {
 		l=0;
 		level.insert_new(el.id, -1); // -1 means: in visit
 		for (std::vector<long>::const_iterator it=el.dependencies.begin(); it!=el.dependencies.end(); it++) {
-			try {
-				int l2=topo_sort_rec(map[*it], level);
-				if (l2>=l) l=l2+1;
-			} catch(Map<Bxp>::NotFound&) {
-				throw PropertyNotFound();
-			}
+			const Bxp* dep=operator[](*it);
+			if (!dep) throw PropertyNotFound();
+			int l2=topo_sort_rec(*dep, level);
+			if (l2>=l) l=l2+1;
 		}
 		level[el.id] = l;
 	}
@@ -54,40 +53,82 @@ int BoxProperties::topo_sort_rec(const Bxp& el, Map<int,false>& level) const {
 }
 
 void BoxProperties::topo_sort() const {
-	dep.clear();
 
 	Map<int,false> level;
 
-	for (Map<Bxp>::const_iterator it=map.begin(); it!=map.end(); it++) {
-		// push the property in the dependency array
-		dep.push_back(it->second);
-		// and determine its level
-		topo_sort_rec(*it->second, level);
+	for (BxpVector::const_iterator it=bxps.begin(); it!=bxps.end(); it++) {
+		// determine the level of the property
+		topo_sort_rec(**it, level);
 	}
 
-	// sort the dependency array w.r.t. level
-	std::stable_sort(dep.begin(),dep.end(),DepComparator(level));
+	// sort the slots w.r.t. level
+	std::stable_sort(bxps.begin(),bxps.end(),DepComparator(level));
+
+	// the layout is not shared (see add(...))
+	for (size_t i=0; i<bxps.size(); i++) {
+		layout->ids[i]=bxps[i]->id;
+		layout->slots[bxps[i]->id]=i;
+	}
 
 	_dep_up2date = true;
 }
 
+int BoxProperties::slot(long id) const {
+	if (!layout || id<0 || id>=(long) layout->slots.size()) return -1;
+	else return layout->slots[id];
+}
+
+void BoxProperties::push(Bxp* prop) {
+	assert(layout && bxps.size()<layout->ids.size() && layout->ids[bxps.size()]==prop->id);
+	prop->nb_refs++;
+	bxps.push_back(prop);
+}
+
+void BoxProperties::release(Bxp* prop) {
+	if (prop->nb_refs.fetch_sub(1, std::memory_order_acq_rel)==1)
+		delete prop;
+}
+
 void BoxProperties::add(Bxp* prop) {
 
-	if (map.found(prop->id)) return;
+	if (slot(prop->id)!=-1) return;
 
-	// forced to create a pointer to a pair because this is the way Map works
+	if (!layout)
+		layout = std::make_shared<Layout>();
+	else if (layout.use_count()>1) // shared with other boxes: duplicate it
+		layout = std::make_shared<Layout>(*layout);
 
-	map.insert_new(prop->id, *prop);
+	assert(prop->id>=0);
+	if (prop->id>=(long) layout->slots.size())
+		layout->slots.resize(prop->id+1, -1);
+	layout->slots[prop->id]=bxps.size();
+	layout->ids.push_back(prop->id);
+	push(prop);
 
 	_dep_up2date=false;
 }
 
 const Bxp* BoxProperties::operator[](long id) const {
-	try {
-		return &map[id];
-	} catch(Map<Bxp>::NotFound&) {
-		return NULL; //throw PropertyNotFound();
+	int i=slot(id);
+	// note: the slot can exist but not be filled yet
+	// (when properties are being copied)
+	if (i==-1 || i>=(int) bxps.size()) return NULL;
+	else return bxps[i];
+}
+
+Bxp* BoxProperties::operator[](long id) {
+	int i=slot(id);
+	if (i==-1 || i>=(int) bxps.size()) return NULL;
+
+	Bxp* p=bxps[i];
+	if (p->nb_refs.load(std::memory_order_acquire)>1) {
+		// shared with another box: duplicate it
+		Bxp* copy=p->copy(box, *this);
+		copy->nb_refs++;
+		bxps[i]=copy;
+		release(p);
 	}
+	return bxps[i];
 }
 
 void BoxProperties::update(const BoxEvent& e) {
@@ -98,15 +139,16 @@ void BoxProperties::update(const BoxEvent& e) {
 	// We could also create each time a new property map with
 	// the required properties only. But we have shared
 	// memory to avoid copies -> not very safe
-	for (vector<Bxp*>::iterator it=dep.begin(); it!=dep.end(); ++it) {
-		(*it)->update(e,*this);
+	for (BxpVector::iterator it=bxps.begin(); it!=bxps.end(); ++it) {
+		if (!(*it)->unchanged(e,*this))
+			operator[]((*it)->id)->update(e,*this);
 	}
 }
 
 void BoxProperties::propagate(const Bxp& p) {
 //	// TODO: something more clever of course.. !!
 //
-//	vector<Bxp*>::iterator it;
+//	BxpVector::iterator it;
 //	for (it=dep.begin(); it!=dep.end() && (*it)->id != p.id; ++it) { }
 //	if (it==dep.end())
 //		ibex_error("[BoxProperties]: unknown property in propagate");
@@ -119,22 +161,51 @@ void BoxProperties::update_bisect(const Bisection& b, BoxProperties& lprop, BoxP
 
 	if (!_dep_up2date) topo_sort();
 
+	// the sub-boxes are expected to have no property yet
+	// (otherwise, the properties are added one by one).
+	bool same_layout = lprop.bxps.empty() && rprop.bxps.empty();
+
+	if (same_layout) {
+		lprop.layout = layout;
+		rprop.layout = layout;
+		lprop.bxps.reserve(bxps.size());
+		rprop.bxps.reserve(bxps.size());
+	}
+
+	BoxEvent eleft(b.left,BoxEvent::CONTRACT,BitSet::singleton(b.box.size(), b.pt.var));
+	BoxEvent eright(b.right,BoxEvent::CONTRACT,BitSet::singleton(b.box.size(), b.pt.var));
+
 	// Duplicate properties respecting dependencies
-	for (vector<Bxp*>::iterator it=dep.begin(); it!=dep.end(); it++) {
-		Bxp* p1 = (*it)->copy(b.left, lprop);
-		p1->update(BoxEvent(b.left,BoxEvent::CONTRACT,BitSet::singleton(b.box.size(), b.pt.var)), lprop);
+	for (BxpVector::iterator it=bxps.begin(); it!=bxps.end(); it++) {
+		Bxp* p1;
+		if ((*it)->unchanged(eleft, lprop))
+			p1 = *it; // shared
+		else {
+			p1 = (*it)->copy(b.left, lprop);
+			p1->update(eleft, lprop);
+		}
 
-		Bxp* p2 = (*it)->copy(b.right, rprop);
-		p2->update(BoxEvent(b.right,BoxEvent::CONTRACT,BitSet::singleton(b.box.size(), b.pt.var)), rprop);
+		Bxp* p2;
+		if ((*it)->unchanged(eright, rprop))
+			p2 = *it; // shared
+		else {
+			p2 = (*it)->copy(b.right, rprop);
+			p2->update(eright, rprop);
+		}
 
-		lprop.add(p1);
-		lprop.dep.push_back(p1);
-		rprop.add(p2);
-		rprop.dep.push_back(p2);
+		if (same_layout) {
+			lprop.push(p1);
+			rprop.push(p2);
+		} else {
+			lprop.add(p1);
+			rprop.add(p2);
+		}
 	}
 
-	lprop._dep_up2date = true; // avoid a call to topo_sort()
-	rprop._dep_up2date = true; // avoid a call to topo_sort()
+	if (same_layout) {
+		lprop._dep_up2date = true; // avoid a call to topo_sort()
+		rprop._dep_up2date = true; // avoid a call to topo_sort()
+	}
 }
 
 BoxProperties::BoxProperties(const IntervalVector& box) : box(box), _dep_up2date(true) {
@@ -145,29 +216,28 @@ BoxProperties::BoxProperties(const BoxProperties& p) : BoxProperties(p.box, p) {
 
 }
 
-BoxProperties::BoxProperties(const IntervalVector& box, const BoxProperties& p) : box(box), _dep_up2date(p._dep_up2date) {
+BoxProperties::BoxProperties(const IntervalVector& box, const BoxProperties& p) : box(box), _dep_up2date(true) {
 
 	if (!p._dep_up2date) p.topo_sort();
 
+	layout = p.layout;
+	bxps.reserve(p.bxps.size());
+
 	// Duplicate properties respecting dependencies
-	for (vector<Bxp*>::iterator it=p.dep.begin(); it!=p.dep.end(); it++) {
-		Bxp* bxp=(*it)->copy(box, *this);
-		add(bxp);
-		dep.push_back(bxp);
+	for (BxpVector::iterator it=p.bxps.begin(); it!=p.bxps.end(); it++) {
+		push((*it)->copy(box, *this));
 	}
-
-	_dep_up2date = true; // avoid a call to topo_sort()
 }
 
 BoxProperties::~BoxProperties() {
-	for (Map<Bxp>::iterator it=map.begin(); it!=map.end(); it++)
-		delete it->second;
+	for (BxpVector::iterator it=bxps.begin(); it!=bxps.end(); it++)
+		release(*it);
 }
 
 ostream& operator<<(ostream& os, const BoxProperties& p) {
 	os << "{\n";
-	for (Map<Bxp>::const_iterator it=p.map.begin(); it!=p.map.end(); it++) {
-		os << "  " << it->second->to_string() << endl;
+	for (BoxProperties::BxpVector::const_iterator it=p.bxps.begin(); it!=p.bxps.end(); it++) {
+		os << "  " << (*it)->to_string() << endl;
 	}
 	os << "}";
 	return os;
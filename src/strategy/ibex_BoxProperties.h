@@ -14,8 +14,11 @@
 #include "ibex_Map.h"
 #include "ibex_Bxp.h"
 #include "ibex_Id.h"
+#include "ibex_Pool.h"
 
 #include <utility>
+#include <vector>
+#include <memory>
 
 namespace ibex {
 
@@ -25,7 +28,20 @@ namespace ibex {
  * \brief Box properties
  *
  * This class allows to store a set of potentially inter-dependent
- * box properties, in a map structure.
+ * box properties.
+ *
+ * Each property occupies a slot in a flat array. The slots are given
+ * when properties are added and sorted with respect to dependencies.
+ * The correspondence between identifiers and slots (the "layout") is
+ * shared by all the boxes of a search tree. Since identifiers are consecutive
+ * numbers (see #ibex::next_bxp_id()), the slot of a property is found by an
+ * array access.
+ *
+ * A property that is unchanged by a bisection (see #Bxp::unchanged(...))
+ * is shared by the parent box and the sub-boxes. It is only duplicated when
+ * it has to be modified, i.e., when it is accessed through the non-const
+ * operator[] or updated. A property that is only read should therefore be
+ * accessed through the const operator[].
  */
 class BoxProperties {
 public:
@@ -79,11 +95,12 @@ public:
 	/**
 	 * \brief Return the property of identifier \a id.
 	 *
+	 * If the property is shared with other boxes, it is
+	 * duplicated first (so that it can be modified).
+	 *
 	 * \return NULL if this property does not exist in the map.
 	 */
-	Bxp* operator[](long id) {
-		return (Bxp*) ((const BoxProperties*) this)->operator[](id);
-	}
+	Bxp* operator[](long id);
 
 	/**
 	 * \brief Update all the properties after box modification.
@@ -125,27 +142,61 @@ protected:
 	 */
 	class PropertyNotFound  : Exception { };
 
+	/*
+	 * Identifiers and slots of the properties.
+	 */
+	struct Layout {
+		/*
+		 * Identifier of the property in each slot.
+		 */
+		std::vector<long> ids;
+
+		/*
+		 * Slot of each identifier (-1 if none).
+		 */
+		std::vector<int> slots;
+	};
+
 	/*
 	 * Recursively called by topo_sort()
 	 */
 	int topo_sort_rec(const Bxp& el, Map<int,false>& level) const;
 
 	/*
-	 * Update #dep with a topological sort of the map
+	 * Sort the slots with respect to dependencies
 	 */
 	void topo_sort() const;
 
 	/*
-	 * The map that allows to retrieve a property by its id.
+	 * Slot of a property (-1 if not found).
+	 */
+	int slot(long id) const;
+
+	/*
+	 * Append a property in the next slot of the layout
+	 * (shared with the properties of another box).
+	 */
+	void push(Bxp* prop);
+
+	/*
+	 * Release a property (deleted if not shared anymore).
+	 */
+	static void release(Bxp* prop);
+
+	/*
+	 * The layout (shared by all the boxes of a search tree).
+	 * NULL if there is no property.
 	 */
-	Map<Bxp> map;
+	mutable std::shared_ptr<Layout> layout;
 
 	/*
 	 * Array of properties sorted by dependency level
 	 * (the first element is at the lowest level =
 	 *  depends on nothing).
+	 * Allocated in the pool, like the cells (see #ibex::Pool).
 	 */
-	mutable std::vector<Bxp*> dep;
+	typedef std::vector<Bxp*, PoolAllocator<Bxp*> > BxpVector;
+	mutable BxpVector bxps;
 
 	/*
 	 * Whether the topological sort is up to date.
@@ -12,8 +12,10 @@
 #include "ibex_BitSet.h"
 #include "ibex_Bisection.h"
 #include "ibex_BoxEvent.h"
+#include "ibex_Pool.h"
 
 #include <sstream>
+#include <atomic>
 
 #ifndef __IBEX_BOX_PROPERTY_H__
 #define __IBEX_BOX_PROPERTY_H__
@@ -53,9 +55,14 @@ public:
 	 * \brief Create a property value.
 	 *
 	 * All the instances corresponding to values of the same property must have the same id.
+	 * The id must be generated by #ibex::next_bxp_id().
 	 */
 	Bxp(long id);
 
+	/**
+	 * \brief Constructor by copy.
+	 */
+	Bxp(const Bxp& p);
 
 	/**
 	 * \brief Create a copy.
@@ -74,6 +81,20 @@ public:
 	 */
 	virtual void update(const BoxEvent& event, const BoxProperties& prop)=0;
 
+	/**
+	 * \brief Whether the property value is unchanged by a box modification.
+	 *
+	 * Return true only if update(event, prop) would do nothing. The
+	 * value is then shared by the sub-boxes of a bisection instead
+	 * of being copied (see #ibex::BoxProperties). This also requires the
+	 * value not to depend on the box itself (e.g., to store a reference to
+	 * the box given to copy(...)) and not to be modified through const
+	 * functions.
+	 *
+	 * By default: false.
+	 */
+	virtual bool unchanged(const BoxEvent& event, const BoxProperties& prop) const;
+
 	/**
 	 * \brief To string
 	 *
@@ -86,6 +107,16 @@ public:
 	 */
 	virtual ~Bxp();
 
+	/**
+	 * \brief Allocation (see #ibex::Pool).
+	 */
+	static void* operator new(size_t size);
+
+	/**
+	 * \brief Disallocation (see #ibex::Pool).
+	 */
+	static void operator delete(void* p, size_t size);
+
 	/**
 	 * \brief Identifying number.
 	 */
@@ -98,16 +129,39 @@ public:
 	 * by this property.
 	 */
 	std::vector<long> dependencies;
+
+private:
+	friend class BoxProperties;
+
+	/*
+	 * Number of boxes sharing this value.
+	 */
+	std::atomic<int> nb_refs;
 };
 
 /*================================== inline implementations ========================================*/
 
-inline Bxp::Bxp(long id) : id(id) {
+inline Bxp::Bxp(long id) : id(id), nb_refs(0) {
+}
+
+inline Bxp::Bxp(const Bxp& p) : id(p.id), dependencies(p.dependencies), nb_refs(0) {
+}
+
+inline bool Bxp::unchanged(const BoxEvent& event, const BoxProperties& prop) const {
+	return false;
 }
 
 inline Bxp::~Bxp() {
 }
 
+inline void* Bxp::operator new(size_t size) {
+	return Pool::alloc(size);
+}
+
+inline void Bxp::operator delete(void* p, size_t size) {
+	Pool::free(p, size);
+}
+
 inline std::string Bxp::to_string() const {
 	std::stringstream ss;
 	ss << '[' << id << ']';
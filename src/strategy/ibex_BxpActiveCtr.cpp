@@ -52,7 +52,7 @@ long BxpActiveCtr::get_id(const NumConstraint& ctr) {
 	try {
 		return ids()[ctr.id];
 	} catch(Map<long,false>::NotFound&) {
-		long new_id=next_id();
+		long new_id=next_bxp_id();
 		ids().insert_new(ctr.id, new_id);
 		return new_id;
 	}
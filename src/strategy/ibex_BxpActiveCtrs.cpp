@@ -71,7 +71,7 @@ long BxpActiveCtrs::get_id(const System& sys) {
 	try {
 		return ids()[sys.id];
 	} catch(Map<long,false>::NotFound&) {
-		long new_id=next_id();
+		long new_id=next_bxp_id();
 		ids().insert_new(sys.id, new_id);
 		return new_id;
 	}
@@ -76,7 +76,7 @@ long BxpLinearRelaxArgMin::get_id(const System& sys) {
 	try {
 		return ids()[sys_id];
 	} catch(Map<long,false>::NotFound&) {
-		long new_id=next_id();
+		long new_id=next_bxp_id();
 		ids().insert_new(sys_id, new_id);
 		return new_id;
 	}
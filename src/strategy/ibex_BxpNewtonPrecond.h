@@ -0,0 +1,104 @@
+//============================================================================
+//                                  I B E X
+// File        : ibex_BxpNewtonPrecond.h
+// Authors     : Gilles Chabert
+// Copyright   : IMT Atlantique (France)
+// License     : See the LICENSE file
+// Created     : Oct 17, 2026
+//============================================================================
+
+#ifndef __IBEX_BXP_NEWTON_PRECOND_H__
+#define __IBEX_BXP_NEWTON_PRECOND_H__
+
+#include "ibex_Bxp.h"
+#include "ibex_Matrix.h"
+
+namespace ibex {
+
+/**
+ * \ingroup strategy
+ *
+ * \brief Preconditioner of the interval Newton iteration.
+ *
+ * Stores the last preconditioning matrix calculated by a Newton
+ * contractor on the box. The matrix is inherited by the sub-boxes
+ * so that it can be reused by Newton in the descendant nodes of
+ * the search tree (see #ibex::newton(const Fnc&, IntervalVector&, Matrix&, bool&, double, double)).
+ *
+ * There is no need to invalidate the matrix upon box modification:
+ * Newton only reuses it as long as it yields a contracting step.
+ */
+class BxpNewtonPrecond : public Bxp {
+public:
+	/**
+	 * \brief Build the property.
+	 *
+	 * \param id - The identifying number (typically, one per contractor)
+	 * \param n  - The number of variables of the Newton iteration
+	 */
+	BxpNewtonPrecond(long id, int n);
+
+	/**
+	 * \brief Copy the property
+	 */
+	virtual BxpNewtonPrecond* copy(const IntervalVector& box, const BoxProperties& prop) const;
+
+	/**
+	 * \brief Update the property after box modification.
+	 *
+	 * Does nothing.
+	 */
+	virtual void update(const BoxEvent& event, const BoxProperties& prop);
+
+	/**
+	 * \brief Always true (the matrix is shared by the sub-boxes).
+	 */
+	virtual bool unchanged(const BoxEvent& event, const BoxProperties& prop) const;
+
+	/**
+	 * \brief To string
+	 */
+	virtual std::string to_string() const;
+
+	/**
+	 * \brief The preconditioning matrix.
+	 */
+	Matrix C;
+
+	/**
+	 * \brief Whether C contains a preconditioner.
+	 */
+	bool valid;
+};
+
+/*================================== inline implementations ========================================*/
+
+inline BxpNewtonPrecond::BxpNewtonPrecond(long id, int n) : Bxp(id), C(n,n), valid(false) {
+}
+
+inline BxpNewtonPrecond* BxpNewtonPrecond::copy(const IntervalVector& box, const BoxProperties& prop) const {
+	BxpNewtonPrecond* p=new BxpNewtonPrecond(id, C.nb_rows());
+	if (valid) {
+		p->C=C;
+		p->valid=true;
+	}
+	return p;
+}
+
+inline void BxpNewtonPrecond::update(const BoxEvent& event, const BoxProperties& prop) {
+
+}
+
+inline bool BxpNewtonPrecond::unchanged(const BoxEvent& event, const BoxProperties& prop) const {
+	return true;
+}
+
+inline std::string BxpNewtonPrecond::to_string() const {
+	std::stringstream ss;
+	ss << '[' << id << "] BxpNewtonPrecond " << (valid? "(set)" : "(unset)");
+	return ss.str();
+}
+
+} /* namespace ibex */
+
+#endif /* __IBEX_BXP_NEWTON_PRECOND_H__ */
@@ -0,0 +1,149 @@
+//============================================================================
+//                                  I B E X
+// File        : ibex_BxpQuantifCache.h
+// Authors     : Gilles Chabert
+// Copyright   : IMT Atlantique (France)
+// License     : See the LICENSE file
+// Created     : Oct 17, 2026
+//============================================================================
+
+#ifndef __IBEX_BXP_QUANTIF_CACHE_H__
+#define __IBEX_BXP_QUANTIF_CACHE_H__
+
+#include "ibex_Bxp.h"
+#include "ibex_IntervalVector.h"
+
+#include <vector>
+#include <sstream>
+
+namespace ibex {
+
+/**
+ * \ingroup strategy
+ *
+ * \brief Parameter boxes discarded by a quantified contractor.
+ *
+ * Stores the boxes of parameters that a quantified contractor
+ * (see #ibex::CtcForAll and #ibex::CtcExist) has proven to be
+ * irrelevant for the current box [x]:
+ * <ul>
+ * <li> for CtcForAll: the boxes [y] such that c(x,y) holds for all (x,y) in [x]x[y],
+ * <li> for CtcExist:  the boxes [y] such that c(x,y) holds for no (x,y) in [x]x[y].
+ * </ul>
+ * Both properties remain true for any sub-box of [x], so the
+ * boxes are inherited by the sub-boxes and the contractor does
+ * not explore them again. The boxes are forgotten as soon as
+ * the box [x] is inflated or changed.
+ */
+class BxpQuantifCache : public Bxp {
+public:
+	/**
+	 * \brief Build the property.
+	 *
+	 * \param id - The identifying number (one per contractor)
+	 */
+	BxpQuantifCache(long id);
+
+	/**
+	 * \brief Copy the property
+	 */
+	virtual BxpQuantifCache* copy(const IntervalVector& box, const BoxProperties& prop) const;
+
+	/**
+	 * \brief Update the property after box modification.
+	 *
+	 * Clear the cache if the box is not contracted.
+	 */
+	virtual void update(const BoxEvent& event, const BoxProperties& prop);
+
+	/**
+	 * \brief True if the box is contracted (the cache is shared by the sub-boxes).
+	 */
+	virtual bool unchanged(const BoxEvent& event, const BoxProperties& prop) const;
+
+	/**
+	 * \brief To string
+	 */
+	virtual std::string to_string() const;
+
+	/**
+	 * \brief Add a discarded box of parameters.
+	 *
+	 * The box is merged with the previously added ones when
+	 * their union is a box (typically, the two halves of a
+	 * bisected box), so that the list remains short.
+	 */
+	void add(const IntervalVector& y);
+
+	/**
+	 * \brief Whether [y] is included in a discarded box.
+	 */
+	bool contains(const IntervalVector& y) const;
+
+	/**
+	 * \brief The discarded boxes of parameters.
+	 */
+	std::vector<IntervalVector> boxes;
+
+protected:
+	/**
+	 * \brief True if a|b is a box.
+	 */
+	static bool mergeable(const IntervalVector& a, const IntervalVector& b);
+};
+
+/*================================== inline implementations ========================================*/
+
+inline BxpQuantifCache::BxpQuantifCache(long id) : Bxp(id) {
+}
+
+inline BxpQuantifCache* BxpQuantifCache::copy(const IntervalVector& box, const BoxProperties& prop) const {
+	BxpQuantifCache* p=new BxpQuantifCache(id);
+	p->boxes=boxes;
+	return p;
+}
+
+inline void BxpQuantifCache::update(const BoxEvent& event, const BoxProperties& prop) {
+	if (event.type!=BoxEvent::CONTRACT)
+		boxes.clear();
+}
+
+inline bool BxpQuantifCache::unchanged(const BoxEvent& event, const BoxProperties& prop) const {
+	return event.type==BoxEvent::CONTRACT || boxes.empty();
+}
+
+inline std::string BxpQuantifCache::to_string() const {
+	std::stringstream ss;
+	ss << '[' << id << "] BxpQuantifCache (" << boxes.size() << " boxes)";
+	return ss.str();
+}
+
+inline bool BxpQuantifCache::mergeable(const IntervalVector& a, const IntervalVector& b) {
+	int i=-1; // the only component where a and b differ
+	for (int j=0; j<a.size(); j++) {
+		if (a[j]!=b[j]) {
+			if (i!=-1) return false;
+			i=j;
+		}
+	}
+	return i==-1 || a[i].ub()==b[i].lb() || b[i].ub()==a[i].lb();
+}
+
+inline void BxpQuantifCache::add(const IntervalVector& y) {
+	IntervalVector b=y;
+	while (!boxes.empty() && mergeable(boxes.back(),b)) {
+		b|=boxes.back();
+		boxes.pop_back();
+	}
+	boxes.push_back(b);
+}
+
+inline bool BxpQuantifCache::contains(const IntervalVector& y) const {
+	for (std::vector<IntervalVector>::const_iterator it=boxes.begin(); it!=boxes.end(); ++it)
+		if (y.is_subset(*it)) return true;
+	return false;
+}
+
+} /* namespace ibex */
+
+#endif /* __IBEX_BXP_QUANTIF_CACHE_H__ */
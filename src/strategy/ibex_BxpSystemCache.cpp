@@ -58,7 +58,7 @@ long BxpSystemCache::get_id(const System& sys) {
 	try {
 		return ids()[sys.id];
 	} catch(Map<long,false>::NotFound&) {
-		long new_id=next_id();
+		long new_id=next_bxp_id();
 		ids().insert_new(sys.id, new_id);
 		return new_id;
 	}
@@ -165,7 +165,12 @@ IntervalVector BxpSystemCache::goal_gradient() const {
 
 void BxpSystemCache::goal_gradient(IntervalVector& g) const {
 	if (!goal_gradient_updated) {
-		sys.goal->gradient(cache,_goal_gradient);
+		if (!goal_eval_updated) {
+			// evaluation for free
+			sys.goal->eval_gradient(cache,_goal_eval,_goal_gradient);
+			goal_eval_updated=true;
+		} else
+			sys.goal->gradient(cache,_goal_gradient);
 		goal_gradient_updated=true;
 	}
 	g=_goal_gradient;
@@ -195,7 +200,12 @@ IntervalMatrix BxpSystemCache::ctrs_jacobian() const {
 
 void BxpSystemCache::ctrs_jacobian(IntervalMatrix& J) const {
 	if (!ctr_jacobian_updated) {
-		sys.f_ctrs.jacobian(cache,_ctrs_jacobian);
+		if (!ctr_eval_updated) {
+			// evaluation for free (single forward sweep)
+			sys.f_ctrs.eval_jacobian(cache,_ctrs_eval,_ctrs_jacobian);
+			ctr_eval_updated=true;
+		} else
+			sys.f_ctrs.jacobian(cache,_ctrs_jacobian);
 		ctr_jacobian_updated=true;
 	}
 	J=_ctrs_jacobian;
@@ -26,6 +26,11 @@ namespace ibex {
  * This class stores in a cache typical interval computations
  * based on a system, like the evaluation of goal/constraints, etc.
  *
+ * The cache is not shared with the sub-boxes of a bisection (see
+ * #Bxp::unchanged(...)): a bisection moves a bound by half the diameter,
+ * which exceeds the update ratio, so that the cached computations
+ * would be discarded anyway. Besides, they are made lazily by const
+ * functions, which would be unsafe on a value shared by several threads.
  */
 class BxpSystemCache : public Bxp {
 public:
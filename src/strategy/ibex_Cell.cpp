@@ -11,46 +11,67 @@
 #include "ibex_Cell.h"
 #include "ibex_Bsc.h"
 #include <limits.h>
+#include <sstream>
 #include "ibex_Bxp.h"
 #include "ibex_Bxp.h"
 
+#include <new>
+
 using namespace std;
 
 namespace ibex {
 
-Cell::Cell(const IntervalVector& box, int var, unsigned int depth) : box(box), prop(this->box), bisected_var(var), depth(depth) {
+const IntervalVector& Cell::init_box(const IntervalVector& x) {
+	box.vec = (Interval*) Pool::alloc(x.size()*sizeof(Interval));
+	for (int i=0; i<x.size(); i++)
+		new (&box.vec[i]) Interval(x[i]);
+	box.n = x.size();
+	return box;
+}
+
+// note: "box" is first built empty, then filled before "prop" is built.
+Cell::Cell(const IntervalVector& box, int var, unsigned int depth) : prop(init_box(box)), bisected_var(var), depth(depth) {
 
 }
 
-Cell::Cell(const Cell& e) : box(e.box), prop(this->box, e.prop), bisected_var(e.bisected_var), depth(e.depth) {
+Cell::Cell(const Cell& e) : prop(init_box(e.box), e.prop), bisected_var(e.bisected_var), depth(e.depth) {
 
 }
 
 pair<Cell*,Cell*> Cell::bisect(const BisectionPoint& pt) const {
 
-	Cell* cleft;
-	Cell* cright;
+	pair<Interval,Interval> p;
 
 	if (pt.rel_pos) {
-		pair<IntervalVector,IntervalVector> boxes=box.bisect(pt.var,pt.pos);
-		cleft = new Cell(boxes.first, pt.var, depth+1);
-		cright = new Cell(boxes.second, pt.var, depth+1);
+		if (!box[pt.var].is_bisectable()) {
+			ostringstream oss;
+			oss << "Unable to bisect " << box;
+			throw InvalidIntervalVectorOp(oss.str());
+		}
+		p=box[pt.var].bisect(pt.pos);
 	} else {
-		IntervalVector b1(box);
-		IntervalVector b2(box);
-		b1[pt.var]=Interval(box[pt.var].lb(), pt.pos);
-		b2[pt.var]=Interval(pt.pos, box[pt.var].ub());
-		cleft = new Cell(b1, pt.var, depth+1);
-		cright = new Cell(b2, pt.var, depth+1);
+		p.first=Interval(box[pt.var].lb(), pt.pos);
+		p.second=Interval(pt.pos, box[pt.var].ub());
 	}
 
+	// the sub-boxes are built in place (no intermediate box)
+	Cell* cleft = new Cell(box, pt.var, depth+1);
+	Cell* cright = new Cell(box, pt.var, depth+1);
+	cleft->box[pt.var]=p.first;
+	cright->box[pt.var]=p.second;
+
 	prop.update_bisect(Bisection(box, pt, cleft->box, cright->box), cleft->prop, cright->prop);
 
 	return pair<Cell*,Cell*>(cleft,cright);
 }
 
 Cell::~Cell() {
-
+	for (int i=0; i<box.n; i++)
+		box.vec[i].~Interval();
+	Pool::free(box.vec, box.n*sizeof(Interval));
+	// detach the elements so that the destructor of the box does not free them
+	box.n = 0;
+	box.vec = NULL;
 }
 
 std::ostream& operator<<(std::ostream& os, const Cell& c) {
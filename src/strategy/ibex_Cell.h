@@ -15,6 +15,7 @@
 #include "ibex_BoxProperties.h"
 #include "ibex_BisectionPoint.h"
 #include "ibex_Map.h"
+#include "ibex_Pool.h"
 
 namespace ibex {
 
@@ -71,8 +72,32 @@ public:
 	 */
 	virtual ~Cell();
 
+	/**
+	 * \brief Allocation (see #ibex::Pool).
+	 */
+	static void* operator new(size_t size);
+
+	/**
+	 * \brief Disallocation (see #ibex::Pool).
+	 */
+	static void operator delete(void* p, size_t size);
+
+private:
+	/*
+	 * Allocate the elements of the box in the pool
+	 * and initialize them with \a x. Return the box.
+	 */
+	const IntervalVector& init_box(const IntervalVector& x);
+
+public:
+
 	/**
 	 * \brief The box
+	 *
+	 * The elements of the box are allocated in the pool
+	 * (see #ibex::Pool), like the cell itself. The size of
+	 * the box is therefore fixed: it cannot be resized
+	 * nor assigned a box of another size.
 	 */
 	IntervalVector box;
 
@@ -100,6 +125,16 @@ public:
  */
 std::ostream& operator<<(std::ostream& os, const Cell& c);
 
+/*================================== inline implementations ========================================*/
+
+inline void* Cell::operator new(size_t size) {
+	return Pool::alloc(size);
+}
+
+inline void Cell::operator delete(void* p, size_t size) {
+	Pool::free(p, size);
+}
+
 } // end namespace ibex
 
 #endif // __IBEX_CELL_H__
@@ -0,0 +1,284 @@
+//============================================================================
+//                                  I B E X
+// File        : ibex_Expr2Cpp.cpp
+// Author      : Gilles Chabert
+// Copyright   : IMT Atlantique (France)
+// License     : See the LICENSE file
+// Created     : Oct 17, 2026
+//============================================================================
+
+#include "ibex_Expr2Cpp.h"
+#include "ibex_Expr.h"
+
+#include <iomanip>
+#include <limits>
+
+using namespace std;
+
+namespace ibex {
+
+namespace {
+
+// replace all the occurrences of a one-character placeholder
+string subst(const char* tmpl, char c, const string& s) {
+	string res;
+	for (const char* p=tmpl; *p; p++) {
+		if (*p==c) res+=s;
+		else res+=*p;
+	}
+	return res;
+}
+
+// exact (round-trip) representation of a double
+string dbl(double x) {
+	if (x==POS_INFINITY) return "POS_INFINITY";
+	if (x==NEG_INFINITY) return "NEG_INFINITY";
+	stringstream s;
+	s << setprecision(numeric_limits<double>::digits10+2) << x;
+	string res=s.str();
+	if (res.find_first_of(".e")==string::npos) res+=".0";
+	return res;
+}
+
+}
+
+bool Expr2Cpp::print(std::ostream& os, const Array<const ExprSymbol>& x, const ExprNode& y) {
+
+	if (!y.dim.is_scalar()) return false;
+
+	for (int j=0; j<x.size(); j++)
+		if (!x[j].dim.is_scalar()) return false;
+
+	ExprSubNodes _nodes(x,y);
+	nodes=&_nodes;
+
+	int n=nodes->size();
+
+	supported=true;
+	fwd_code.resize(n);
+	bwd_code.resize(n);
+	grad_code.resize(n);
+
+	for (int i=n-1; supported && i>=0; i--) {
+		fwd.str(""); bwd.str(""); grad.str("");
+		(*nodes)[i].acceptVisitor(*this);
+		fwd_code[i]=fwd.str();
+		bwd_code[i]=bwd.str();
+		grad_code[i]=grad.str();
+	}
+
+	if (!supported) return false;
+
+	stringstream load, store;
+
+	for (int j=0; j<x.size(); j++) {
+		load  << "\t" << d(x[j]) << "=x[" << j << "];" << endl;
+		store << "\tx[" << j << "]=" << d(x[j]) << ";" << endl;
+	}
+
+	stringstream forward;
+	for (int i=n-1; i>=0; i--)
+		forward << fwd_code[i];
+
+	os << "// Generated by ibex (Expr2Cpp) -- do not edit" << endl;
+	os << "#include \"ibex_Interval.h\"" << endl << endl;
+	os << "using namespace ibex;" << endl << endl;
+	os << "extern \"C\" {" << endl << endl;
+
+	// ============== forward evaluation ==================
+	os << "void ibex_native_eval(const Interval* x, Interval* y) {" << endl;
+	os << "\tInterval d[" << n << "];" << endl;
+	os << load.str() << forward.str();
+	os << "\t*y=d[0];" << endl;
+	os << "\treturn;" << endl;
+	os << "empty:" << endl;
+	os << "\ty->set_empty();" << endl;
+	os << "}" << endl << endl;
+
+	// ============== HC4Revise ==================
+	os << "int ibex_native_proj(const Interval* y, Interval* x) {" << endl;
+	os << "\tInterval d[" << n << "];" << endl;
+	os << load.str() << forward.str();
+	os << "\tif (d[0].is_empty()) goto empty;" << endl;
+	os << "\tif (d[0].is_subset(*y)) return 1;" << endl;
+	os << "\tif ((d[0]&=*y).is_empty()) goto empty;" << endl;
+	for (int i=0; i<n; i++)
+		os << bwd_code[i];
+	os << store.str();
+	os << "\treturn 0;" << endl;
+	os << "empty:" << endl;
+	os << "\treturn -1;" << endl;
+	os << "}" << endl << endl;
+
+	// ============== gradient ==================
+	os << "void ibex_native_gradient(const Interval* x, Interval* gx) {" << endl;
+	os << "\tInterval d[" << n << "];" << endl;
+	os << "\tInterval g[" << n << "];" << endl;
+	os << load.str() << forward.str();
+	os << "\tif (d[0].is_empty()) goto empty;" << endl;
+	os << "\tfor (int i=1; i<" << n << "; i++) g[i]=Interval::ZERO;" << endl;
+	os << "\tg[0]=Interval::ONE;" << endl;
+	for (int i=0; i<n; i++)
+		os << grad_code[i];
+	for (int j=0; j<x.size(); j++)
+		os << "\tgx[" << j << "]=" << g(x[j]) << ";" << endl;
+	os << "\treturn;" << endl;
+	os << "empty:" << endl;
+	os << "\tfor (int j=0; j<" << x.size() << "; j++) gx[j].set_empty();" << endl;
+	os << "}" << endl << endl;
+
+	os << "} // extern \"C\"" << endl;
+
+	return true;
+}
+
+string Expr2Cpp::d(const ExprNode& e) {
+	stringstream s;
+	s << "d[" << nodes->rank(e) << "]";
+	return s.str();
+}
+
+string Expr2Cpp::g(const ExprNode& e) {
+	stringstream s;
+	s << "g[" << nodes->rank(e) << "]";
+	return s.str();
+}
+
+void Expr2Cpp::visit(const ExprNode& e) {
+	// not supported (vector, apply, etc.)
+	supported=false;
+}
+
+void Expr2Cpp::visit(const ExprSymbol& e) {
+	// nothing to do (the domain is loaded from x)
+}
+
+void Expr2Cpp::visit(const ExprConstant& e) {
+	if (!e.dim.is_scalar()) { supported=false; return; }
+	const Interval& c=e.get_value();
+	if (c.is_empty()) { supported=false; return; }
+	fwd << "\t" << d(e) << "=Interval(" << dbl(c.lb()) << "," << dbl(c.ub()) << ");" << endl;
+}
+
+void Expr2Cpp::unary(const ExprUnaryOp& e, const char* name, bool partial, const char* deriv) {
+	if (!e.dim.is_scalar()) { supported=false; return; }
+
+	string x=d(e.expr), y=d(e), gx=g(e.expr), gy=g(e);
+
+	if (partial)
+		fwd << "\tif ((" << y << "=" << name << "(" << x << ")).is_empty()) goto empty;" << endl;
+	else
+		fwd << "\t" << y << "=" << name << "(" << x << ");" << endl;
+
+	bwd << "\tif (!bwd_" << name << "(" << y << "," << x << ")) goto empty;" << endl;
+
+	if (deriv)
+		grad << "\t" << gx << " += " << subst(subst(deriv,'G',gy).c_str(),'X',x) << ";" << endl;
+}
+
+void Expr2Cpp::binary(const ExprBinaryOp& e, const char* f, const char* name) {
+	if (!e.dim.is_scalar()) { supported=false; return; }
+
+	string a=d(e.left), b=d(e.right), y=d(e);
+
+	fwd << "\t" << y << "=" << subst(subst(f,'A',a).c_str(),'B',b) << ";" << endl;
+
+	bwd << "\tif (!bwd_" << name << "(" << y << "," << a << "," << b << ")) goto empty;" << endl;
+}
+
+void Expr2Cpp::visit(const ExprAdd& e) {
+	binary(e,"A+B","add");
+	grad << "\t" << g(e.left) << " += " << g(e) << "; " << g(e.right) << " += " << g(e) << ";" << endl;
+}
+
+void Expr2Cpp::visit(const ExprMul& e) {
+	binary(e,"A*B","mul");
+	grad << "\t" << g(e.left) << " += " << g(e) << " * " << d(e.right) << "; "
+	             << g(e.right) << " += " << g(e) << " * " << d(e.left) << ";" << endl;
+}
+
+void Expr2Cpp::visit(const ExprSub& e) {
+	binary(e,"A-B","sub");
+	grad << "\t" << g(e.left) << " += " << g(e) << "; " << g(e.right) << " += -" << g(e) << ";" << endl;
+}
+
+void Expr2Cpp::visit(const ExprDiv& e) {
+	binary(e,"A/B","div");
+	grad << "\t" << g(e.left) << " += " << g(e) << " / " << d(e.right) << "; "
+	             << g(e.right) << " += " << g(e) << "*(-" << d(e.left) << ")/sqr(" << d(e.right) << ");" << endl;
+}
+
+void Expr2Cpp::visit(const ExprMax& e) {
+	binary(e,"max(A,B)","max");
+	string a=d(e.left), b=d(e.right);
+	grad << "\tif (" << a << ".lb() > " << b << ".ub()) " << g(e.left) << " += " << g(e) << " * Interval::ONE;" << endl
+	     << "\telse if (" << b << ".lb() > " << a << ".ub()) " << g(e.right) << " += " << g(e) << " * Interval::ONE;" << endl
+	     << "\telse { " << g(e.left) << " += " << g(e) << " * Interval(0,1); "
+	                    << g(e.right) << " += " << g(e) << " * Interval(0,1); }" << endl;
+}
+
+void Expr2Cpp::visit(const ExprMin& e) {
+	binary(e,"min(A,B)","min");
+	string a=d(e.left), b=d(e.right);
+	grad << "\tif (" << a << ".lb() > " << b << ".ub()) " << g(e.right) << " += " << g(e) << " * Interval::ONE;" << endl
+	     << "\telse if (" << b << ".lb() > " << a << ".ub()) " << g(e.left) << " += " << g(e) << " * Interval::ONE;" << endl
+	     << "\telse { " << g(e.left) << " += " << g(e) << " * Interval(0,1); "
+	                    << g(e.right) << " += " << g(e) << " * Interval(0,1); }" << endl;
+}
+
+void Expr2Cpp::visit(const ExprAtan2& e) {
+	binary(e,"atan2(A,B)","atan2");
+	string a=d(e.left), b=d(e.right);
+	grad << "\t" << g(e.left)  << " += " << g(e) << " * " << b << " / (sqr(" << b << ") + sqr(" << a << ")); "
+	             << g(e.right) << " += " << g(e) << " * -" << a << " / (sqr(" << b << ") + sqr(" << a << "));" << endl;
+}
+
+void Expr2Cpp::visit(const ExprMinus& e) {
+	if (!e.dim.is_scalar()) { supported=false; return; }
+	string x=d(e.expr), y=d(e);
+	fwd  << "\t" << y << "=-" << x << ";" << endl;
+	bwd  << "\tif ((" << x << " &= -" << y << ").is_empty()) goto empty;" << endl;
+	grad << "\t" << g(e.expr) << " += -1.0*" << g(e) << ";" << endl;
+}
+
+void Expr2Cpp::visit(const ExprSign& e) {
+	unary(e,"sign",false,NULL);
+	// the derivative of sign is zero, except around 0
+	string x=d(e.expr);
+	grad << "\tif (" << x << ".contains(0)) " << g(e.expr) << " += " << g(e) << "*Interval::POS_REALS;" << endl;
+}
+
+void Expr2Cpp::visit(const ExprAbs& e) {
+	unary(e,"abs",false,NULL);
+	string x=d(e.expr), gx=g(e.expr), gy=g(e);
+	grad << "\tif (" << x << ".lb()>0) " << gx << " += 1.0*" << gy << ";" << endl
+	     << "\telse if (" << x << ".ub()<0) " << gx << " += -1.0*" << gy << ";" << endl
+	     << "\telse " << gx << " += Interval(-1,1)*" << gy << ";" << endl;
+}
+
+void Expr2Cpp::visit(const ExprPower& e) {
+	if (!e.dim.is_scalar()) { supported=false; return; }
+	string x=d(e.expr), y=d(e);
+	fwd  << "\t" << y << "=pow(" << x << "," << e.expon << ");" << endl;
+	bwd  << "\tif (!bwd_pow(" << y << "," << e.expon << "," << x << ")) goto empty;" << endl;
+	grad << "\t" << g(e.expr) << " += " << g(e) << " * " << e.expon << " * pow(" << x << "," << (e.expon-1) << ");" << endl;
+}
+
+void Expr2Cpp::visit(const ExprSqr& e)   { unary(e,"sqr",  false,"G * 2.0 * X"); }
+void Expr2Cpp::visit(const ExprSqrt& e)  { unary(e,"sqrt", true, "G * 0.5 / sqrt(X)"); }
+void Expr2Cpp::visit(const ExprExp& e)   { unary(e,"exp",  false,"G * exp(X)"); }
+void Expr2Cpp::visit(const ExprLog& e)   { unary(e,"log",  true, "G / X"); }
+void Expr2Cpp::visit(const ExprCos& e)   { unary(e,"cos",  false,"G * -sin(X)"); }
+void Expr2Cpp::visit(const ExprSin& e)   { unary(e,"sin",  false,"G * cos(X)"); }
+void Expr2Cpp::visit(const ExprTan& e)   { unary(e,"tan",  true, "G * (1.0 + sqr(tan(X)))"); }
+void Expr2Cpp::visit(const ExprCosh& e)  { unary(e,"cosh", false,"G * sinh(X)"); }
+void Expr2Cpp::visit(const ExprSinh& e)  { unary(e,"sinh", false,"G * cosh(X)"); }
+void Expr2Cpp::visit(const ExprTanh& e)  { unary(e,"tanh", false,"G * (1.0 - sqr(tanh(X)))"); }
+void Expr2Cpp::visit(const ExprAcos& e)  { unary(e,"acos", true, "G * -1.0 / sqrt(1.0-sqr(X))"); }
+void Expr2Cpp::visit(const ExprAsin& e)  { unary(e,"asin", true, "G * 1.0 / sqrt(1.0-sqr(X))"); }
+void Expr2Cpp::visit(const ExprAtan& e)  { unary(e,"atan", false,"G * 1.0 / (1.0+sqr(X))"); }
+void Expr2Cpp::visit(const ExprAcosh& e) { unary(e,"acosh",true, "G * 1.0 / sqrt(sqr(X) -1.0)"); }
+void Expr2Cpp::visit(const ExprAsinh& e) { unary(e,"asinh",false,"G * 1.0 / sqrt(1.0+sqr(X))"); }
+void Expr2Cpp::visit(const ExprAtanh& e) { unary(e,"atanh",true, "G * 1.0 / (1.0-sqr(X))"); }
+
+} // namespace ibex
@@ -0,0 +1,122 @@
+//============================================================================
+//                                  I B E X
+// File        : ibex_Expr2Cpp.h
+// Author      : Gilles Chabert
+// Copyright   : IMT Atlantique (France)
+// License     : See the LICENSE file
+// Created     : Oct 17, 2026
+//============================================================================
+
+#ifndef __IBEX_EXPR_2_CPP_H__
+#define __IBEX_EXPR_2_CPP_H__
+
+#include "ibex_ExprVisitor.h"
+#include "ibex_ExprSubNodes.h"
+
+#include <sstream>
+#include <vector>
+
+namespace ibex {
+
+/**
+ * \ingroup symbolic
+ * \brief Get the C++ code of an expression.
+ *
+ * Generate straight-line C++ code (based on ibex::Interval)
+ * for the forward evaluation, the HC4Revise projection and the
+ * gradient of a real-valued function y=f(x). The code is made of
+ * three "C" functions:
+ *
+ * <ul>
+ * <li> <code>void ibex_native_eval(const Interval* x, Interval* y)</code>:
+ *      y:=f(x) (set to the empty interval if x is outside the definition domain)
+ * <li> <code>int ibex_native_proj(const Interval* y, Interval* x)</code>:
+ *      HC4Revise projection of f(x)=y onto x. Return -1 if the result is empty,
+ *      1 if f(x) is already a subset of y (x is not modified) and 0 otherwise.
+ * <li> <code>void ibex_native_gradient(const Interval* x, Interval* g)</code>:
+ *      g:=gradient of f at x (automatic differentiation, like #ibex::Gradient).
+ * </ul>
+ *
+ * Only scalar expressions with scalar arguments are supported, and neither
+ * function applications, nor generic operators nor "chi" can appear.
+ */
+class Expr2Cpp : public ExprVisitor {
+public:
+	/**
+	 * \brief Print the C++ code of f:x->y on a given output stream.
+	 *
+	 * \return false if the expression is not supported (nothing is printed).
+	 */
+	bool print(std::ostream& os, const Array<const ExprSymbol>& x, const ExprNode& y);
+
+protected:
+	void visit(const ExprNode& e);
+	void visit(const ExprSymbol& e);
+	void visit(const ExprConstant& e);
+	void visit(const ExprAdd& e);
+	void visit(const ExprMul& e);
+	void visit(const ExprSub& e);
+	void visit(const ExprDiv& e);
+	void visit(const ExprMax& e);
+	void visit(const ExprMin& e);
+	void visit(const ExprAtan2& e);
+	void visit(const ExprMinus& e);
+	void visit(const ExprSign& e);
+	void visit(const ExprAbs& e);
+	void visit(const ExprPower& e);
+	void visit(const ExprSqr& e);
+	void visit(const ExprSqrt& e);
+	void visit(const ExprExp& e);
+	void visit(const ExprLog& e);
+	void visit(const ExprCos& e);
+	void visit(const ExprSin& e);
+	void visit(const ExprTan& e);
+	void visit(const ExprCosh& e);
+	void visit(const ExprSinh& e);
+	void visit(const ExprTanh& e);
+	void visit(const ExprAcos& e);
+	void visit(const ExprAsin& e);
+	void visit(const ExprAtan& e);
+	void visit(const ExprAcosh& e);
+	void visit(const ExprAsinh& e);
+	void visit(const ExprAtanh& e);
+
+private:
+	/*
+	 * Generate the code of a unary operator.
+	 *
+	 * \param partial - true if the operator is not defined everywhere
+	 * \param deriv   - the term added to the gradient of the argument, where "X"
+	 *                  stands for the argument and "G" for the gradient of the node
+	 *                  (NULL if the caller generates the gradient itself).
+	 */
+	void unary(const ExprUnaryOp& e, const char* name, bool partial, const char* deriv);
+
+	/*
+	 * Generate the code of a binary operator with its
+	 * forward expression "fwd" where "A" and "B" stand
+	 * for the arguments.
+	 */
+	void binary(const ExprBinaryOp& e, const char* fwd, const char* name);
+
+	std::string d(const ExprNode& e);
+	std::string g(const ExprNode& e);
+
+	ExprSubNodes* nodes;
+
+	// code of the current node for each phase
+	std::stringstream fwd;
+	std::stringstream bwd;
+	std::stringstream grad;
+
+	// code of all the nodes for each phase
+	std::vector<std::string> fwd_code;
+	std::vector<std::string> bwd_code;
+	std::vector<std::string> grad_code;
+
+	bool supported;
+};
+
+} // namespace ibex
+
+#endif // __IBEX_EXPR_2_CPP_H__
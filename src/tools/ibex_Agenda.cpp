@@ -72,4 +72,31 @@ std::ostream& operator<<(std::ostream& os, const Agenda& a) {
 	return os << ')';
 }
 
+void PriorityAgenda::up(int i) {
+	int p=heap[i];
+	while (i>0) {
+		int parent=(i-1)/2;
+		if (key[heap[parent]]>=key[p]) break;
+		heap[i]=heap[parent];
+		pos[heap[i]]=i;
+		i=parent;
+	}
+	heap[i]=p;
+	pos[p]=i;
+}
+
+void PriorityAgenda::down(int i) {
+	int p=heap[i];
+	while (2*i+1<nb) {
+		int child=2*i+1;
+		if (child+1<nb && key[heap[child+1]]>key[heap[child]]) child++;
+		if (key[p]>=key[heap[child]]) break;
+		heap[i]=heap[child];
+		pos[heap[i]]=i;
+		i=child;
+	}
+	heap[i]=p;
+	pos[p]=i;
+}
+
 } // namespace ibex
@@ -274,6 +274,131 @@ public:
 	friend std::ostream& operator<<(std::ostream& os, const ArcAgenda& q);
 };
 
+/**
+ * \ingroup tools
+ * \brief Priority agenda.
+ *
+ * A priority agenda is a fixed-size set of positive integers where each
+ * element can only appear once, with a priority attached to each element.
+ * In particular:
+ * - The "push" operation adds an element (or updates its priority, if present)
+ * - The "pop" operation retrieves the element with the highest priority
+ *
+ * The elements are stored in a binary heap (push and pop are in O(log(size))).
+ */
+class PriorityAgenda {
+public:
+	/**
+	 * \brief Create the agenda.
+	 *
+	 * All elements will be inside the range [0,size-1].
+	 */
+	PriorityAgenda(int size) : size(size), nb(0) {
+		heap = new int[size];
+		pos = new int[size];
+		key = new double[size];
+		for (int i=0; i<size; i++) {
+			pos[i]=-1;
+		}
+	}
+
+	/**
+	 * \brief Delete this.
+	 */
+	~PriorityAgenda() {
+		delete[] heap;
+		delete[] pos;
+		delete[] key;
+	}
+
+	/**
+	 * \brief Push an integer with a given priority.
+	 *
+	 * If the integer is already present, its priority is updated.
+	 */
+	inline void push(int p, double priority) {
+		assert(p>=0 && p<size);
+		if (pos[p]==-1) {
+			pos[p]=nb;
+			heap[nb++]=p;
+			key[p]=priority;
+			up(pos[p]);
+		} else if (priority>key[p]) {
+			key[p]=priority;
+			up(pos[p]);
+		} else {
+			key[p]=priority;
+			down(pos[p]);
+		}
+	}
+
+	/**
+	 * \brief Pop the integer with the highest priority.
+	 *
+	 * \throw EmptyAgendaException if the agenda is empty.
+	 */
+	inline void pop(int& p) {
+		if (nb==0) throw EmptyAgendaException();
+		p=heap[0];
+		pos[p]=-1;
+		if (--nb>0) {
+			heap[0]=heap[nb];
+			pos[heap[0]]=0;
+			down(0);
+		}
+	}
+
+	/**
+	 * \brief Element with the highest priority.
+	 */
+	inline int first() const {
+		if (nb==0) throw EmptyAgendaException();
+		return heap[0];
+	}
+
+	/**
+	 * \brief The highest priority.
+	 */
+	inline double first_priority() const {
+		return key[first()];
+	}
+
+	/**
+	 * \brief Remove all integers
+	 */
+	inline void flush() {
+		for (int i=0; i<nb; i++)
+			pos[heap[i]]=-1;
+		nb=0;
+	}
+
+	/**
+	 * \brief True iff the agenda is empty.
+	 */
+	inline bool empty() const {
+		return nb==0;
+	}
+
+	/**
+	 * \brief The size defining the range of the agenda.
+	 *
+	 * All elements must be inside [0,size-1].
+	 */
+	const int size;
+
+protected:
+	PriorityAgenda(const PriorityAgenda&); // forbidden
+
+	/* Move the element at position i up/down in the heap */
+	void up(int i);
+	void down(int i);
+
+	int nb;       // number of elements
+	int* heap;    // the elements, as a binary heap
+	int* pos;     // the position of each element in the heap (-1 if absent)
+	double* key;  // the priority of each element
+};
+
 } // namespace ibex
 
 #endif // __IBEX_AGENDA_H__
@@ -0,0 +1,304 @@
+/* ============================================================================
+ * I B E X - Communication channel between processes
+ * ============================================================================
+ * Copyright   : IMT Atlantique (FRANCE)
+ * License     : This program can be distributed under the terms of the GNU LGPL.
+ *               See the file COPYING.LESSER.
+ *
+ * Author(s)   : Gilles Chabert
+ * Created     : Oct 17, 2026
+ * ---------------------------------------------------------------------------- */
+
+#include "ibex_Channel.h"
+
+#include <fstream>
+#include <sstream>
+#include <cstdlib>
+#include <cstring>
+#include <stdint.h>
+#include <algorithm>
+
+#ifndef _WIN32
+#include <unistd.h>
+#include <netdb.h>
+#include <sys/types.h>
+#include <sys/socket.h>
+#include <sys/un.h>
+#include <netinet/in.h>
+#include <netinet/tcp.h>
+#endif
+
+using namespace std;
+
+namespace ibex {
+
+#ifndef _WIN32
+
+namespace {
+
+#ifdef MSG_NOSIGNAL
+const int SEND_FLAGS = MSG_NOSIGNAL; // no SIGPIPE if the other process is dead
+#else
+const int SEND_FLAGS = 0;
+#endif
+
+/* Number of attempts to connect (one every 100ms). */
+const int NB_CONNECT_ATTEMPTS = 50;
+
+bool is_unix(const string& address) {
+	return address.compare(0,5,"unix:")==0;
+}
+
+/* Socket of a TCP address, bound or connected. */
+int tcp_socket(const string& address, bool server) {
+	size_t colon=address.find_last_of(':');
+	if (colon==string::npos)
+		ibex_error("[Channel] invalid address (expected \"unix:<path>\" or \"<host>:<port>\")");
+
+	string host=address.substr(0,colon);
+	string port=address.substr(colon+1);
+
+	struct addrinfo hints;
+	memset(&hints, 0, sizeof(hints));
+	hints.ai_family=AF_UNSPEC;
+	hints.ai_socktype=SOCK_STREAM;
+	if (server) hints.ai_flags=AI_PASSIVE;
+
+	struct addrinfo* res;
+	if (getaddrinfo(host=="*"? NULL : host.c_str(), port.c_str(), &hints, &res)!=0)
+		ibex_error("[Channel] cannot resolve host");
+
+	int fd=-1;
+	for (struct addrinfo* p=res; p!=NULL && fd==-1; p=p->ai_next) {
+		fd=socket(p->ai_family, p->ai_socktype, p->ai_protocol);
+		if (fd==-1) continue;
+
+		if (server) {
+			int yes=1;
+			setsockopt(fd, SOL_SOCKET, SO_REUSEADDR, &yes, sizeof(yes));
+			if (bind(fd, p->ai_addr, p->ai_addrlen)==0) break;
+		} else {
+			if (connect(fd, p->ai_addr, p->ai_addrlen)==0) {
+				int yes=1;
+				setsockopt(fd, IPPROTO_TCP, TCP_NODELAY, &yes, sizeof(yes));
+				break;
+			}
+		}
+		close(fd);
+		fd=-1;
+	}
+
+	freeaddrinfo(res);
+	return fd;
+}
+
+/* Socket of a Unix-domain address, bound or connected. */
+int unix_socket(const string& path, bool server) {
+	struct sockaddr_un addr;
+	memset(&addr, 0, sizeof(addr));
+	addr.sun_family=AF_UNIX;
+	if (path.size()>=sizeof(addr.sun_path))
+		ibex_error("[Channel] socket path too long");
+	strcpy(addr.sun_path, path.c_str());
+
+	int fd=socket(AF_UNIX, SOCK_STREAM, 0);
+	if (fd==-1) return -1;
+
+	int r = server ? bind(fd, (struct sockaddr*) &addr, sizeof(addr)) :
+			         connect(fd, (struct sockaddr*) &addr, sizeof(addr));
+	if (r!=0) {
+		close(fd);
+		return -1;
+	}
+	return fd;
+}
+
+} // end anonymous namespace
+
+Channel::Channel(const string& address) : fd(-1) {
+	for (int i=0; i<NB_CONNECT_ATTEMPTS && fd==-1; i++) {
+		if (i>0) usleep(100000);
+		fd = is_unix(address) ? unix_socket(address.substr(5), false) : tcp_socket(address, false);
+	}
+	if (fd==-1)
+		ibex_error("[Channel] cannot connect");
+
+#ifndef MSG_NOSIGNAL
+	int yes=1;
+	setsockopt(fd, SOL_SOCKET, SO_NOSIGPIPE, &yes, sizeof(yes));
+#endif
+}
+
+Channel::Channel(int fd) : fd(fd) {
+#ifndef MSG_NOSIGNAL
+	int yes=1;
+	setsockopt(fd, SOL_SOCKET, SO_NOSIGPIPE, &yes, sizeof(yes));
+#endif
+}
+
+Channel::~Channel() {
+	close(fd);
+}
+
+void Channel::send(const string& msg) {
+	// header: size of the message (8 bytes, little endian)
+	char header[8];
+	uint64_t size=msg.size();
+	for (int i=0; i<8; i++)
+		header[i]=(char) ((size >> (8*i)) & 0xff);
+
+	string frame=string(header,8)+msg;
+
+	size_t sent=0;
+	while (sent<frame.size()) {
+		ssize_t r=::send(fd, frame.data()+sent, frame.size()-sent, SEND_FLAGS);
+		if (r<=0) throw Closed();
+		sent+=r;
+	}
+}
+
+string Channel::receive() {
+	string frame;
+	uint64_t size=0;
+	bool header=true; // reading the header
+
+	while (header || frame.size()<size) {
+		char buf[65536];
+		size_t wanted = header ? 8-frame.size() : std::min(sizeof(buf), (size_t) (size-frame.size()));
+		ssize_t r=::recv(fd, buf, wanted, 0);
+		if (r<=0) throw Closed();
+		frame.append(buf, r);
+
+		if (header && frame.size()==8) {
+			for (int i=0; i<8; i++)
+				size |= ((uint64_t) (unsigned char) frame[i]) << (8*i);
+			frame.clear();
+			header=false;
+		}
+	}
+	return frame;
+}
+
+string Channel::tmp_file() {
+	const char* dir=getenv("TMPDIR");
+	string pattern=string(dir? dir : "/tmp")+"/ibex-XXXXXX";
+	char* name=strdup(pattern.c_str());
+	int tmp=mkstemp(name);
+	if (tmp==-1)
+		ibex_error("[Channel] cannot create a temporary file");
+	close(tmp);
+	string filename(name);
+	free(name);
+	return filename;
+}
+
+string Channel::read_file(const string& filename) {
+	ifstream f(filename.c_str(), ios::in | ios::binary);
+	stringstream ss;
+	ss << f.rdbuf();
+	f.close();
+	std::remove(filename.c_str());
+	return ss.str();
+}
+
+void Channel::write_file(const string& filename, const string& content) {
+	ofstream f(filename.c_str(), ios::out | ios::binary);
+	f.write(content.data(), content.size());
+	f.close();
+}
+
+ChannelServer::ChannelServer(const string& address) : fd(-1) {
+	if (is_unix(address)) {
+		path=address.substr(5);
+		unlink(path.c_str()); // remove a former socket
+		fd=unix_socket(path, true);
+	} else
+		fd=tcp_socket(address, true);
+
+	if (fd==-1 || listen(fd, SOMAXCONN)!=0)
+		ibex_error("[ChannelServer] cannot listen on this address");
+}
+
+ChannelServer::~ChannelServer() {
+	close(fd);
+	if (!path.empty()) unlink(path.c_str());
+}
+
+Channel* ChannelServer::accept() {
+	int c=::accept(fd, NULL, NULL);
+	if (c==-1)
+		ibex_error("[ChannelServer] cannot accept a connection");
+	return new Channel(c);
+}
+
+int ChannelServer::port() const {
+	if (!path.empty()) return -1;
+
+	struct sockaddr_storage addr;
+	socklen_t len=sizeof(addr);
+	if (getsockname(fd, (struct sockaddr*) &addr, &len)!=0)
+		return -1;
+
+	if (addr.ss_family==AF_INET)
+		return ntohs(((struct sockaddr_in*) &addr)->sin_port);
+	else if (addr.ss_family==AF_INET6)
+		return ntohs(((struct sockaddr_in6*) &addr)->sin6_port);
+	else
+		return -1;
+}
+
+#else
+
+Channel::Channel(const string& address) : fd(-1) {
+	not_implemented("Channel under Windows");
+}
+
+Channel::Channel(int fd) : fd(fd) {
+}
+
+Channel::~Channel() {
+}
+
+void Channel::send(const string& msg) {
+	not_implemented("Channel under Windows");
+}
+
+string Channel::receive() {
+	not_implemented("Channel under Windows");
+	return "";
+}
+
+string Channel::tmp_file() {
+	not_implemented("Channel under Windows");
+	return "";
+}
+
+string Channel::read_file(const string& filename) {
+	not_implemented("Channel under Windows");
+	return "";
+}
+
+void Channel::write_file(const string& filename, const string& content) {
+	not_implemented("Channel under Windows");
+}
+
+ChannelServer::ChannelServer(const string& address) : fd(-1) {
+	not_implemented("Channel under Windows");
+}
+
+ChannelServer::~ChannelServer() {
+}
+
+Channel* ChannelServer::accept() {
+	not_implemented("Channel under Windows");
+	return NULL;
+}
+
+int ChannelServer::port() const {
+	not_implemented("Channel under Windows");
+	return -1;
+}
+
+#endif
+
+} // namespace ibex
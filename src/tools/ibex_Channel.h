@@ -0,0 +1,175 @@
+/* ============================================================================
+ * I B E X - Communication channel between processes
+ * ============================================================================
+ * Copyright   : IMT Atlantique (FRANCE)
+ * License     : This program can be distributed under the terms of the GNU LGPL.
+ *               See the file COPYING.LESSER.
+ *
+ * Author(s)   : Gilles Chabert
+ * Created     : Oct 17, 2026
+ * ---------------------------------------------------------------------------- */
+
+#ifndef __IBEX_CHANNEL_H__
+#define __IBEX_CHANNEL_H__
+
+#include "ibex_Exception.h"
+
+#include <string>
+#include <cstdio>
+
+namespace ibex {
+
+/**
+ * \ingroup tools
+ * \brief Connection between two processes.
+ *
+ * A channel is a stream socket on which messages (sequences
+ * of bytes) are exchanged. Coverings (see #ibex::Cov) are sent
+ * in the COV format.
+ *
+ * An address is either "unix:<path>" for a Unix-domain socket
+ * or "<host>:<port>" for a TCP socket.
+ *
+ * Not available under Windows.
+ */
+class Channel {
+public:
+	/**
+	 * \brief Thrown when the other process has closed the connection.
+	 */
+	class Closed : public Exception { };
+
+	/**
+	 * \brief Connect to a server (see #ibex::ChannelServer).
+	 *
+	 * If the server is not ready, the connection is retried
+	 * during a few seconds.
+	 */
+	explicit Channel(const std::string& address);
+
+	/**
+	 * \brief Close the connection.
+	 */
+	~Channel();
+
+	/**
+	 * \brief Send a message.
+	 *
+	 * \throw Closed
+	 */
+	void send(const std::string& msg);
+
+	/**
+	 * \brief Receive a message (wait until a message arrives).
+	 *
+	 * \throw Closed
+	 */
+	std::string receive();
+
+	/**
+	 * \brief Send a covering.
+	 *
+	 * C is a COV class (CovList, CovOptimData, CovSolverData, etc.).
+	 *
+	 * \throw Closed
+	 */
+	template<class C>
+	void send_cov(const C& cov);
+
+	/**
+	 * \brief Receive a covering.
+	 *
+	 * Return NULL if the message is empty.
+	 *
+	 * \throw Closed
+	 */
+	template<class C>
+	C* receive_cov();
+
+private:
+	friend class ChannelServer;
+
+	Channel(int fd);
+	Channel(const Channel&);            // forbidden
+	Channel& operator=(const Channel&); // forbidden
+
+	/* Name of a new temporary file. */
+	static std::string tmp_file();
+
+	/* Content of a file (the file is removed). */
+	static std::string read_file(const std::string& filename);
+
+	/* Write a file. */
+	static void write_file(const std::string& filename, const std::string& content);
+
+	/* Socket. */
+	int fd;
+};
+
+/**
+ * \ingroup tools
+ * \brief Server of channels.
+ *
+ * Listen on an address and accept connections.
+ */
+class ChannelServer {
+public:
+	/**
+	 * \brief Listen on an address (see #ibex::Channel).
+	 *
+	 * For a TCP socket, the host can be "*" (any interface).
+	 */
+	explicit ChannelServer(const std::string& address);
+
+	/**
+	 * \brief Stop listening.
+	 */
+	~ChannelServer();
+
+	/**
+	 * \brief Accept a new connection (wait until a process connects).
+	 */
+	Channel* accept();
+
+	/**
+	 * \brief Port the server listens on (TCP socket).
+	 *
+	 * Useful when the server listens on the port 0 (any free port).
+	 * Return -1 for a Unix-domain socket.
+	 */
+	int port() const;
+
+private:
+	ChannelServer(const ChannelServer&);            // forbidden
+	ChannelServer& operator=(const ChannelServer&); // forbidden
+
+	/* Socket. */
+	int fd;
+
+	/* Path of the Unix-domain socket (empty if TCP). */
+	std::string path;
+};
+
+/*================================== inline implementations ========================================*/
+
+template<class C>
+void Channel::send_cov(const C& cov) {
+	std::string filename=tmp_file();
+	cov.save(filename.c_str());
+	send(read_file(filename));
+}
+
+template<class C>
+C* Channel::receive_cov() {
+	std::string msg=receive();
+	if (msg.empty()) return NULL;
+	std::string filename=tmp_file();
+	write_file(filename, msg);
+	C* cov=new C(filename.c_str());
+	std::remove(filename.c_str());
+	return cov;
+}
+
+} // namespace ibex
+
+#endif // __IBEX_CHANNEL_H__
@@ -11,23 +11,64 @@
 
 #include "ibex_DirectedHyperGraph.h"
 #include <iterator>
+#include <algorithm>
+#include <cassert>
+
+using namespace std;
 
 namespace ibex {
 
+namespace {
+
+// swap the pairs (ctr,var) into (var,ctr)
+vector<pair<int,int> > reverse(const vector<pair<int,int> >& arcs) {
+	vector<pair<int,int> > r;
+	r.reserve(arcs.size());
+	for (vector<pair<int,int> >::const_iterator it=arcs.begin(); it!=arcs.end(); ++it)
+		r.push_back(make_pair(it->second,it->first));
+	return r;
+}
+
+}
+
+DirectedHyperGraph::Adjacency::Adjacency(int n, vector<pair<int,int> > arcs) : ptr(n+1,0) {
+	sort(arcs.begin(),arcs.end());
+	arcs.erase(unique(arcs.begin(),arcs.end()),arcs.end());
+
+	ind.reserve(arcs.size());
+	for (vector<pair<int,int> >::const_iterator it=arcs.begin(); it!=arcs.end(); ++it) {
+		assert(it->first>=0 && it->first<n);
+		ptr[it->first+1]++;
+		ind.push_back(it->second);
+	}
+	for (int i=0; i<n; i++)
+		ptr[i+1]+=ptr[i];
+}
+
+DirectedHyperGraph::DirectedHyperGraph(int nb_ctr, int nb_var,
+		const vector<pair<int,int> >& input_arcs,
+		const vector<pair<int,int> >& output_arcs) : m(nb_ctr), n(nb_var),
+		ctr_input_adj(nb_ctr, input_arcs),
+		ctr_output_adj(nb_ctr, output_arcs),
+		var_input_adj(nb_var, reverse(output_arcs)),
+		var_output_adj(nb_var, reverse(input_arcs)) {
+
+}
+
 std::ostream& operator<<(std::ostream& os, const DirectedHyperGraph& g) {
 	for (int c=0; c<g.m; c++) {
 		os << "ctr " << c << " input=( ";
-		copy(g.input_vars(c).begin(), g.input_vars(c).end(), std::ostream_iterator<int>(os, " "));
+		copy(g.input_vars(c), g.input_vars(c)+g.nb_input_vars(c), std::ostream_iterator<int>(os, " "));
 		os << ") output=( ";
-		copy(g.output_vars(c).begin(), g.output_vars(c).end(), std::ostream_iterator<int>(os, " "));
+		copy(g.output_vars(c), g.output_vars(c)+g.nb_output_vars(c), std::ostream_iterator<int>(os, " "));
 		os << ")\n";
 	}
 
 	for (int v=0; v<g.n; v++) {
 		os << "var " << v << " input=( ";
-		copy(g.input_ctrs(v).begin(), g.input_ctrs(v).end(), std::ostream_iterator<int>(os, " "));
+		copy(g.input_ctrs(v), g.input_ctrs(v)+g.nb_input_ctrs(v), std::ostream_iterator<int>(os, " "));
 		os << ") output=( ";
-		copy(g.output_ctrs(v).begin(), g.output_ctrs(v).end(), std::ostream_iterator<int>(os, " "));
+		copy(g.output_ctrs(v), g.output_ctrs(v)+g.nb_output_ctrs(v), std::ostream_iterator<int>(os, " "));
 		os << ")\n";
 	}
 	return os;
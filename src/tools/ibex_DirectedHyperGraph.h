@@ -1,5 +1,5 @@
 /* ============================================================================
- * I B E X - Directed hyper-graph (represented by an adjacency matrix)
+ * I B E X - Directed hyper-graph (represented by CSR adjacency lists)
  * ============================================================================
  * Copyright   : Ecole des Mines de Nantes (FRANCE)
  * License     : This program can be distributed under the terms of the GNU LGPL.
@@ -13,7 +13,8 @@
 #define __IBEX_DIRECTED_HYPER_GRAPH_H__
 
 #include <iostream>
-#include <set>
+#include <vector>
+#include <utility>
 
 namespace ibex {
 
@@ -21,64 +22,90 @@ namespace ibex {
  * \ingroup tools
  * \brief Directed hyper-graph.
  *
+ * The graph is immutable: the adjacency lists are built once
+ * for all in CSR format, i.e., the neighbors of a node are stored
+ * contiguously, in increasing order. Typical loop:
+ * <pre>
+ *   const int* vars=g.output_vars(c);
+ *   for (int k=0; k<g.nb_output_vars(c); k++)
+ *      ... vars[k] ...
+ * </pre>
  */
 class DirectedHyperGraph {
 public:
 	/**
 	 * \brief Build a new directed hyper-graph.
 	 *
+	 * \param input_arcs  - the arcs var->ctr, given as (ctr,var) pairs.
+	 * \param output_arcs - the arcs var<-ctr, given as (ctr,var) pairs.
+	 *
+	 * Duplicated arcs are ignored.
 	 */
-	DirectedHyperGraph(int nb_ctr, int nb_var);
-
-		/**
-	 * \brief Delete the graph.
-	 */
-	~DirectedHyperGraph();
+	DirectedHyperGraph(int nb_ctr, int nb_var,
+			const std::vector<std::pair<int,int> >& input_arcs,
+			const std::vector<std::pair<int,int> >& output_arcs);
 
 	/**
 	 * \brief Return the number of constraints.
 	 */
-	 int nb_ctr() const;
+	int nb_ctr() const;
 
 	/**
 	 * \brief Return the number of variables.
 	 */
-	 int nb_var() const;
+	int nb_var() const;
 
 	/**
-	 * \brief add an arc betweeen \a ctr and \a var.
-	 *
-	 * \param incoming True iff \a var is an incoming variable
-	 * (the arc is var->ctr). Otherwise, \a var is outgoing (the
-	 * arc is var<-ctr).
+	 * \brief Return the number of input variables of a constraint \a ctr.
 	 */
-	void add_arc(int ctr, int var, bool incoming);
+	int nb_input_vars(int ctr) const;
 
 	/**
 	 * \brief Return the input variables of a constraint \a ctr.
 	 *
+	 * The array has #nb_input_vars(ctr) elements.
 	 */
-	 const std::set<int>& input_vars(int ctr) const;
+	const int* input_vars(int ctr) const;
+
+	/**
+	 * \brief Return the number of output variables of a constraint \a ctr.
+	 */
+	int nb_output_vars(int ctr) const;
 
 	/**
 	 * \brief Return the output variables of a constraint \a ctr.
 	 *
+	 * The array has #nb_output_vars(ctr) elements.
+	 */
+	const int* output_vars(int ctr) const;
+
+	/**
+	 * \brief Return the number of input constraints of a variable \a var.
 	 */
-	 const std::set<int>& output_vars(int ctr) const;
+	int nb_input_ctrs(int var) const;
 
 	/**
 	 * \brief Return the input constraints of a variable \a var.
 	 *
+	 * The array has #nb_input_ctrs(var) elements.
+	 *
 	 *  \pre 0 <= \a var < #nb_var().
 	 */
-	 const std::set<int>& input_ctrs(int var) const;
+	const int* input_ctrs(int var) const;
+
+	/**
+	 * \brief Return the number of output constraints of a variable \a var.
+	 */
+	int nb_output_ctrs(int var) const;
 
 	/**
 	 * \brief Return the output constraints of a variable \a var.
 	 *
+	 * The array has #nb_output_ctrs(var) elements.
+	 *
 	 *  \pre 0 <= \a var < #nb_var().
 	 */
-	 const std::set<int>& output_ctrs(int var) const;
+	const int* output_ctrs(int var) const;
 
 	/**
 	 * \brief Display the internal structure (matrix & tables).
@@ -90,31 +117,29 @@ public:
 private:
 	DirectedHyperGraph(const DirectedHyperGraph&);
 
+	/*
+	 * Adjacency lists of nodes in CSR format: the neighbors
+	 * of the ith node are ind[ptr[i]]...ind[ptr[i+1]-1].
+	 */
+	struct Adjacency {
+		Adjacency(int n, std::vector<std::pair<int,int> > arcs);
+		int size(int i) const;
+		const int* operator[](int i) const;
+		std::vector<int> ptr;
+		std::vector<int> ind;
+	};
+
 	const int m;
 	const int n;
-	std::set<int> *ctr_input_adj;
-	std::set<int> *ctr_output_adj;
-	std::set<int> *var_input_adj;
-	std::set<int> *var_output_adj;
+	Adjacency ctr_input_adj;
+	Adjacency ctr_output_adj;
+	Adjacency var_input_adj;
+	Adjacency var_output_adj;
 };
 
 
 /*================================== inline implementations ========================================*/
 
-inline DirectedHyperGraph::DirectedHyperGraph(int nb_ctr, int nb_var) : m(nb_ctr), n(nb_var) {
-	ctr_input_adj = new std::set<int>[m];
-	ctr_output_adj = new std::set<int>[m];
-	var_input_adj = new std::set<int>[n];
-	var_output_adj = new std::set<int>[n];
-}
-
-inline DirectedHyperGraph::~DirectedHyperGraph() {
-	delete[] ctr_input_adj;
-	delete[] ctr_output_adj;
-	delete[] var_input_adj;
-	delete[] var_output_adj;
-}
-
 inline int DirectedHyperGraph::nb_ctr() const {
 	return m;
 }
@@ -123,31 +148,45 @@ inline int DirectedHyperGraph::nb_var() const {
 	return n;
 }
 
-inline void DirectedHyperGraph::add_arc(int ctr, int var, bool incoming) {
-	if (incoming) {
-		ctr_input_adj[ctr].insert(var);
-		var_output_adj[var].insert(ctr);
-	} else {
-		ctr_output_adj[ctr].insert(var);
-		var_input_adj[var].insert(ctr);
-	}
+inline int DirectedHyperGraph::nb_input_vars(int ctr) const {
+	return ctr_input_adj.size(ctr);
 }
 
-inline const std::set<int>& DirectedHyperGraph::input_vars(int ctr) const {
+inline const int* DirectedHyperGraph::input_vars(int ctr) const {
 	return ctr_input_adj[ctr];
 }
 
-inline const std::set<int>& DirectedHyperGraph::output_vars(int ctr) const {
+inline int DirectedHyperGraph::nb_output_vars(int ctr) const {
+	return ctr_output_adj.size(ctr);
+}
+
+inline const int* DirectedHyperGraph::output_vars(int ctr) const {
 	return ctr_output_adj[ctr];
 }
 
-inline const std::set<int>& DirectedHyperGraph::input_ctrs(int var) const {
+inline int DirectedHyperGraph::nb_input_ctrs(int var) const {
+	return var_input_adj.size(var);
+}
+
+inline const int* DirectedHyperGraph::input_ctrs(int var) const {
 	return var_input_adj[var];
 }
 
-inline const std::set<int>& DirectedHyperGraph::output_ctrs(int var) const {
+inline int DirectedHyperGraph::nb_output_ctrs(int var) const {
+	return var_output_adj.size(var);
+}
+
+inline const int* DirectedHyperGraph::output_ctrs(int var) const {
 	return var_output_adj[var];
 }
 
+inline int DirectedHyperGraph::Adjacency::size(int i) const {
+	return ptr[i+1]-ptr[i];
+}
+
+inline const int* DirectedHyperGraph::Adjacency::operator[](int i) const {
+	return ind.data()+ptr[i];
+}
+
 } // namespace ibex
 #endif // __IBEX_DIRECTED_HYPER_GRAPH_H__
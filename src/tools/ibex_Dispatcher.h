@@ -0,0 +1,153 @@
+/* ============================================================================
+ * I B E X - Dispatch of subproblems to worker processes
+ * ============================================================================
+ * Copyright   : IMT Atlantique (FRANCE)
+ * License     : This program can be distributed under the terms of the GNU LGPL.
+ *               See the file COPYING.LESSER.
+ *
+ * Author(s)   : Gilles Chabert
+ * Created     : Oct 17, 2026
+ * ---------------------------------------------------------------------------- */
+
+#ifndef __IBEX_DISPATCHER_H__
+#define __IBEX_DISPATCHER_H__
+
+#include "ibex_Channel.h"
+#include "ibex_ThreadPool.h"
+#include "ibex_IntervalVector.h"
+
+#include <deque>
+#include <vector>
+#include <memory>
+#include <functional>
+#include <mutex>
+#include <condition_variable>
+
+namespace ibex {
+
+/**
+ * \ingroup tools
+ * \brief Dispatch of subproblems to worker processes.
+ *
+ * Coordinator side of a search distributed on several processes
+ * (see #Solver::coordinate(...) and #Optimizer::coordinate(...)).
+ */
+class Dispatcher {
+public:
+	/**
+	 * \brief Number of subproblems per worker created by
+	 * splitting the initial box.
+	 */
+	static const int NB_SUBPROBLEMS = 4;
+
+	/**
+	 * \brief Process boxes by worker processes.
+	 *
+	 * Accept the connection of nb_workers workers. Then, as long as boxes
+	 * remain, each idle worker is sent a subproblem built from its share
+	 * of the remaining boxes (a "batch") and its result (a COV of class C)
+	 * is merged. There is one thread per worker. The batch of a worker that
+	 * disconnects is given back to the other ones. At the end, an empty
+	 * message is sent to each worker (end of the work).
+	 *
+	 * The functions "build", "merge" and "cancel" are called by one thread
+	 * at a time. They can modify the boxes (in particular, "merge" has to
+	 * push the boxes that remain to be processed).
+	 *
+	 * \param build  - Build the subproblem of worker n°w from a batch.
+	 * \param merge  - Merge the result of worker n°w. Return true to stop the search.
+	 * \param cancel - Called when the batch of worker n°w is given back
+	 *                 to the other workers (can be empty).
+	 *
+	 * \throw Channel::Closed - if all the workers have disconnected while boxes remain.
+	 */
+	template<class C>
+	static void run(ChannelServer& server, int nb_workers, std::deque<IntervalVector>& boxes,
+			const std::function<C*(int w, const std::vector<IntervalVector>& batch)>& build,
+			const std::function<bool(int w, const C& result)>& merge,
+			const std::function<void(int w)>& cancel=std::function<void(int)>());
+};
+
+/*================================== inline implementations ========================================*/
+
+template<class C>
+void Dispatcher::run(ChannelServer& server, int nb_workers, std::deque<IntervalVector>& boxes,
+		const std::function<C*(int w, const std::vector<IntervalVector>& batch)>& build,
+		const std::function<bool(int w, const C& result)>& merge,
+		const std::function<void(int w)>& cancel) {
+
+	std::vector<Channel*> channels;
+	for (int w=0; w<nb_workers; w++)
+		channels.push_back(server.accept());
+
+	std::mutex mutex;                   // protects the boxes and the calls to build/merge/cancel
+	std::condition_variable ready;      // notified when boxes are available or the search is over
+	int nb_busy=0;                      // number of workers running a subproblem
+	int nb_lost=0;                      // number of disconnected workers
+	bool stop=false;
+
+	ThreadPool threads(nb_workers);
+
+	// one thread per worker
+	threads.run(nb_workers, [&](int w, int thread) {
+		Channel& channel=*channels[w];
+		std::vector<IntervalVector> batch;
+
+		try {
+			while (true) {
+				std::unique_ptr<C> task;
+				{
+					std::unique_lock<std::mutex> lock(mutex);
+					ready.wait(lock, [&] { return stop || !boxes.empty() || nb_busy==0; });
+					if (stop || boxes.empty()) break;
+
+					// share the remaining boxes between the workers
+					size_t size=(boxes.size()+nb_workers-1)/nb_workers;
+					batch.assign(boxes.begin(), boxes.begin()+size);
+					boxes.erase(boxes.begin(), boxes.begin()+size);
+					nb_busy++;
+
+					task.reset(build(w, batch));
+				}
+
+				channel.send_cov(*task);
+				std::unique_ptr<C> result(channel.template receive_cov<C>());
+				if (!result) throw Channel::Closed();
+
+				{
+					std::lock_guard<std::mutex> lock(mutex);
+					batch.clear();
+					nb_busy--;
+					if (merge(w, *result)) stop=true;
+				}
+
+				ready.notify_all();
+			}
+		} catch(Channel::Closed&) {
+			// the subproblem is given to the other workers
+			std::lock_guard<std::mutex> lock(mutex);
+			if (!batch.empty()) {
+				boxes.insert(boxes.end(), batch.begin(), batch.end());
+				nb_busy--;
+				if (cancel) cancel(w);
+			}
+			if (++nb_lost==nb_workers) stop=true;
+		}
+
+		ready.notify_all();
+
+		try {
+			channel.send(""); // end of the work
+		} catch(Channel::Closed&) { }
+	});
+
+	for (std::vector<Channel*>::iterator it=channels.begin(); it!=channels.end(); ++it)
+		delete *it;
+
+	if (nb_lost==nb_workers && !boxes.empty())
+		throw Channel::Closed();
+}
+
+} // namespace ibex
+
+#endif // __IBEX_DISPATCHER_H__
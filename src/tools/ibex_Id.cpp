@@ -15,6 +15,8 @@ namespace {
 
 atomic_long id_count(0);
 
+atomic_long bxp_id_count(0);
+
 }
 
 namespace ibex {
@@ -23,4 +25,8 @@ long next_id() {
 	return id_count++;
 }
 
+long next_bxp_id() {
+	return bxp_id_count++;
+}
+
 }
@@ -22,6 +22,18 @@ namespace ibex {
  */
 long next_id();
 
+/**
+ * \ingroup tools
+ *
+ * \brief Generate a box property identifier.
+ *
+ * Unlike #next_id(), the identifiers are consecutive
+ * numbers starting from 0, so that they can index an array
+ * (see #ibex::BoxProperties). All the box properties
+ * (see #ibex::Bxp) must be identified by such numbers.
+ */
+long next_bxp_id();
+
 }
 
 #endif /* __IBEX_ID_H__ */
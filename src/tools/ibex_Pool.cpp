@@ -0,0 +1,167 @@
+/* ============================================================================
+ * I B E X - Pool of memory blocks
+ * ============================================================================
+ * Copyright   : IMT Atlantique (FRANCE)
+ * License     : This program can be distributed under the terms of the GNU LGPL.
+ *               See the file COPYING.LESSER.
+ *
+ * Author(s)   : Gilles Chabert
+ * Created     : Oct 17, 2026
+ * ---------------------------------------------------------------------------- */
+
+#include "ibex_Pool.h"
+
+#include <new>
+#include <vector>
+#include <mutex>
+
+using namespace std;
+
+namespace ibex {
+
+const size_t Pool::MAX_SIZE = 4096;
+
+namespace {
+
+/* Size of a size class. */
+const size_t GRAIN = 16;
+
+/* Number of size classes.
+ * The largest class holds the box of a cell
+ * with 256 variables (16-byte intervals, see #ibex::Cell). */
+const size_t NB_CLASSES = 4096 / GRAIN;
+
+/* Number of blocks exchanged between a thread cache and the reserve. */
+const size_t BATCH_SIZE = 256;
+
+/* A free block. */
+struct Block {
+	Block* next;
+};
+
+/* A list of free blocks. */
+struct Batch {
+	Block* first;
+	size_t size;
+};
+
+/*
+ * Blocks shared by all the threads.
+ *
+ * The reserve is never destroyed: blocks can still be
+ * freed during the destruction of static objects.
+ */
+struct Reserve {
+	mutex mtx;
+	vector<Batch> batches[NB_CLASSES];
+};
+
+Reserve& reserve() {
+	static Reserve* r=new Reserve();
+	return *r;
+}
+
+/* Free blocks of the current thread (one list per class). */
+thread_local Block* cache[NB_CLASSES];
+thread_local size_t cache_size[NB_CLASSES];
+
+/* Give back the blocks of a terminating thread to the reserve. */
+struct CacheFlusher {
+	~CacheFlusher() {
+		Reserve& r=reserve();
+		lock_guard<mutex> lock(r.mtx);
+		for (size_t c=0; c<NB_CLASSES; c++) {
+			if (cache_size[c]>0) {
+				Batch b = { cache[c], cache_size[c] };
+				r.batches[c].push_back(b);
+				cache[c]=NULL;
+				cache_size[c]=0;
+			}
+		}
+	}
+};
+
+thread_local CacheFlusher flusher;
+
+/* Fill the cache of class c (empty) from the reserve. */
+void refill(size_t c) {
+	(void) &flusher; // makes sure the flusher is created in this thread
+
+	Reserve& r=reserve();
+	{
+		lock_guard<mutex> lock(r.mtx);
+		if (!r.batches[c].empty()) {
+			cache[c]=r.batches[c].back().first;
+			cache_size[c]=r.batches[c].back().size;
+			r.batches[c].pop_back();
+			return;
+		}
+	}
+
+	// carve a new chunk
+	size_t block_size=(c+1)*GRAIN;
+	char* chunk=(char*) ::operator new(BATCH_SIZE*block_size);
+	for (size_t i=0; i<BATCH_SIZE; i++) {
+		Block* b=(Block*) (chunk+i*block_size);
+		b->next = i<BATCH_SIZE-1 ? (Block*) (chunk+(i+1)*block_size) : NULL;
+	}
+	cache[c]=(Block*) chunk;
+	cache_size[c]=BATCH_SIZE;
+}
+
+/* Give back a batch of the (full) cache of class c to the reserve. */
+void spill(size_t c) {
+	Block* first=cache[c];
+	Block* last=first;
+	for (size_t i=1; i<BATCH_SIZE; i++)
+		last=last->next;
+
+	cache[c]=last->next;
+	cache_size[c]-=BATCH_SIZE;
+	last->next=NULL;
+
+	Batch b = { first, BATCH_SIZE };
+	Reserve& r=reserve();
+	lock_guard<mutex> lock(r.mtx);
+	r.batches[c].push_back(b);
+}
+
+} // end anonymous namespace
+
+void* Pool::alloc(size_t size) {
+	if (size==0 || size>MAX_SIZE)
+		return ::operator new(size);
+
+	size_t c=(size-1)/GRAIN;
+
+	if (cache_size[c]==0)
+		refill(c);
+
+	Block* b=cache[c];
+	cache[c]=b->next;
+	cache_size[c]--;
+	return b;
+}
+
+void Pool::free(void* p, size_t size) {
+	if (p==NULL) return;
+
+	if (size==0 || size>MAX_SIZE) {
+		::operator delete(p);
+		return;
+	}
+
+	size_t c=(size-1)/GRAIN;
+
+	Block* b=(Block*) p;
+	b->next=cache[c];
+	cache[c]=b;
+	cache_size[c]++;
+
+	// a thread that frees more than it allocates
+	// (e.g., with work stealing) gives its blocks back
+	if (cache_size[c]>=2*BATCH_SIZE)
+		spill(c);
+}
+
+} // namespace ibex
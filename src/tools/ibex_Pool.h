@@ -0,0 +1,101 @@
+/* ============================================================================
+ * I B E X - Pool of memory blocks
+ * ============================================================================
+ * Copyright   : IMT Atlantique (FRANCE)
+ * License     : This program can be distributed under the terms of the GNU LGPL.
+ *               See the file COPYING.LESSER.
+ *
+ * Author(s)   : Gilles Chabert
+ * Created     : Oct 17, 2026
+ * ---------------------------------------------------------------------------- */
+
+#ifndef __IBEX_POOL_H__
+#define __IBEX_POOL_H__
+
+#include <cstddef>
+
+namespace ibex {
+
+/**
+ * \ingroup tools
+ * \brief Pool of small memory blocks.
+ *
+ * Allocator for the small objects that are created and deleted
+ * at a high rate during a search (cells, boxes of cells, box properties).
+ *
+ * Blocks are grouped by size classes (multiples of 16 bytes).
+ * A freed block is not given back to the system but kept for
+ * the next allocation of the same class. Each thread has its
+ * own cache of free blocks, so that no lock is taken in the
+ * common case; the caches exchange blocks by batches through
+ * a shared reserve. A block can be freed by another thread
+ * than the one that allocated it.
+ *
+ * Blocks larger than #MAX_SIZE are directly allocated on the heap.
+ *
+ * A class uses the pool by overloading its allocation functions:
+ * \code
+ * static void* operator new(size_t size) { return Pool::alloc(size); }
+ * static void operator delete(void* p, size_t size) { Pool::free(p,size); }
+ * \endcode
+ * (with a virtual destructor, the size given to "delete" is the
+ * size of the actual object). A container uses the pool through
+ * #ibex::PoolAllocator.
+ */
+class Pool {
+public:
+	/**
+	 * \brief Allocate a block of \a size bytes.
+	 */
+	static void* alloc(size_t size);
+
+	/**
+	 * \brief Free a block allocated by #alloc(size_t).
+	 *
+	 * \a size must be the size given to #alloc(size_t).
+	 */
+	static void free(void* p, size_t size);
+
+	/**
+	 * \brief Size of the largest block managed by the pool.
+	 */
+	static const size_t MAX_SIZE;
+};
+
+/**
+ * \ingroup tools
+ * \brief Standard allocator on top of the pool.
+ *
+ * Example:
+ * \code
+ * std::vector<Bxp*, PoolAllocator<Bxp*> > v;
+ * \endcode
+ */
+template<class T>
+class PoolAllocator {
+public:
+	typedef T value_type;
+
+	PoolAllocator() { }
+
+	template<class U>
+	PoolAllocator(const PoolAllocator<U>&) { }
+
+	T* allocate(size_t n) {
+		return (T*) Pool::alloc(n*sizeof(T));
+	}
+
+	void deallocate(T* p, size_t n) {
+		Pool::free(p, n*sizeof(T));
+	}
+};
+
+template<class T, class U>
+inline bool operator==(const PoolAllocator<T>&, const PoolAllocator<U>&) { return true; }
+
+template<class T, class U>
+inline bool operator!=(const PoolAllocator<T>&, const PoolAllocator<U>&) { return false; }
+
+} // namespace ibex
+
+#endif // __IBEX_POOL_H__
@@ -0,0 +1,116 @@
+/* ============================================================================
+ * I B E X - Pool of threads
+ * ============================================================================
+ * Copyright   : IMT Atlantique (FRANCE)
+ * License     : This program can be distributed under the terms of the GNU LGPL.
+ *               See the file COPYING.LESSER.
+ *
+ * Author(s)   : Gilles Chabert
+ * Created     : Oct 17, 2026
+ * ---------------------------------------------------------------------------- */
+
+#include "ibex_ThreadPool.h"
+
+using namespace std;
+
+namespace ibex {
+
+ThreadPool::ThreadPool(int n) : f(NULL), nb_tasks(0), next_task(0), busy(0), generation(0), stop(false) {
+	if (n<=0) n=hardware_threads();
+
+	fegetenv(&env);
+
+	for (int t=1; t<n; t++)
+		threads.push_back(thread(&ThreadPool::loop, this, t));
+}
+
+ThreadPool::~ThreadPool() {
+	{
+		lock_guard<std::mutex> lock(mutex);
+		stop=true;
+	}
+	start.notify_all();
+
+	for (vector<thread>::iterator it=threads.begin(); it!=threads.end(); ++it)
+		it->join();
+}
+
+int ThreadPool::hardware_threads() {
+	int n=(int) thread::hardware_concurrency();
+	return n<1 ? 1 : n;
+}
+
+void ThreadPool::run(int n, const function<void(int,int)>& task) {
+	if (n<=0) return;
+
+	if (threads.empty()) {
+		for (int i=0; i<n; i++)
+			task(i,0);
+		return;
+	}
+
+	{
+		lock_guard<std::mutex> lock(mutex);
+		f=&task;
+		nb_tasks=n;
+		next_task=0;
+		error=exception_ptr();
+		fegetenv(&env);
+		busy=(int) threads.size();
+		generation++;
+	}
+	start.notify_all();
+
+	work(0);
+
+	exception_ptr e;
+	{
+		unique_lock<std::mutex> lock(mutex);
+		while (busy>0) finish.wait(lock);
+		f=NULL;
+		e=error;
+		error=exception_ptr();
+	}
+
+	if (e) rethrow_exception(e);
+}
+
+void ThreadPool::work(int t) {
+	while (true) {
+		int i;
+		{
+			lock_guard<std::mutex> lock(mutex);
+			if (next_task>=nb_tasks) return;
+			i=next_task++;
+		}
+
+		try {
+			(*f)(i,t);
+		} catch(...) {
+			lock_guard<std::mutex> lock(mutex);
+			if (!error) error=current_exception();
+			next_task=nb_tasks; // cancel the remaining tasks
+		}
+	}
+}
+
+void ThreadPool::loop(int t) {
+	unsigned long seen=0;
+
+	unique_lock<std::mutex> lock(mutex);
+
+	while (true) {
+		while (!stop && generation==seen) start.wait(lock);
+		if (stop) return;
+		seen=generation;
+
+		lock.unlock();
+		fesetenv(&env);
+		work(t);
+		lock.lock();
+
+		if (--busy==0) finish.notify_all();
+	}
+}
+
+} // namespace ibex
@@ -0,0 +1,111 @@
+/* ============================================================================
+ * I B E X - Pool of threads
+ * ============================================================================
+ * Copyright   : IMT Atlantique (FRANCE)
+ * License     : This program can be distributed under the terms of the GNU LGPL.
+ *               See the file COPYING.LESSER.
+ *
+ * Author(s)   : Gilles Chabert
+ * Created     : Oct 17, 2026
+ * ---------------------------------------------------------------------------- */
+
+#ifndef __IBEX_THREAD_POOL_H__
+#define __IBEX_THREAD_POOL_H__
+
+#include <vector>
+#include <functional>
+#include <thread>
+#include <mutex>
+#include <condition_variable>
+#include <exception>
+#include <cfenv>
+
+namespace ibex {
+
+/**
+ * \ingroup tools
+ * \brief Pool of threads.
+ *
+ * The threads are created once and for all, and then
+ * wait for tasks. The calling thread also executes tasks,
+ * so that a pool of size 1 creates no thread at all.
+ *
+ * Tasks are dispatched dynamically (the first thread
+ * available takes the next task).
+ *
+ * The floating-point environment (in particular, the
+ * rounding mode required by the interval arithmetic)
+ * of the calling thread is set in all the threads
+ * before running the tasks.
+ *
+ * A pool must not be used by two threads at the same time.
+ */
+class ThreadPool {
+public:
+	/**
+	 * \brief Create a pool of n threads (including the calling one).
+	 *
+	 * If n<=0, the number of hardware threads is taken.
+	 */
+	explicit ThreadPool(int n);
+
+	/**
+	 * \brief Delete this (join the threads).
+	 */
+	~ThreadPool();
+
+	/**
+	 * \brief Number of threads (including the calling one).
+	 */
+	int size() const;
+
+	/**
+	 * \brief Run f(task, thread) for task=0...nb_tasks-1.
+	 *
+	 * The calling thread is the thread n°0 and the
+	 * function returns when all the tasks are finished.
+	 *
+	 * If a task throws an exception, the tasks that have not
+	 * started yet are cancelled and the exception is rethrown
+	 * by this function.
+	 */
+	void run(int nb_tasks, const std::function<void(int,int)>& f);
+
+	/**
+	 * \brief Number of hardware threads (at least 1).
+	 */
+	static int hardware_threads();
+
+private:
+	ThreadPool(const ThreadPool&);            // forbidden
+	ThreadPool& operator=(const ThreadPool&); // forbidden
+
+	void work(int thread);
+
+	void loop(int thread);
+
+	std::vector<std::thread> threads;
+
+	std::mutex mutex;
+	std::condition_variable start;  // notified when tasks are available
+	std::condition_variable finish; // notified when a thread has finished
+
+	const std::function<void(int,int)>* f;
+	int nb_tasks;
+	int next_task;
+	int busy;           // number of helper threads working on the current run
+	unsigned long generation; // incremented at each run
+	bool stop;
+	std::exception_ptr error;
+	std::fenv_t env;
+};
+
+/*================================== inline implementations ========================================*/
+
+inline int ThreadPool::size() const {
+	return (int) threads.size()+1;
+}
+
+} // namespace ibex
+
+#endif // __IBEX_THREAD_POOL_H__
@@ -128,3 +128,46 @@ void TestAgenda::push01() {
 	CPPUNIT_ASSERT(((i=a.next(i))==a.end()));
 }
 
+void TestAgenda::priority01() {
+	PriorityAgenda a(10);
+	a.push(3,1.0);
+	a.push(7,5.0);
+	a.push(1,2.0);
+	a.push(3,1.0); // already present
+	a.push(0,4.0);
+	int i;
+	a.pop(i);
+	CPPUNIT_ASSERT(i==7);
+	a.pop(i);
+	CPPUNIT_ASSERT(i==0);
+	a.push(7,0.5);
+	a.pop(i);
+	CPPUNIT_ASSERT(i==1);
+	a.pop(i);
+	CPPUNIT_ASSERT(i==3);
+	a.pop(i);
+	CPPUNIT_ASSERT(i==7);
+	CPPUNIT_ASSERT(a.empty());
+}
+
+void TestAgenda::priority02() {
+	// priority update
+	PriorityAgenda a(5);
+	for (int i=0; i<5; i++) a.push(i,i);
+	a.push(4,-1.0);
+	a.push(0,10.0);
+	CPPUNIT_ASSERT(a.first()==0);
+	CPPUNIT_ASSERT(a.first_priority()==10.0);
+	int order[]={0,3,2,1,4};
+	int i;
+	for (int k=0; k<5; k++) {
+		a.pop(i);
+		CPPUNIT_ASSERT(i==order[k]);
+	}
+	CPPUNIT_ASSERT(a.empty());
+	a.push(2,1.0);
+	a.flush();
+	CPPUNIT_ASSERT(a.empty());
+	a.push(2,1.0);
+	CPPUNIT_ASSERT(a.first()==2);
+}
@@ -15,13 +15,15 @@
 #include "ibex_LargestFirst.h"
 #include "ibex_SystemFactory.h"
 #include "ibex_NormalizedSystem.h"
+#include "ibex_BxpNewtonPrecond.h"
 #include "ibex_Cell.h"
 
 //using namespace std;
 
 namespace ibex {
 
-long BxpTest::id = next_id();
+long BxpTest::id = next_bxp_id();
+long BxpSharedTest::id = next_bxp_id();
 
 void TestCell::test01() {
 	IntervalVector box (2, Interval(-1,1));
@@ -116,6 +118,52 @@ void TestCell::test02() {
 
 }
 
+void TestCell::test03() {
+	IntervalVector box (2, Interval(-1,1));
+	Cell * root = new Cell(box);
+
+	root->prop.add(new BxpTest());
+	root->prop.add(new BxpSharedTest());
+	BxpSharedTest* back = (BxpSharedTest*) root->prop[BxpSharedTest::id];
+	back->n = 100;
+
+	LargestFirst bsc;
+	std::pair<Cell*, Cell*> new_cells = bsc.bisect(*root);
+
+	const Cell& c1 = *new_cells.first;
+	const Cell& c2 = *new_cells.second;
+
+	// shared with the parent
+	CPPUNIT_ASSERT(c1.prop[BxpSharedTest::id]==back);
+	CPPUNIT_ASSERT(c2.prop[BxpSharedTest::id]==back);
+	// copied
+	CPPUNIT_ASSERT(c1.prop[BxpTest::id]!=root->prop[BxpTest::id]);
+
+	delete root;
+
+	// duplicated before modification
+	BxpSharedTest* back_1 = (BxpSharedTest*) new_cells.first->prop[BxpSharedTest::id];
+	CPPUNIT_ASSERT(back_1!=back);
+	back_1->n = 10;
+	CPPUNIT_ASSERT(((const BxpSharedTest*) c2.prop[BxpSharedTest::id])->n == 100);
+
+	// not shared anymore: no copy
+	BxpSharedTest* back_2 = (BxpSharedTest*) new_cells.second->prop[BxpSharedTest::id];
+	CPPUNIT_ASSERT(back_2==back);
+	back_2->n = 20;
+	CPPUNIT_ASSERT(((const BxpSharedTest*) c1.prop[BxpSharedTest::id])->n == 10);
+
+	// a property added to a sub-box only
+	long id=next_bxp_id();
+	new_cells.first->prop.add(new BxpNewtonPrecond(id, 2));
+	CPPUNIT_ASSERT(c1.prop[id]!=NULL);
+	CPPUNIT_ASSERT(c2.prop[id]==NULL);
+	CPPUNIT_ASSERT(c1.prop[BxpTest::id]!=NULL);
+	CPPUNIT_ASSERT(c2.prop[BxpTest::id]!=NULL);
+
+	delete new_cells.first;
+	delete new_cells.second;
+}
 
 } // end namespace
 
@@ -40,6 +40,29 @@ protected:
 
 };
 
+class BxpSharedTest:  public Bxp {
+public:
+	BxpSharedTest(): Bxp(id), n(10) { };
+
+	Bxp* copy(const IntervalVector& box, const BoxProperties& prop) const {
+		return new BxpSharedTest(*this);
+	};
+
+	void update(const BoxEvent& event, const BoxProperties& prop) { }
+
+	bool unchanged(const BoxEvent& event, const BoxProperties& prop) const { return true; }
+
+	int n;
+	static long id;
+
+protected:
+	/**
+	 * \brief Constructor by copy.
+	 */
+	explicit BxpSharedTest(const BxpSharedTest& e) : Bxp(id), n(e.n) { };
+
+};
+
 class TestCell : public CppUnit::TestFixture {
 
 public:
@@ -47,10 +70,13 @@ public:
 	CPPUNIT_TEST_SUITE(TestCell);
 	CPPUNIT_TEST(test01);
 	CPPUNIT_TEST(test02);
+	CPPUNIT_TEST(test03);
 	CPPUNIT_TEST_SUITE_END();
 
 	void test01();
 	void test02();
+	// copy-on-write of properties
+	void test03();
 
 };
 
@@ -0,0 +1,125 @@
+/* ============================================================================
+ * I B E X - TestChannel
+ * ============================================================================
+ * Copyright   : IMT Atlantique (FRANCE)
+ * License     : This program can be distributed under the terms of the GNU LGPL.
+ *               See the file COPYING.LESSER.
+ *
+ * Author(s)   : Gilles Chabert
+ * Created     : Oct 17, 2026
+ * ---------------------------------------------------------------------------- */
+
+#include "TestChannel.h"
+#include "ibex_Channel.h"
+#include "ibex_CovList.h"
+
+#include <thread>
+#include <sstream>
+
+#ifndef _WIN32
+#include <unistd.h>
+#endif
+
+using namespace std;
+
+namespace {
+
+string unix_address() {
+	stringstream ss;
+#ifndef _WIN32
+	ss << "unix:/tmp/ibex-test-" << getpid() << ".sock";
+#endif
+	return ss.str();
+}
+
+// the server echoes the messages until an empty one
+// (the client connects to "address")
+void echo(ChannelServer& server, const string& address) {
+	bool ok=true;
+
+	thread client([&address,&ok]() {
+		Channel channel(address);
+		string large(1000000,'x');
+		for (int i=0; i<(int) large.size(); i+=1000) large[i]=(char) i;
+
+		channel.send("hello");
+		ok &= channel.receive()=="hello";
+		channel.send(large);
+		ok &= channel.receive()==large;
+		channel.send(string("\0a\0",3));
+		ok &= channel.receive()==string("\0a\0",3);
+		channel.send("");
+	});
+
+	Channel* channel=server.accept();
+	string msg;
+	while (!(msg=channel->receive()).empty())
+		channel->send(msg);
+	delete channel;
+	client.join();
+
+	CPPUNIT_ASSERT(ok);
+}
+
+}
+
+void TestChannel::unix01() {
+	string address=unix_address();
+	ChannelServer server(address);
+	echo(server, address);
+}
+
+void TestChannel::tcp01() {
+	ChannelServer server("localhost:0"); // any free port
+	CPPUNIT_ASSERT(server.port()>0);
+
+	stringstream address;
+	address << "localhost:" << server.port();
+	echo(server, address.str());
+}
+
+void TestChannel::cov01() {
+	string address=unix_address();
+	ChannelServer server(address);
+
+	CovList cov(2);
+	double _b1[][2]={{0,1},{NEG_INFINITY,2}};
+	double _b2[][2]={{-1,-0.5},{1e-10,POS_INFINITY}};
+	cov.add(IntervalVector(2,_b1));
+	cov.add(IntervalVector(2,_b2));
+
+	thread client([&address,&cov]() {
+		Channel channel(address);
+		channel.send_cov(cov);
+	});
+
+	Channel* channel=server.accept();
+	CovList* cov2=channel->receive_cov<CovList>();
+	client.join();
+
+	CPPUNIT_ASSERT(cov2!=NULL);
+	CPPUNIT_ASSERT(cov2->n==2);
+	CPPUNIT_ASSERT(cov2->size()==2);
+	CPPUNIT_ASSERT(cov2->operator[](0)==cov[0]);
+	CPPUNIT_ASSERT(cov2->operator[](1)==cov[1]);
+	delete cov2;
+
+	delete channel;
+}
+
+void TestChannel::closed01() {
+	string address=unix_address();
+	ChannelServer server(address);
+
+	thread client([&address]() {
+		Channel channel(address);
+		channel.send("bye");
+	});
+
+	Channel* channel=server.accept();
+	client.join();
+
+	CPPUNIT_ASSERT(channel->receive()=="bye");
+	CPPUNIT_ASSERT_THROW(channel->receive(), Channel::Closed);
+	delete channel;
+}
@@ -0,0 +1,46 @@
+/* ============================================================================
+ * I B E X - TestChannel
+ * ============================================================================
+ * Copyright   : IMT Atlantique (FRANCE)
+ * License     : This program can be distributed under the terms of the GNU LGPL.
+ *               See the file COPYING.LESSER.
+ *
+ * Author(s)   : Gilles Chabert
+ * Created     : Oct 17, 2026
+ * ---------------------------------------------------------------------------- */
+
+#ifndef __TEST_CHANNEL_H__
+#define __TEST_CHANNEL_H__
+
+#include <cppunit/TestFixture.h>
+#include <cppunit/extensions/HelperMacros.h>
+#include "utils.h"
+
+using namespace ibex;
+
+class TestChannel : public CppUnit::TestFixture {
+public:
+
+	CPPUNIT_TEST_SUITE(TestChannel);
+#ifndef _WIN32
+	CPPUNIT_TEST(unix01);
+	CPPUNIT_TEST(tcp01);
+	CPPUNIT_TEST(cov01);
+	CPPUNIT_TEST(closed01);
+#endif
+	CPPUNIT_TEST_SUITE_END();
+private:
+
+	// messages (including empty and large ones) on a Unix-domain socket
+	void unix01();
+	// messages on a TCP socket
+	void tcp01();
+	// coverings
+	void cov01();
+	// connection closed by the other side
+	void closed01();
+};
+
+CPPUNIT_TEST_SUITE_REGISTRATION(TestChannel);
+
+#endif // __TEST_CHANNEL_H__
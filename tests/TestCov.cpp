@@ -1041,3 +1041,46 @@ void TestCov::write_covSolverDatafile(ScenarioType scenario) {
 
 	free(tmpname);
 }
+
+void TestCov::write_empty_covIUlistfile() {
+	char *tmpname = strdup("/tmp/tmpfileXXXXXX");
+	mkstemp(tmpname);
+
+	CovIUList cov(n);
+	cov.save(tmpname);
+
+	CovIUList cov2(tmpname);
+	CPPUNIT_ASSERT(cov2.n==n);
+	CPPUNIT_ASSERT(cov2.size()==0);
+	CPPUNIT_ASSERT(cov2.nb_inner()==0);
+	CPPUNIT_ASSERT(cov2.nb_unknown()==0);
+
+	remove(tmpname);
+	free(tmpname);
+}
+
+void TestCov::write_empty_covSolverDatafile() {
+	char *tmpname = strdup("/tmp/tmpfileXXXXXX");
+	mkstemp(tmpname);
+
+	vector<string> var_names(solver_var_names, solver_var_names+n);
+	CovSolverData cov(n, m, nb_ineq, CovManifold::HALF_BALL, var_names);
+	cov.set_solver_status(solver_status);
+	cov.set_nb_cells(solver_nb_cells);
+	cov.save(tmpname);
+
+	CovSolverData cov2(tmpname);
+	CPPUNIT_ASSERT(cov2.n==n);
+	CPPUNIT_ASSERT(cov2.nb_eq()==m);
+	CPPUNIT_ASSERT(cov2.nb_ineq()==nb_ineq);
+	CPPUNIT_ASSERT(cov2.boundary_type()==CovManifold::HALF_BALL);
+	CPPUNIT_ASSERT(cov2.size()==0);
+	CPPUNIT_ASSERT(cov2.nb_solution()==0);
+	CPPUNIT_ASSERT(cov2.nb_pending()==0);
+	CPPUNIT_ASSERT(cov2.solver_status()==solver_status);
+	CPPUNIT_ASSERT(cov2.nb_cells()==solver_nb_cells);
+	CPPUNIT_ASSERT(cov2.var_names()==var_names);
+
+	remove(tmpname);
+	free(tmpname);
+}
@@ -151,6 +151,9 @@ public:
 	CPPUNIT_TEST(read_covSolverDatafile2_scenario4);
 	CPPUNIT_TEST(write_covSolverDatafile_scenario4);
 
+	CPPUNIT_TEST(write_empty_covIUlistfile);
+	CPPUNIT_TEST(write_empty_covSolverDatafile);
+
 	CPPUNIT_TEST_SUITE_END();
 
 private:
@@ -212,6 +215,10 @@ private:
 	static void read_covSolverDatafile2(ScenarioType scenario);
 	static void write_covSolverDatafile(ScenarioType scenario);
 
+	// save and read back empty coverings
+	static void write_empty_covIUlistfile();
+	static void write_empty_covSolverDatafile();
+
 	static void covfac_scenario1()                  { covfac(INEQ_EQ_ONLY); }
 	static void read_covfile_scenario1()            { read_covfile(INEQ_EQ_ONLY); }
 	static void write_covfile_scenario1()           { write_covfile(INEQ_EQ_ONLY); }
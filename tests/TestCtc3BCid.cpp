@@ -0,0 +1,98 @@
+/* ============================================================================
+ * I B E X - TestCtc3BCid
+ * ============================================================================
+ * Copyright   : IMT Atlantique (FRANCE)
+ * License     : This program can be distributed under the terms of the GNU LGPL.
+ *               See the file COPYING.LESSER.
+ *
+ * Author(s)   : Gilles Chabert
+ * Created     : Oct 17, 2026
+ * ---------------------------------------------------------------------------- */
+
+#include "TestCtc3BCid.h"
+#include "ibex_Ctc3BCid.h"
+#include "ibex_CtcAcid.h"
+#include "ibex_CtcHC4.h"
+#include "ibex_SystemFactory.h"
+
+using namespace std;
+
+namespace ibex {
+
+namespace {
+
+System* circles() {
+	const ExprSymbol& x=ExprSymbol::new_("x");
+	const ExprSymbol& y=ExprSymbol::new_("y");
+	const ExprSymbol& z=ExprSymbol::new_("z");
+
+	SystemFactory fac;
+	fac.add_var(x);
+	fac.add_var(y);
+	fac.add_var(z);
+	fac.add_ctr(sqr(x)+sqr(y)=1);
+	fac.add_ctr(sqr(x-1)+sqr(y)=1);
+	fac.add_ctr(z=x*y+sqr(x));
+	return new System(fac);
+}
+
+}
+
+// parallel 3BCID gives the same result as sequential 3BCID
+void TestCtc3BCid::threads01() {
+	System* sys=circles();
+	CtcHC4 hc4(*sys);
+	Ctc3BCid cid(hc4,10,3);
+
+	IntervalVector box1(3,Interval(-10,10));
+	cid.contract(box1);
+	CPPUNIT_ASSERT(!box1.is_empty());
+	CPPUNIT_ASSERT(box1[0].diam()<1);
+
+	// one copy of the system per additional thread
+	System* sys2=circles();
+	System* sys3=circles();
+	CtcHC4 hc4_2(*sys2);
+	CtcHC4 hc4_3(*sys3);
+
+	Ctc3BCid pcid(hc4,10,3);
+	pcid.set_thread_ctcs(Array<Ctc>(hc4_2,hc4_3));
+
+	IntervalVector box2(3,Interval(-10,10));
+	pcid.contract(box2);
+	CPPUNIT_ASSERT(box2==box1);
+
+	// infeasible box
+	IntervalVector box3(3,Interval(2,10));
+	pcid.contract(box3);
+	CPPUNIT_ASSERT(box3.is_empty());
+
+	delete sys;
+	delete sys2;
+	delete sys3;
+}
+
+// same with ACID
+void TestCtc3BCid::threads02() {
+	System* sys=circles();
+	System* sys2=circles();
+	CtcHC4 hc4(*sys);
+	CtcHC4 hc4_2(*sys2);
+
+	CtcAcid acid(*sys,hc4);
+	CtcAcid pacid(*sys,hc4);
+	pacid.set_thread_ctcs(Array<Ctc>(hc4_2));
+
+	IntervalVector box1(3,Interval(-10,10));
+	IntervalVector box2(box1);
+	for (int i=0; i<3; i++) {
+		acid.contract(box1);
+		pacid.contract(box2);
+		CPPUNIT_ASSERT(box2==box1);
+	}
+
+	delete sys;
+	delete sys2;
+}
+
+} // namespace ibex
@@ -0,0 +1,37 @@
+/* ============================================================================
+ * I B E X - TestCtc3BCid
+ * ============================================================================
+ * Copyright   : IMT Atlantique (FRANCE)
+ * License     : This program can be distributed under the terms of the GNU LGPL.
+ *               See the file COPYING.LESSER.
+ *
+ * Author(s)   : Gilles Chabert
+ * Created     : Oct 17, 2026
+ * ---------------------------------------------------------------------------- */
+
+#ifndef __TEST_CTC_3BCID_H__
+#define __TEST_CTC_3BCID_H__
+
+#include <cppunit/TestFixture.h>
+#include <cppunit/extensions/HelperMacros.h>
+#include "utils.h"
+
+namespace ibex {
+
+class TestCtc3BCid : public CppUnit::TestFixture {
+public:
+
+	CPPUNIT_TEST_SUITE(TestCtc3BCid);
+	CPPUNIT_TEST(threads01);
+	CPPUNIT_TEST(threads02);
+	CPPUNIT_TEST_SUITE_END();
+
+	void threads01();
+	void threads02();
+};
+
+CPPUNIT_TEST_SUITE_REGISTRATION(TestCtc3BCid);
+
+} // namespace ibex
+
+#endif // __TEST_CTC_3BCID_H__
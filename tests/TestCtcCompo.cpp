@@ -0,0 +1,84 @@
+/* ============================================================================
+ * I B E X - TestCtcCompo
+ * ============================================================================
+ * Copyright   : IMT Atlantique (FRANCE)
+ * License     : This program can be distributed under the terms of the GNU LGPL.
+ *               See the file COPYING.LESSER.
+ *
+ * Author(s)   : Gilles Chabert
+ * Created     : Oct 17, 2026
+ * ---------------------------------------------------------------------------- */
+
+#include "TestCtcCompo.h"
+#include "ibex_CtcCompo.h"
+#include "ibex_CtcFwdBwd.h"
+
+using namespace std;
+
+namespace {
+
+// A contractor that does nothing (but counts its calls)
+class CtcIdle : public Ctc {
+public:
+	CtcIdle(int n) : Ctc(n), nb_calls(0) { }
+
+	void contract(IntervalVector& box) {
+		nb_calls++;
+	}
+
+	int nb_calls;
+};
+
+}
+
+void TestCtcCompo::compo01() {
+	Variable x,y;
+	Function f1(x,y,y-sqr(x));
+	Function f2(x,y,y-2*x);
+	CtcFwdBwd c1(f1);
+	CtcFwdBwd c2(f2);
+	CtcCompo compo(c1,c2);
+
+	IntervalVector box(2,Interval(1,10));
+	compo.contract(box);
+	// y<=10 => x<=sqrt(10), y=2x => y<=2*sqrt(10) ...
+	CPPUNIT_ASSERT(box[0].ub()<=::sqrt(10.0)+1e-10);
+	CPPUNIT_ASSERT(box[1].lb()>=2-1e-10);
+}
+
+// the idle contractor is skipped most of the time
+void TestCtcCompo::adaptive01() {
+	Variable x,y;
+	Function f(x,y,y-sqr(x));
+	CtcFwdBwd c1(f);
+	CtcIdle c2(2);
+	CtcCompo compo(c1,c2);
+	compo.adaptive=true;
+
+	int n=1000;
+	for (int i=0; i<n; i++) {
+		IntervalVector box(2,Interval(-10,10));
+		compo.contract(box);
+		CPPUNIT_ASSERT(box[1]==Interval(0,10));
+	}
+
+	CPPUNIT_ASSERT(c2.nb_calls < n/10);
+	CPPUNIT_ASSERT(c2.nb_calls >= n/(compo.probe_period+1)); // re-probed
+}
+
+// without adaptive mode, all the contractors are called
+void TestCtcCompo::adaptive02() {
+	Variable x,y;
+	Function f(x,y,y-sqr(x));
+	CtcFwdBwd c1(f);
+	CtcIdle c2(2);
+	CtcCompo compo(c1,c2);
+
+	int n=100;
+	for (int i=0; i<n; i++) {
+		IntervalVector box(2,Interval(-10,10));
+		compo.contract(box);
+	}
+
+	CPPUNIT_ASSERT(c2.nb_calls==n);
+}
@@ -0,0 +1,38 @@
+/* ============================================================================
+ * I B E X - TestCtcCompo
+ * ============================================================================
+ * Copyright   : IMT Atlantique (FRANCE)
+ * License     : This program can be distributed under the terms of the GNU LGPL.
+ *               See the file COPYING.LESSER.
+ *
+ * Author(s)   : Gilles Chabert
+ * Created     : Oct 17, 2026
+ * ---------------------------------------------------------------------------- */
+
+#ifndef __TEST_CTC_COMPO_H__
+#define __TEST_CTC_COMPO_H__
+
+#include <cppunit/TestFixture.h>
+#include <cppunit/extensions/HelperMacros.h>
+#include "utils.h"
+
+using namespace ibex;
+
+class TestCtcCompo : public CppUnit::TestFixture {
+public:
+
+	CPPUNIT_TEST_SUITE(TestCtcCompo);
+	CPPUNIT_TEST(compo01);
+	CPPUNIT_TEST(adaptive01);
+	CPPUNIT_TEST(adaptive02);
+	CPPUNIT_TEST_SUITE_END();
+private:
+
+	void compo01();
+	void adaptive01();
+	void adaptive02();
+};
+
+CPPUNIT_TEST_SUITE_REGISTRATION(TestCtcCompo);
+
+#endif // __TEST_CTC_COMPO_H__
@@ -14,6 +14,7 @@
 #include "ibex_Solver.h"
 #include "ibex_RoundRobin.h"
 #include "ibex_CellStack.h"
+#include "ibex_BxpQuantifCache.h"
 
 using namespace std;
 
@@ -72,4 +73,63 @@ void TestCtcExist::test01() {
 
 }
 
+void TestCtcExist::threads01() {
+
+	Variable x,y;
+	Function f(x,y,1.5*sqr(x)+1.5*sqr(y)-x*y-0.2);
+
+	NumConstraint c(f,LEQ);
+	CtcExist exist1(c,y,IntervalVector(1,Interval(-10,10)),1e-03);
+	CtcExist exist2(c,y,IntervalVector(1,Interval(-10,10)),1e-03);
+	exist2.set_nb_threads(3);
+
+	double right_bound=+0.3872983346072957;
+
+	IntervalVector box1(1,Interval(0,10));
+	IntervalVector box2(box1);
+	exist1.contract(box1);
+	exist2.contract(box2);
+
+	CPPUNIT_ASSERT(box2[0].ub()<1);
+	CPPUNIT_ASSERT(box1[0].contains(right_bound));
+	CPPUNIT_ASSERT(box2[0].contains(right_bound));
+
+	// empty result
+	box2=IntervalVector(1,Interval(1,10));
+	exist2.contract(box2);
+	CPPUNIT_ASSERT(box2.is_empty());
+}
+
+void TestCtcExist::cache01() {
+
+	Variable x,y;
+	Function f(x,y,1.5*sqr(x)+1.5*sqr(y)-x*y-0.2);
+
+	NumConstraint c(f,LEQ);
+	CtcExist exist(c,y,IntervalVector(1,Interval(-10,10)),1e-03);
+
+	// the constraint has no solution for y in [-10,-1]
+	IntervalVector box(1,Interval(0,0.45));
+	BoxProperties prop(box);
+	exist.add_property(box, prop);
+	ContractContext context(prop);
+	exist.contract(box, context);
+
+	CPPUNIT_ASSERT(!box.is_empty());
+
+	BxpQuantifCache* cache=(BxpQuantifCache*) prop[exist.cache_id];
+	CPPUNIT_ASSERT(cache);
+	CPPUNIT_ASSERT(!cache->boxes.empty());
+	CPPUNIT_ASSERT(cache->contains(IntervalVector(1,Interval(-10,-1))));
+
+	// the sub-box gives the same result with the inherited cache
+	IntervalVector box2(1,Interval(0.2,0.45));
+	IntervalVector box3(box2);
+	BoxProperties prop2(box2, prop);
+	ContractContext context2(prop2);
+	exist.contract(box2, context2);
+	exist.contract(box3);
+	CPPUNIT_ASSERT(box2==box3);
+}
+
 } // end namespace
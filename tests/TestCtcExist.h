@@ -27,12 +27,16 @@ public:
 	
 
 		CPPUNIT_TEST(test01);
+		CPPUNIT_TEST(threads01);
+		CPPUNIT_TEST(cache01);
 		//CPPUNIT_TEST(test02);
 		//CPPUNIT_TEST(test03);
 		//CPPUNIT_TEST(test04);
 	CPPUNIT_TEST_SUITE_END();
 
 	void test01();
+	void threads01();
+	void cache01();
 	//void test02();
 	//void test03();
 	//void test04();
@@ -14,6 +14,7 @@
 #include "ibex_Solver.h"
 #include "ibex_RoundRobin.h"
 #include "ibex_CellStack.h"
+#include "ibex_BxpQuantifCache.h"
 
 using namespace std;
 
@@ -78,4 +79,74 @@ void TestCtcForAll::test01() {
 	CPPUNIT_ASSERT(sol[0].contains(right_bound));
 }
 
+void TestCtcForAll::threads01() {
+
+	Variable x,y;
+	Function f(x,y,1.5*sqr(x)+1.5*sqr(y)-x*y-0.2);
+
+	NumConstraint c(f,LEQ);
+
+	IntervalVector parambox(1,Interval(-0.01,0.01));
+
+	CtcForAll forall1(c, y, parambox, 1e-03);
+	CtcForAll forall2(c, y, parambox, 1e-03);
+	forall2.set_nb_threads(3);
+
+	double right_bound=+0.3616933019201018; // the positive one such that f(x,-0.01)=0
+
+	IntervalVector box1(1,Interval(0,10));
+	IntervalVector box2(box1);
+	forall1.contract(box1);
+	forall2.contract(box2);
+
+	CPPUNIT_ASSERT(box1.is_subset(box2));
+	CPPUNIT_ASSERT(box2[0].ub()<1);
+	CPPUNIT_ASSERT(box2[0].contains(right_bound));
+
+	// empty result
+	box2=IntervalVector(1,Interval(1,10));
+	forall2.contract(box2);
+	CPPUNIT_ASSERT(box2.is_empty());
+}
+
+void TestCtcForAll::cache01() {
+
+	Variable x,y;
+	Function f(x,y,1.5*sqr(x)+1.5*sqr(y)-x*y-0.2);
+
+	NumConstraint c(f,LEQ);
+
+	IntervalVector parambox(1,Interval(-0.01,0.01));
+
+	CtcForAll forall(c, y, parambox, 1e-03);
+
+	// the constraint holds everywhere in [0,0.1]x[-0.01,0.01]
+	IntervalVector box(1,Interval(0,0.1));
+	BoxProperties prop(box);
+	forall.add_property(box, prop);
+	ContractContext context(prop);
+	forall.contract(box, context);
+
+	CPPUNIT_ASSERT(box==IntervalVector(1,Interval(0,0.1)));
+	CPPUNIT_ASSERT(context.output_flags[Ctc::INACTIVE]);
+
+	// the leaves of the paving are merged
+	BxpQuantifCache* cache=(BxpQuantifCache*) prop[forall.cache_id];
+	CPPUNIT_ASSERT(cache);
+	CPPUNIT_ASSERT(cache->boxes.size()==1);
+	CPPUNIT_ASSERT(cache->boxes[0]==parambox);
+
+	// the cache is inherited by a sub-box: nothing is re-paved
+	IntervalVector box2(1,Interval(0,0.05));
+	BoxProperties prop2(box2, prop);
+	ContractContext context2(prop2);
+	forall.contract(box2, context2);
+	CPPUNIT_ASSERT(box2==IntervalVector(1,Interval(0,0.05)));
+	CPPUNIT_ASSERT(context2.output_flags[Ctc::INACTIVE]);
+
+	// ... and forgotten if the box is inflated
+	prop2.update(BoxEvent(box2,BoxEvent::INFLATE));
+	CPPUNIT_ASSERT(((BxpQuantifCache*) prop2[forall.cache_id])->boxes.empty());
+}
+
 } // end namespace
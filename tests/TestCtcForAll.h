@@ -26,9 +26,13 @@ public:
 	
 
 		CPPUNIT_TEST(test01);
+		CPPUNIT_TEST(threads01);
+		CPPUNIT_TEST(cache01);
 	CPPUNIT_TEST_SUITE_END();
 
 	void test01();
+	void threads01();
+	void cache01();
 };
 
 CPPUNIT_TEST_SUITE_REGISTRATION(TestCtcForAll);
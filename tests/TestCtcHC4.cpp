@@ -12,6 +12,8 @@
 #include "Ponts30.h"
 #include "ibex_CtcFwdBwd.h"
 #include "ibex_CtcHC4.h"
+#include "ibex_CtcCompo.h"
+#include "ibex_CtcFixPoint.h"
 #include "ibex_Array.h"
 
 namespace ibex {
@@ -55,4 +57,76 @@ void TestCtcHC4::ponts30() {
 	}
 }
 
+void TestCtcHC4::priority01() {
+	Ponts30 p30;
+	NumConstraint* ctr[30];
+	for (int i=0; i<30; i++)
+		ctr[i]=new NumConstraint(dynamic_cast<Function&>((*p30.f)[i]),EQ);
+
+	Array<NumConstraint> a(ctr,30);
+	// with a small ratio, the order does not matter
+	CtcHC4 hc4(a,1e-4);
+	CtcHC4 hc4_prio(a,1e-4);
+	hc4_prio.priority=true;
+
+	// twice, to use the scores of the first call
+	for (int k=0; k<2; k++) {
+		IntervalVector box=p30.init_box;
+		IntervalVector box_prio=p30.init_box;
+		hc4.contract(box);
+		hc4_prio.contract(box_prio);
+		CPPUNIT_ASSERT(almost_eq(box, box_prio, 1e-04));
+	}
+
+	for (int i=0; i<30; i++)
+		delete ctr[i];
+}
+
+void TestCtcHC4::cutoff01() {
+	// the domains converge slowly towards (0,0)
+	NumConstraint c1("x","y","x-y=0");
+	NumConstraint c2("x","y","x-2*y=0");
+	Array<NumConstraint> a(c1,c2);
+
+	CtcHC4 hc4(a,1e-3);
+	CtcHC4 hc4_cut(a,1e-3);
+	hc4_cut.priority=true;
+	// any reduction is below the cut-off once a contractor has reduced the box
+	hc4_cut.cutoff=1e300;
+
+	IntervalVector box(2,Interval(0,10));
+	IntervalVector box_cut(box);
+	hc4.contract(box);
+	hc4_cut.contract(box_cut);
+
+	// the propagation stops early...
+	CPPUNIT_ASSERT(box_cut.max_diam()>2*box.max_diam());
+	// ...with a sound box
+	CPPUNIT_ASSERT(box.is_subset(box_cut));
+	CPPUNIT_ASSERT(box_cut.is_strict_subset(IntervalVector(2,Interval(0,10))));
+}
+
+void TestCtcHC4::cutoff02() {
+	NumConstraint c1("x","y","x-y=0");
+	NumConstraint c2("x","y","x-2*y=0");
+	CtcFwdBwd fb1(c1);
+	CtcFwdBwd fb2(c2);
+	CtcCompo compo(fb1,fb2);
+
+	CtcFixPoint fp(compo,1e-3);
+	CtcFixPoint fp_cut(compo,1e-3);
+	// the iteration stops after the second one
+	fp_cut.cutoff=1e300;
+
+	IntervalVector box(2,Interval(0,10));
+	IntervalVector box_cut(box);
+	fp.contract(box);
+	fp_cut.contract(box_cut);
+
+	CPPUNIT_ASSERT(box_cut.max_diam()>2*box.max_diam());
+	CPPUNIT_ASSERT(box.is_subset(box_cut));
+	// at least one iteration
+	CPPUNIT_ASSERT(box_cut.is_strict_subset(IntervalVector(2,Interval(0,10))));
+}
+
 } // end namespace ibex
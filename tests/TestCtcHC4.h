@@ -23,9 +23,15 @@ public:
 	CPPUNIT_TEST_SUITE(TestCtcHC4);
 	
 		CPPUNIT_TEST(ponts30);
+		CPPUNIT_TEST(priority01);
+		CPPUNIT_TEST(cutoff01);
+		CPPUNIT_TEST(cutoff02);
 	CPPUNIT_TEST_SUITE_END();
 
 	void ponts30();
+	void priority01();
+	void cutoff01();
+	void cutoff02();
 };
 
 CPPUNIT_TEST_SUITE_REGISTRATION(TestCtcHC4);
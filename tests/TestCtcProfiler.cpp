@@ -0,0 +1,102 @@
+/* ============================================================================
+ * I B E X - TestCtcProfiler
+ * ============================================================================
+ * Copyright   : IMT Atlantique (FRANCE)
+ * License     : This program can be distributed under the terms of the GNU LGPL.
+ *               See the file COPYING.LESSER.
+ *
+ * Author(s)   : Gilles Chabert
+ * Created     : Oct 17, 2026
+ * ---------------------------------------------------------------------------- */
+
+#include "TestCtcProfiler.h"
+#include "ibex_CtcProfiler.h"
+#include "ibex_CtcFwdBwd.h"
+#include "ibex_CtcCompo.h"
+#include "ibex_CtcFixPoint.h"
+
+using namespace std;
+
+// y=x^2 and y=2x: one call of the fixpoint, several calls of the sub-contractors
+void TestCtcProfiler::compo01() {
+	Variable x,y;
+	Function f1(x,y,y-sqr(x));
+	Function f2(x,y,y-2*x);
+	CtcFwdBwd c1(f1);
+	CtcFwdBwd c2(f2);
+	CtcCompo compo(c1,c2);
+	CtcFixPoint fp(compo);
+
+	IntervalVector box(2,Interval(1,10));
+	ContractContext context(box);
+	CtcProfiler profiler;
+	context.profiler=&profiler;
+
+	CtcProfiler::contract(fp, box, context);
+
+	CPPUNIT_ASSERT(almost_eq(box[0],Interval(2,2),1e-8));
+	CPPUNIT_ASSERT(profiler.size()==4);
+
+	const CtcProfiler::Entry* e_fp=profiler[fp];
+	const CtcProfiler::Entry* e_compo=profiler[compo];
+	const CtcProfiler::Entry* e1=profiler[c1];
+	const CtcProfiler::Entry* e2=profiler[c2];
+
+	CPPUNIT_ASSERT(e_fp && e_compo && e1 && e2);
+	CPPUNIT_ASSERT(e_fp->nb_calls==1);
+	CPPUNIT_ASSERT(e_fp->depth==0);
+	CPPUNIT_ASSERT(e_compo->depth==1);
+	CPPUNIT_ASSERT(e1->depth==2);
+	// the first call of a contractor starts before the ones of its sub-contractors
+	CPPUNIT_ASSERT(e_fp->first_call<e_compo->first_call);
+	CPPUNIT_ASSERT(e_compo->first_call<e1->first_call);
+	CPPUNIT_ASSERT(e1->first_call<e2->first_call);
+	CPPUNIT_ASSERT(e_compo->nb_calls>1);
+	CPPUNIT_ASSERT(e1->nb_calls==e_compo->nb_calls);
+	CPPUNIT_ASSERT(e2->nb_calls==e_compo->nb_calls);
+	CPPUNIT_ASSERT(e_fp->nb_empty==0);
+
+	// the fixpoint reduction is the sum of the reductions of the calls of compo
+	CPPUNIT_ASSERT(e_fp->log_vol_reduction>0);
+	CPPUNIT_ASSERT(almost_eq(Interval(e_fp->log_vol_reduction),Interval(e_compo->log_vol_reduction),1e-8));
+	CPPUNIT_ASSERT(e_fp->time>=e_compo->time);
+	CPPUNIT_ASSERT(profiler[compo]->name=="CtcCompo");
+
+	profiler.clear();
+	CPPUNIT_ASSERT(profiler.size()==0);
+	CPPUNIT_ASSERT(!profiler[fp]);
+}
+
+void TestCtcProfiler::empty01() {
+	Variable x,y;
+	Function f1(x,y,y-sqr(x)-1);
+	Function f2(x,y,y+sqr(x));
+	CtcFwdBwd c1(f1);
+	CtcFwdBwd c2(f2);
+	CtcCompo compo(c1,c2);
+
+	IntervalVector box(2,Interval(-10,10));
+	ContractContext context(box);
+	CtcProfiler profiler;
+	context.profiler=&profiler;
+
+	CtcProfiler::contract(compo, box, context);
+
+	CPPUNIT_ASSERT(box.is_empty());
+	CPPUNIT_ASSERT(profiler[compo]->nb_empty==1);
+	CPPUNIT_ASSERT(profiler[c1]->nb_empty==0);
+	CPPUNIT_ASSERT(profiler[c2]->nb_empty==1);
+}
+
+void TestCtcProfiler::disabled01() {
+	Variable x,y;
+	Function f1(x,y,y-sqr(x));
+	CtcFwdBwd c1(f1);
+
+	IntervalVector box(2,Interval(1,10));
+	ContractContext context(box);
+	CtcProfiler::contract(c1, box, context);
+
+	CPPUNIT_ASSERT(box[0].ub()<10);
+	CPPUNIT_ASSERT(!context.profiler);
+}
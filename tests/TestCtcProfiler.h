@@ -0,0 +1,38 @@
+/* ============================================================================
+ * I B E X - TestCtcProfiler
+ * ============================================================================
+ * Copyright   : IMT Atlantique (FRANCE)
+ * License     : This program can be distributed under the terms of the GNU LGPL.
+ *               See the file COPYING.LESSER.
+ *
+ * Author(s)   : Gilles Chabert
+ * Created     : Oct 17, 2026
+ * ---------------------------------------------------------------------------- */
+
+#ifndef __TEST_CTC_PROFILER_H__
+#define __TEST_CTC_PROFILER_H__
+
+#include <cppunit/TestFixture.h>
+#include <cppunit/extensions/HelperMacros.h>
+#include "utils.h"
+
+using namespace ibex;
+
+class TestCtcProfiler : public CppUnit::TestFixture {
+public:
+
+	CPPUNIT_TEST_SUITE(TestCtcProfiler);
+	CPPUNIT_TEST(compo01);
+	CPPUNIT_TEST(empty01);
+	CPPUNIT_TEST(disabled01);
+	CPPUNIT_TEST_SUITE_END();
+private:
+
+	void compo01();
+	void empty01();
+	void disabled01();
+};
+
+CPPUNIT_TEST_SUITE_REGISTRATION(TestCtcProfiler);
+
+#endif // __TEST_CTC_PROFILER_H__
@@ -0,0 +1,127 @@
+/* ============================================================================
+ * I B E X - TestCtcUnion
+ * ============================================================================
+ * Copyright   : IMT Atlantique (FRANCE)
+ * License     : This program can be distributed under the terms of the GNU LGPL.
+ *               See the file COPYING.LESSER.
+ *
+ * Author(s)   : Gilles Chabert
+ * Created     : Oct 17, 2026
+ * ---------------------------------------------------------------------------- */
+
+#include "TestCtcUnion.h"
+#include "ibex_CtcUnion.h"
+#include "ibex_CtcFwdBwd.h"
+#include "ibex_CtcIdentity.h"
+
+using namespace std;
+
+namespace {
+
+// A contractor that does nothing (but counts its calls)
+class CtcIdle : public Ctc {
+public:
+	CtcIdle(int n) : Ctc(n), nb_calls(0) { }
+
+	void contract(IntervalVector& box) {
+		nb_calls++;
+	}
+
+	int nb_calls;
+};
+
+// Contractors for the disks of radius 1 centered on (i,i), i=0..n-1
+class Disks {
+public:
+	Disks(int n) : f(n), c(n) {
+		for (int i=0; i<n; i++) {
+			Variable x,y;
+			f.set_ref(i, *new Function(x,y,sqr(x-i)+sqr(y-i)-1));
+			c.set_ref(i, *new CtcFwdBwd(f[i],LEQ));
+		}
+	}
+
+	~Disks() {
+		for (int i=0; i<f.size(); i++) {
+			delete &c[i];
+			delete &f[i];
+		}
+	}
+
+	Array<Function> f;
+	Array<Ctc> c;
+};
+
+}
+
+void TestCtcUnion::union01() {
+	Disks d(2);
+	CtcUnion u(d.c);
+	IntervalVector box(2,Interval(-10,10));
+	u.contract(box);
+	CPPUNIT_ASSERT(almost_eq(box[0],Interval(-1,2),1e-10));
+	CPPUNIT_ASSERT(almost_eq(box[1],Interval(-1,2),1e-10));
+}
+
+// the other branches are not called once the hull is the initial box
+void TestCtcUnion::early_stop01() {
+	CtcIdentity id(2);
+	CtcIdle idle(2);
+	CtcUnion u(id,idle);
+	IntervalVector box(2,Interval(-10,10));
+	u.contract(box);
+	CPPUNIT_ASSERT(box==IntervalVector(2,Interval(-10,10)));
+	CPPUNIT_ASSERT(idle.nb_calls==0);
+}
+
+// same result with several threads
+void TestCtcUnion::threads01() {
+	int n=50;
+	Disks d(n);
+	CtcUnion u1(d.c);
+	CtcUnion u2(d.c);
+	u2.set_nb_threads(4);
+
+	double _box[][2] = { {-2,70}, {5.5,70} };
+	IntervalVector box1(2,_box);
+	IntervalVector box2(2,_box);
+	u1.contract(box1);
+	u2.contract(box2);
+	CPPUNIT_ASSERT(box1==box2);
+	CPPUNIT_ASSERT(almost_eq(box1[1],Interval(5.5,n),1e-10));
+
+	// empty result
+	double _box3[][2] = { {-2,-1.5}, {5.5,70} };
+	IntervalVector box3(2,_box3);
+	u2.contract(box3);
+	CPPUNIT_ASSERT(box3.is_empty());
+}
+
+// inactive flag and early stop with several threads
+void TestCtcUnion::threads02() {
+	// a constraint satisfied by the whole box: the branch raises INACTIVE
+	Variable x,y;
+	Function f(x,y,-sqr(x)-sqr(y)-1);
+	CtcFwdBwd inactive(f,LEQ);
+
+	Array<Ctc> list(10);
+	Disks d(9);
+	for (int i=0; i<9; i++) list.set_ref(i<5? i : i+1,d.c[i]);
+	list.set_ref(5,inactive);
+	CtcUnion u(list);
+	u.set_nb_threads(3);
+
+	IntervalVector box(2,Interval(-10,10));
+	ContractContext context(box);
+	u.contract(box,context);
+	CPPUNIT_ASSERT(box==IntervalVector(2,Interval(-10,10)));
+	CPPUNIT_ASSERT(context.output_flags[Ctc::INACTIVE]);
+
+	// no inactive branch
+	CtcUnion u2(d.c);
+	u2.set_nb_threads(3);
+	ContractContext context2(box);
+	u2.contract(box,context2);
+	CPPUNIT_ASSERT(!context2.output_flags[Ctc::INACTIVE]);
+	CPPUNIT_ASSERT(box.is_strict_subset(IntervalVector(2,Interval(-10,10))));
+}
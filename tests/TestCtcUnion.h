@@ -0,0 +1,40 @@
+/* ============================================================================
+ * I B E X - TestCtcUnion
+ * ============================================================================
+ * Copyright   : IMT Atlantique (FRANCE)
+ * License     : This program can be distributed under the terms of the GNU LGPL.
+ *               See the file COPYING.LESSER.
+ *
+ * Author(s)   : Gilles Chabert
+ * Created     : Oct 17, 2026
+ * ---------------------------------------------------------------------------- */
+
+#ifndef __TEST_CTC_UNION_H__
+#define __TEST_CTC_UNION_H__
+
+#include <cppunit/TestFixture.h>
+#include <cppunit/extensions/HelperMacros.h>
+#include "utils.h"
+
+using namespace ibex;
+
+class TestCtcUnion : public CppUnit::TestFixture {
+public:
+
+	CPPUNIT_TEST_SUITE(TestCtcUnion);
+	CPPUNIT_TEST(union01);
+	CPPUNIT_TEST(early_stop01);
+	CPPUNIT_TEST(threads01);
+	CPPUNIT_TEST(threads02);
+	CPPUNIT_TEST_SUITE_END();
+private:
+
+	void union01();
+	void early_stop01();
+	void threads01();
+	void threads02();
+};
+
+CPPUNIT_TEST_SUITE_REGISTRATION(TestCtcUnion);
+
+#endif // __TEST_CTC_UNION_H__
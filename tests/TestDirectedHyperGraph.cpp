@@ -0,0 +1,73 @@
+/* ============================================================================
+ * I B E X - TestDirectedHyperGraph
+ * ============================================================================
+ * Copyright   : IMT Atlantique (FRANCE)
+ * License     : This program can be distributed under the terms of the GNU LGPL.
+ *               See the file COPYING.LESSER.
+ *
+ * Author(s)   : Gilles Chabert
+ * Created     : Oct 17, 2026
+ * ---------------------------------------------------------------------------- */
+
+#include "TestDirectedHyperGraph.h"
+#include "ibex_DirectedHyperGraph.h"
+
+using namespace std;
+
+namespace {
+
+bool same(const int* a, int n, const int* b, int m) {
+	if (n!=m) return false;
+	for (int i=0; i<n; i++)
+		if (a[i]!=b[i]) return false;
+	return true;
+}
+
+}
+
+void TestDirectedHyperGraph::build01() {
+	// c0: x0,x2 -> x2 ; c1: x1 -> x0,x1
+	vector<pair<int,int> > in, out;
+	in.push_back(make_pair(0,2));
+	in.push_back(make_pair(0,0));
+	in.push_back(make_pair(1,1));
+	out.push_back(make_pair(1,1));
+	out.push_back(make_pair(0,2));
+	out.push_back(make_pair(1,0));
+
+	DirectedHyperGraph g(2,3,in,out);
+	CPPUNIT_ASSERT(g.nb_ctr()==2);
+	CPPUNIT_ASSERT(g.nb_var()==3);
+
+	int c0_in[]={0,2}, c0_out[]={2}, c1_in[]={1}, c1_out[]={0,1};
+	CPPUNIT_ASSERT(same(g.input_vars(0),g.nb_input_vars(0),c0_in,2));
+	CPPUNIT_ASSERT(same(g.output_vars(0),g.nb_output_vars(0),c0_out,1));
+	CPPUNIT_ASSERT(same(g.input_vars(1),g.nb_input_vars(1),c1_in,1));
+	CPPUNIT_ASSERT(same(g.output_vars(1),g.nb_output_vars(1),c1_out,2));
+
+	int x0_in[]={1}, x0_out[]={0}, x1_in[]={1}, x1_out[]={1}, x2_in[]={0}, x2_out[]={0};
+	CPPUNIT_ASSERT(same(g.input_ctrs(0),g.nb_input_ctrs(0),x0_in,1));
+	CPPUNIT_ASSERT(same(g.output_ctrs(0),g.nb_output_ctrs(0),x0_out,1));
+	CPPUNIT_ASSERT(same(g.input_ctrs(1),g.nb_input_ctrs(1),x1_in,1));
+	CPPUNIT_ASSERT(same(g.output_ctrs(1),g.nb_output_ctrs(1),x1_out,1));
+	CPPUNIT_ASSERT(same(g.input_ctrs(2),g.nb_input_ctrs(2),x2_in,1));
+	CPPUNIT_ASSERT(same(g.output_ctrs(2),g.nb_output_ctrs(2),x2_out,1));
+}
+
+void TestDirectedHyperGraph::build02() {
+	// duplicated arcs and isolated nodes
+	vector<pair<int,int> > in, out;
+	in.push_back(make_pair(2,1));
+	in.push_back(make_pair(2,1));
+	in.push_back(make_pair(0,1));
+
+	DirectedHyperGraph g(3,4,in,out);
+
+	int x1_out[]={0,2};
+	CPPUNIT_ASSERT(same(g.output_ctrs(1),g.nb_output_ctrs(1),x1_out,2));
+	CPPUNIT_ASSERT(g.nb_input_vars(1)==0);
+	CPPUNIT_ASSERT(g.nb_input_vars(2)==1);
+	CPPUNIT_ASSERT(g.nb_output_ctrs(3)==0);
+	for (int c=0; c<3; c++)
+		CPPUNIT_ASSERT(g.nb_output_vars(c)==0);
+}
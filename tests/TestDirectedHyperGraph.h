@@ -0,0 +1,36 @@
+/* ============================================================================
+ * I B E X - TestDirectedHyperGraph
+ * ============================================================================
+ * Copyright   : IMT Atlantique (FRANCE)
+ * License     : This program can be distributed under the terms of the GNU LGPL.
+ *               See the file COPYING.LESSER.
+ *
+ * Author(s)   : Gilles Chabert
+ * Created     : Oct 17, 2026
+ * ---------------------------------------------------------------------------- */
+
+#ifndef __TEST_DIRECTED_HYPER_GRAPH_H__
+#define __TEST_DIRECTED_HYPER_GRAPH_H__
+
+#include <cppunit/TestFixture.h>
+#include <cppunit/extensions/HelperMacros.h>
+#include "utils.h"
+
+using namespace ibex;
+
+class TestDirectedHyperGraph : public CppUnit::TestFixture {
+public:
+
+	CPPUNIT_TEST_SUITE(TestDirectedHyperGraph);
+	CPPUNIT_TEST(build01);
+	CPPUNIT_TEST(build02);
+	CPPUNIT_TEST_SUITE_END();
+private:
+
+	void build01();
+	void build02();
+};
+
+CPPUNIT_TEST_SUITE_REGISTRATION(TestDirectedHyperGraph);
+
+#endif // __TEST_DIRECTED_HYPER_GRAPH_H__
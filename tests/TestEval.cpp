@@ -270,4 +270,170 @@ void TestEval::eval_components02() {
 	CPPUNIT_ASSERT(res[3]==19);
 }
 
+void TestEval::eval_batch01() {
+	Function f("x","y","sqrt(x)*y+cos(x-y)^2");
+
+	IntervalVector boxes[4];
+	IntervalVector out[4];
+	double _b[4][2][2]={{{0,1},{2,3}}, {{1,2},{-1,1}}, {{-2,-1},{0,1}}, {{-1,1},{4,4}}};
+
+	for (int k=0; k<4; k++) {
+		boxes[k]=IntervalVector(2,_b[k]);
+		out[k].resize(1);
+	}
+
+	f.eval_batch(boxes,4,out);
+
+	CPPUNIT_ASSERT(out[0][0]==f.eval(boxes[0]));
+	CPPUNIT_ASSERT(out[1][0]==f.eval(boxes[1]));
+	CPPUNIT_ASSERT(out[2].is_empty()); // outside definition domain
+	CPPUNIT_ASSERT(out[3][0]==f.eval(boxes[3]));
+}
+
+void TestEval::eval_batch02() {
+	const ExprSymbol& x = ExprSymbol::new_("x");
+	const ExprSymbol& y = ExprSymbol::new_("y");
+	const ExprSymbol& z = ExprSymbol::new_("z");
+	const ExprNode& e1=x+3*y;
+	const ExprNode& e2=y-2*x;
+	Function f(x,y,z,Return(e1*e2+1,exp(e2)+z,-e1));
+
+	IntervalVector boxes[3];
+	IntervalVector out[3];
+
+	for (int k=0; k<3; k++) {
+		boxes[k]=IntervalVector(3,Interval(k,k+1));
+		out[k].resize(3);
+	}
+
+	f.eval_batch(boxes,3,out);
+
+	for (int k=0; k<3; k++)
+		CPPUNIT_ASSERT(out[k]==f.eval_vector(boxes[k]));
+}
+
+void TestEval::eval_batch03() {
+	// not vectorizable -> fallback to the basic evaluator
+	Function f("x[2]","y","(x(1)*y;x(2)+y)");
+
+	IntervalVector boxes[2];
+	IntervalVector out[2];
+
+	for (int k=0; k<2; k++) {
+		boxes[k]=IntervalVector(3,Interval(k,k+1));
+		out[k].resize(2);
+	}
+
+	f.eval_batch(boxes,2,out);
+
+	for (int k=0; k<2; k++)
+		CPPUNIT_ASSERT(out[k]==f.eval_vector(boxes[k]));
+}
+
+void TestEval::eval_batch04() {
+	// empty results of operators other than sqrt, log, etc.
+	Function f("x","y","x/y+atan(y)");
+
+	IntervalVector boxes[3];
+	IntervalVector out[3];
+	double _b[3][2][2]={{{1,2},{1,2}}, {{1,2},{0,0}}, {{1,2},{3,4}}};
+
+	for (int k=0; k<3; k++) {
+		boxes[k]=IntervalVector(2,_b[k]);
+		out[k].resize(1);
+	}
+
+	f.eval_batch(boxes,3,out);
+
+	CPPUNIT_ASSERT(out[0][0]==f.eval(boxes[0]));
+	CPPUNIT_ASSERT(f.eval(boxes[1]).is_empty());
+	CPPUNIT_ASSERT(out[1].is_empty());
+	CPPUNIT_ASSERT(out[2][0]==f.eval(boxes[2]));
+}
+
+void TestEval::incremental01() {
+	const char* expr="sin(x(1))*y+x(2)^2-exp(x(3)+ln(x(4)))";
+	Function f("x[4]","y",expr);
+	Function g("x[4]","y",expr);
+	f.basic_evaluator().set_incremental(true);
+
+	IntervalVector box(5,Interval(1,2));
+	CPPUNIT_ASSERT(f.eval(box)==g.eval(box));
+
+	// one variable
+	box[0]=Interval(1,1.5);
+	CPPUNIT_ASSERT(f.eval(box)==g.eval(box));
+
+	// same box
+	CPPUNIT_ASSERT(f.eval(box)==g.eval(box));
+
+	// the node domains are contracted by the backward phase
+	IntervalVector x(box);
+	f.backward(Interval(-10,-5),x);
+	g.backward(Interval(-10,-5),box);
+	CPPUNIT_ASSERT(x==box);
+	Interval y=f.basic_evaluator().d.top->i();
+	box[4]=Interval(0,1);
+	CPPUNIT_ASSERT(f.eval(box)==g.eval(box));
+	// the incremental evaluation has its own node domains
+	CPPUNIT_ASSERT(f.basic_evaluator().d.top->i()==y);
+
+	// outside the definition domain
+	box[3]=Interval(-2,-1);
+	CPPUNIT_ASSERT(f.eval(box).is_empty());
+	box[3]=Interval(1,2);
+	CPPUNIT_ASSERT(f.eval(box)==g.eval(box));
+
+	// scalar function evaluated by components
+	box[1]=Interval(0,1);
+	CPPUNIT_ASSERT(f.eval_vector(box,BitSet::all(1))==g.eval_vector(box,BitSet::all(1)));
+}
+
+void TestEval::incremental02() {
+	// matrix symbol and vector-valued function
+	const char* expr="(A(1,1)*x(1)+A(1,2)*x(2);A(2,1)*x(1)+A(2,2)*x(2);A(2)*x)";
+	Function f("A[2][2]","x[2]",expr);
+	Function g("A[2][2]","x[2]",expr);
+	f.basic_evaluator().set_incremental(true);
+
+	IntervalVector box(6,Interval(-1,2));
+	CPPUNIT_ASSERT(f.eval_vector(box)==g.eval_vector(box));
+
+	for (int i=0; i<6; i++) {
+		box[i]=Interval(i,i+1);
+		CPPUNIT_ASSERT(f.eval_vector(box)==g.eval_vector(box));
+	}
+
+	BitSet components=BitSet::empty(3);
+	components.add(0);
+	components.add(2);
+	box[0]=Interval(-1,0);
+	CPPUNIT_ASSERT(f.eval_vector(box,components)==g.eval_vector(box,components));
+
+	f.basic_evaluator().set_incremental(false);
+	CPPUNIT_ASSERT(f.eval_vector(box)==g.eval_vector(box));
+}
+
+void TestEval::domain_copy01() {
+	// scalar, vector and matrix nodes, with references (x(1), A(1)) and copies (A(:,2))
+	Function f("A[2][2]","x[2]","A(1)*x+A(:,2)'*x+x(1)*x'*A*x");
+	IntervalVector box(6);
+	for (int i=0; i<6; i++) box[i]=Interval(i,i+1);
+	f.eval(box);
+
+	ExprDomain& d=f.basic_evaluator().d;
+	ExprDomain d2(d);
+	for (int i=0; i<f.nb_nodes(); i++)
+		CPPUNIT_ASSERT(d2[i]==d[i]);
+
+	// the copy is independent
+	for (int i=0; i<f.nb_nodes(); i++)
+		d2[i].set_empty();
+	CPPUNIT_ASSERT(!d.top->is_empty());
+
+	d2=d;
+	for (int i=0; i<f.nb_nodes(); i++)
+		CPPUNIT_ASSERT(d2[i]==d[i]);
+}
+
 }
@@ -35,6 +35,13 @@ public:
 	CPPUNIT_TEST(issue242);
 	CPPUNIT_TEST(eval_components01);
 	CPPUNIT_TEST(eval_components02);
+	CPPUNIT_TEST(eval_batch01);
+	CPPUNIT_TEST(eval_batch02);
+	CPPUNIT_TEST(eval_batch03);
+	CPPUNIT_TEST(eval_batch04);
+	CPPUNIT_TEST(incremental01);
+	CPPUNIT_TEST(incremental02);
+	CPPUNIT_TEST(domain_copy01);
 
 	CPPUNIT_TEST_SUITE_END();
 
@@ -52,6 +59,15 @@ public:
 	void eval_components01();
 	void eval_components02();
 
+	void eval_batch01();
+	void eval_batch02();
+	void eval_batch03();
+	void eval_batch04();
+
+	void incremental01();
+	void incremental02();
+	void domain_copy01();
+
 private:
 	void check_deco(Function& f, const ExprNode& e);
 };
@@ -14,8 +14,17 @@
 #include "ibex_NumConstraint.h"
 #include "ibex_Expr.h"
 #include "ibex_SyntaxError.h"
+#include "ibex_Expr2Cpp.h"
+#include "ibex_ThreadPool.h"
 #include <sstream>
 #include <cstdio>
+#include <cstdlib>
+
+#ifndef _WIN32
+#include <unistd.h>
+#include <sys/stat.h>
+#include <dirent.h>
+#endif
 
 // fmemopen doesn't exist on no POSIX system
 // The function is defined here
@@ -32,6 +41,54 @@ using namespace std;
 
 namespace ibex {
 
+#ifndef _WIN32
+namespace {
+
+/*
+ * Temporary cache directory for native functions, used
+ * in place of the real one (see IBEX_NATIVE_CACHE).
+ * The directory and its files are removed at the end.
+ */
+class TmpNativeCache {
+public:
+	TmpNativeCache(const char* name) {
+		std::stringstream s;
+		s << "/tmp/ibex-test-" << name << "-" << getpid();
+		dir=s.str();
+		mkdir(dir.c_str(), 0700);
+
+		const char* old=getenv("IBEX_NATIVE_CACHE");
+		has_old=(old!=NULL);
+		if (old) old_value=old;
+		setenv("IBEX_NATIVE_CACHE", dir.c_str(), 1);
+	}
+
+	~TmpNativeCache() {
+		if (has_old) setenv("IBEX_NATIVE_CACHE", old_value.c_str(), 1);
+		else unsetenv("IBEX_NATIVE_CACHE");
+
+		// the directory only contains regular files
+		DIR* d=opendir(dir.c_str());
+		if (d) {
+			struct dirent* e;
+			while ((e=readdir(d))!=NULL) {
+				std::string file=e->d_name;
+				if (file!="." && file!="..")
+					unlink((dir+"/"+file).c_str());
+			}
+			closedir(d);
+		}
+		rmdir(dir.c_str());
+	}
+
+	std::string dir;
+	bool has_old;
+	std::string old_value;
+};
+
+} // end anonymous namespace
+#endif
+
 void TestFunction::setUp() {
 	  symbol_01     = new Function("x","x");
 	  symbol_02     = new Function("x","y", "x");
@@ -552,4 +609,179 @@ void TestFunction::issue43_bis() {
 	Function g(x,y,f(x,y));
 }
 
+void TestFunction::context01() {
+	Variable x("x"),y("y");
+	Function f(x,y,x*y+sin(x));
+
+	IntervalVector box1(2,Interval(1,2));
+	IntervalVector box2(2,Interval(-3,-2));
+
+	EvalContext c1(f);
+	EvalContext c2(f);
+
+	Interval r1=f.eval(box1,c1);
+	Interval r2=f.eval(box2,c2);
+	CPPUNIT_ASSERT(r1==f.eval(box1));
+	CPPUNIT_ASSERT(r2==f.eval(box2));
+
+	// the domains of c1 are not overwritten by c2 or the default context
+	CPPUNIT_ASSERT(c1.eval.d.top->i()==r1);
+
+	IntervalVector g1(2), g2(2);
+	f.gradient(box1,g1,c1);
+	f.gradient(box2,g2,c2);
+	CPPUNIT_ASSERT(g1==f.gradient(box1));
+	CPPUNIT_ASSERT(g2==f.gradient(box2));
+
+	IntervalVector x1(box1);
+	IntervalVector x2(box1);
+	CPPUNIT_ASSERT(f.backward(Interval(2,3),x1,c1)==f.backward(Interval(2,3),x2));
+	CPPUNIT_ASSERT(x1==x2);
+}
+
+void TestFunction::context02() {
+	Variable x(2,"x");
+	// not a vector of expressions: components are used
+	Function f(x,sqr(x[0])*x);
+
+	IntervalVector box(2,Interval(1,2));
+
+	EvalContext c(f);
+	CPPUNIT_ASSERT(f.eval_vector(box,c)==f.eval_vector(box));
+
+	IntervalMatrix J(2,2);
+	f.jacobian(box,J,c);
+	CPPUNIT_ASSERT(J==f.jacobian(box));
+}
+
+void TestFunction::context03() {
+	Variable x("x"),y("y");
+	Function f(x,y,Return(x*y,x+y));
+	Variable z("z");
+	Function g(z,f(z,sqr(z))[0]+f(z,z)[1]);
+
+	IntervalVector box(1,Interval(1,2));
+
+	EvalContext c1(g);
+	EvalContext c2(g);
+
+	CPPUNIT_ASSERT(g.eval(box,c1)==g.eval(box));
+	CPPUNIT_ASSERT(g.eval(-box,c2)==g.eval(-box));
+
+	IntervalVector g1(1);
+	g.gradient(box,g1,c1);
+	CPPUNIT_ASSERT(g1==g.gradient(box));
+
+	IntervalVector x1(box);
+	IntervalVector x2(box);
+	g.backward(Interval(3,4),x1,c2);
+	g.backward(Interval(3,4),x2);
+	CPPUNIT_ASSERT(x1==x2);
+}
+
+void TestFunction::context04() {
+	Variable x("x"),y("y");
+	Function f(x,y,Return(x*y+sin(x),sqr(x)-exp(y)));
+	Variable z("z");
+	Function g(z,f(z,sqr(z))[0]*f(z,z)[1]);
+
+	const int nb_boxes=200;
+	vector<IntervalVector> boxes;
+	for (int k=0; k<nb_boxes; k++)
+		boxes.push_back(IntervalVector(1,Interval(-2+0.02*k,-1.9+0.03*k)));
+
+	ThreadPool pool(4);
+	vector<EvalContext*> contexts;
+	for (int t=0; t<pool.size(); t++)
+		contexts.push_back(new EvalContext(g));
+
+	vector<Interval> r(nb_boxes);
+	vector<IntervalVector> grad(nb_boxes, IntervalVector(1));
+	vector<IntervalVector> proj(boxes);
+
+	pool.run(nb_boxes, [&](int k, int t) {
+		EvalContext& c=*contexts[t];
+		r[k]=g.eval(boxes[k],c);
+		g.gradient(boxes[k],grad[k],c);
+		g.backward(Interval(-1,1),proj[k],c);
+	});
+
+	for (int k=0; k<nb_boxes; k++) {
+		CPPUNIT_ASSERT(r[k]==g.eval(boxes[k]));
+		CPPUNIT_ASSERT(grad[k]==g.gradient(boxes[k]));
+		IntervalVector x2(boxes[k]);
+		g.backward(Interval(-1,1),x2);
+		CPPUNIT_ASSERT(proj[k]==x2);
+	}
+
+	for (int t=0; t<pool.size(); t++)
+		delete contexts[t];
+}
+
+void TestFunction::native01() {
+	Variable x("x"),y("y");
+
+	std::stringstream code;
+	CPPUNIT_ASSERT(Expr2Cpp().print(code,Array<const ExprSymbol>(x,y),sqrt(sqr(x)+y)-atan2(y,x)));
+	CPPUNIT_ASSERT(code.str().find("ibex_native_proj")!=std::string::npos);
+
+	// vector-valued
+	CPPUNIT_ASSERT(!Expr2Cpp().print(code,Array<const ExprSymbol>(x,y),Return(x,y)));
+
+	// vector argument
+	Variable z(2,"z");
+	CPPUNIT_ASSERT(!Expr2Cpp().print(code,Array<const ExprSymbol>(z),z[0]+z[1]));
+}
+
+void TestFunction::native02() {
+#ifndef _WIN32
+	TmpNativeCache cache("native02");
+
+	Variable x("x"),y("y");
+	Function f(x,y,x*exp(y)+sqrt(x-y));
+	Function f_native(x,y,x*exp(y)+sqrt(x-y));
+
+	// requires a C++ compiler at runtime
+	CPPUNIT_ASSERT(f_native.compile_native());
+	CPPUNIT_ASSERT(f_native.is_native());
+
+	double _box[][2] = {{1,2},{-1,0}};
+	IntervalVector box(2,_box);
+
+	CPPUNIT_ASSERT(almost_eq(f_native.eval(box),f.eval(box),ERROR));
+	CPPUNIT_ASSERT(almost_eq(f_native.gradient(box),f.gradient(box),ERROR));
+
+	// outside the definition domain
+	IntervalVector box2(2,Interval(0,1)); box2[1]=Interval(2,3);
+	CPPUNIT_ASSERT(f_native.eval(box2).is_empty());
+	CPPUNIT_ASSERT(f_native.gradient(box2).is_empty());
+
+	IntervalVector x1(box);
+	IntervalVector x2(box);
+	CPPUNIT_ASSERT(f_native.backward(Interval(0,1),x1)==f.backward(Interval(0,1),x2));
+	CPPUNIT_ASSERT(almost_eq(x1,x2,ERROR));
+
+	x1=box;
+	CPPUNIT_ASSERT(!f_native.backward(Interval(10,11),x1));
+	CPPUNIT_ASSERT(x1.is_empty());
+#endif
+}
+
+void TestFunction::native03() {
+#ifndef _WIN32
+	Variable x("x"),y("y");
+	Function f(x,y,x*y+1);
+
+	TmpNativeCache cache("native03");
+
+	// a cache directory writable by others is not used
+	chmod(cache.dir.c_str(), 0777);
+	CPPUNIT_ASSERT(!f.compile_native());
+
+	// a private directory is used
+	chmod(cache.dir.c_str(), 0700);
+	CPPUNIT_ASSERT(f.compile_native());
+#endif
+}
+
 } // end namespace
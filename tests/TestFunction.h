@@ -88,6 +88,13 @@ public:
 	CPPUNIT_TEST(minibex01);
 	CPPUNIT_TEST(minibex02);
 	CPPUNIT_TEST(minibex03);
+	CPPUNIT_TEST(context01);
+	CPPUNIT_TEST(context02);
+	CPPUNIT_TEST(context03);
+	CPPUNIT_TEST(context04);
+	CPPUNIT_TEST(native01);
+	CPPUNIT_TEST(native02);
+	CPPUNIT_TEST(native03);
 	CPPUNIT_TEST_SUITE_END();
 
 	void parser_symbol_01();
@@ -147,6 +154,18 @@ public:
 	void minibex01();
 	void minibex02();
 	void minibex03();
+
+	void context01();
+	void context02();
+	void context03();
+	// one context per thread
+	void context04();
+
+	// native code generation
+	void native01();
+	void native02();
+	// insecure cache directory
+	void native03();
 };
 
 CPPUNIT_TEST_SUITE_REGISTRATION(TestFunction);
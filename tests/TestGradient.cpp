@@ -10,6 +10,7 @@
 
 #include "TestGradient.h"
 #include "ibex_Function.h"
+#include "ibex_IntervalSparseMatrix.h"
 #include "ibex_Expr.h"
 #include "ibex_Eval.h"
 #include "Ponts30.h"
@@ -665,5 +666,108 @@ void TestGradient::jacobian_components02() {
 
 }
 
+void TestGradient::eval_gradient01() {
+	Function f("x","y","x*sqrt(y)");
+	IntervalVector box(2,Interval(1,2));
+	Interval y;
+	IntervalVector g(2);
+	f.eval_gradient(box,y,g);
+	CPPUNIT_ASSERT(y==f.eval(box));
+	CPPUNIT_ASSERT(g==f.gradient(box));
+
+	// outside definition domain
+	box[1]=Interval(-2,-1);
+	f.eval_gradient(box,y,g);
+	CPPUNIT_ASSERT(y.is_empty());
+	CPPUNIT_ASSERT(g.is_empty());
+}
+
+void TestGradient::eval_jacobian01() {
+	// vector of expressions (shared forward sweep), with a linear component
+	Function f("x","y","(x*y;x+y;sqrt(x)*exp(y))");
+	IntervalVector box(2);
+	box[0]=Interval(1,2);
+	box[1]=Interval(-1,3);
+	IntervalVector y(3);
+	IntervalMatrix J(3,2);
+	f.eval_jacobian(box,y,J);
+	CPPUNIT_ASSERT(y==f.eval_vector(box));
+	CPPUNIT_ASSERT(J==f.jacobian(box));
+
+	// outside definition domain
+	box[0]=Interval(-2,-1);
+	f.eval_jacobian(box,y,J);
+	CPPUNIT_ASSERT(y.is_empty());
+	CPPUNIT_ASSERT(J.is_empty());
+}
+
+void TestGradient::eval_jacobian02() {
+	// vector-valued expression (components are differentiated separately)
+	Function f("x[2]","sin(x(1))*x");
+	IntervalVector box(2);
+	box[0]=Interval(0,1);
+	box[1]=Interval(2,3);
+	IntervalVector y(2);
+	IntervalMatrix J(2,2);
+	f.eval_jacobian(box,y,J);
+	CPPUNIT_ASSERT(y==f.eval_vector(box));
+	CPPUNIT_ASSERT(J==f.jacobian(box));
+}
+
+void TestGradient::sparse_jacobian01() {
+	// linear and nonlinear components
+	Function f("x","y","z","(x+2*z;y*z;sin(x);3*y)");
+
+	const IntervalSparseMatrix& S=f.jacobian_structure();
+	CPPUNIT_ASSERT(S.nb_rows()==4);
+	CPPUNIT_ASSERT(S.nb_cols()==3);
+	CPPUNIT_ASSERT(S.nnz()==6);
+	CPPUNIT_ASSERT(S.find(0,1)==-1);
+	CPPUNIT_ASSERT(S.get(0,2)==Interval(2));
+	CPPUNIT_ASSERT(S.get(3,1)==Interval(3));
+
+	IntervalVector box(3);
+	box[0]=Interval(0,1);
+	box[1]=Interval(1,2);
+	box[2]=Interval(-1,3);
+
+	IntervalSparseMatrix J;
+	f.jacobian(box,J);
+	CPPUNIT_ASSERT(J.same_structure(S));
+	CPPUNIT_ASSERT(J.dense()==f.jacobian(box));
+
+	// the matrix is reused
+	box[1]=Interval(5,6);
+	f.jacobian(box,J);
+	CPPUNIT_ASSERT(J.dense()==f.jacobian(box));
+
+	Vector x(3);
+	x[0]=1; x[1]=-1; x[2]=2;
+	CPPUNIT_ASSERT(J*x==f.jacobian(box)*x);
+}
+
+void TestGradient::sparse_jacobian02() {
+	// real-valued function
+	Function f("x","y","z","x*z+1");
+	IntervalVector box(3,Interval(1,2));
+	IntervalSparseMatrix J;
+	f.jacobian(box,J);
+	CPPUNIT_ASSERT(J.nnz()==2);
+	CPPUNIT_ASSERT(J.dense()==f.jacobian(box));
+}
+
+void TestGradient::sparse_jacobian03() {
+	// vector arguments
+	Function f("x[2]","y","(x(1)*y;x(2)+y)");
+	IntervalVector box(3);
+	box[0]=Interval(0,1);
+	box[1]=Interval(2,3);
+	box[2]=Interval(-1,1);
+	IntervalSparseMatrix J;
+	f.jacobian(box,J);
+	CPPUNIT_ASSERT(J.nnz()==4);
+	CPPUNIT_ASSERT(J.dense()==f.jacobian(box));
+}
+
 } // end namespace
 
@@ -45,6 +45,12 @@ public:
 	CPPUNIT_TEST(mulVM02);
 	CPPUNIT_TEST(jacobian_components01);
 	CPPUNIT_TEST(jacobian_components02);
+	CPPUNIT_TEST(eval_gradient01);
+	CPPUNIT_TEST(eval_jacobian01);
+	CPPUNIT_TEST(eval_jacobian02);
+	CPPUNIT_TEST(sparse_jacobian01);
+	CPPUNIT_TEST(sparse_jacobian02);
+	CPPUNIT_TEST(sparse_jacobian03);
 	CPPUNIT_TEST_SUITE_END();
 
 	void deco01();
@@ -70,6 +76,14 @@ public:
 
 	void jacobian_components01();
 	void jacobian_components02();
+
+	void eval_gradient01();
+	void eval_jacobian01();
+	void eval_jacobian02();
+
+	void sparse_jacobian01();
+	void sparse_jacobian02();
+	void sparse_jacobian03();
 private:
 	void check_deco(const ExprNode& e);
 };
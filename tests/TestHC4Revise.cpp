@@ -131,5 +131,37 @@ void TestHC4Revise::dist02() {
 	check(box, boxR);
 }
 
+void TestHC4Revise::empty01() {
+	// empty domain in a sub-function
+	const ExprSymbol& x = ExprSymbol::new_("x");
+	Function g("x","(x;x)");
+	Function f(x,g(x));
+
+	IntervalVector y(2);
+	y[0]=Interval(0,1);
+	y[1]=Interval(2,3);
+
+	IntervalVector box(1,Interval(-10,10));
+	CPPUNIT_ASSERT(!f.backward(y,box));
+	CPPUNIT_ASSERT(box.is_empty());
+}
+
+void TestHC4Revise::empty02() {
+	// empty domain in the backward phase
+	Function f("x","y","sqrt(x)+y");
+
+	IntervalVector box(2);
+	box[0]=Interval(-1,4);
+	box[1]=Interval(0,1);
+	CPPUNIT_ASSERT(!f.backward(Interval(5,6),box));
+	CPPUNIT_ASSERT(box.is_empty());
+
+	// the algorithm can be run again
+	box[0]=Interval(-1,4);
+	box[1]=Interval(0,1);
+	f.backward(Interval(2,3),box);
+	CPPUNIT_ASSERT(box[0]==Interval(1,4));
+}
+
 } // end namespace
 
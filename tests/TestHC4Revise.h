@@ -33,6 +33,8 @@ public:
 		CPPUNIT_TEST(min01);
 		CPPUNIT_TEST(dist01);
 		CPPUNIT_TEST(dist02);
+		CPPUNIT_TEST(empty01);
+		CPPUNIT_TEST(empty02);
 	CPPUNIT_TEST_SUITE_END();
 	void id01();
 	void add01();
@@ -45,6 +47,9 @@ public:
 
 	void dist01();
 	void dist02();
+
+	void empty01();
+	void empty02();
 };
 
 CPPUNIT_TEST_SUITE_REGISTRATION(TestHC4Revise);
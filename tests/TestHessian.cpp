@@ -0,0 +1,126 @@
+/* ============================================================================
+ * I B E X - Hessian Tests
+ * ============================================================================
+ * Copyright   : IMT Atlantique (FRANCE)
+ * License     : This program can be distributed under the terms of the GNU LGPL.
+ *               See the file COPYING.LESSER.
+ *
+ * Author(s)   : Gilles Chabert
+ * Created     : Oct 17, 2026
+ * ---------------------------------------------------------------------------- */
+
+#include "TestHessian.h"
+#include "ibex_Function.h"
+#include "ibex_Expr.h"
+
+using namespace std;
+
+namespace ibex {
+
+void TestHessian::linear01() {
+	Function f("x","y","z","2*x-y+3*z+1");
+	IntervalMatrix H=f.hessian(IntervalVector(3,Interval(1,2)));
+	CPPUNIT_ASSERT(H==Matrix::zeros(3));
+}
+
+void TestHessian::poly01() {
+	// z only appears linearly
+	Function f("x","y","z","x^2*y+sin(y)+z");
+	double _box[][2]={{1,1},{2,2},{0,1}};
+	IntervalVector box(3,_box);
+	IntervalMatrix H=f.hessian(box);
+
+	double _H[]={4,2,0,
+	             2,0,0,
+	             0,0,0};
+	IntervalMatrix H2=Matrix(3,3,_H);
+	H2[1][1]=-sin(Interval(2));
+	CPPUNIT_ASSERT(almost_eq(H,H2,1e-10));
+	CPPUNIT_ASSERT(H[1][1].is_superset(-sin(Interval(2))));
+	CPPUNIT_ASSERT(H[0][1]==H[1][0]);
+}
+
+void TestHessian::vec01() {
+	// vector argument, indices and dot product
+	const ExprSymbol& x=ExprSymbol::new_("x",Dim::col_vec(3));
+	Function f(x, transpose(x)*x + x[0]*exp(x[2]));
+
+	Vector pt=Vector::ones(3);
+	IntervalMatrix H=f.hessian(IntervalVector(pt));
+
+	Interval e=exp(Interval::ONE);
+	IntervalMatrix H2(3,3,Interval::ZERO);
+	H2[0][0]=2; H2[1][1]=2; H2[2][2]=2+e;
+	H2[0][2]=e; H2[2][0]=e;
+	CPPUNIT_ASSERT(almost_eq(H,H2,1e-10));
+}
+
+void TestHessian::apply01() {
+	Function g("x","exp(x)");
+	const ExprSymbol& x=ExprSymbol::new_("x");
+	const ExprSymbol& y=ExprSymbol::new_("y");
+	Function f(x,y,g(x*y));
+
+	IntervalVector box(2);
+	box[0]=1;
+	box[1]=2;
+	IntervalMatrix H=f.hessian(box);
+
+	Interval e=exp(Interval(2));
+	IntervalMatrix H2(2,2);
+	H2[0][0]=4*e;
+	H2[0][1]=3*e;
+	H2[1][0]=3*e;
+	H2[1][1]=e;
+	CPPUNIT_ASSERT(almost_eq(H,H2,1e-10));
+}
+
+void TestHessian::apply02() {
+	// vector-valued function applied
+	Function g("x","y","(x*y;x+y)");
+	const ExprSymbol& x=ExprSymbol::new_("x");
+	const ExprSymbol& y=ExprSymbol::new_("y");
+	Function f(x,y,g(x,y)[0]*g(x,y)[1]);
+
+	IntervalVector box(2);
+	box[0]=Interval(1,2);
+	box[1]=Interval(3,4);
+	IntervalMatrix H=f.hessian(box);
+
+	// f=x^2*y+x*y^2
+	IntervalMatrix H2(2,2);
+	H2[0][0]=2*box[1];
+	H2[0][1]=2*box[0]+2*box[1];
+	H2[1][0]=H2[0][1];
+	H2[1][1]=2*box[0];
+	CPPUNIT_ASSERT(H.is_superset(H2));
+	CPPUNIT_ASSERT(almost_eq(H,H2,1e-10));
+}
+
+void TestHessian::empty01() {
+	Function f("x","y","sqrt(x)*y");
+	IntervalVector box(2);
+	box[0]=Interval(-2,-1);
+	box[1]=Interval(1,2);
+	CPPUNIT_ASSERT(f.hessian(box).is_empty());
+}
+
+void TestHessian::diff01() {
+	// comparison with symbolic differentiation
+	Function f("x","y","atan2(x,y)+tanh(x*y)+x/y+acos(x/10)+sqrt(y)+ln(y)*cos(x)+x^3*y^4+asinh(x)+atan(y)+cosh(x)/exp(y)+tan(x)*y");
+	Function df(f,Function::DIFF);
+
+	IntervalVector box(2);
+	box[0]=Interval(0.1,0.2);
+	box[1]=Interval(1,1.1);
+
+	IntervalMatrix H=f.hessian(box);
+	IntervalMatrix H2=df.jacobian(box);
+
+	// both are enclosures of the Hessian matrix
+	CPPUNIT_ASSERT(H.is_superset(df.jacobian(box.mid())));
+	CPPUNIT_ASSERT(!(IntervalMatrix(H) &= H2).is_empty());
+	CPPUNIT_ASSERT(H[0][1]==H[1][0]);
+}
+
+} // namespace ibex
@@ -0,0 +1,49 @@
+/* ============================================================================
+ * I B E X - Hessian Tests
+ * ============================================================================
+ * Copyright   : IMT Atlantique (FRANCE)
+ * License     : This program can be distributed under the terms of the GNU LGPL.
+ *               See the file COPYING.LESSER.
+ *
+ * Author(s)   : Gilles Chabert
+ * Created     : Oct 17, 2026
+ * ---------------------------------------------------------------------------- */
+
+#ifndef __TEST_HESSIAN_H__
+#define __TEST_HESSIAN_H__
+
+#include <cppunit/TestFixture.h>
+#include <cppunit/extensions/HelperMacros.h>
+#include "utils.h"
+
+namespace ibex {
+
+class TestHessian : public CppUnit::TestFixture {
+
+public:
+
+	CPPUNIT_TEST_SUITE(TestHessian);
+
+	CPPUNIT_TEST(linear01);
+	CPPUNIT_TEST(poly01);
+	CPPUNIT_TEST(vec01);
+	CPPUNIT_TEST(apply01);
+	CPPUNIT_TEST(apply02);
+	CPPUNIT_TEST(empty01);
+	CPPUNIT_TEST(diff01);
+	CPPUNIT_TEST_SUITE_END();
+
+	void linear01();
+	void poly01();
+	void vec01();
+	void apply01();
+	void apply02();
+	void empty01();
+	void diff01();
+};
+
+CPPUNIT_TEST_SUITE_REGISTRATION(TestHessian);
+
+} // namespace ibex
+
+#endif // __TEST_HESSIAN_H__
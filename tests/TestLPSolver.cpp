@@ -143,4 +143,47 @@ void TestLinearSolver::kleemin30() {
 
 }
 
+void TestLinearSolver::update01() {
+	LPSolver lp(2);
+	lp.set_obj(-Vector::ones(2));
+	lp.set_bounds(IntervalVector(2, Interval(0,10)));
+
+	double _a1[]={1,2};
+	double _a2[]={2,1};
+	double _a3[]={3,1};
+	double _a4[]={1,0};
+	Vector a1(2,_a1), a2(2,_a2), a3(2,_a3), a4(2,_a4);
+
+	lp.add_constraint(a1, LEQ, 4);
+	lp.add_constraint(a2, LEQ, 4);
+	CPPUNIT_ASSERT(lp.solve()==LPSolver::OPTIMAL);
+	CPPUNIT_ASSERT(almost_eq(lp.get_obj_value(), Interval(-8.0/3), 1e-9));
+
+	// modify a constraint in place
+	lp.set_constraint(1, a3, LEQ, 3);
+	CPPUNIT_ASSERT(lp.get_nb_rows()==4);
+	CPPUNIT_ASSERT(lp.solve()==LPSolver::OPTIMAL);
+	CPPUNIT_ASSERT(almost_eq(lp.get_obj_value(), Interval(-11.0/5), 1e-9));
+
+	// modify the right-hand side only
+	lp.set_constraint(1, a3, LEQ, 6);
+	CPPUNIT_ASSERT(lp.solve()==LPSolver::OPTIMAL);
+	CPPUNIT_ASSERT(almost_eq(lp.get_obj_value(), Interval(-14.0/5), 1e-9));
+
+	// less constraints than before
+	lp.clean_ctrs();
+	lp.add_constraint(a4, LEQ, 1);
+	CPPUNIT_ASSERT(lp.get_nb_rows()==3);
+	CPPUNIT_ASSERT(lp.solve()==LPSolver::OPTIMAL);
+	CPPUNIT_ASSERT(almost_eq(lp.get_obj_value(), Interval(-11), 1e-9));
+
+	// more constraints than before
+	lp.clean_ctrs();
+	lp.add_constraint(a1, LEQ, 4);
+	lp.add_constraint(a2, LEQ, 4);
+	CPPUNIT_ASSERT(lp.get_nb_rows()==4);
+	CPPUNIT_ASSERT(lp.solve()==LPSolver::OPTIMAL);
+	CPPUNIT_ASSERT(almost_eq(lp.get_obj_value(), Interval(-8.0/3), 1e-9));
+}
+
 } // end namespace
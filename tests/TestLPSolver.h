@@ -30,6 +30,7 @@ public:
 	CPPUNIT_TEST(kleemin6);
 	CPPUNIT_TEST(kleemin8);
 	CPPUNIT_TEST(kleemin30);
+	CPPUNIT_TEST(update01);
 #endif
 
 	CPPUNIT_TEST_SUITE_END();
@@ -40,6 +41,7 @@ public:
 	void kleemin6() {kleemin(6);};
 	void kleemin8() {kleemin(8);};
 	void kleemin30();
+	void update01();
 };
 
 CPPUNIT_TEST_SUITE_REGISTRATION(TestLinearSolver);
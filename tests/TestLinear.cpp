@@ -137,6 +137,29 @@ void TestLinear::gauss_seidel03() {
 }
 
 
+void TestLinear::gauss_seidel_sparse01() {
+	int n=5;
+	double eps=0.01;
+
+	// tridiagonal matrix
+	IntervalMatrix A(n,n,Interval::ZERO);
+	for (int i=0; i<n; i++) {
+		A[i][i]=Interval(4-eps,4+eps);
+		if (i>0) A[i][i-1]=Interval(1-eps,1+eps);
+		if (i<n-1) A[i][i+1]=Interval(-1-eps,-1+eps);
+	}
+	IntervalSparseMatrix S(A);
+	CPPUNIT_ASSERT(S.nnz()==3*n-2);
+
+	IntervalVector b(n,Interval(1,2));
+	IntervalVector x(n,Interval(-10,10));
+	IntervalVector y(x);
+
+	gauss_seidel(A,b,x,0.001);
+	gauss_seidel(S,b,y,0.001);
+	CPPUNIT_ASSERT(x==y);
+}
+
 void TestLinear::inflating_gauss_seidel01() {
 	int n=4;
 	Matrix A=(n+1)*Matrix::eye(n)-Matrix::ones(n); // diagonally dominant matrix
@@ -27,6 +27,7 @@ public:
 	CPPUNIT_TEST(gauss_seidel01);
 	CPPUNIT_TEST(gauss_seidel02);
 	CPPUNIT_TEST(gauss_seidel03);
+	CPPUNIT_TEST(gauss_seidel_sparse01);
 	CPPUNIT_TEST(inflating_gauss_seidel01);
 	CPPUNIT_TEST(inflating_gauss_seidel02);
 	CPPUNIT_TEST(inflating_gauss_seidel03);
@@ -47,6 +48,8 @@ public:
 	void gauss_seidel02();
 	// m>n (over-constrained)
 	void gauss_seidel03();
+
+	void gauss_seidel_sparse01();
 	// convergence, start with degenerated vector
 	void inflating_gauss_seidel01();
 	// convergence, start with thick vector
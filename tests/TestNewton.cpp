@@ -13,6 +13,9 @@
 #include "ibex_Newton.h"
 #include "ibex_CtcNewton.h"
 #include "ibex_LinearException.h"
+#include "ibex_BxpNewtonPrecond.h"
+#include "ibex_LargestFirst.h"
+#include "ibex_Cell.h"
 
 using namespace std;
 
@@ -100,6 +103,52 @@ void TestNewton::newton01() {
 	CPPUNIT_ASSERT(almost_eq(box,expected,1e-10));
 }
 
+void TestNewton::newton_precond01() {
+	Ponts30 p30;
+	IntervalVector box(30,BOX1);
+	Matrix C(30,30);
+	int nb_store=0;
+	std::function<void(const Matrix&)> store=[&C,&nb_store](const Matrix& C2) { C=C2; nb_store++; };
+
+	newton(*p30.f,box,NULL,store);
+	CPPUNIT_ASSERT(nb_store>0);
+
+	IntervalVector expected(30,BOX2);
+	CPPUNIT_ASSERT(almost_eq(box,expected,1e-10));
+
+	// reuse the preconditioner in a sub-box
+	IntervalVector box2(30,BOX1);
+	box2[0]=Interval(box2[0].lb(),box2[0].mid());
+	IntervalVector box3(box2);
+	newton(*p30.f,box2,&C,store);
+	newton(*p30.f,box3);
+	CPPUNIT_ASSERT(almost_eq(box2,box3,1e-10));
+}
+
+void TestNewton::newton_precond02() {
+	Variable x,y;
+	Function f(x,y,Return(sqr(x)+sqr(y)-1,x-y));
+	double _box[][2] = {{0.5,1},{0.5,1}};
+	IntervalVector box(2,_box);
+	Matrix C(2,2);
+	int nb_precond=0;
+	std::function<void(const Matrix&)> store=[&C,&nb_precond](const Matrix& C2) { C=C2; nb_precond++; };
+	newton(f,box,NULL,store);
+	CPPUNIT_ASSERT(nb_precond>0);
+
+	// count the recomputations of the preconditioner in
+	// sub-boxes closer and closer to the solution
+	nb_precond=0;
+	for (int k=1; k<=10; k++) {
+		double r=0.1/(1<<k);
+		IntervalVector box2(2,::sqrt(2)/2+Interval(-r,2*r));
+		newton(f,box2,&C,store);
+		CPPUNIT_ASSERT(almost_eq(box2,box,1e-10));
+	}
+	// the last (non-contracting) steps do not recompute it
+	CPPUNIT_ASSERT(nb_precond==0);
+}
+
 void TestNewton::inflating_newton01() {
 	Ponts30 p30;
 	double eps=1e-2;
@@ -157,4 +206,59 @@ void TestNewton::ctc_parameter01() {
 	CPPUNIT_ASSERT(box[0].diam()<=0.1);
 	CPPUNIT_ASSERT(box[1].diam()<=0.1);
 }
+void TestNewton::ctc_precond01() {
+	Ponts30 p30;
+	CtcNewton newton(*p30.f,POS_INFINITY);
+
+	IntervalVector box(30,BOX1);
+	BoxProperties prop(box);
+	newton.add_property(box,prop);
+	CPPUNIT_ASSERT(prop[newton.precond_id]);
+
+	ContractContext context(prop);
+	newton.contract(box,context);
+
+	IntervalVector expected(30,BOX2);
+	CPPUNIT_ASSERT(almost_eq(box,expected,1e-10));
+
+	BxpNewtonPrecond* p=(BxpNewtonPrecond*) prop[newton.precond_id];
+	CPPUNIT_ASSERT(p->valid);
+
+	// the preconditioner is inherited by copy
+	BoxProperties prop2(prop);
+	CPPUNIT_ASSERT(((BxpNewtonPrecond*) prop2[p->id])->valid);
+	CPPUNIT_ASSERT(((BxpNewtonPrecond*) prop2[p->id])->C==p->C);
+}
+
+void TestNewton::ctc_precond02() {
+	Variable x,y;
+	Function f(x,y,Return(sqr(x)+sqr(y)-1,x-y));
+	CtcNewton newton(f,POS_INFINITY);
+
+	double _box[][2] = {{0.5,1},{0.5,1}};
+	Cell root(IntervalVector(2,_box));
+	newton.add_property(root.box,root.prop);
+
+	// calculate the preconditioner of the root box
+	IntervalVector box(root.box);
+	ContractContext context(root.prop);
+	newton.contract(box,context);
+	const BxpNewtonPrecond* p=(const BxpNewtonPrecond*) ((const BoxProperties&) root.prop)[newton.precond_id];
+	CPPUNIT_ASSERT(p->valid);
+
+	LargestFirst bsc;
+	pair<Cell*,Cell*> cells=bsc.bisect(root);
+	Cell& left=*cells.first;
+	CPPUNIT_ASSERT(((const BoxProperties&) left.prop)[newton.precond_id]==p);
+
+	// the preconditioner is reused: it is only read, not duplicated
+	ContractContext context2(left.prop);
+	newton.contract(left.box,context2);
+	CPPUNIT_ASSERT(almost_eq(left.box,box,1e-10));
+	CPPUNIT_ASSERT(((const BoxProperties&) left.prop)[newton.precond_id]==p);
+
+	delete cells.first;
+	delete cells.second;
+}
+
 } // end namespace ibex
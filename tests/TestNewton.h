@@ -25,16 +25,24 @@ public:
 	CPPUNIT_TEST_SUITE(TestNewton);
 
 	CPPUNIT_TEST(newton01);
+	CPPUNIT_TEST(newton_precond01);
+	CPPUNIT_TEST(newton_precond02);
 	CPPUNIT_TEST(inflating_newton01);
 	CPPUNIT_TEST(inflating_newton02);
 	CPPUNIT_TEST(ctc_parameter01);
+	CPPUNIT_TEST(ctc_precond01);
+	CPPUNIT_TEST(ctc_precond02);
 
 	CPPUNIT_TEST_SUITE_END();
 
 	void newton01();
+	void newton_precond01();
+	void newton_precond02();
 	void inflating_newton01();
 	void inflating_newton02();
 	void ctc_parameter01();
+	void ctc_precond01();
+	void ctc_precond02();
 };
 
 CPPUNIT_TEST_SUITE_REGISTRATION(TestNewton);
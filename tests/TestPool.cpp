@@ -0,0 +1,118 @@
+/* ============================================================================
+ * I B E X - TestPool
+ * ============================================================================
+ * Copyright   : IMT Atlantique (FRANCE)
+ * License     : This program can be distributed under the terms of the GNU LGPL.
+ *               See the file COPYING.LESSER.
+ *
+ * Author(s)   : Gilles Chabert
+ * Created     : Oct 17, 2026
+ * ---------------------------------------------------------------------------- */
+
+#include "TestPool.h"
+#include "ibex_Pool.h"
+#include "ibex_Cell.h"
+#include "ibex_ThreadPool.h"
+
+#include <vector>
+#include <cstring>
+
+using namespace std;
+
+void TestPool::reuse01() {
+	void* p=Pool::alloc(40);
+	Pool::free(p,40);
+	void* q=Pool::alloc(48); // same size class
+	CPPUNIT_ASSERT(p==q);
+	void* r=Pool::alloc(40);
+	CPPUNIT_ASSERT(r!=q);
+	Pool::free(q,48);
+	Pool::free(r,40);
+}
+
+void TestPool::large01() {
+	size_t size=Pool::MAX_SIZE+1;
+	char* p=(char*) Pool::alloc(size);
+	memset(p, 1, size);
+	Pool::free(p,size);
+}
+
+void TestPool::threads01() {
+	const int N=4;
+	const int nb_blocks=10000;
+	vector<int*> blocks[N];
+
+	// each thread fills its blocks with its number
+	ThreadPool pool(N);
+	pool.run(N, [&blocks,nb_blocks](int t, int) {
+		for (int i=0; i<nb_blocks; i++) {
+			int* b=(int*) Pool::alloc(8*sizeof(int));
+			for (int j=0; j<8; j++) b[j]=t;
+			blocks[t].push_back(b);
+		}
+	});
+
+	bool ok=true;
+	for (int t=0; t<N; t++)
+		for (int i=0; i<nb_blocks; i++)
+			for (int j=0; j<8; j++)
+				if (blocks[t][i][j]!=t) ok=false;
+	CPPUNIT_ASSERT(ok);
+
+	// each thread frees the blocks of another thread
+	pool.run(N, [&blocks](int t, int) {
+		for (size_t i=0; i<blocks[(t+1)%N].size(); i++)
+			Pool::free(blocks[(t+1)%N][i], 8*sizeof(int));
+	});
+}
+
+void TestPool::cell01() {
+	double _box[][2] = {{0,1},{2,4}};
+	IntervalVector box(2,_box);
+	Cell* c=new Cell(box);
+
+	pair<Cell*,Cell*> p=c->bisect(BisectionPoint(1,0.5,true));
+	CPPUNIT_ASSERT(p.first->box[0]==Interval(0,1));
+	CPPUNIT_ASSERT(p.first->box[1]==Interval(2,3));
+	CPPUNIT_ASSERT(p.second->box[1]==Interval(3,4));
+	CPPUNIT_ASSERT(p.first->depth==1);
+	CPPUNIT_ASSERT(p.second->bisected_var==1);
+
+	pair<Cell*,Cell*> p2=p.second->bisect(BisectionPoint(0,0.25,false));
+	CPPUNIT_ASSERT(p2.first->box[0]==Interval(0,0.25));
+	CPPUNIT_ASSERT(p2.second->box[0]==Interval(0.25,1));
+	CPPUNIT_ASSERT(p2.second->box[1]==Interval(3,4));
+
+	delete c;
+	delete p.first;
+	delete p.second;
+	delete p2.first;
+	delete p2.second;
+}
+
+void TestPool::cell02() {
+	IntervalVector box(100,Interval(0,1));
+	Cell* c=new Cell(box);
+	const Interval* elements=&c->box[0];
+	delete c;
+
+	// the elements of the box are reused
+	c=new Cell(box);
+	CPPUNIT_ASSERT(&c->box[0]==elements);
+	CPPUNIT_ASSERT(c->box==box);
+
+	Cell* c2=new Cell(*c);
+	CPPUNIT_ASSERT(&c2->box[0]!=&c->box[0]);
+	CPPUNIT_ASSERT(c2->box==box);
+
+	pair<Cell*,Cell*> p=c2->bisect(BisectionPoint(99,0.5,true));
+	CPPUNIT_ASSERT(p.first->box.size()==100);
+	CPPUNIT_ASSERT(p.first->box[99]==Interval(0,0.5));
+	CPPUNIT_ASSERT(p.second->box[99]==Interval(0.5,1));
+	CPPUNIT_ASSERT(p.second->box.subvector(0,98)==box.subvector(0,98));
+
+	delete c;
+	delete c2;
+	delete p.first;
+	delete p.second;
+}
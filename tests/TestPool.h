@@ -0,0 +1,47 @@
+/* ============================================================================
+ * I B E X - TestPool
+ * ============================================================================
+ * Copyright   : IMT Atlantique (FRANCE)
+ * License     : This program can be distributed under the terms of the GNU LGPL.
+ *               See the file COPYING.LESSER.
+ *
+ * Author(s)   : Gilles Chabert
+ * Created     : Oct 17, 2026
+ * ---------------------------------------------------------------------------- */
+
+#ifndef __TEST_POOL_H__
+#define __TEST_POOL_H__
+
+#include <cppunit/TestFixture.h>
+#include <cppunit/extensions/HelperMacros.h>
+#include "utils.h"
+
+using namespace ibex;
+
+class TestPool : public CppUnit::TestFixture {
+public:
+
+	CPPUNIT_TEST_SUITE(TestPool);
+	CPPUNIT_TEST(reuse01);
+	CPPUNIT_TEST(large01);
+	CPPUNIT_TEST(threads01);
+	CPPUNIT_TEST(cell01);
+	CPPUNIT_TEST(cell02);
+	CPPUNIT_TEST_SUITE_END();
+private:
+
+	// a freed block is reused
+	void reuse01();
+	// blocks larger than the maximal size
+	void large01();
+	// blocks allocated and freed by different threads
+	void threads01();
+	// bisection of cells
+	void cell01();
+	// boxes of cells allocated in the pool
+	void cell02();
+};
+
+CPPUNIT_TEST_SUITE_REGISTRATION(TestPool);
+
+#endif // __TEST_POOL_H__
@@ -94,6 +94,43 @@ void TestSeparator::test_SepUnionInter() {
   }
 }
 
+void TestSeparator::test_SepUnion_threads() {
+  int n=20;
+  Array<Function> f(n);
+  Array<Sep> S(n);
+  for (int i=0; i<n; i++) {
+    Variable x,y;
+    f.set_ref(i, *new Function(x,y,sqr(x-i)+sqr(y)));
+    S.set_ref(i, *new SepFwdBwd(f[i],Interval(1,4)));
+  }
+
+  SepUnion SU(S);
+  SU.set_nb_threads(4);
+
+  double _box[][2] = { {-10,30}, {0.5,10} };
+  IntervalVector box(2,_box);
+
+  // expected: intersection of inner boxes and hull of outer boxes
+  IntervalVector in(box), out(IntervalVector::empty(2));
+  for (int i=0; i<n; i++) {
+    IntervalVector box_in(box), box_out(box);
+    S[i].separate(box_in, box_out);
+    in &= box_in;
+    out |= box_out;
+  }
+
+  IntervalVector box_in(box), box_out(box);
+  SU.separate(box_in, box_out);
+  CPPUNIT_ASSERT(box_in==in);
+  CPPUNIT_ASSERT(box_out==out);
+  CPPUNIT_ASSERT(box_out[1].ub()<=2+1e-10);
+
+  for (int i=0; i<n; i++) {
+    delete &S[i];
+    delete &f[i];
+  }
+}
+
 void TestSeparator::test_SepQInter(){
   // SepQinter is based on qinter function which has its own tests
   // Only the behaviour of the class need to be tested
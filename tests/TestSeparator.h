@@ -36,6 +36,7 @@ public:
 	CPPUNIT_TEST(SepFwdBwd_GT_GEQ);
 	CPPUNIT_TEST(test_SepCtcPair);
 	CPPUNIT_TEST(test_SepUnionInter);
+	CPPUNIT_TEST(test_SepUnion_threads);
 	CPPUNIT_TEST(test_SepNot);
 	CPPUNIT_TEST(test_SepQInter);
 	CPPUNIT_TEST(test_SepInverse);
@@ -45,6 +46,7 @@ public:
 	void SepFwdBwd_GT_GEQ();
 	void test_SepCtcPair();
 	void test_SepUnionInter();
+	void test_SepUnion_threads();
 	void test_SepNot();
 	void test_SepQInter();
 	void test_SepInverse();
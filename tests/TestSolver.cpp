@@ -15,6 +15,16 @@
 #include "ibex_RoundRobin.h"
 #include "ibex_CellStack.h"
 #include "ibex_CtcHC4.h"
+#include "ibex_DefaultSolver.h"
+#include "ibex_Random.h"
+
+#include <sstream>
+#include <chrono>
+
+#ifndef _WIN32
+#include <unistd.h>
+#include <sys/wait.h>
+#endif
 
 using namespace std;
 
@@ -196,4 +206,253 @@ void TestSolver::circle4() {
 }
 
 
+void TestSolver::threads01() {
+	const ExprSymbol& x=ExprSymbol::new_("x");
+	const ExprSymbol& y=ExprSymbol::new_("y");
+
+	SystemFactory f;
+	f.add_var(x);
+	f.add_var(y);
+	f.add_ctr(sqr(x)+sqr(y)=1);
+	f.add_ctr(sqr(x-1)+sqr(y)=1);
+	double cospi6=0.5;
+	double sinpi6=::sqrt(3)/2;
+	double _sol1[]={cospi6,sinpi6};
+	double _sol2[]={cospi6,-sinpi6};
+
+	Vector sol1(2,_sol1);
+	Vector sol2(2,_sol2);
+	System sys(f);
+	RoundRobin rr(1e-3);
+	CellStack stack;
+	CtcHC4 hc4(sys);
+	Vector prec(2,1e-3);
+
+	// the solver of the second thread
+	System sys2(sys,System::COPY);
+	RoundRobin rr2(1e-3);
+	CellStack stack2;
+	CtcHC4 hc4_2(sys2);
+	Solver solver2(sys2,hc4_2,rr2,stack2,prec,prec);
+
+	Solver solver(sys,hc4,rr,stack,prec,prec);
+	Array<Solver> solvers(1);
+	solvers.set_ref(0,solver2);
+	solver.set_thread_solvers(solvers);
+
+	Solver::Status status=solver.solve(IntervalVector(2,Interval(-10,10)));
+
+	CPPUNIT_ASSERT(status==Solver::SUCCESS);
+	CPPUNIT_ASSERT(solver.get_data().nb_solution()==2);
+	const IntervalVector& s1=solver.get_data().solution(0);
+	const IntervalVector& s2=solver.get_data().solution(1);
+	CPPUNIT_ASSERT((s1.is_superset(sol1) && s2.is_superset(sol2)) || (s1.is_superset(sol2) && s2.is_superset(sol1)));
+}
+
+void TestSolver::threads02() {
+	const ExprSymbol& x=ExprSymbol::new_("x");
+	const ExprSymbol& y=ExprSymbol::new_("y");
+
+	SystemFactory f;
+	f.add_var(x);
+	f.add_var(y);
+	f.add_ctr(sqr(x)+sqr(y)<=1);
+	f.add_ctr(sqr(x-1)+sqr(y)<=1);
+
+	System sys(f);
+	IntervalVector box(2,Interval(-10,10));
+
+	DefaultSolver solver1(sys,1e-2);
+	solver1.solve(box);
+
+	DefaultSolver solver2(sys,1e-2);
+	solver2.set_nb_threads(3);
+	solver2.solve(box);
+
+	const CovSolverData& data1=solver1.get_data();
+	const CovSolverData& data2=solver2.get_data();
+
+	// note: the paving depends on the random corners of the linearization
+	CPPUNIT_ASSERT(data2.nb_pending()==0);
+	CPPUNIT_ASSERT(data2.solver_status()==data1.solver_status());
+	CPPUNIT_ASSERT(data2.nb_inner()>0);
+
+	// all the boxes are inside the initial box and
+	// the inner boxes satisfy the constraints
+	for (size_t i=0; i<data2.size(); i++)
+		CPPUNIT_ASSERT(data2[i].is_subset(box));
+
+	for (size_t i=0; i<data2.nb_inner(); i++) {
+		const IntervalVector& b=data2.inner(i);
+		CPPUNIT_ASSERT((sqr(b[0])+sqr(b[1])).ub()<=1);
+		CPPUNIT_ASSERT((sqr(b[0]-1)+sqr(b[1])).ub()<=1);
+	}
+
+	// back to sequential mode
+	solver2.set_nb_threads(1);
+	solver2.solve(box);
+	CPPUNIT_ASSERT(solver2.get_data().solver_status()==data1.solver_status());
+}
+
+void TestSolver::threads03() {
+	const ExprSymbol& x=ExprSymbol::new_("x");
+	const ExprSymbol& y=ExprSymbol::new_("y");
+
+	SystemFactory f;
+	f.add_var(x);
+	f.add_var(y);
+	f.add_ctr(sqr(x)+sqr(y)<=1);
+
+	System sys(f);
+
+	DefaultSolver solver(sys,1e-3);
+	solver.set_nb_threads(2);
+	solver.cell_limit=100;
+
+	Solver::Status status=solver.solve(IntervalVector(2,Interval(-10,10)));
+
+	CPPUNIT_ASSERT(status==Solver::CELL_OVERFLOW);
+	CPPUNIT_ASSERT(solver.get_data().nb_pending()>0);
+	CPPUNIT_ASSERT(solver.get_data().solver_status()==Solver::CELL_OVERFLOW);
+}
+
+void TestSolver::threads04() {
+	const ExprSymbol& x=ExprSymbol::new_("x");
+	const ExprSymbol& y=ExprSymbol::new_("y");
+
+	SystemFactory f;
+	f.add_var(x);
+	f.add_var(y);
+	f.add_ctr(sqr(x)+sqr(y)<=1);
+
+	System sys(f);
+
+	DefaultSolver solver(sys,1e-9);
+	solver.set_nb_threads(4);
+	solver.time_limit=0.5;
+
+	chrono::steady_clock::time_point start=chrono::steady_clock::now();
+	Solver::Status status=solver.solve(IntervalVector(2,Interval(-10,10)));
+	double elapsed=chrono::duration<double>(chrono::steady_clock::now()-start).count();
+
+	CPPUNIT_ASSERT(status==Solver::TIME_OUT);
+	CPPUNIT_ASSERT(solver.get_data().nb_pending()>0);
+	// the limit is a wall-clock time (not the CPU time of all the threads)
+	CPPUNIT_ASSERT(elapsed>=0.45);
+	CPPUNIT_ASSERT(elapsed<10);
+}
+
+namespace {
+
+/* HC4 that records the first random number drawn in its thread. */
+class CtcRandHC4 : public CtcHC4 {
+public:
+	CtcRandHC4(const System& sys) : CtcHC4(sys), first(0), drawn(false) { }
+
+	virtual void contract(IntervalVector& box, ContractContext& context) {
+		if (!drawn) {
+			first=RNG::rand();
+			drawn=true;
+		}
+		CtcHC4::contract(box, context);
+	}
+
+	uint32_t first;
+	bool drawn;
+};
+
+/* First random number drawn after RNG::srand(seed). */
+uint32_t first_rand(int seed) {
+	RNG::srand(seed);
+	return RNG::rand();
+}
+
+} // end anonymous namespace
+
+void TestSolver::threads05() {
+	const ExprSymbol& x=ExprSymbol::new_("x");
+	const ExprSymbol& y=ExprSymbol::new_("y");
+
+	SystemFactory f;
+	f.add_var(x);
+	f.add_var(y);
+	f.add_ctr(sqr(x)+sqr(y)<=1);
+
+	System sys(f);
+	RoundRobin rr(1e-2);
+	CellStack stack;
+	CtcRandHC4 hc4(sys);
+	Vector prec(2,1e-2);
+
+	System sys2(sys,System::COPY);
+	RoundRobin rr2(1e-2);
+	CellStack stack2;
+	CtcRandHC4 hc4_2(sys2);
+	Solver solver2(sys2,hc4_2,rr2,stack2,prec,prec);
+
+	Solver solver(sys,hc4,rr,stack,prec,prec);
+	Array<Solver> solvers(1);
+	solvers.set_ref(0,solver2);
+	solver.set_thread_solvers(solvers);
+	solver.parallel_seed=10;
+
+	solver.solve(IntervalVector(2,Interval(-10,10)));
+
+	// each task is seeded in its own thread
+	uint32_t r0=first_rand(10);
+	uint32_t r1=first_rand(11);
+	CPPUNIT_ASSERT(hc4.drawn && (hc4.first==r0 || hc4.first==r1));
+	CPPUNIT_ASSERT(!hc4_2.drawn || hc4_2.first==r0 || hc4_2.first==r1);
+}
+
+#ifndef _WIN32
+void TestSolver::distributed01() {
+	const ExprSymbol& x=ExprSymbol::new_("x");
+	const ExprSymbol& y=ExprSymbol::new_("y");
+
+	SystemFactory f;
+	f.add_var(x);
+	f.add_var(y);
+	f.add_ctr(sqr(x)+sqr(y)=1);
+	f.add_ctr(sqr(x-1)+sqr(y)=1);
+	double cospi6=0.5;
+	double sinpi6=::sqrt(3)/2;
+	double _sol1[]={cospi6,sinpi6};
+	double _sol2[]={cospi6,-sinpi6};
+
+	Vector sol1(2,_sol1);
+	Vector sol2(2,_sol2);
+	System sys(f);
+
+	stringstream address;
+	address << "unix:/tmp/ibex-test-solver-" << getpid() << ".sock";
+	ChannelServer server(address.str());
+
+	vector<pid_t> workers;
+	for (int i=0; i<2; i++) {
+		pid_t pid=fork();
+		if (pid==0) {
+			DefaultSolver solver(sys,1e-3);
+			Channel channel(address.str());
+			solver.work(channel, 0.01);
+			_exit(0);
+		}
+		workers.push_back(pid);
+	}
+
+	DefaultSolver solver(sys,1e-3);
+	Solver::Status status=solver.coordinate(server, 2, IntervalVector(2,Interval(-10,10)));
+
+	for (vector<pid_t>::iterator it=workers.begin(); it!=workers.end(); ++it)
+		waitpid(*it, NULL, 0);
+
+	CPPUNIT_ASSERT(status==Solver::SUCCESS);
+	CPPUNIT_ASSERT(solver.get_data().nb_solution()==2);
+	CPPUNIT_ASSERT(solver.get_data().nb_pending()==0);
+	const IntervalVector& s1=solver.get_data().solution(0);
+	const IntervalVector& s2=solver.get_data().solution(1);
+	CPPUNIT_ASSERT((s1.is_superset(sol1) && s2.is_superset(sol2)) || (s1.is_superset(sol2) && s2.is_superset(sol1)));
+}
+#endif
+
 } // end namespace
@@ -28,12 +28,29 @@ public:
 	CPPUNIT_TEST(circle2);
 	CPPUNIT_TEST(circle3);
 	CPPUNIT_TEST(circle4);
+	CPPUNIT_TEST(threads01);
+	CPPUNIT_TEST(threads02);
+	CPPUNIT_TEST(threads03);
+	CPPUNIT_TEST(threads04);
+	CPPUNIT_TEST(threads05);
+#ifndef _WIN32
+	CPPUNIT_TEST(distributed01);
+#endif
 	CPPUNIT_TEST_SUITE_END();
 
 	void circle1();
 	void circle2();
 	void circle3();
 	void circle4();
+	void threads01();
+	void threads02();
+	void threads03();
+	// time limit with several threads
+	void threads04();
+	// random seed of the threads
+	void threads05();
+	// circle intersection with two worker processes
+	void distributed01();
 };
 
 CPPUNIT_TEST_SUITE_REGISTRATION(TestSolver);
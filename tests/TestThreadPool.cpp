@@ -0,0 +1,74 @@
+/* ============================================================================
+ * I B E X - TestThreadPool
+ * ============================================================================
+ * Copyright   : IMT Atlantique (FRANCE)
+ * License     : This program can be distributed under the terms of the GNU LGPL.
+ *               See the file COPYING.LESSER.
+ *
+ * Author(s)   : Gilles Chabert
+ * Created     : Oct 17, 2026
+ * ---------------------------------------------------------------------------- */
+
+#include "TestThreadPool.h"
+#include "ibex_ThreadPool.h"
+#include "ibex_Exception.h"
+
+using namespace std;
+
+// all the tasks are executed once
+void TestThreadPool::run01() {
+	ThreadPool pool(4);
+	CPPUNIT_ASSERT(pool.size()==4);
+
+	vector<int> done(1000,0);
+	vector<int> thread(1000,-1);
+	pool.run(1000, [&](int i, int t) { done[i]++; thread[i]=t; });
+
+	for (int i=0; i<1000; i++) {
+		CPPUNIT_ASSERT(done[i]==1);
+		CPPUNIT_ASSERT(thread[i]>=0 && thread[i]<4);
+	}
+}
+
+// several runs with the same pool, and a pool without thread
+void TestThreadPool::run02() {
+	ThreadPool pool(3);
+	ThreadPool seq(1);
+	CPPUNIT_ASSERT(seq.size()==1);
+
+	for (int k=0; k<50; k++) {
+		vector<double> x(k,0);
+		pool.run(k, [&](int i, int) { x[i]=i; });
+		seq.run(k, [&](int i, int t) { CPPUNIT_ASSERT(t==0); x[i]+=i; });
+		for (int i=0; i<k; i++)
+			CPPUNIT_ASSERT(x[i]==2*i);
+	}
+}
+
+// the interval arithmetic is correct in all the threads
+void TestThreadPool::rounding01() {
+	ThreadPool pool(4);
+
+	vector<Interval> x(100);
+	pool.run(100, [&](int i, int) { x[i]=Interval(1)/Interval(3+i); });
+
+	for (int i=0; i<100; i++)
+		CPPUNIT_ASSERT(x[i]==Interval(1)/Interval(3+i));
+}
+
+void TestThreadPool::exception01() {
+	ThreadPool pool(4);
+
+	bool thrown=false;
+	try {
+		pool.run(100, [&](int i, int) { if (i==10) throw Exception(); });
+	} catch(Exception&) {
+		thrown=true;
+	}
+	CPPUNIT_ASSERT(thrown);
+
+	// the pool is still usable
+	int sum=0;
+	pool.run(1, [&](int, int) { sum++; });
+	CPPUNIT_ASSERT(sum==1);
+}
@@ -0,0 +1,40 @@
+/* ============================================================================
+ * I B E X - TestThreadPool
+ * ============================================================================
+ * Copyright   : IMT Atlantique (FRANCE)
+ * License     : This program can be distributed under the terms of the GNU LGPL.
+ *               See the file COPYING.LESSER.
+ *
+ * Author(s)   : Gilles Chabert
+ * Created     : Oct 17, 2026
+ * ---------------------------------------------------------------------------- */
+
+#ifndef __TEST_THREAD_POOL_H__
+#define __TEST_THREAD_POOL_H__
+
+#include <cppunit/TestFixture.h>
+#include <cppunit/extensions/HelperMacros.h>
+#include "utils.h"
+
+using namespace ibex;
+
+class TestThreadPool : public CppUnit::TestFixture {
+public:
+
+	CPPUNIT_TEST_SUITE(TestThreadPool);
+	CPPUNIT_TEST(run01);
+	CPPUNIT_TEST(run02);
+	CPPUNIT_TEST(rounding01);
+	CPPUNIT_TEST(exception01);
+	CPPUNIT_TEST_SUITE_END();
+private:
+
+	void run01();
+	void run02();
+	void rounding01();
+	void exception01();
+};
+
+CPPUNIT_TEST_SUITE_REGISTRATION(TestThreadPool);
+
+#endif // __TEST_THREAD_POOL_H__